@@ -159,6 +159,10 @@ struct SortParameters {
     bool low_card = false;
     bool nullable = false;
     int max_buffered_chunks = ChunksSorterTopn::kDefaultBufferedChunks;
+    // The type of the odd columns, the same as the even ones if TYPE_UNKNOWN
+    LogicalType odd_column_type = TYPE_UNKNOWN;
+    // config::full_sort_radix_sort_max_key_width of the full sort, the config is kept if negative
+    int radix_sort_max_key_width = -1;
 
     SortParameters() = default;
 
@@ -193,15 +197,19 @@ static void do_bench(benchmark::State& state, SortAlgorithm sorter_algo, Logical
     ChunkSorterBase suite;
     suite.SetUp();
 
-    TypeDescriptor type_desc;
-    if (data_type == TYPE_INT) {
-        type_desc = TypeDescriptor(TYPE_INT);
-    } else if (data_type == TYPE_VARCHAR) {
-        type_desc = TypeDescriptor::create_varchar_type(TypeDescriptor::MAX_VARCHAR_LENGTH);
-    } else if (data_type == TYPE_DOUBLE) {
-        type_desc = TypeDescriptor(TYPE_DOUBLE);
-    } else {
-        ASSERT_TRUE(false) << "not support type: " << data_type;
+    auto create_type_desc = [](LogicalType data_type) {
+        if (data_type == TYPE_VARCHAR) {
+            return TypeDescriptor::create_varchar_type(TypeDescriptor::MAX_VARCHAR_LENGTH);
+        }
+        CHECK(data_type == TYPE_INT || data_type == TYPE_DOUBLE) << "not support type: " << data_type;
+        return TypeDescriptor(data_type);
+    };
+    TypeDescriptor type_desc = create_type_desc(data_type);
+    TypeDescriptor odd_type_desc =
+            params.odd_column_type == TYPE_UNKNOWN ? type_desc : create_type_desc(params.odd_column_type);
+    const int radix_sort_max_key_width = config::full_sort_radix_sort_max_key_width;
+    if (params.radix_sort_max_key_width >= 0) {
+        config::full_sort_radix_sort_max_key_width = params.radix_sort_max_key_width;
     }
 
     Columns columns;
@@ -212,7 +220,8 @@ static void do_bench(benchmark::State& state, SortAlgorithm sorter_algo, Logical
     Chunk::SlotHashMap map;
 
     for (int i = 0; i < num_columns; i++) {
-        auto [column, expr] = suite.build_column(type_desc, i, params.low_card, params.nullable);
+        auto [column, expr] = suite.build_column(i % 2 == 0 ? type_desc : odd_type_desc, i, params.low_card,
+                                                 params.nullable);
         columns.push_back(column);
         exprs.emplace_back(std::move(expr));
         auto sort_expr = new ExprContext(exprs.back().get());
@@ -306,6 +315,7 @@ static void do_bench(benchmark::State& state, SortAlgorithm sorter_algo, Logical
     state.counters["mem_usage"] = mem_usage;
     state.SetItemsProcessed(item_processed);
 
+    config::full_sort_radix_sort_max_key_width = radix_sort_max_key_width;
     suite.TearDown();
 }
 
@@ -472,6 +482,35 @@ static void BM_fullsort_low_card_nullable(benchmark::State& state) {
     do_bench(state, FullSort, TYPE_INT, state.range(0), state.range(1), params);
 }
 
+// Radix sort of the normalized keys against sorting column by column, on different mixes of the keys
+static void do_bench_radix_sort(benchmark::State& state, LogicalType data_type, SortParameters params) {
+    params.radix_sort_max_key_width = state.range(2) ? 32 : 0;
+    do_bench(state, FullSort, data_type, state.range(0), state.range(1), params);
+}
+static void BM_fullsort_radix_int(benchmark::State& state) {
+    do_bench_radix_sort(state, TYPE_INT, SortParameters());
+}
+static void BM_fullsort_radix_int_nullable(benchmark::State& state) {
+    do_bench_radix_sort(state, TYPE_INT, SortParameters::with_nullable(true));
+}
+static void BM_fullsort_radix_int_low_card(benchmark::State& state) {
+    do_bench_radix_sort(state, TYPE_INT, SortParameters::with_low_card(true));
+}
+static void BM_fullsort_radix_varchar(benchmark::State& state) {
+    do_bench_radix_sort(state, TYPE_VARCHAR, SortParameters());
+}
+static void BM_fullsort_radix_int_varchar(benchmark::State& state) {
+    SortParameters params;
+    params.odd_column_type = TYPE_VARCHAR;
+    do_bench_radix_sort(state, TYPE_INT, params);
+}
+// The double keys are not normalized, and compared on the ties of the int keys
+static void BM_fullsort_radix_int_double(benchmark::State& state) {
+    SortParameters params;
+    params.odd_column_type = TYPE_DOUBLE;
+    do_bench_radix_sort(state, TYPE_INT, params);
+}
+
 // Sort partial data: ORDER BY xxx LIMIT
 static void BM_topn_limit_heapsort(benchmark::State& state) {
     do_bench(state, HeapSort, TYPE_INT, state.range(0), state.range(1), SortParameters::with_limit(state.range(2)));
@@ -517,6 +556,18 @@ static void CustomArgsFull(benchmark::internal::Benchmark* b) {
         }
     }
 }
+static void CustomArgsRadix(benchmark::internal::Benchmark* b) {
+    // num_chunks
+    for (int num_chunks = 64; num_chunks <= 4096; num_chunks *= 8) {
+        // num_columns
+        for (int num_columns = 1; num_columns <= 4; num_columns++) {
+            // column by column, radix sort
+            for (int radix_sort = 0; radix_sort <= 1; radix_sort++) {
+                b->Args({num_chunks, num_columns, radix_sort});
+            }
+        }
+    }
+}
 static void CustomArgsLimit(benchmark::internal::Benchmark* b) {
     // num_chunks
     for (int num_chunks = 1024; num_chunks <= 32768; num_chunks *= 4) {
@@ -536,6 +587,14 @@ BENCHMARK(BM_fullsort_nullable)->Apply(CustomArgsFull);
 BENCHMARK(BM_fullsort_float_notnull)->Apply(CustomArgsFull);
 BENCHMARK(BM_fullsort_varchar_column_incr)->Apply(CustomArgsFull);
 
+// Radix sort against column by column
+BENCHMARK(BM_fullsort_radix_int)->Apply(CustomArgsRadix);
+BENCHMARK(BM_fullsort_radix_int_nullable)->Apply(CustomArgsRadix);
+BENCHMARK(BM_fullsort_radix_int_low_card)->Apply(CustomArgsRadix);
+BENCHMARK(BM_fullsort_radix_varchar)->Apply(CustomArgsRadix);
+BENCHMARK(BM_fullsort_radix_int_varchar)->Apply(CustomArgsRadix);
+BENCHMARK(BM_fullsort_radix_int_double)->Apply(CustomArgsRadix);
+
 // Low-Cardinality Sort
 BENCHMARK(BM_fullsort_low_card_colinc)->Apply(CustomArgsFull);
 BENCHMARK(BM_fullsort_low_card_nullable)->Apply(CustomArgsFull);
@@ -0,0 +1,115 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "column/fixed_length_column.h"
+#include "storage/rowset/alp_page.h"
+#include "storage/rowset/bitshuffle_page.h"
+#include "storage/rowset/bitshuffle_wrapper.h"
+
+namespace starrocks {
+
+// The number of doubles in a page of the default data_page_size.
+static const int kPageValues = 8192;
+
+enum FloatDataset { PRICE = 0, SENSOR = 1, RATIO = 2 };
+
+static std::vector<double> gen_values(int dataset) {
+    std::mt19937_64 rng(0);
+    std::vector<double> values;
+    values.reserve(kPageValues);
+    double reading = 20;
+    for (int i = 0; i < kPageValues; i++) {
+        switch (dataset) {
+        case PRICE:
+            values.push_back(static_cast<double>(rng() % 100000) / 100);
+            break;
+        case SENSOR:
+            reading += (static_cast<int>(rng() % 21) - 10) / 1000.0;
+            values.push_back(std::round(reading * 1000) / 1000);
+            break;
+        default:
+            values.push_back(static_cast<double>(rng()) / static_cast<double>(rng()));
+            break;
+        }
+    }
+    return values;
+}
+
+static void BM_AlpDecode(benchmark::State& state) {
+    std::vector<double> values = gen_values(state.range(0));
+    PageBuilderOptions options;
+    AlpPageBuilder<TYPE_DOUBLE> builder(options);
+    builder.add(reinterpret_cast<const uint8_t*>(values.data()), values.size());
+    OwnedSlice page = builder.finish()->build();
+
+    DoubleColumn column;
+    column.reserve(kPageValues);
+    for (auto _ : state) {
+        column.resize(0);
+        AlpPageDecoder<TYPE_DOUBLE> decoder(page.slice());
+        CHECK(decoder.init().ok());
+        size_t n = kPageValues;
+        CHECK(decoder.next_batch(&n, &column).ok());
+        benchmark::DoNotOptimize(column.get_data().data());
+    }
+    state.SetItemsProcessed(state.iterations() * kPageValues);
+    state.counters["bytes_per_value"] = static_cast<double>(page.slice().size) / kPageValues;
+}
+
+// Decompress the page like StoragePageDecoder does when the page is loaded, then read it.
+static void BM_BitShuffleLz4Decode(benchmark::State& state) {
+    std::vector<double> values = gen_values(state.range(0));
+    PageBuilderOptions options;
+    options.data_page_size = kPageValues * sizeof(double);
+    BitshufflePageBuilder<TYPE_DOUBLE> builder(options);
+    builder.add(reinterpret_cast<const uint8_t*>(values.data()), values.size());
+    OwnedSlice page = builder.finish()->build();
+
+    const auto* data = reinterpret_cast<const uint8_t*>(page.slice().data);
+    size_t num_elements_after_padding = decode_fixed32_le(data + 8);
+    size_t data_size = num_elements_after_padding * sizeof(double);
+    std::unique_ptr<char[]> decompressed(new char[BITSHUFFLE_PAGE_HEADER_SIZE + data_size]);
+
+    DoubleColumn column;
+    column.reserve(kPageValues);
+    for (auto _ : state) {
+        column.resize(0);
+        memcpy(decompressed.get(), data, BITSHUFFLE_PAGE_HEADER_SIZE);
+        int64_t bytes = bitshuffle::decompress_lz4(data + BITSHUFFLE_PAGE_HEADER_SIZE,
+                                                   decompressed.get() + BITSHUFFLE_PAGE_HEADER_SIZE,
+                                                   num_elements_after_padding, sizeof(double), 0);
+        CHECK_GT(bytes, 0);
+        BitShufflePageDecoder<TYPE_DOUBLE> decoder(Slice(decompressed.get(), BITSHUFFLE_PAGE_HEADER_SIZE + data_size));
+        CHECK(decoder.init().ok());
+        size_t n = kPageValues;
+        CHECK(decoder.next_batch(&n, &column).ok());
+        benchmark::DoNotOptimize(column.get_data().data());
+    }
+    state.SetItemsProcessed(state.iterations() * kPageValues);
+    state.counters["bytes_per_value"] = static_cast<double>(page.slice().size) / kPageValues;
+}
+
+BENCHMARK(BM_AlpDecode)->DenseRange(PRICE, RATIO);
+BENCHMARK(BM_BitShuffleLz4Decode)->DenseRange(PRICE, RATIO);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
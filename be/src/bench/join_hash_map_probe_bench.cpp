@@ -0,0 +1,128 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <glog/logging.h>
+
+#include <memory>
+#include <random>
+
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "exec/join_hash_map.h"
+
+namespace starrocks {
+
+// Probes a bigint join hash table with uniformly random keys, which is the DRAM-latency bound case of a large
+// fact-dimension join. Args: build rows, probe prefetch group size (0 means no prefetching).
+
+static constexpr size_t kProbeChunkSize = 4096;
+static constexpr size_t kProbeChunks = 256;
+
+class JoinHashMapProbeBench {
+public:
+    explicit JoinHashMapProbeBench(uint32_t build_rows) : _build_rows(build_rows) {}
+
+    uint32_t build_rows() const { return _build_rows; }
+
+    void SetUp() {
+        auto build_column = Int64Column::create();
+        build_column->reserve(_build_rows + 1);
+        build_column->append(0);
+        for (uint32_t i = 0; i < _build_rows; i++) {
+            build_column->append(static_cast<int64_t>(i) * 7);
+        }
+        _table_items.key_columns.emplace_back(std::move(build_column));
+        _table_items.row_count = _build_rows;
+
+        HashTableProbeState build_state;
+        JoinBuildFunc<TYPE_BIGINT>::prepare(nullptr, &_table_items);
+        JoinBuildFunc<TYPE_BIGINT>::construct_hash_table(nullptr, &_table_items, &build_state);
+
+        std::mt19937_64 rng(0);
+        std::uniform_int_distribution<uint32_t> dist(0, _build_rows - 1);
+        _probe_columns.resize(kProbeChunks);
+        for (auto& column : _probe_columns) {
+            auto probe_column = Int64Column::create();
+            probe_column->reserve(kProbeChunkSize);
+            for (size_t i = 0; i < kProbeChunkSize; i++) {
+                probe_column->append(static_cast<int64_t>(dist(rng)) * 7);
+            }
+            column = std::move(probe_column);
+        }
+    }
+
+    void do_bench(benchmark::State& state, int32_t group_size) {
+        config::join_probe_prefetch_group_size = group_size;
+        // the prefetching is only enabled for a table that does not fit in the cache, force it for small tables.
+        _table_items.cache_miss_serious = group_size > 0;
+
+        HashTableProbeState probe_state;
+        probe_state.buckets.resize(kProbeChunkSize);
+        probe_state.next.resize(kProbeChunkSize);
+        const auto& build_data = JoinBuildFunc<TYPE_BIGINT>::get_key_data(_table_items);
+
+        size_t matched = 0;
+        for (auto _ : state) {
+            for (auto& probe_column : _probe_columns) {
+                Columns key_columns{probe_column};
+                probe_state.key_columns = &key_columns;
+                probe_state.probe_row_count = kProbeChunkSize;
+                JoinProbeFunc<TYPE_BIGINT>::lookup_init(_table_items, &probe_state);
+
+                const auto& probe_data = JoinProbeFunc<TYPE_BIGINT>::get_key_data(probe_state);
+                for (size_t i = 0; i < kProbeChunkSize; i++) {
+                    for (uint32_t index = probe_state.next[i]; index != 0; index = _table_items.next[index]) {
+                        matched += build_data[index] == probe_data[i];
+                    }
+                }
+            }
+        }
+        benchmark::DoNotOptimize(matched);
+        state.SetItemsProcessed(state.iterations() * kProbeChunks * kProbeChunkSize);
+    }
+
+private:
+    uint32_t _build_rows;
+    JoinHashTableItems _table_items;
+    Columns _probe_columns;
+};
+
+static void BM_JoinHashMapProbe_Args(benchmark::internal::Benchmark* b) {
+    for (int64_t build_rows : {1'000'000, 10'000'000, 100'000'000, 500'000'000}) {
+        for (int64_t group_size : {0, 8, 16, 32}) {
+            b->Args({build_rows, group_size});
+        }
+    }
+    b->Unit(benchmark::kMillisecond);
+}
+
+static void BM_JoinHashMapProbe(benchmark::State& state) {
+    // building the table dominates, so share it between the group sizes of the same table size.
+    static std::unique_ptr<JoinHashMapProbeBench> bench;
+    auto build_rows = static_cast<uint32_t>(state.range(0));
+    if (bench == nullptr || bench->build_rows() != build_rows) {
+        bench.reset();
+        bench = std::make_unique<JoinHashMapProbeBench>(build_rows);
+        bench->SetUp();
+    }
+    bench->do_bench(state, static_cast<int32_t>(state.range(1)));
+}
+
+BENCHMARK(BM_JoinHashMapProbe)->Apply(BM_JoinHashMapProbe_Args);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -0,0 +1,85 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+// The cache holds a tenth of the hot keys.
+static const int kHotKeys = 100000;
+static const int kCacheSize = kHotKeys / 10;
+static const int kTraceLength = 2000000;
+
+// A trace of point reads on the hot keys of a Zipf distribution, mixed with |scan_percent|% reads of a
+// sequential scan over the keys never read again, like an ad-hoc full table scan among dashboard queries.
+static std::vector<uint32_t> gen_trace(int scan_percent) {
+    std::mt19937_64 rng(0);
+    std::vector<double> weights(kHotKeys);
+    for (int i = 0; i < kHotKeys; i++) {
+        weights[i] = 1.0 / std::pow(i + 1, 0.99);
+    }
+    std::discrete_distribution<uint32_t> zipf(weights.begin(), weights.end());
+    std::uniform_int_distribution<int> percent(0, 99);
+    std::vector<uint32_t> trace;
+    trace.reserve(kTraceLength);
+    uint32_t scan_key = kHotKeys;
+    for (int i = 0; i < kTraceLength; i++) {
+        trace.push_back(percent(rng) < scan_percent ? scan_key++ : zipf(rng));
+    }
+    return trace;
+}
+
+static void deleter(const CacheKey& key, void* value) {}
+
+// Replay the trace, a miss reads the key into the cache like StoragePageCache does.
+static void BM_CacheTraceReplay(benchmark::State& state) {
+    auto policy = static_cast<CacheEvictionPolicy>(state.range(0));
+    std::vector<uint32_t> trace = gen_trace(state.range(1));
+    size_t lookups = 0;
+    size_t hits = 0;
+    for (auto _ : state) {
+        std::unique_ptr<Cache> cache(new_lru_cache(kCacheSize, ChargeMode::VALUESIZE, policy));
+        for (uint32_t key : trace) {
+            CacheKey cache_key(reinterpret_cast<const char*>(&key), sizeof(key));
+            Cache::Handle* handle = cache->lookup(cache_key);
+            if (handle == nullptr) {
+                handle = cache->insert(cache_key, nullptr, 1, &deleter);
+            }
+            cache->release(handle);
+        }
+        lookups += cache->get_lookup_count();
+        hits += cache->get_hit_count();
+    }
+    state.SetItemsProcessed(state.iterations() * trace.size());
+    state.counters["hit_ratio"] = static_cast<double>(hits) / lookups;
+}
+
+BENCHMARK(BM_CacheTraceReplay)
+        ->ArgsProduct({{static_cast<int>(CacheEvictionPolicy::LRU), static_cast<int>(CacheEvictionPolicy::S3FIFO),
+                        static_cast<int>(CacheEvictionPolicy::WTINYLFU)},
+                       {0, 20, 50}})
+        ->ArgNames({"policy", "scan_percent"})
+        ->Unit(benchmark::kMillisecond);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
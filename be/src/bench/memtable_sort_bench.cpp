@@ -0,0 +1,97 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "column/column_helper.h"
+#include "column/vectorized_fwd.h"
+#include "exec/sorting/sort_helper.h"
+#include "exec/sorting/sort_permute.h"
+#include "exec/sorting/sorting.h"
+#include "runtime/types.h"
+
+namespace starrocks {
+
+// The rows of a flushed memtable.
+static const size_t kNumRows = 1000000;
+
+enum KeyMix { kBigint = 0, kIntDateBigint = 1, kVarcharBigint = 2, kNullableIntVarchar = 3 };
+
+// Keys of a stream load into a duplicate key table, which come in random order.
+static Columns gen_sort_keys(KeyMix mix) {
+    std::mt19937_64 rng(0);
+    auto gen_column = [&](LogicalType type, bool nullable) {
+        TypeDescriptor type_desc = type == TYPE_VARCHAR ? TypeDescriptor::create_varchar_type(32) : TypeDescriptor(type);
+        ColumnPtr column = ColumnHelper::create_column(type_desc, nullable);
+        for (size_t i = 0; i < kNumRows; i++) {
+            if (nullable && rng() % 10 == 0) {
+                column->append_nulls(1);
+            } else if (type == TYPE_INT) {
+                column->append_datum(Datum(static_cast<int32_t>(rng() % 10000)));
+            } else if (type == TYPE_BIGINT) {
+                column->append_datum(Datum(static_cast<int64_t>(rng())));
+            } else if (type == TYPE_DATE) {
+                column->append_datum(Datum(DateValue::create(2023, 1 + rng() % 12, 1 + rng() % 28)));
+            } else {
+                std::string s = "region_" + std::to_string(rng() % 200);
+                column->append_datum(Datum(Slice(s)));
+            }
+        }
+        return column;
+    };
+    switch (mix) {
+    case kBigint:
+        return {gen_column(TYPE_BIGINT, false)};
+    case kIntDateBigint:
+        return {gen_column(TYPE_INT, false), gen_column(TYPE_DATE, false), gen_column(TYPE_BIGINT, false)};
+    case kVarcharBigint:
+        return {gen_column(TYPE_VARCHAR, false), gen_column(TYPE_BIGINT, false)};
+    default:
+        return {gen_column(TYPE_INT, true), gen_column(TYPE_VARCHAR, true)};
+    }
+}
+
+// Sort the keys like MemTable::_sort_column_inc, column by column or by the normalized keys.
+static void BM_MemTableSort(benchmark::State& state) {
+    Columns columns = gen_sort_keys(static_cast<KeyMix>(state.range(0)));
+    bool radix_sort = state.range(1);
+    SortDescs sort_desc = SortDescs::asc_null_first(columns.size());
+    for (auto _ : state) {
+        SmallPermutation perm = create_small_permutation(kNumRows);
+        if (radix_sort) {
+            Status st = stable_sort_by_normalized_keys(false, columns, sort_desc, 64, &perm);
+            if (!st.ok()) {
+                state.SkipWithError(st.to_string().c_str());
+                break;
+            }
+        } else {
+            (void)stable_sort_and_tie_columns(false, columns, sort_desc, &perm);
+        }
+        benchmark::DoNotOptimize(perm.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+BENCHMARK(BM_MemTableSort)
+        ->ArgsProduct({{kBigint, kIntDateBigint, kVarcharBigint, kNullableIntVarchar}, {0, 1}})
+        ->ArgNames({"key_mix", "radix_sort"})
+        ->Unit(benchmark::kMillisecond);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -0,0 +1,126 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <glog/logging.h>
+
+#include <memory>
+#include <thread>
+
+#include "common/config.h"
+#include "exec/pipeline/pipeline_driver_queue.h"
+#include "exec/pipeline/query_context.h"
+#include "exec/pipeline/source_operator.h"
+#include "exec/workgroup/work_group.h"
+
+namespace starrocks::pipeline {
+
+// Executor threads repeatedly take a driver, run it for a short time slice and put it back from the executor,
+// which is the dispatch path of the drivers yielding for time slices.
+// Args: number of executor threads, local queue size (0 means every driver goes through the shared queue),
+// shared queue (0 means QuerySharedDriverQueue, 1 means WorkGroupDriverQueue over kNumWorkGroups workgroups).
+
+static constexpr int kDriversPerThread = 4;
+static constexpr int kTakesPerThread = 100'000;
+static constexpr int64_t kTimeSliceNs = 10'000;
+static constexpr int kNumWorkGroups = 4;
+
+class MockSourceOperator final : public SourceOperator {
+public:
+    MockSourceOperator() : SourceOperator(nullptr, 1, "mock_source", 1, false, 0) {}
+    ~MockSourceOperator() override = default;
+
+    bool has_output() const override { return true; }
+    bool need_input() const override { return false; }
+    bool is_finished() const override { return false; }
+
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override { return nullptr; }
+    Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override { return Status::OK(); }
+};
+
+static void BM_DriverQueueDispatch(benchmark::State& state) {
+    const auto num_threads = static_cast<int>(state.range(0));
+    config::pipeline_driver_local_queue_size = static_cast<int32_t>(state.range(1));
+    const bool use_workgroup_queue = state.range(2) != 0;
+
+    std::vector<workgroup::WorkGroupPtr> workgroups;
+    for (int i = 0; i < kNumWorkGroups; i++) {
+        auto wg = std::make_shared<workgroup::WorkGroup>("bench_wg" + std::to_string(i), 10'000 + i,
+                                                         workgroup::WorkGroup::DEFAULT_VERSION, 1, 0.5, 10, 1.0,
+                                                         workgroup::WorkGroupType::WG_NORMAL);
+        wg->driver_sched_entity()->set_queue(std::make_unique<QuerySharedDriverQueue>());
+        workgroups.emplace_back(std::move(wg));
+    }
+
+    QueryContext query_ctx;
+    std::vector<DriverPtr> drivers;
+    for (int i = 0; i < num_threads * kDriversPerThread; i++) {
+        Operators operators{std::make_shared<MockSourceOperator>()};
+        drivers.emplace_back(std::make_shared<PipelineDriver>(operators, &query_ctx, nullptr, nullptr, i));
+        drivers.back()->set_workgroup(workgroups[i % kNumWorkGroups]);
+    }
+
+    for (auto _ : state) {
+        DriverQueuePtr shared_queue;
+        if (use_workgroup_queue) {
+            shared_queue = std::make_unique<WorkGroupDriverQueue>();
+        } else {
+            shared_queue = std::make_unique<QuerySharedDriverQueue>();
+        }
+        WorkStealingDriverQueue queue(std::move(shared_queue));
+        for (auto& driver : drivers) {
+            queue.put_back(driver.get());
+        }
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < num_threads; i++) {
+            threads.emplace_back([&queue]() {
+                queue.register_worker();
+                for (int num_takes = 0; num_takes < kTakesPerThread;) {
+                    auto* driver = queue.take(false).value();
+                    if (driver == nullptr) {
+                        continue;
+                    }
+                    num_takes++;
+                    driver->driver_acct().update_last_time_spent(kTimeSliceNs);
+                    queue.update_statistics(driver);
+                    queue.put_back_from_executor(driver);
+                }
+                queue.unregister_worker();
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        CHECK_EQ(drivers.size(), queue.size());
+    }
+    state.SetItemsProcessed(state.iterations() * num_threads * kTakesPerThread);
+}
+
+static void BM_DriverQueueDispatch_Args(benchmark::internal::Benchmark* b) {
+    for (int64_t num_threads : {1, 2, 4, 8, 16, 32, 64}) {
+        for (int64_t local_queue_size : {0, 4}) {
+            for (int64_t use_workgroup_queue : {0, 1}) {
+                b->Args({num_threads, local_queue_size, use_workgroup_queue});
+            }
+        }
+    }
+    b->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+BENCHMARK(BM_DriverQueueDispatch)->Apply(BM_DriverQueueDispatch_Args);
+
+} // namespace starrocks::pipeline
+
+BENCHMARK_MAIN();
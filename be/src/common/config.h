@@ -227,6 +227,11 @@ CONF_mInt32(max_pushdown_conditions_per_column, "1024");
 CONF_mInt32(exchg_node_buffer_size_bytes, "10485760");
 // The block_size every block allocate for sorter.
 CONF_Int32(sorter_block_size, "8388608");
+// The sort keys of a full sort, e.g. ORDER BY or the sort of the partitions of a window function, are encoded
+// into normalized keys of at most this many bytes and radix sorted, the rows of equal keys are then compared
+// on the rest of the keys. It takes about twice the key width plus 8 bytes of memory per row when sorting.
+// 0 means always sorting column by column.
+CONF_mInt32(full_sort_radix_sort_max_key_width, "32");
 
 CONF_mInt64(column_dictionary_key_ratio_threshold, "0");
 CONF_mInt64(column_dictionary_key_size_threshold, "0");
@@ -271,12 +276,21 @@ CONF_Int32(data_page_size, "65536");
 CONF_mString(storage_page_cache_limit, "20%");
 // whether to disable page cache feature in storage
 CONF_mBool(disable_storage_page_cache, "false");
+// the eviction policy of the storage page cache: "lru", "s3fifo" or "wtinylfu". s3fifo and wtinylfu keep
+// the frequently read pages from being flushed out by large scans.
+CONF_String(storage_page_cache_eviction_policy, "lru");
 // whether to enable the bitmap index memory cache
 CONF_mBool(enable_bitmap_index_memory_page_cache, "false");
 // whether to enable the zonemap index memory cache
 CONF_mBool(enable_zonemap_index_memory_page_cache, "false");
 // whether to enable the ordinal index memory cache
 CONF_mBool(enable_ordinal_index_memory_page_cache, "false");
+// whether to cache the numeric data pages decoded into plain values in the storage page cache, so that
+// the scans of the hot pages skip decoding. Only the pages of RLE, DICT, FOR, DELTA and ALP encodings
+// are cached, the other pages are plain values already once in the page cache.
+CONF_mBool(enable_decoded_page_cache, "false");
+// a decoded page is admitted to the storage page cache after it's decoded this many times recently.
+CONF_mInt32(decoded_page_cache_admit_frequency, "2");
 // whether to disable column pool
 CONF_Bool(disable_column_pool, "true");
 
@@ -381,6 +395,9 @@ CONF_mInt32(number_tablet_writer_threads, "16");
 CONF_mInt64(max_queueing_memtable_per_tablet, "2");
 // when memory limit exceed and memtable last update time exceed this time, memtable will be flushed
 CONF_mInt64(stale_memtable_flush_time_sec, "30");
+// the sort keys of a memtable are encoded into normalized keys of at most this many bytes and radix sorted
+// when it is flushed. 0 means always sorting column by column.
+CONF_mInt32(memtable_radix_sort_max_key_width, "64");
 
 // delta writer hang after this time, be will exit since storage is in error state
 CONF_Int32(be_exit_after_disk_write_hang_second, "60");
@@ -401,6 +418,26 @@ CONF_Int32(dictionary_page_size, "1048576");
 // no-string column.
 CONF_Double(dictionary_encoding_ratio_for_non_string_column, "0");
 
+// Whether to encode the INT/BIGINT/DATE/DATETIME columns with DELTA_ENCODING, which chooses between
+// frame-of-reference, delta and delta-of-delta bit-packing for each page. The segments written with it
+// can not be read by the versions without DELTA_ENCODING.
+CONF_mBool(enable_integer_delta_encoding, "false");
+
+// Whether to encode the FLOAT/DOUBLE columns with ALP_ENCODING, which turns the decimal values into integers
+// losslessly and falls back to the XOR encoding for the others. The segments written with it can not be read
+// by the versions without ALP_ENCODING.
+CONF_mBool(enable_float_alp_encoding, "false");
+
+// Whether to encode the high-cardinality CHAR/VARCHAR columns, and the data pages written after the dictionary
+// is full, with FSST_ENCODING. The equality and simple LIKE predicates on VARCHAR are evaluated on the compressed
+// strings. The segments written with it can not be read by the versions without FSST_ENCODING.
+CONF_mBool(enable_string_fsst_encoding, "false");
+
+// The zone map of a CHAR/VARCHAR data page encoded by dictionary encoding keeps the bitmap of the dictionary
+// codes in the page, if all of them are less than this value, so that the pages without any value selected
+// by `=`, `!=`, `IN` and `NOT IN` predicates are skipped. 0 to disable.
+CONF_mInt32(zone_map_max_dict_codes, "1024");
+
 // The minimum chunk size for dictionary encoding speculation
 CONF_Int32(dictionary_speculate_min_chunk_size, "10000");
 
@@ -663,6 +700,11 @@ CONF_Int32(late_materialization_ratio, "10");
 // `1000` will enable late materialization always select metric type.
 CONF_Int32(metric_late_materialization_ratio, "1000");
 
+// Whether to read the predicate columns of late materialization one by one, each of them only for the rows
+// selected by the predicates of the previous ones. The columns are ordered by the cost and the selectivity
+// of their predicates observed during the scan.
+CONF_mBool(enable_progressive_late_materialization, "false");
+
 // Max batched bytes for each transmit request. (256KB)
 CONF_Int64(max_transmit_batched_bytes, "262144");
 
@@ -748,6 +790,17 @@ CONF_mBool(pipeline_print_profile, "false");
 // when the value of level_time_slice_base_ns is smaller and queue_ratio_of_adjacent_queue is larger.
 CONF_Int64(pipeline_driver_queue_level_time_slice_base_ns, "200000000");
 CONF_Double(pipeline_driver_queue_ratio_of_adjacent_queue, "1.2");
+// The capacity of the local driver queue of each pipeline execution thread, which keeps the drivers yielded by the
+// thread to run them again without going through the shared driver queue, and from which the idle threads steal.
+// 0 means that all the drivers go through the shared driver queue.
+CONF_mInt32(pipeline_driver_local_queue_size, "4");
+// Whether the blocked drivers waiting for the notifiable events (the chunk arrivals of exchange sources and scan
+// operators, the RPC completions of exchange sinks and the global runtime filter arrivals) are woken up by
+// the events, instead of being polled by the poller thread repeatedly.
+CONF_mBool(enable_pipeline_event_driven_wakeup, "true");
+// The interval at which the poller checks the drivers waiting for the notifiable events,
+// to find out the timeouts and cancellations which are not notified.
+CONF_mInt64(pipeline_poller_fallback_check_interval_ms, "10");
 // 0 represents PriorityScanTaskQueue (by default), while 1 represents MultiLevelFeedScanTaskQueue.
 // - PriorityScanTaskQueue prioritizes scan tasks with lower committed times.
 // - MultiLevelFeedScanTaskQueue prioritizes scan tasks with shorter execution time.
@@ -984,6 +1037,8 @@ CONF_mInt32(lake_pk_preload_memory_limit_percent, "30");
 CONF_mInt32(lake_pk_index_sst_min_compaction_versions, "2");
 CONF_mInt32(lake_pk_index_sst_max_compaction_versions, "5");
 CONF_Int32(lake_pk_index_block_cache_limit_percent, "10");
+// The max threads reading the blocks of a multi_get on the PK index sstables in parallel, 0 to read them sequentially.
+CONF_Int32(lake_pk_index_sst_read_threads, "8");
 
 CONF_mBool(dependency_librdkafka_debug_enable, "false");
 
@@ -1028,6 +1083,16 @@ CONF_Int64(spill_max_log_block_container_bytes, "10737418240"); // 10GB
 // be the same with storage path. Spill will return with error when used size has exceeded
 // the limit.
 CONF_mDouble(spill_max_dir_bytes_ratio, "0.8"); // 80%
+// Whether to compress the spilled chunks by the compression type of the spill options (LZ4 by default).
+// The compression is skipped adaptively if the compression ratio of the sampled chunks is poor.
+CONF_mBool(enable_spill_compression, "false");
+// Whether to write and read the spilled blocks on the local disks through io_uring. It falls back to the
+// blocking LogBlockManager if io_uring is not supported by the kernel.
+CONF_Bool(spill_enable_io_uring, "false");
+// The size of each write-behind and read-ahead buffer of the io_uring spill blocks, aligned up to 4KB.
+CONF_mInt64(spill_io_uring_buffer_size, "1048576");
+// Whether to open the spill files with O_DIRECT when io_uring is enabled, to bypass the page cache.
+CONF_Bool(spill_io_uring_direct_io, "true");
 
 CONF_Int32(internal_service_query_rpc_thread_num, "-1");
 
@@ -1201,6 +1266,14 @@ CONF_Int64(local_exchange_buffer_mem_limit_per_driver, "134217728"); // 128MB
 CONF_mInt64(streaming_agg_limited_memory_size, "134217728");
 // pipeline streaming aggregate chunk buffer size
 CONF_mInt32(streaming_agg_chunk_buffer_size, "1024");
+// The max number of slots of the array that the single SMALLINT/INT group by keys of a small range, like the
+// codes of a global dictionary, are mapped to instead of being hashed. The keys out of it are hashed.
+// 0 to always hash the keys, which is the default until the gain is measured, e.g. 65536 to enable it.
+CONF_mInt32(agg_direct_mapping_max_slots, "0");
+// Keep the states of the simple aggregate functions like sum/count/min/max of a group by aggregation in a
+// column per function indexed by group id, instead of in the row of each group.
+// Disabled by default until the aggregator tests pass on it in CI and its gain over the row layout is measured.
+CONF_mBool(enable_agg_columnar_states, "false");
 CONF_mInt64(wait_apply_time, "6000"); // 6s
 
 // Max size of a binlog file. The default is 512MB.
@@ -1302,4 +1375,30 @@ CONF_mInt64(jit_lru_cache_size, "0");
 CONF_mInt64(arrow_io_coalesce_read_max_buffer_size, "8388608");
 CONF_mInt64(arrow_io_coalesce_read_max_distance_size, "1048576");
 CONF_mInt64(arrow_read_batch_size, "4096");
+
+// If true, the ODPS jni scanner exports arrow batches through the Arrow C Data Interface
+// and BE converts them directly, instead of copying every value into the java off-heap table.
+// A scanner reading a column of a type the arrow converters may not handle, e.g. JSON, keeps
+// using the off-heap table.
+CONF_mBool(enable_odps_arrow_c_data_import, "false");
+
+// The number of chunks a jni scanner keeps prefetched in background, 0 disables prefetching.
+CONF_mInt32(jni_scanner_prefetch_chunk_num, "0");
+// The thread num of the jni scanner prefetch pool, <= 0 means the number of cpu cores.
+CONF_Int32(jni_scanner_prefetch_thread_num, "0");
+
+// A join hash table with at least this many build rows links its bucket chains by radix partitions in parallel.
+// The keys are still hashed and serialized by the build driver, which waits for the linking outside of the
+// workgroup cpu accounting. <= 0 disables it, which is the default.
+CONF_mInt64(join_hash_table_parallel_link_min_rows, "0");
+// The number of radix partitions the bucket chains are linked by, rounded down to a power of two.
+CONF_mInt32(join_hash_table_parallel_link_partition_num, "16");
+// The thread num of the pool linking the bucket chains of join hash tables, <= 0 means the number of cpu cores.
+CONF_Int32(join_hash_table_parallel_link_thread_num, "0");
+// The number of probe rows whose hash table slots are prefetched together when a join hash table is much larger
+// than the last level cache, 0 disables the prefetching.
+CONF_mInt32(join_probe_prefetch_group_size, "16");
+// If true, LEFT SEMI/ANTI joins without other join conjuncts use a hash table that only indexes the distinct
+// build keys, instead of chaining every build row.
+CONF_mBool(enable_hash_join_existence_table, "true");
 } // namespace starrocks::config
@@ -530,6 +530,7 @@ Status HiveDataSource::_init_scanner(RuntimeState* state) {
     scanner_params.slots_of_mutli_slot_conjunct = _slots_of_mutli_slot_conjunct;
     scanner_params.min_max_conjunct_ctxs = _min_max_conjunct_ctxs;
     scanner_params.min_max_tuple_desc = _min_max_tuple_desc;
+    scanner_params.read_limit = _read_limit;
     scanner_params.hive_column_names = &_hive_column_names;
     scanner_params.case_sensitive = _case_sensitive;
     scanner_params.profile = &_profile;
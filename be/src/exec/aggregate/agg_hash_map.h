@@ -60,6 +60,13 @@ using TimeStampAggHashMap = phmap::flat_hash_map<TimestampValue, AggDataPtr, Std
 template <PhmapSeed seed>
 using SliceAggHashMap = phmap::flat_hash_map<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual>;
 
+// =====================
+// direct mapping agg hash map, for the keys of a small range
+template <PhmapSeed seed>
+using Int16DirectMappingAggHashMap = RangeDirectMappingHashMap<int16_t, AggDataPtr, seed>;
+template <PhmapSeed seed>
+using Int32DirectMappingAggHashMap = RangeDirectMappingHashMap<int32_t, AggDataPtr, seed>;
+
 // ==================
 // one level fixed size slice hash map
 template <PhmapSeed seed>
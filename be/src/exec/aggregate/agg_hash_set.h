@@ -47,6 +47,13 @@ template <PhmapSeed seed>
 using SliceAggHashSet =
         phmap::flat_hash_set<TSliceWithHash<seed>, THashOnSliceWithHash<seed>, TEqualOnSliceWithHash<seed>>;
 
+// =====================
+// direct mapping agg hash set, for the keys of a small range
+template <PhmapSeed seed>
+using Int16DirectMappingAggHashSet = RangeDirectMappingHashSet<int16_t, seed>;
+template <PhmapSeed seed>
+using Int32DirectMappingAggHashSet = RangeDirectMappingHashSet<int32_t, seed>;
+
 // ==================
 // one level fixed size slice hash set
 template <PhmapSeed seed>
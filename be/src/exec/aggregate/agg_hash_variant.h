@@ -89,7 +89,15 @@ namespace starrocks {
     M(phase1_slice_fx16)             \
     M(phase2_slice_fx4)              \
     M(phase2_slice_fx8)              \
-    M(phase2_slice_fx16)
+    M(phase2_slice_fx16)             \
+    M(phase1_int16_direct)           \
+    M(phase1_int32_direct)           \
+    M(phase1_null_int16_direct)      \
+    M(phase1_null_int32_direct)      \
+    M(phase2_int16_direct)           \
+    M(phase2_int32_direct)           \
+    M(phase2_null_int16_direct)      \
+    M(phase2_null_int32_direct)
 
 // Aggregate Hash maps
 
@@ -165,6 +173,20 @@ using SerializedKeyFixedSize8AggHashMap = AggHashMapWithSerializedKeyFixedSize<F
 template <PhmapSeed seed>
 using SerializedKeyFixedSize16AggHashMap = AggHashMapWithSerializedKeyFixedSize<FixedSize16SliceAggHashMap<seed>>;
 
+// direct mapping key type.
+template <PhmapSeed seed>
+using Int16DirectMappingAggHashMapWithOneNumberKey =
+        AggHashMapWithOneNumberKey<TYPE_SMALLINT, Int16DirectMappingAggHashMap<seed>>;
+template <PhmapSeed seed>
+using Int32DirectMappingAggHashMapWithOneNumberKey =
+        AggHashMapWithOneNumberKey<TYPE_INT, Int32DirectMappingAggHashMap<seed>>;
+template <PhmapSeed seed>
+using NullInt16DirectMappingAggHashMapWithOneNumberKey =
+        AggHashMapWithOneNullableNumberKey<TYPE_SMALLINT, Int16DirectMappingAggHashMap<seed>>;
+template <PhmapSeed seed>
+using NullInt32DirectMappingAggHashMapWithOneNumberKey =
+        AggHashMapWithOneNullableNumberKey<TYPE_INT, Int32DirectMappingAggHashMap<seed>>;
+
 // Hash sets
 //
 template <PhmapSeed seed>
@@ -239,6 +261,20 @@ using SerializedKeyAggHashSetFixedSize8 = AggHashSetOfSerializedKeyFixedSize<Fix
 template <PhmapSeed seed>
 using SerializedKeyAggHashSetFixedSize16 = AggHashSetOfSerializedKeyFixedSize<FixedSize16SliceAggHashSet<seed>>;
 
+// For direct mapping type.
+template <PhmapSeed seed>
+using Int16DirectMappingAggHashSetOfOneNumberKey =
+        AggHashSetOfOneNumberKey<TYPE_SMALLINT, Int16DirectMappingAggHashSet<seed>>;
+template <PhmapSeed seed>
+using Int32DirectMappingAggHashSetOfOneNumberKey =
+        AggHashSetOfOneNumberKey<TYPE_INT, Int32DirectMappingAggHashSet<seed>>;
+template <PhmapSeed seed>
+using NullInt16DirectMappingAggHashSetOfOneNumberKey =
+        AggHashSetOfOneNullableNumberKey<TYPE_SMALLINT, Int16DirectMappingAggHashSet<seed>>;
+template <PhmapSeed seed>
+using NullInt32DirectMappingAggHashSetOfOneNumberKey =
+        AggHashSetOfOneNullableNumberKey<TYPE_INT, Int32DirectMappingAggHashSet<seed>>;
+
 // aggregate key
 template <class HashMapWithKey>
 struct CombinedFixedSizeKey {
@@ -263,6 +299,48 @@ static_assert(!is_combined_fixed_size_key<Int32TwoLevelAggHashSetOfOneNumberKey<
 static_assert(is_combined_fixed_size_key<SerializedKeyAggHashSetFixedSize4<PhmapSeed1>>);
 static_assert(!is_combined_fixed_size_key<Int32TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>>);
 
+// direct mapping key, whose max number of slots is set by the aggregator.
+template <class HashMapOrSetWithKey>
+struct DirectMappingKey {
+    static auto constexpr value = false;
+};
+
+template <LogicalType logical_type, typename KeyType, PhmapSeed seed, bool is_nullable>
+struct DirectMappingKey<
+        AggHashMapWithOneNumberKeyWithNullable<logical_type, RangeDirectMappingHashMap<KeyType, AggDataPtr, seed>,
+                                               is_nullable>> {
+    static auto constexpr value = true;
+    template <class HashMapWithKey>
+    static void set_max_slots(HashMapWithKey& hash_map_with_key, size_t max_slots) {
+        hash_map_with_key.hash_map.set_max_slots(max_slots);
+    }
+};
+
+template <LogicalType logical_type, typename KeyType, PhmapSeed seed>
+struct DirectMappingKey<AggHashSetOfOneNumberKey<logical_type, RangeDirectMappingHashSet<KeyType, seed>>> {
+    static auto constexpr value = true;
+    template <class HashSetWithKey>
+    static void set_max_slots(HashSetWithKey& hash_set_with_key, size_t max_slots) {
+        hash_set_with_key.hash_set.set_max_slots(max_slots);
+    }
+};
+
+template <LogicalType logical_type, typename KeyType, PhmapSeed seed>
+struct DirectMappingKey<AggHashSetOfOneNullableNumberKey<logical_type, RangeDirectMappingHashSet<KeyType, seed>>> {
+    static auto constexpr value = true;
+    template <class HashSetWithKey>
+    static void set_max_slots(HashSetWithKey& hash_set_with_key, size_t max_slots) {
+        hash_set_with_key.hash_set.set_max_slots(max_slots);
+    }
+};
+
+template <typename HashMapOrSetWithKey>
+inline constexpr bool is_direct_mapping_key = DirectMappingKey<HashMapOrSetWithKey>::value;
+
+static_assert(is_direct_mapping_key<NullInt32DirectMappingAggHashMapWithOneNumberKey<PhmapSeed1>>);
+static_assert(is_direct_mapping_key<Int16DirectMappingAggHashSetOfOneNumberKey<PhmapSeed2>>);
+static_assert(!is_direct_mapping_key<Int32AggHashMapWithOneNumberKey<PhmapSeed1>>);
+
 // 1) For different group by columns type, size, cardinality, volume, we should choose different
 // hash functions and different hashmaps.
 // When runtime, we will only have one hashmap.
@@ -334,7 +412,15 @@ using AggHashMapWithKeyPtr = std::variant<
         std::unique_ptr<Int32TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyFixedSize4AggHashMap<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyFixedSize8AggHashMap<PhmapSeed2>>,
-        std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed2>>>;
+        std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed2>>,
+        std::unique_ptr<Int16DirectMappingAggHashMapWithOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<Int32DirectMappingAggHashMapWithOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<NullInt16DirectMappingAggHashMapWithOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<NullInt32DirectMappingAggHashMapWithOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<Int16DirectMappingAggHashMapWithOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<Int32DirectMappingAggHashMapWithOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<NullInt16DirectMappingAggHashMapWithOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<NullInt32DirectMappingAggHashMapWithOneNumberKey<PhmapSeed2>>>;
 
 using AggHashSetWithKeyPtr = std::variant<
         std::unique_ptr<UInt8AggHashSetOfOneNumberKey<PhmapSeed1>>,
@@ -394,7 +480,15 @@ using AggHashSetWithKeyPtr = std::variant<
         std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed1>>,
         std::unique_ptr<SerializedKeyAggHashSetFixedSize4<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyAggHashSetFixedSize8<PhmapSeed2>>,
-        std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed2>>>;
+        std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed2>>,
+        std::unique_ptr<Int16DirectMappingAggHashSetOfOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<Int32DirectMappingAggHashSetOfOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<NullInt16DirectMappingAggHashSetOfOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<NullInt32DirectMappingAggHashSetOfOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<Int16DirectMappingAggHashSetOfOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<Int32DirectMappingAggHashSetOfOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<NullInt16DirectMappingAggHashSetOfOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<NullInt32DirectMappingAggHashSetOfOneNumberKey<PhmapSeed2>>>;
 } // namespace detail
 struct AggHashMapVariant {
     enum class Type {
@@ -461,6 +555,15 @@ struct AggHashMapVariant {
         phase2_slice_fx4,
         phase2_slice_fx8,
         phase2_slice_fx16,
+
+        phase1_int16_direct,
+        phase1_int32_direct,
+        phase1_null_int16_direct,
+        phase1_null_int32_direct,
+        phase2_int16_direct,
+        phase2_int32_direct,
+        phase2_null_int16_direct,
+        phase2_null_int32_direct,
     };
 
     detail::AggHashMapWithKeyPtr hash_map_with_key;
@@ -564,6 +667,15 @@ struct AggHashSetVariant {
         phase2_slice_fx4,
         phase2_slice_fx8,
         phase2_slice_fx16,
+
+        phase1_int16_direct,
+        phase1_int32_direct,
+        phase1_null_int16_direct,
+        phase1_null_int32_direct,
+        phase2_int16_direct,
+        phase2_int32_direct,
+        phase2_null_int16_direct,
+        phase2_null_int32_direct,
     };
 
     detail::AggHashSetWithKeyPtr hash_set_with_key;
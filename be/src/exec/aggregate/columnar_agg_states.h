@@ -0,0 +1,134 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "exprs/agg/aggregate.h"
+
+namespace starrocks {
+
+// The states of the simple aggregate functions of a group by aggregation, kept in a dense column per
+// function indexed by the group id, instead of in the row of each group allocated from the MemPool.
+// Updating a chunk is then a loop over the group ids of its rows for each function, see
+// AggregateFunction::update_batch_columnar, rather than a scatter through the per-row pointers.
+//
+// The group ids are handed out consecutively from 1, the group 0 is reserved for the rows to be
+// discarded, e.g. the rows not found in the hash table once the aggregation reaches its limit.
+// Only the functions supporting columnar states are kept here, the others stay in the rows.
+class ColumnarAggStates {
+public:
+    static constexpr uint32_t kDiscardGroupId = 0;
+
+    // Keep the states of the functions of |fn_indexes| in columns.
+    void init(const std::vector<const AggregateFunction*>& functions, const std::vector<FunctionContext*>& ctxs,
+              const std::vector<size_t>& fn_indexes) {
+        _columns.clear();
+        _column_of_fn.assign(functions.size(), -1);
+        for (size_t fn_index : fn_indexes) {
+            DCHECK(functions[fn_index]->support_columnar_state());
+            _column_of_fn[fn_index] = _columns.size();
+            _columns.push_back({functions[fn_index], ctxs[fn_index], functions[fn_index]->size(), {}});
+        }
+        _num_groups = 0;
+    }
+
+    bool empty() const { return _columns.empty(); }
+
+    // Whether the states of the |fn_index|-th function are kept in a column.
+    bool contains(size_t fn_index) const { return !_columns.empty() && _column_of_fn[fn_index] >= 0; }
+
+    // The states of all the groups of the |fn_index|-th function, AggregateFunction::size() bytes each.
+    AggDataPtr states(size_t fn_index) { return _columns[_column_of_fn[fn_index]].data.data(); }
+
+    AggDataPtr state(size_t fn_index, uint32_t group_id) {
+        auto& column = _columns[_column_of_fn[fn_index]];
+        return column.data.data() + group_id * column.state_size;
+    }
+
+    ConstAggDataPtr state(size_t fn_index, uint32_t group_id) const {
+        const auto& column = _columns[_column_of_fn[fn_index]];
+        return column.data.data() + group_id * column.state_size;
+    }
+
+    // Create the states of a new group and return its id, throw std::bad_alloc if out of memory.
+    uint32_t allocate() {
+        if (_num_groups == 0) {
+            _append();
+        }
+        return _append();
+    }
+
+    // Drop the states of the group allocated last.
+    void rollback() {
+        DCHECK_GT(_num_groups, 1);
+        for (auto& column : _columns) {
+            column.data.resize(column.data.size() - column.state_size);
+        }
+        _num_groups--;
+    }
+
+    // The states are trivially destructible, so they are dropped without calling destroy.
+    void reset() {
+        for (auto& column : _columns) {
+            Buffer<uint8_t>().swap(column.data);
+        }
+        _num_groups = 0;
+    }
+
+    size_t memory_usage() const {
+        size_t usage = 0;
+        for (const auto& column : _columns) {
+            usage += column.data.capacity();
+        }
+        return usage;
+    }
+
+private:
+    struct StateColumn {
+        const AggregateFunction* function;
+        FunctionContext* ctx;
+        size_t state_size;
+        Buffer<uint8_t> data;
+    };
+
+    uint32_t _append() {
+        // Reserve all the columns ahead, so that a failed allocation leaves them untouched.
+        for (auto& column : _columns) {
+            if (column.data.size() + column.state_size > column.data.capacity()) {
+                column.data.reserve(std::max<size_t>(column.data.capacity() * 2, kInitialGroups * column.state_size));
+            }
+        }
+        for (auto& column : _columns) {
+            size_t offset = column.data.size();
+            column.data.resize(offset + column.state_size);
+            column.function->create(column.ctx, column.data.data() + offset);
+        }
+        return _num_groups++;
+    }
+
+    static constexpr size_t kInitialGroups = 1024;
+
+    std::vector<StateColumn> _columns;
+    // The index in _columns of each function, -1 if its states are kept in the rows.
+    std::vector<int> _column_of_fn;
+    uint32_t _num_groups = 0;
+};
+
+} // namespace starrocks
@@ -190,7 +190,6 @@ ChunkUniquePtr AggregatorParams::create_result_chunk(bool is_serialize_fmt, cons
 }
 
 #define ALIGN_TO(size, align) ((size + align - 1) / align * align)
-#define PAD(size, align) (align - (size % align)) % align;
 
 Aggregator::Aggregator(AggregatorParamsPtr params) : _params(std::move(params)) {}
 
@@ -247,22 +246,26 @@ Status Aggregator::open(RuntimeState* state) {
             });
 
             DCHECK_GT(_agg_fn_ctxs.size(), 0);
-            _max_agg_state_align_size = std::max(_max_agg_state_align_size, _agg_functions[0]->alignof_size());
-            _agg_states_total_size += PAD(_agg_states_total_size, _agg_functions[0]->alignof_size());
+            _init_columnar_states();
+            if (!_columnar_states.empty()) {
+                // The group id follows the key, it indexes the states kept in columns.
+                _group_id_offset = ALIGN_TO(_agg_states_total_size, alignof(uint32_t));
+                _agg_states_total_size = _group_id_offset + sizeof(uint32_t);
+                _max_agg_state_align_size = std::max(_max_agg_state_align_size, alignof(uint32_t));
+            }
 
             // compute agg state total size and offsets
             for (int i = 0; i < _agg_fn_ctxs.size(); ++i) {
+                if (_columnar_states.contains(i)) {
+                    // Kept in a column, no space in the row.
+                    _agg_states_offsets[i] = 0;
+                    continue;
+                }
+                // Add padding by rounding up '_agg_states_total_size' to be a multiplier of the alignment.
+                _agg_states_total_size = ALIGN_TO(_agg_states_total_size, _agg_functions[i]->alignof_size());
                 _agg_states_offsets[i] = _agg_states_total_size;
                 _agg_states_total_size += _agg_functions[i]->size();
                 _max_agg_state_align_size = std::max(_max_agg_state_align_size, _agg_functions[i]->alignof_size());
-
-                // If not the last aggregate_state, we need pad it so that next aggregate_state will be aligned.
-                if (i + 1 < _agg_fn_ctxs.size()) {
-                    size_t next_state_align_size = _agg_functions[i + 1]->alignof_size();
-                    // Extend total_size to next alignment requirement
-                    // Add padding by rounding up '_agg_states_total_size' to be a multiplier of next_state_align_size.
-                    _agg_states_total_size = ALIGN_TO(_agg_states_total_size, next_state_align_size);
-                }
             }
             _agg_states_total_size = ALIGN_TO(_agg_states_total_size, _max_agg_state_align_size);
             _state_allocator.aggregate_key_size = _agg_states_total_size;
@@ -350,6 +353,8 @@ Status Aggregator::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile
     _has_nullable_key = _params->has_nullable_key;
 
     _tmp_agg_states.resize(_state->chunk_size());
+    _tmp_group_ids.resize(_state->chunk_size());
+    _tmp_columnar_agg_states.resize(_state->chunk_size());
 
     auto& aggregate_functions = _params->aggregate_functions;
     size_t agg_size = aggregate_functions.size();
@@ -559,6 +564,7 @@ Status Aggregator::_reset_state(RuntimeState* state, bool reset_sink_complete) {
     // _state_allocator holds the entries of the hash_map/hash_set, when iterating a hash_map/set, the _state_allocator
     // is used to access these entries, so we must reset the _state_allocator along with the hash_map/hash_set.
     _state_allocator.reset();
+    _columnar_states.reset();
     return Status::OK();
 }
 
@@ -608,6 +614,7 @@ void Aggregator::close(RuntimeState* state) {
                 }
             } else if (!_is_only_group_by_columns) {
                 _release_agg_memory();
+                _columnar_states.reset();
             }
 
             _mem_pool->free_all();
@@ -765,10 +772,17 @@ Status Aggregator::compute_batch_agg_states(Chunk* chunk, size_t chunk_size) {
     SCOPED_TIMER(_agg_stat->agg_function_compute_timer);
     bool use_intermediate = _use_intermediate_as_input();
     auto& agg_expr_ctxs = use_intermediate ? _intermediate_agg_expr_ctxs : _agg_expr_ctxs;
+    if (!_columnar_states.empty()) {
+        _gather_group_ids(chunk_size, nullptr);
+    }
 
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
         // evaluate arguments at i-th agg function
         RETURN_IF_ERROR(evaluate_agg_input_column(chunk, agg_expr_ctxs[i], i));
+        if (_columnar_states.contains(i)) {
+            _compute_columnar_agg_states(i, chunk_size, use_intermediate);
+            continue;
+        }
         // batch call update or merge
         if (!_is_merge_funcs[i] && !use_intermediate) {
             _agg_functions[i]->update_batch(_agg_fn_ctxs[i], chunk_size, _agg_states_offsets[i],
@@ -787,9 +801,17 @@ Status Aggregator::compute_batch_agg_states_with_selection(Chunk* chunk, size_t
     SCOPED_TIMER(_agg_stat->agg_function_compute_timer);
     bool use_intermediate = _use_intermediate_as_input();
     auto& agg_expr_ctxs = use_intermediate ? _intermediate_agg_expr_ctxs : _agg_expr_ctxs;
+    if (!_columnar_states.empty()) {
+        // The rows not selected are updated into the discard group instead of being skipped.
+        _gather_group_ids(chunk_size, &_streaming_selection);
+    }
 
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
         RETURN_IF_ERROR(evaluate_agg_input_column(chunk, agg_expr_ctxs[i], i));
+        if (_columnar_states.contains(i)) {
+            _compute_columnar_agg_states(i, chunk_size, use_intermediate);
+            continue;
+        }
 
         if (!_is_merge_funcs[i] && !use_intermediate) {
             _agg_functions[i]->update_batch_selectively(_agg_fn_ctxs[i], chunk_size, _agg_states_offsets[i],
@@ -806,6 +828,54 @@ Status Aggregator::compute_batch_agg_states_with_selection(Chunk* chunk, size_t
     return Status::OK();
 }
 
+void Aggregator::_compute_columnar_agg_states(size_t i, size_t chunk_size, bool use_intermediate) {
+    if (!_is_merge_funcs[i] && !use_intermediate) {
+        _agg_functions[i]->update_batch_columnar(_agg_fn_ctxs[i], chunk_size, _agg_input_raw_columns[i].data(),
+                                                 _tmp_group_ids.data(), _columnar_states.states(i));
+    } else {
+        DCHECK_GE(_agg_input_columns[i].size(), 1);
+        DCHECK_EQ(chunk_size, _agg_input_columns[i][0]->size());
+        _agg_functions[i]->merge_batch_columnar(_agg_fn_ctxs[i], chunk_size, _agg_input_columns[i][0].get(),
+                                                _tmp_group_ids.data(), _columnar_states.states(i));
+    }
+}
+
+void Aggregator::_init_columnar_states() {
+    std::vector<size_t> fn_indexes;
+    if (_enable_columnar_states && config::enable_agg_columnar_states && !_group_by_expr_ctxs.empty()) {
+        for (size_t i = 0; i < _agg_functions.size(); i++) {
+            if (_agg_functions[i]->support_columnar_state() &&
+                _agg_functions[i]->alignof_size() <= HashTableKeyAllocator::aligned) {
+                fn_indexes.push_back(i);
+            }
+        }
+    }
+    _columnar_states.init(_agg_functions, _agg_fn_ctxs, fn_indexes);
+}
+
+void Aggregator::_gather_group_ids(size_t chunk_size, const std::vector<uint8_t>* selection) {
+    if (selection == nullptr) {
+        for (size_t i = 0; i < chunk_size; i++) {
+            _tmp_group_ids[i] = *reinterpret_cast<const uint32_t*>(_tmp_agg_states[i] + _group_id_offset);
+        }
+    } else {
+        for (size_t i = 0; i < chunk_size; i++) {
+            _tmp_group_ids[i] = (*selection)[i]
+                                        ? ColumnarAggStates::kDiscardGroupId
+                                        : *reinterpret_cast<const uint32_t*>(_tmp_agg_states[i] + _group_id_offset);
+        }
+    }
+}
+
+const Buffer<AggDataPtr>& Aggregator::_columnar_agg_states(size_t i, size_t num_groups) {
+    AggDataPtr states = _columnar_states.states(i);
+    size_t state_size = _agg_functions[i]->size();
+    for (size_t j = 0; j < num_groups; j++) {
+        _tmp_columnar_agg_states[j] = states + _tmp_group_ids[j] * state_size;
+    }
+    return _tmp_columnar_agg_states;
+}
+
 Status Aggregator::_evaluate_const_columns(int i) {
     // used for const columns.
     std::vector<ColumnPtr> const_columns;
@@ -1061,21 +1131,22 @@ Columns Aggregator::_create_group_by_columns(size_t num_rows) {
 
 void Aggregator::_serialize_to_chunk(ConstAggDataPtr __restrict state, const Columns& agg_result_columns) {
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
-        _agg_functions[i]->serialize_to_column(_agg_fn_ctxs[i], state + _agg_states_offsets[i],
-                                               agg_result_columns[i].get());
+        _agg_functions[i]->serialize_to_column(_agg_fn_ctxs[i], _agg_state(state, i), agg_result_columns[i].get());
     }
 }
 
 void Aggregator::_finalize_to_chunk(ConstAggDataPtr __restrict state, const Columns& agg_result_columns) {
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
-        _agg_functions[i]->finalize_to_column(_agg_fn_ctxs[i], state + _agg_states_offsets[i],
-                                              agg_result_columns[i].get());
+        _agg_functions[i]->finalize_to_column(_agg_fn_ctxs[i], _agg_state(state, i), agg_result_columns[i].get());
     }
 }
 
 void Aggregator::_destroy_state(AggDataPtr __restrict state) {
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
-        _agg_functions[i]->destroy(_agg_fn_ctxs[i], state + _agg_states_offsets[i]);
+        // The columnar states are trivially destructible.
+        if (!_columnar_states.contains(i)) {
+            _agg_functions[i]->destroy(_agg_fn_ctxs[i], state + _agg_states_offsets[i]);
+        }
     }
 }
 
@@ -1265,6 +1336,29 @@ void Aggregator::_init_agg_hash_variant(HashVariantType& hash_variant) {
         }
     }
 
+    // Map the single SMALLINT/INT keys into an array by key - min if they turn out to be of a small range at
+    // runtime, e.g. the codes of low-cardinality strings encoded by a global dictionary.
+    if (config::agg_direct_mapping_max_slots > 0) {
+        switch (type) {
+#define CHECK_DIRECT_MAPPING(VALUE)                   \
+    case HashVariantType::Type::VALUE: {              \
+        type = HashVariantType::Type::VALUE##_direct; \
+        break;                                        \
+    }
+            CHECK_DIRECT_MAPPING(phase1_int16);
+            CHECK_DIRECT_MAPPING(phase1_int32);
+            CHECK_DIRECT_MAPPING(phase1_null_int16);
+            CHECK_DIRECT_MAPPING(phase1_null_int32);
+            CHECK_DIRECT_MAPPING(phase2_int16);
+            CHECK_DIRECT_MAPPING(phase2_int32);
+            CHECK_DIRECT_MAPPING(phase2_null_int16);
+            CHECK_DIRECT_MAPPING(phase2_null_int32);
+#undef CHECK_DIRECT_MAPPING
+        default:
+            break;
+        }
+    }
+
     bool has_null_column = false;
     int fixed_byte_size = 0;
     // this optimization don't need to be limited to multi-column group by.
@@ -1293,10 +1387,14 @@ void Aggregator::_init_agg_hash_variant(HashVariantType& hash_variant) {
     hash_variant.init(_state, type, _agg_stat);
 
     hash_variant.visit([&](auto& variant) {
-        if constexpr (is_combined_fixed_size_key<std::decay_t<decltype(*variant)>>) {
+        using HashMapOrSetWithKey = std::decay_t<decltype(*variant)>;
+        if constexpr (is_combined_fixed_size_key<HashMapOrSetWithKey>) {
             variant->has_null_column = has_null_column;
             variant->fixed_byte_size = fixed_byte_size;
         }
+        if constexpr (is_direct_mapping_key<HashMapOrSetWithKey>) {
+            DirectMappingKey<HashMapOrSetWithKey>::set_max_slots(*variant, config::agg_direct_mapping_max_slots);
+        }
     });
 }
 
@@ -1392,6 +1490,9 @@ Status Aggregator::convert_hash_map_to_chunk(int32_t chunk_size, ChunkPtr* chunk
                 ++read_index;
                 it.next();
             }
+            if (!_columnar_states.empty()) {
+                _gather_group_ids(read_index, nullptr);
+            }
         }
 
         if (read_index > 0) {
@@ -1404,12 +1505,24 @@ Status Aggregator::convert_hash_map_to_chunk(int32_t chunk_size, ChunkPtr* chunk
                 SCOPED_TIMER(_agg_stat->agg_append_timer);
                 if (!use_intermediate) {
                     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+                        if (_columnar_states.contains(i)) {
+                            TRY_CATCH_BAD_ALLOC(_agg_functions[i]->batch_finalize(
+                                    _agg_fn_ctxs[i], read_index, _columnar_agg_states(i, read_index), 0,
+                                    agg_result_columns[i].get()));
+                            continue;
+                        }
                         TRY_CATCH_BAD_ALLOC(_agg_functions[i]->batch_finalize(_agg_fn_ctxs[i], read_index,
                                                                               _tmp_agg_states, _agg_states_offsets[i],
                                                                               agg_result_columns[i].get()));
                     }
                 } else {
                     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+                        if (_columnar_states.contains(i)) {
+                            TRY_CATCH_BAD_ALLOC(_agg_functions[i]->batch_serialize(
+                                    _agg_fn_ctxs[i], read_index, _columnar_agg_states(i, read_index), 0,
+                                    agg_result_columns[i].get()));
+                            continue;
+                        }
                         TRY_CATCH_BAD_ALLOC(_agg_functions[i]->batch_serialize(_agg_fn_ctxs[i], read_index,
                                                                                _tmp_agg_states, _agg_states_offsets[i],
                                                                                agg_result_columns[i].get()));
@@ -1545,17 +1658,13 @@ void Aggregator::_release_agg_memory() {
         if (hash_map_with_key != nullptr && !skip_destroy) {
             auto null_data_ptr = hash_map_with_key->get_null_key_data();
             if (null_data_ptr != nullptr) {
-                for (int i = 0; i < _agg_functions.size(); i++) {
-                    _agg_functions[i]->destroy(_agg_fn_ctxs[i], null_data_ptr + _agg_states_offsets[i]);
-                }
+                _destroy_state(null_data_ptr);
             }
             auto it = _state_allocator.begin();
             auto end = _state_allocator.end();
 
             while (it != end) {
-                for (int i = 0; i < _agg_functions.size(); i++) {
-                    _agg_functions[i]->destroy(_agg_fn_ctxs[i], it.value() + _agg_states_offsets[i]);
-                }
+                _destroy_state(it.value());
                 it.next();
             }
         }
@@ -31,6 +31,7 @@
 #include "common/statusor.h"
 #include "exec/aggregate/agg_hash_variant.h"
 #include "exec/aggregate/agg_profile.h"
+#include "exec/aggregate/columnar_agg_states.h"
 #include "exec/chunk_buffer_memory_manager.h"
 #include "exec/pipeline/context_with_dependency.h"
 #include "exec/pipeline/spill_process_channel.h"
@@ -287,7 +288,9 @@ public:
     AggrPhase get_aggr_phase() { return _aggr_phase; }
 
     bool is_hash_set() const { return _is_only_group_by_columns; }
-    const int64_t hash_map_memory_usage() const { return _hash_map_variant.reserved_memory_usage(mem_pool()); }
+    const int64_t hash_map_memory_usage() const {
+        return _hash_map_variant.reserved_memory_usage(mem_pool()) + _columnar_states.memory_usage();
+    }
     const int64_t hash_set_memory_usage() const { return _hash_set_variant.reserved_memory_usage(mem_pool()); }
 
     const int64_t memory_usage() const {
@@ -464,6 +467,16 @@ protected:
     std::vector<bool> _is_merge_funcs;
     // In order batch update agg states
     Buffer<AggDataPtr> _tmp_agg_states;
+
+    // Whether the states of the simple aggregate functions could be kept in columns, see ColumnarAggStates.
+    // The subclasses accessing the states through _agg_states_offsets turn it off.
+    bool _enable_columnar_states = true;
+    ColumnarAggStates _columnar_states;
+    // The offset of the group id in a row of aggregate functions, if _columnar_states is not empty.
+    size_t _group_id_offset = 0;
+    // The group ids of the rows of _tmp_agg_states
+    Buffer<uint32_t> _tmp_group_ids;
+    Buffer<AggDataPtr> _tmp_columnar_agg_states;
     std::vector<AggFunctionTypes> _agg_fn_types;
 
     // Exprs used to evaluate conjunct
@@ -545,6 +558,22 @@ protected:
     void _finalize_to_chunk(ConstAggDataPtr __restrict state, const Columns& agg_result_columns);
     void _destroy_state(AggDataPtr __restrict state);
 
+    void _init_columnar_states();
+    void _compute_columnar_agg_states(size_t i, size_t chunk_size, bool use_intermediate);
+    // Read the group ids of the first |chunk_size| rows of _tmp_agg_states into _tmp_group_ids,
+    // the rows not selected go to ColumnarAggStates::kDiscardGroupId.
+    void _gather_group_ids(size_t chunk_size, const std::vector<uint8_t>* selection);
+    // The columnar states of the i-th aggregate function of the groups in _tmp_group_ids.
+    const Buffer<AggDataPtr>& _columnar_agg_states(size_t i, size_t num_groups);
+
+    // The state of the i-th aggregate function in the group of |row|.
+    ConstAggDataPtr _agg_state(ConstAggDataPtr __restrict row, size_t i) const {
+        if (_columnar_states.contains(i)) {
+            return _columnar_states.state(i, *reinterpret_cast<const uint32_t*>(row + _group_id_offset));
+        }
+        return row + _agg_states_offsets[i];
+    }
+
     ChunkPtr _build_output_chunk(const Columns& group_by_columns, const Columns& agg_result_columns,
                                  bool use_intermediate);
 
@@ -572,19 +601,35 @@ template <class HashMapWithKey>
 inline AggDataPtr AllocateState<HashMapWithKey>::operator()(const typename HashMapWithKey::KeyType& key) {
     AggDataPtr agg_state = aggregator->_state_allocator.allocate();
     *reinterpret_cast<typename HashMapWithKey::KeyType*>(agg_state) = key;
+    auto& columnar_states = aggregator->_columnar_states;
+    if (!columnar_states.empty()) {
+        try {
+            *reinterpret_cast<uint32_t*>(agg_state + aggregator->_group_id_offset) = columnar_states.allocate();
+        } catch (std::bad_alloc& e) {
+            aggregator->_state_allocator.rollback();
+            throw;
+        }
+    }
     size_t created = 0;
     size_t aggregate_function_sz = aggregator->_agg_fn_ctxs.size();
     try {
         for (int i = 0; i < aggregate_function_sz; i++) {
-            aggregator->_agg_functions[i]->create(aggregator->_agg_fn_ctxs[i],
-                                                  agg_state + aggregator->_agg_states_offsets[i]);
+            if (!columnar_states.contains(i)) {
+                aggregator->_agg_functions[i]->create(aggregator->_agg_fn_ctxs[i],
+                                                      agg_state + aggregator->_agg_states_offsets[i]);
+            }
             created++;
         }
         return agg_state;
     } catch (std::bad_alloc& e) {
         for (size_t i = 0; i < created; ++i) {
-            aggregator->_agg_functions[i]->destroy(aggregator->_agg_fn_ctxs[i],
-                                                   agg_state + aggregator->_agg_states_offsets[i]);
+            if (!columnar_states.contains(i)) {
+                aggregator->_agg_functions[i]->destroy(aggregator->_agg_fn_ctxs[i],
+                                                       agg_state + aggregator->_agg_states_offsets[i]);
+            }
+        }
+        if (!columnar_states.empty()) {
+            columnar_states.rollback();
         }
         aggregator->_state_allocator.rollback();
         throw;
@@ -594,19 +639,30 @@ inline AggDataPtr AllocateState<HashMapWithKey>::operator()(const typename HashM
 template <class HashMapWithKey>
 inline AggDataPtr AllocateState<HashMapWithKey>::operator()(std::nullptr_t) {
     AggDataPtr agg_state = aggregator->_state_allocator.allocate_null_key_data();
+    auto& columnar_states = aggregator->_columnar_states;
+    if (!columnar_states.empty()) {
+        *reinterpret_cast<uint32_t*>(agg_state + aggregator->_group_id_offset) = columnar_states.allocate();
+    }
     size_t created = 0;
     size_t aggregate_function_sz = aggregator->_agg_fn_ctxs.size();
     try {
         for (int i = 0; i < aggregate_function_sz; i++) {
-            aggregator->_agg_functions[i]->create(aggregator->_agg_fn_ctxs[i],
-                                                  agg_state + aggregator->_agg_states_offsets[i]);
+            if (!columnar_states.contains(i)) {
+                aggregator->_agg_functions[i]->create(aggregator->_agg_fn_ctxs[i],
+                                                      agg_state + aggregator->_agg_states_offsets[i]);
+            }
             created++;
         }
         return agg_state;
     } catch (std::bad_alloc& e) {
         for (int i = 0; i < created; i++) {
-            aggregator->_agg_functions[i]->destroy(aggregator->_agg_fn_ctxs[i],
-                                                   agg_state + aggregator->_agg_states_offsets[i]);
+            if (!columnar_states.contains(i)) {
+                aggregator->_agg_functions[i]->destroy(aggregator->_agg_fn_ctxs[i],
+                                                       agg_state + aggregator->_agg_states_offsets[i]);
+            }
+        }
+        if (!columnar_states.empty()) {
+            columnar_states.rollback();
         }
         throw;
     }
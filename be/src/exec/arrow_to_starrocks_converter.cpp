@@ -78,6 +78,16 @@ size_t fill_null_column(const arrow::Array* array, size_t array_start_idx, size_
                         size_t column_start_idx) {
     null_column->resize(null_column->size() + num_elements);
     auto* null_data = (&null_column->get_data().front()) + column_start_idx;
+    // the null count of the whole array is cached by arrow, skip the per-row check if there is no null or all
+    // values are null.
+    if (array->null_count() == 0) {
+        memset(null_data, 0, num_elements);
+        return 0;
+    }
+    if (array->null_count() == array->length()) {
+        memset(null_data, 1, num_elements);
+        return num_elements;
+    }
     size_t null_count = 0;
     for (size_t i = 0; i < num_elements; ++i) {
         auto is_null = array->IsNull(array_start_idx + i);
@@ -26,11 +26,13 @@ struct ChunksSorterFullSortProfiler {
             : profile(runtime_profile) {
         input_required_memory = ADD_COUNTER(profile, "InputRequiredMemory", TUnit::BYTES);
         num_sorted_runs = ADD_COUNTER(profile, "NumSortedRuns", TUnit::UNIT);
+        num_radix_sorted_runs = ADD_COUNTER(profile, "NumRadixSortedRuns", TUnit::UNIT);
     }
 
     RuntimeProfile* profile{};
     RuntimeProfile::Counter* input_required_memory = nullptr;
     RuntimeProfile::Counter* num_sorted_runs = nullptr;
+    RuntimeProfile::Counter* num_radix_sorted_runs = nullptr;
 };
 class ChunksSorterFullSort : public ChunksSorter {
 public:
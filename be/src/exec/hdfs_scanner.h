@@ -196,6 +196,10 @@ struct HdfsScannerParams {
 
     const TupleDescriptor* min_max_tuple_desc = nullptr;
 
+    // limit of the scan node, -1 means no limit. It is only valid when
+    // the scanner can apply all conjuncts and runtime filters by itself.
+    int64_t read_limit = -1;
+
     std::vector<std::string>* hive_column_names = nullptr;
 
     bool case_sensitive = false;
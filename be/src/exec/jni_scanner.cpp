@@ -14,12 +14,27 @@
 
 #include "exec/jni_scanner.h"
 
+#include <algorithm>
+#include <arrow/array.h>
+#include <arrow/c/abi.h>
+#include <arrow/c/bridge.h>
+
 #include "column/array_column.h"
+#include "column/column_helper.h"
 #include "column/map_column.h"
 #include "column/struct_column.h"
 #include "column/type_traits.h"
+#include "common/config.h"
+#include "exec/parquet_scanner.h"
+#include "exprs/column_ref.h"
+#include "exprs/in_const_predicate.hpp"
 #include "fmt/core.h"
+#include "runtime/current_thread.h"
+#include "runtime/exec_env.h"
+#include "simd/simd.h"
+#include "storage/chunk_helper.h"
 #include "udf/java/java_udf.h"
+#include "util/arrow/utils.h"
 #include "util/defer_op.h"
 
 namespace starrocks {
@@ -43,7 +58,16 @@ Status JniScanner::do_init(RuntimeState* runtime_state, const HdfsScannerParams&
 Status JniScanner::do_open(RuntimeState* state) {
     SCOPED_RAW_TIMER(&_app_stats.reader_init_ns);
     JNIEnv* env = JVMFunctionHelper::getInstance().getEnv();
+    // decide before the params are updated and passed to java, both sides must use the same path.
+    auto it = _jni_scanner_params.find("use_arrow_c_data");
+    if (it != _jni_scanner_params.end() && it->second == "true" && !_can_import_arrow_c_data()) {
+        it->second = "false";
+    }
+    _use_arrow_c_data = it != _jni_scanner_params.end() && it->second == "true";
     update_jni_scanner_params();
+    if (config::jni_scanner_prefetch_chunk_num > 0 && ExecEnv::GetInstance()->jni_scanner_prefetch_pool() != nullptr) {
+        _prefetch_capacity = config::jni_scanner_prefetch_chunk_num;
+    }
     if (env->EnsureLocalCapacity(_jni_scanner_params.size() * 2 + 6) < 0) {
         RETURN_IF_ERROR(_check_jni_exception(env, "Failed to ensure the local capacity."));
     }
@@ -55,16 +79,20 @@ Status JniScanner::do_open(RuntimeState* state) {
 }
 
 void JniScanner::do_close(RuntimeState* runtime_state) noexcept {
+    _stop_prefetch();
+    if (_jni_scanner_obj == nullptr && _jni_scanner_cls == nullptr) {
+        return;
+    }
     JNIEnv* env = JVMFunctionHelper::getInstance().getEnv();
     if (_jni_scanner_obj != nullptr) {
         if (_jni_scanner_close != nullptr) {
             env->CallVoidMethod(_jni_scanner_obj, _jni_scanner_close);
         }
-        env->DeleteLocalRef(_jni_scanner_obj);
+        env->DeleteGlobalRef(_jni_scanner_obj);
         _jni_scanner_obj = nullptr;
     }
     if (_jni_scanner_cls != nullptr) {
-        env->DeleteLocalRef(_jni_scanner_cls);
+        env->DeleteGlobalRef(_jni_scanner_cls);
         _jni_scanner_cls = nullptr;
     }
 }
@@ -85,6 +113,11 @@ Status JniScanner::_init_jni_method(JNIEnv* env) {
 
     _jni_scanner_release_table = env->GetMethodID(_jni_scanner_cls, "releaseOffHeapTable", "()V");
     RETURN_IF_ERROR(_check_jni_exception(env, "Failed to get `releaseOffHeapTable` jni method"));
+
+    if (_use_arrow_c_data) {
+        _jni_scanner_get_next_arrow_batch = env->GetMethodID(_jni_scanner_cls, "getNextArrowBatch", "(JJ)I");
+        RETURN_IF_ERROR(_check_jni_exception(env, "Failed to get `getNextArrowBatch` jni method"));
+    }
     return Status::OK();
 }
 
@@ -93,8 +126,12 @@ Status JniScanner::_init_jni_table_scanner(JNIEnv* env, RuntimeState* runtime_st
     jmethodID scanner_factory_constructor = env->GetMethodID(scanner_factory_class, "<init>", "()V");
     jobject scanner_factory_obj = env->NewObject(scanner_factory_class, scanner_factory_constructor);
     jmethodID get_scanner_method = env->GetMethodID(scanner_factory_class, "getScannerClass", "()Ljava/lang/Class;");
-    _jni_scanner_cls = (jclass)env->CallObjectMethod(scanner_factory_obj, get_scanner_method);
+    auto scanner_cls = (jclass)env->CallObjectMethod(scanner_factory_obj, get_scanner_method);
     RETURN_IF_ERROR(_check_jni_exception(env, "Failed to init the scanner class."));
+    // scanner class and object are global refs, because they may be used by
+    // other threads(io threads or prefetch threads) than the one creating them.
+    _jni_scanner_cls = (jclass)env->NewGlobalRef(scanner_cls);
+    env->DeleteLocalRef(scanner_cls);
     env->DeleteLocalRef(scanner_factory_class);
     env->DeleteLocalRef(scanner_factory_obj);
 
@@ -128,18 +165,20 @@ Status JniScanner::_init_jni_table_scanner(JNIEnv* env, RuntimeState* runtime_st
     LOG(INFO) << message;
 
     int fetch_size = runtime_state->chunk_size();
-    _jni_scanner_obj = env->NewObject(_jni_scanner_cls, scanner_constructor, fetch_size, hashmap_object);
+    jobject scanner_obj = env->NewObject(_jni_scanner_cls, scanner_constructor, fetch_size, hashmap_object);
     env->DeleteLocalRef(hashmap_object);
-    DCHECK(_jni_scanner_obj != nullptr);
+    DCHECK(scanner_obj != nullptr);
     RETURN_IF_ERROR(_check_jni_exception(env, "Failed to initialize a scanner instance."));
+    _jni_scanner_obj = env->NewGlobalRef(scanner_obj);
+    env->DeleteLocalRef(scanner_obj);
 
     return Status::OK();
 }
 
-Status JniScanner::_get_next_chunk(JNIEnv* env, long* chunk_meta) {
-    SCOPED_RAW_TIMER(&_app_stats.column_read_ns);
-    SCOPED_RAW_TIMER(&_app_stats.io_ns);
-    _app_stats.io_count += 1;
+Status JniScanner::_get_next_chunk(JNIEnv* env, long* chunk_meta, HdfsScanStats* stats) {
+    SCOPED_RAW_TIMER(&stats->column_read_ns);
+    SCOPED_RAW_TIMER(&stats->io_ns);
+    stats->io_count += 1;
     *chunk_meta = env->CallLongMethod(_jni_scanner_obj, _jni_scanner_get_next_chunk);
     RETURN_IF_ERROR(_check_jni_exception(env, "Failed to call the nextChunkOffHeap method of off-heap table scanner."));
     return Status::OK();
@@ -338,14 +377,15 @@ Status JniScanner::_fill_column(FillColumnArgs* pargs) {
     return Status::OK();
 }
 
-Status JniScanner::_fill_chunk(JNIEnv* env, ChunkPtr* chunk, const std::vector<SlotDescriptor*>& slot_desc_list) {
-    SCOPED_RAW_TIMER(&_app_stats.column_convert_ns);
+Status JniScanner::_fill_chunk(JNIEnv* env, ChunkPtr* chunk, const std::vector<SlotDescriptor*>& slot_desc_list,
+                               HdfsScanStats* stats) {
+    SCOPED_RAW_TIMER(&stats->column_convert_ns);
 
     long num_rows = next_chunk_meta_as_long();
     if (num_rows == 0) {
         return Status::EndOfFile("");
     }
-    _app_stats.raw_rows_read += num_rows;
+    stats->raw_rows_read += num_rows;
 
     for (size_t col_idx = 0; col_idx < slot_desc_list.size(); col_idx++) {
         SlotDescriptor* slot_desc = slot_desc_list[col_idx];
@@ -387,12 +427,277 @@ Status JniScanner::do_get_next(RuntimeState* runtime_state, ChunkPtr* chunk) {
     return status;
 }
 
+static bool is_arrow_c_data_importable(const TypeDescriptor& type) {
+    switch (type.type) {
+    case TYPE_BOOLEAN:
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_FLOAT:
+    case TYPE_DOUBLE:
+    case TYPE_CHAR:
+    case TYPE_VARCHAR:
+    case TYPE_VARBINARY:
+    case TYPE_DATE:
+    case TYPE_DATETIME:
+    case TYPE_DECIMALV2:
+    case TYPE_DECIMAL32:
+    case TYPE_DECIMAL64:
+    case TYPE_DECIMAL128:
+        return true;
+    case TYPE_ARRAY:
+    case TYPE_MAP:
+    case TYPE_STRUCT:
+        return std::all_of(type.children.begin(), type.children.end(), is_arrow_c_data_importable);
+    default:
+        return false;
+    }
+}
+
+bool JniScanner::_can_import_arrow_c_data() const {
+    for (const auto& column : _scanner_ctx.materialized_columns) {
+        if (!is_arrow_c_data_importable(column.slot_type())) {
+            VLOG_FILE << "Column " << column.name() << " of type " << column.slot_type().debug_string()
+                      << " can not be imported from arrow, use the off-heap table instead.";
+            return false;
+        }
+    }
+    return true;
+}
+
+Status JniScanner::_get_next_arrow_batch(JNIEnv* env, std::shared_ptr<arrow::RecordBatch>* batch,
+                                         HdfsScanStats* stats) {
+    SCOPED_RAW_TIMER(&stats->column_read_ns);
+    SCOPED_RAW_TIMER(&stats->io_ns);
+    stats->io_count += 1;
+
+    struct ArrowArray c_array;
+    struct ArrowSchema c_schema;
+    c_array.release = nullptr;
+    c_schema.release = nullptr;
+    jint num_rows = env->CallIntMethod(_jni_scanner_obj, _jni_scanner_get_next_arrow_batch,
+                                       reinterpret_cast<jlong>(&c_array), reinterpret_cast<jlong>(&c_schema));
+    Status status = _check_jni_exception(env, "Failed to call the getNextArrowBatch method of off-heap table scanner.");
+    if (!status.ok() || num_rows == 0) {
+        // nothing is imported, so the exported structs (if any) must be released by us.
+        if (c_array.release != nullptr) {
+            c_array.release(&c_array);
+        }
+        if (c_schema.release != nullptr) {
+            c_schema.release(&c_schema);
+        }
+        return status.ok() ? Status::EndOfFile("") : status;
+    }
+
+    // ImportRecordBatch moves both structs, and releases them even if it fails. The
+    // java buffers are kept alive until the last reference to the record batch is dropped.
+    auto result = arrow::ImportRecordBatch(&c_array, &c_schema);
+    if (!result.ok()) {
+        return to_status(result.status());
+    }
+    *batch = std::move(result).ValueOrDie();
+    return Status::OK();
+}
+
+Status JniScanner::_init_arrow_converters(const arrow::Schema& schema,
+                                          const std::vector<SlotDescriptor*>& slot_desc_list) {
+    _arrow_conv_ctx.state = _runtime_state;
+    _arrow_field_indexes.resize(slot_desc_list.size());
+    _arrow_conv_funcs.resize(slot_desc_list.size());
+    _arrow_cast_exprs.resize(slot_desc_list.size());
+    _arrow_raw_columns.resize(slot_desc_list.size());
+    for (size_t i = 0; i < slot_desc_list.size(); i++) {
+        SlotDescriptor* slot_desc = slot_desc_list[i];
+        int field_index = schema.GetFieldIndex(slot_desc->col_name());
+        _arrow_field_indexes[i] = field_index;
+        if (field_index < 0) {
+            // only the materialized columns are exported, the partition columns and the columns
+            // not existed in the table are filled by the scanner context after the chunk is read.
+            continue;
+        }
+        _arrow_conv_funcs[i] = std::make_unique<ConvertFuncTree>();
+        RETURN_IF_ERROR(ParquetScanner::new_column(schema.field(field_index)->type().get(), slot_desc,
+                                                   &_arrow_raw_columns[i], _arrow_conv_funcs[i].get(),
+                                                   &_arrow_cast_exprs[i], _arrow_pool, false));
+    }
+    _arrow_converters_initialized = true;
+    return Status::OK();
+}
+
+Status JniScanner::_fill_chunk_from_arrow(JNIEnv* env, ChunkPtr* chunk,
+                                          const std::vector<SlotDescriptor*>& slot_desc_list, HdfsScanStats* stats) {
+    std::shared_ptr<arrow::RecordBatch> batch;
+    RETURN_IF_ERROR(_get_next_arrow_batch(env, &batch, stats));
+
+    SCOPED_RAW_TIMER(&stats->column_convert_ns);
+    if (!_arrow_converters_initialized) {
+        RETURN_IF_ERROR(_init_arrow_converters(*batch->schema(), slot_desc_list));
+    }
+
+    size_t num_rows = batch->num_rows();
+    stats->raw_rows_read += num_rows;
+    Filter chunk_filter(num_rows, 1);
+    const std::string& time_zone = _jni_scanner_params["time_zone"];
+    for (size_t col_idx = 0; col_idx < slot_desc_list.size(); col_idx++) {
+        SlotDescriptor* slot_desc = slot_desc_list[col_idx];
+        ColumnPtr& column = (*chunk)->get_column_by_slot_id(slot_desc->id());
+        if (_arrow_field_indexes[col_idx] < 0) {
+            column->append_default(num_rows);
+            continue;
+        }
+        _arrow_conv_ctx.current_slot = slot_desc;
+        std::shared_ptr<arrow::Array> column_array = batch->column(_arrow_field_indexes[col_idx]);
+        // the converters would drop the null rows of a NOT NULL column, fail like the off-heap path instead.
+        if (!slot_desc->is_nullable() && column_array->null_count() > 0) {
+            return Status::DataQualityError(
+                    fmt::format("NOT NULL column[{}] has null values.", slot_desc->col_name()));
+        }
+        // same as the off-heap path, datetime values are interpreted in the time zone of the table.
+        // the batch schema may be shared, so rebind the buffers to a new type instead of mutating it.
+        if (column_array->type_id() == ArrowTypeId::TIMESTAMP && !time_zone.empty()) {
+            const auto* timestamp_type = down_cast<const arrow::TimestampType*>(column_array->type().get());
+            auto array_data = column_array->data()->Copy();
+            array_data->type = arrow::timestamp(timestamp_type->unit(), time_zone);
+            column_array = arrow::MakeArray(array_data);
+        }
+        const arrow::Array* array = column_array.get();
+
+        Expr* cast_expr = _arrow_cast_exprs[col_idx];
+        if (cast_expr->is_slotref()) {
+            RETURN_IF_ERROR(ParquetScanner::convert_array_to_column(_arrow_conv_funcs[col_idx].get(), num_rows, array,
+                                                                    column, 0, 0, &chunk_filter, &_arrow_conv_ctx));
+            continue;
+        }
+        // the arrow type can only be converted to a strict type, cast it to the slot type afterwards.
+        ColumnPtr raw_column = _arrow_raw_columns[col_idx]->clone_empty();
+        RETURN_IF_ERROR(ParquetScanner::convert_array_to_column(_arrow_conv_funcs[col_idx].get(), num_rows, array,
+                                                                raw_column, 0, 0, &chunk_filter, &_arrow_conv_ctx));
+        Chunk raw_chunk;
+        raw_chunk.append_column(raw_column, slot_desc->id());
+        ASSIGN_OR_RETURN(auto cast_column, cast_expr->evaluate_checked(nullptr, &raw_chunk));
+        cast_column = ColumnHelper::unfold_const_column(slot_desc->type(), num_rows, cast_column);
+        column->append(*cast_column, 0, num_rows);
+    }
+    // the converters reset the filter for the values they can not convert, e.g. too long strings.
+    if (SIMD::count_zero(chunk_filter.data(), num_rows) > 0) {
+        (*chunk)->filter(chunk_filter);
+    }
+    return Status::OK();
+}
+
 Status JniScanner::fill_empty_chunk(ChunkPtr* chunk, const std::vector<SlotDescriptor*>& slot_desc_list) {
+    if (_prefetch_capacity > 0) {
+        return _fill_chunk_from_prefetch(chunk, slot_desc_list);
+    }
+    return _fill_chunk_sync(chunk, slot_desc_list, &_app_stats);
+}
+
+bool JniScanner::_try_submit_prefetch_task(const std::vector<SlotDescriptor*>* slot_desc_list) {
+    if (_prefetch_running || _prefetch_finished || _prefetch_stopped ||
+        _prefetched_chunks.size() >= _prefetch_capacity) {
+        return _prefetch_running;
+    }
+    Status st = ExecEnv::GetInstance()->jni_scanner_prefetch_pool()->submit_func(
+            [this, slot_desc_list]() { _prefetch_task(slot_desc_list); });
+    if (!st.ok()) {
+        LOG(WARNING) << "Failed to submit jni scanner prefetch task, read synchronously. " << st;
+        return false;
+    }
+    _prefetch_running = true;
+    return true;
+}
+
+void JniScanner::_prefetch_task(const std::vector<SlotDescriptor*>* slot_desc_list) {
+    // the memory of prefetched chunks is charged to the fragment instance (and so the query).
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_runtime_state->instance_mem_tracker());
+    while (true) {
+        {
+            std::lock_guard<std::mutex> l(_prefetch_mutex);
+            if (_prefetch_stopped || _prefetched_chunks.size() >= _prefetch_capacity) {
+                _prefetch_running = false;
+                _prefetch_cv.notify_all();
+                return;
+            }
+        }
+
+        ChunkPtr chunk = ChunkHelper::new_chunk(*slot_desc_list, _runtime_state->chunk_size());
+        HdfsScanStats stats;
+        Status st;
+        if (_runtime_state->is_cancelled()) {
+            st = Status::Cancelled("Cancelled");
+        } else {
+            st = _fill_chunk_sync(&chunk, *slot_desc_list, &stats);
+        }
+
+        std::lock_guard<std::mutex> l(_prefetch_mutex);
+        _prefetched_chunks.push_back({st, std::move(chunk), stats});
+        if (!st.ok()) {
+            // end of file or error, no more chunk would be produced.
+            _prefetch_finished = true;
+            _prefetch_running = false;
+            _prefetch_cv.notify_all();
+            return;
+        }
+        _prefetch_cv.notify_all();
+    }
+}
+
+// The io time of the prefetch task is not merged, see _fill_chunk_from_prefetch().
+static void merge_prefetch_stats(const HdfsScanStats& from, HdfsScanStats* to) {
+    to->raw_rows_read += from.raw_rows_read;
+    to->io_count += from.io_count;
+    to->column_read_ns += from.column_read_ns;
+    to->column_convert_ns += from.column_convert_ns;
+}
+
+Status JniScanner::_fill_chunk_from_prefetch(ChunkPtr* chunk, const std::vector<SlotDescriptor*>& slot_desc_list) {
+    Status status;
+    ChunkPtr prefetched;
+    {
+        std::unique_lock<std::mutex> l(_prefetch_mutex);
+        while (_prefetched_chunks.empty()) {
+            if (!_try_submit_prefetch_task(&slot_desc_list)) {
+                l.unlock();
+                return _fill_chunk_sync(chunk, slot_desc_list, &_app_stats);
+            }
+            // only the time waiting for the prefetch task is the io time of this scanner.
+            SCOPED_RAW_TIMER(&_app_stats.io_ns);
+            _prefetch_cv.wait(l, [this] { return !_prefetched_chunks.empty() || !_prefetch_running; });
+        }
+        auto& front = _prefetched_chunks.front();
+        status = front.status;
+        prefetched = std::move(front.chunk);
+        merge_prefetch_stats(front.stats, &_app_stats);
+        _prefetched_chunks.pop_front();
+        // keep the pipeline full while the caller is processing this chunk.
+        (void)_try_submit_prefetch_task(&slot_desc_list);
+    }
+
+    for (SlotDescriptor* slot_desc : slot_desc_list) {
+        (*chunk)->get_column_by_slot_id(slot_desc->id())
+                ->swap_column(*prefetched->get_column_by_slot_id(slot_desc->id()));
+    }
+    return status;
+}
+
+void JniScanner::_stop_prefetch() {
+    std::unique_lock<std::mutex> l(_prefetch_mutex);
+    _prefetch_stopped = true;
+    _prefetch_cv.wait(l, [this] { return !_prefetch_running; });
+    _prefetched_chunks.clear();
+}
+
+Status JniScanner::_fill_chunk_sync(ChunkPtr* chunk, const std::vector<SlotDescriptor*>& slot_desc_list,
+                                    HdfsScanStats* stats) {
     JNIEnv* env = JVMFunctionHelper::getInstance().getEnv();
+    if (_use_arrow_c_data) {
+        return _fill_chunk_from_arrow(env, chunk, slot_desc_list, stats);
+    }
     long chunk_meta;
-    RETURN_IF_ERROR(_get_next_chunk(env, &chunk_meta));
+    RETURN_IF_ERROR(_get_next_chunk(env, &chunk_meta, stats));
     reset_chunk_meta(chunk_meta);
-    Status status = _fill_chunk(env, chunk, slot_desc_list);
+    Status status = _fill_chunk(env, chunk, slot_desc_list, stats);
     RETURN_IF_ERROR(_release_off_heap_table(env));
 
     return status;
@@ -611,6 +916,250 @@ std::unique_ptr<JniScanner> create_hudi_jni_scanner(const JniScanner::CreateOpti
 }
 
 // ---------------odps jni scanner------------------
+
+// Single-slot conjuncts which can be evaluated by the odps reader are passed through the
+// `reader_predicates` param, so rows rejected by them are not copied to the off-heap table
+// and never cross JNI. This is not a storage pushdown: the read session is built by FE with
+// odps-sdk-table-api 0.45.5-public, whose TableReadSessionBuilder takes no filter, so the
+// odps service still sends every row of the split and the reader filters the arrow batches.
+// Every predicate is `column KV op [KV value]...`, and predicates are separated by
+// PROP_SEPARATOR, see OdpsPredicate.java for the reader side.
+// BE still evaluates these conjuncts: a varchar slot may come from an odps column which
+// the reader can not compare (e.g. JSON), and the reader skips such predicates.
+class OdpsJniScanner final : public JniScanner {
+public:
+    OdpsJniScanner(std::string factory_class, std::map<std::string, std::string> params)
+            : JniScanner(std::move(factory_class), std::move(params)) {}
+    void update_jni_scanner_params() override;
+
+private:
+    static constexpr char KV_SEPARATOR = 0x1;
+    static constexpr char PROP_SEPARATOR = 0x2;
+
+    static bool _is_reader_comparable_type(LogicalType type);
+    static bool _append_literal(LogicalType type, const Datum& datum, std::string* out);
+    static bool _serialize_conjunct(ExprContext* ctx, const SlotDescriptor* slot, std::string* out);
+    template <LogicalType LT>
+    static bool _serialize_in_values(const Expr* pred, std::string* out);
+};
+
+bool OdpsJniScanner::_is_reader_comparable_type(LogicalType type) {
+    // float/double and datetime are excluded, their text form or time zone
+    // handling may differ between BE and the reader.
+    switch (type) {
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_DATE:
+    case TYPE_VARCHAR:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool OdpsJniScanner::_append_literal(LogicalType type, const Datum& datum, std::string* out) {
+    if (datum.is_null()) {
+        return false;
+    }
+    out->push_back(KV_SEPARATOR);
+    switch (type) {
+    case TYPE_TINYINT:
+        out->append(std::to_string(datum.get_int8()));
+        return true;
+    case TYPE_SMALLINT:
+        out->append(std::to_string(datum.get_int16()));
+        return true;
+    case TYPE_INT:
+        out->append(std::to_string(datum.get_int32()));
+        return true;
+    case TYPE_BIGINT:
+        out->append(std::to_string(datum.get_int64()));
+        return true;
+    case TYPE_DATE:
+        out->append(datum.get_date().to_string());
+        return true;
+    case TYPE_VARCHAR: {
+        const Slice& value = datum.get_slice();
+        // params are passed to java as modified UTF-8, which can not represent `\0` and
+        // 4-byte sequences as is. Separators in the value would break the format.
+        for (size_t i = 0; i < value.size; i++) {
+            auto c = static_cast<uint8_t>(value.data[i]);
+            if (c == 0 || c == KV_SEPARATOR || c == PROP_SEPARATOR || c >= 0xF0) {
+                return false;
+            }
+        }
+        out->append(value.data, value.size);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+template <LogicalType LT>
+bool OdpsJniScanner::_serialize_in_values(const Expr* pred, std::string* out) {
+    const auto* in_pred = down_cast<const VectorizedInConstPredicate<LT>*>(pred);
+    if (in_pred->null_in_set()) {
+        return false;
+    }
+    out->append(in_pred->is_not_in() ? "not_in" : "in");
+    for (const auto& v : in_pred->hash_set()) {
+        if (!_append_literal(LT, Datum(v), out)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool OdpsJniScanner::_serialize_conjunct(ExprContext* ctx, const SlotDescriptor* slot, std::string* out) {
+    const Expr* root = ctx->root();
+    const LogicalType type = slot->type().type;
+    std::string result = slot->col_name();
+    result.push_back(KV_SEPARATOR);
+
+    if (root->node_type() == TExprNodeType::BINARY_PRED) {
+        const Expr* lhs = root->get_child(0);
+        const Expr* rhs = root->get_child(1);
+        TExprOpcode::type op = root->op();
+        if (rhs->node_type() == TExprNodeType::SLOT_REF) {
+            std::swap(lhs, rhs);
+            // `literal op column` => `column reversed-op literal`
+            switch (op) {
+            case TExprOpcode::LT:
+                op = TExprOpcode::GT;
+                break;
+            case TExprOpcode::LE:
+                op = TExprOpcode::GE;
+                break;
+            case TExprOpcode::GT:
+                op = TExprOpcode::LT;
+                break;
+            case TExprOpcode::GE:
+                op = TExprOpcode::LE;
+                break;
+            default:
+                break;
+            }
+        }
+        if (lhs->node_type() != TExprNodeType::SLOT_REF || !rhs->is_constant() || rhs->type().type != type) {
+            return false;
+        }
+        switch (op) {
+        case TExprOpcode::EQ:
+            result.append("eq");
+            break;
+        case TExprOpcode::NE:
+            result.append("ne");
+            break;
+        case TExprOpcode::LT:
+            result.append("lt");
+            break;
+        case TExprOpcode::LE:
+            result.append("le");
+            break;
+        case TExprOpcode::GT:
+            result.append("gt");
+            break;
+        case TExprOpcode::GE:
+            result.append("ge");
+            break;
+        default:
+            return false;
+        }
+        auto value = ctx->evaluate(const_cast<Expr*>(rhs), nullptr);
+        if (!value.ok() || value.value()->size() == 0 || !_append_literal(type, value.value()->get(0), &result)) {
+            return false;
+        }
+    } else if (root->node_type() == TExprNodeType::IN_PRED) {
+        if ((root->op() != TExprOpcode::FILTER_IN && root->op() != TExprOpcode::FILTER_NOT_IN) ||
+            root->get_child(0)->node_type() != TExprNodeType::SLOT_REF) {
+            return false;
+        }
+        bool ok = false;
+        switch (type) {
+        case TYPE_TINYINT:
+            ok = _serialize_in_values<TYPE_TINYINT>(root, &result);
+            break;
+        case TYPE_SMALLINT:
+            ok = _serialize_in_values<TYPE_SMALLINT>(root, &result);
+            break;
+        case TYPE_INT:
+            ok = _serialize_in_values<TYPE_INT>(root, &result);
+            break;
+        case TYPE_BIGINT:
+            ok = _serialize_in_values<TYPE_BIGINT>(root, &result);
+            break;
+        case TYPE_DATE:
+            ok = _serialize_in_values<TYPE_DATE>(root, &result);
+            break;
+        case TYPE_VARCHAR:
+            ok = _serialize_in_values<TYPE_VARCHAR>(root, &result);
+            break;
+        default:
+            break;
+        }
+        if (!ok) {
+            return false;
+        }
+    } else if (root->node_type() == TExprNodeType::FUNCTION_CALL) {
+        const std::string& fname = root->fn().name.function_name;
+        if ((fname != "is_null_pred" && fname != "is_not_null_pred") ||
+            root->get_child(0)->node_type() != TExprNodeType::SLOT_REF) {
+            return false;
+        }
+        result.append(fname == "is_null_pred" ? "is_null" : "is_not_null");
+    } else {
+        return false;
+    }
+
+    if (!out->empty()) {
+        out->push_back(PROP_SEPARATOR);
+    }
+    out->append(result);
+    return true;
+}
+
+void OdpsJniScanner::update_jni_scanner_params() {
+    JniScanner::update_jni_scanner_params();
+    // the arrow batch is exported as a whole, so no predicate could be applied by the reader.
+    if (_jni_scanner_params["use_arrow_c_data"] == "true") {
+        return;
+    }
+
+    std::string reader_predicates;
+    bool all_filtered = _scanner_params.conjunct_ctxs.empty();
+    size_t num_filtered_slots = 0;
+    for (const auto& column : _scanner_ctx.materialized_columns) {
+        auto it = _scanner_ctx.conjunct_ctxs_by_slot.find(column.slot_id());
+        if (it == _scanner_ctx.conjunct_ctxs_by_slot.end()) {
+            continue;
+        }
+        if (!_is_reader_comparable_type(column.slot_type().type)) {
+            all_filtered = false;
+            continue;
+        }
+        bool slot_filtered = true;
+        for (ExprContext* ctx : it->second) {
+            slot_filtered &= _serialize_conjunct(ctx, column.slot_desc, &reader_predicates);
+        }
+        num_filtered_slots += slot_filtered;
+    }
+    if (num_filtered_slots != _scanner_ctx.conjunct_ctxs_by_slot.size()) {
+        all_filtered = false;
+    }
+    _jni_scanner_params["reader_predicates"] = reader_predicates;
+
+    // the limit can only be applied by the reader if it evaluates all filters. The reader ignores
+    // the limit if it skips any of the predicates.
+    const auto* runtime_filters = _scanner_params.runtime_filter_collector;
+    if (all_filtered && _scanner_params.read_limit >= 0 &&
+        (runtime_filters == nullptr || runtime_filters->size() == 0)) {
+        _jni_scanner_params["limit"] = std::to_string(_scanner_params.read_limit);
+    }
+}
+
 std::unique_ptr<JniScanner> create_odps_jni_scanner(const JniScanner::CreateOptions& options) {
     const auto& scan_range = *(options.scan_range);
     const auto* odps_table = dynamic_cast<const OdpsTableDescriptor*>(options.hive_table);
@@ -627,9 +1176,10 @@ std::unique_ptr<JniScanner> create_odps_jni_scanner(const JniScanner::CreateOpti
     jni_scanner_params["endpoint"] = aliyun_cloud_credential.endpoint;
     jni_scanner_params["access_id"] = aliyun_cloud_credential.access_key;
     jni_scanner_params["access_key"] = aliyun_cloud_credential.secret_key;
+    jni_scanner_params["use_arrow_c_data"] = config::enable_odps_arrow_c_data_import ? "true" : "false";
 
     std::string scanner_factory_class = "com/starrocks/odps/reader/OdpsSplitScannerFactory";
-    return std::make_unique<JniScanner>(scanner_factory_class, jni_scanner_params);
+    return std::make_unique<OdpsJniScanner>(scanner_factory_class, jni_scanner_params);
 }
 
 } // namespace starrocks
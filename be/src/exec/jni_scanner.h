@@ -14,9 +14,17 @@
 
 #pragma once
 
+#include <arrow/record_batch.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
 #include "column/chunk.h"
 #include "common/logging.h"
+#include "common/object_pool.h"
 #include "common/status.h"
+#include "exec/arrow_to_starrocks_converter.h"
 #include "hdfs_scanner.h"
 #include "jni.h"
 #include "runtime/runtime_state.h"
@@ -48,6 +56,7 @@ protected:
     Status fill_empty_chunk(ChunkPtr* chunk, const std::vector<SlotDescriptor*>& slot_desc_list);
 
     Filter _chunk_filter;
+    std::map<std::string, std::string> _jni_scanner_params;
 
 private:
     struct FillColumnArgs {
@@ -66,7 +75,7 @@ private:
 
     Status _init_jni_method(JNIEnv* env);
 
-    Status _get_next_chunk(JNIEnv* env, long* chunk_meta);
+    Status _get_next_chunk(JNIEnv* env, long* chunk_meta, HdfsScanStats* stats);
 
     template <LogicalType type>
     Status _append_primitive_data(const FillColumnArgs& args);
@@ -81,10 +90,39 @@ private:
     Status _fill_column(FillColumnArgs* args);
 
     // fill chunk according to slot_desc_list(with or without partition columns)
-    Status _fill_chunk(JNIEnv* env, ChunkPtr* chunk, const std::vector<SlotDescriptor*>& slot_desc_list);
+    Status _fill_chunk(JNIEnv* env, ChunkPtr* chunk, const std::vector<SlotDescriptor*>& slot_desc_list,
+                       HdfsScanStats* stats);
 
     Status _release_off_heap_table(JNIEnv* env);
 
+    // Arrow C Data Interface path: the Java scanner exports a whole batch through
+    // `ArrowArray`/`ArrowSchema`, and BE converts the exported buffers straight into
+    // columns, which skips the per-value copy into the Java off-heap table.
+    // The scanner falls back to the off-heap table if any of the materialized columns has a type
+    // that the arrow converters may not handle, see _can_import_arrow_c_data().
+    bool _can_import_arrow_c_data() const;
+    Status _get_next_arrow_batch(JNIEnv* env, std::shared_ptr<arrow::RecordBatch>* batch, HdfsScanStats* stats);
+    Status _init_arrow_converters(const arrow::Schema& schema, const std::vector<SlotDescriptor*>& slot_desc_list);
+    Status _fill_chunk_from_arrow(JNIEnv* env, ChunkPtr* chunk, const std::vector<SlotDescriptor*>& slot_desc_list,
+                                  HdfsScanStats* stats);
+
+    // read and fill one chunk in the current thread, the stats of the reading are added to `stats`.
+    // It is virtual so that the tests can fill chunks without the java scanner.
+    virtual Status _fill_chunk_sync(ChunkPtr* chunk, const std::vector<SlotDescriptor*>& slot_desc_list,
+                                    HdfsScanStats* stats);
+
+    // Prefetch: a task in the jni prefetch pool keeps up to `_prefetch_capacity` filled chunks
+    // ready, so that waiting for the java reader overlaps with the processing of previous chunks.
+    // The java scanner is not thread-safe, so at most one task per scanner is in flight.
+    // The task keeps the stats of each chunk apart from `_app_stats`, and they are merged by the
+    // scanner thread when it takes the chunk. The io time of the scanner is the time it waits for
+    // the prefetched chunks, rather than the io time of the task, which overlaps with the scan.
+    Status _fill_chunk_from_prefetch(ChunkPtr* chunk, const std::vector<SlotDescriptor*>& slot_desc_list);
+    void _prefetch_task(const std::vector<SlotDescriptor*>* slot_desc_list);
+    // must be called with `_prefetch_mutex` held.
+    bool _try_submit_prefetch_task(const std::vector<SlotDescriptor*>* slot_desc_list);
+    void _stop_prefetch();
+
     jclass _jni_scanner_cls = nullptr;
     jobject _jni_scanner_obj = nullptr;
     jmethodID _jni_scanner_open = nullptr;
@@ -92,10 +130,33 @@ private:
     jmethodID _jni_scanner_close = nullptr;
     jmethodID _jni_scanner_release_column = nullptr;
     jmethodID _jni_scanner_release_table = nullptr;
+    jmethodID _jni_scanner_get_next_arrow_batch = nullptr;
 
-    std::map<std::string, std::string> _jni_scanner_params;
     std::string _jni_scanner_factory_class;
 
+    bool _use_arrow_c_data = false;
+    bool _arrow_converters_initialized = false;
+    ObjectPool _arrow_pool;
+    ArrowConvertContext _arrow_conv_ctx;
+    // -1 if the slot is not exported by the java scanner, e.g. partition columns.
+    std::vector<int> _arrow_field_indexes;
+    std::vector<std::unique_ptr<ConvertFuncTree>> _arrow_conv_funcs;
+    std::vector<Expr*> _arrow_cast_exprs;
+    std::vector<ColumnPtr> _arrow_raw_columns;
+
+    size_t _prefetch_capacity = 0;
+    std::mutex _prefetch_mutex;
+    std::condition_variable _prefetch_cv;
+    struct PrefetchedChunk {
+        Status status;
+        ChunkPtr chunk;
+        HdfsScanStats stats;
+    };
+    std::deque<PrefetchedChunk> _prefetched_chunks;
+    bool _prefetch_running = false;
+    bool _prefetch_finished = false;
+    bool _prefetch_stopped = false;
+
     const std::set<std::string> _skipped_log_jni_scanner_params = {"native_table", "split_info", "predicate_info",
                                                                    "access_id",    "access_key", "read_session"};
 
@@ -0,0 +1,165 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/join_existence_table.h"
+
+#include "common/logging.h"
+
+namespace starrocks {
+
+void JoinExistenceTable::_hash(const Columns& key_columns, uint32_t row_count, Buffer<uint32_t>* hashes) {
+    hashes->assign(row_count, HASH_SEED);
+    for (const auto& column : key_columns) {
+        column->crc32_hash(hashes->data(), 0, row_count);
+    }
+}
+
+bool JoinExistenceTable::_equals(const Columns& key_columns, uint32_t row, uint32_t build_row) const {
+    for (size_t i = 0; i < key_columns.size(); i++) {
+        if (!_key_columns[i]->equals(build_row, *key_columns[i], row)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void JoinExistenceTable::_resize_slots(uint32_t slot_bits, const Buffer<uint32_t>& hashes) {
+    Buffer<uint32_t> old_slots;
+    old_slots.swap(_slots);
+    _slot_bits = slot_bits;
+    _slots.assign(1UL << slot_bits, 0);
+
+    const uint32_t mask = (1UL << slot_bits) - 1;
+    for (uint32_t build_row : old_slots) {
+        if (build_row != 0) {
+            uint32_t slot = _slot_hash(hashes[build_row]) >> (32 - _slot_bits);
+            while (_slots[slot] != 0) {
+                slot = (slot + 1) & mask;
+            }
+            _slots[slot] = build_row;
+        }
+    }
+}
+
+void JoinExistenceTable::_build_bloom(const Buffer<uint32_t>& hashes) {
+    size_t bloom_words = std::max<size_t>(1, static_cast<size_t>(_num_keys) * BLOOM_BITS_PER_KEY / 64);
+    _bloom_bits = 0;
+    while ((1UL << _bloom_bits) < bloom_words) {
+        _bloom_bits++;
+    }
+    _bloom.assign(1UL << _bloom_bits, 0);
+
+    for (uint32_t build_row : _slots) {
+        if (build_row != 0) {
+            uint32_t word = _bloom_bits == 0 ? 0 : _bloom_hash(hashes[build_row]) >> (32 - _bloom_bits);
+            _bloom[word] |= _bloom_mask(_slot_hash(hashes[build_row]));
+        }
+    }
+}
+
+void JoinExistenceTable::_compact_keys() {
+    // row 0 stays the unused default row, so 0 still marks an empty slot.
+    Buffer<uint32_t> distinct_rows;
+    distinct_rows.reserve(_num_keys + 1);
+    distinct_rows.push_back(0);
+    for (uint32_t& row : _slots) {
+        if (row != 0) {
+            distinct_rows.push_back(row);
+            row = distinct_rows.size() - 1;
+        }
+    }
+    for (auto& column : _key_columns) {
+        ColumnPtr distinct_column = column->clone_empty();
+        distinct_column->append_selective(*column, distinct_rows);
+        column = std::move(distinct_column);
+    }
+}
+
+size_t JoinExistenceTable::memory_usage() const {
+    size_t usage = _slots.capacity() * sizeof(uint32_t) + _bloom.capacity() * sizeof(uint64_t);
+    for (const auto& column : _key_columns) {
+        usage += column->memory_usage();
+    }
+    return usage;
+}
+
+void JoinExistenceTable::build(const Columns& key_columns, const uint8_t* is_nulls, uint32_t row_count) {
+    _key_columns = key_columns;
+    _num_keys = 0;
+    _slots.clear();
+
+    Buffer<uint32_t> hashes;
+    _hash(key_columns, row_count + 1, &hashes);
+
+    // grow by doubling, so a build side with few distinct keys never allocates slots for all of its rows.
+    _resize_slots(MIN_SLOT_BITS, hashes);
+    for (uint32_t i = 1; i < row_count + 1; i++) {
+        if (is_nulls != nullptr && is_nulls[i] != 0) {
+            continue;
+        }
+        const uint32_t mask = (1UL << _slot_bits) - 1;
+        uint32_t slot = _slot_hash(hashes[i]) >> (32 - _slot_bits);
+        bool found = false;
+        while (_slots[slot] != 0) {
+            if (hashes[_slots[slot]] == hashes[i] && _equals(key_columns, i, _slots[slot])) {
+                found = true;
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+        if (found) {
+            continue;
+        }
+        _slots[slot] = i;
+        // keep the load factor at most 1/2.
+        if (++_num_keys * 2 > _slots.size()) {
+            _resize_slots(_slot_bits + 1, hashes);
+        }
+    }
+
+    _build_bloom(hashes);
+    _compact_keys();
+    VLOG_QUERY << "join existence table keys = " << _num_keys << " , rows = " << row_count
+               << " , bytes = " << memory_usage();
+}
+
+void JoinExistenceTable::probe(const Columns& key_columns, const uint8_t* is_nulls, uint32_t row_count,
+                               Filter* matches) const {
+    Buffer<uint32_t> hashes;
+    _hash(key_columns, row_count, &hashes);
+    matches->assign(row_count, 0);
+
+    const uint32_t mask = (1UL << _slot_bits) - 1;
+    for (uint32_t i = 0; i < row_count; i++) {
+        if (is_nulls != nullptr && is_nulls[i] != 0) {
+            continue;
+        }
+        const uint32_t slot_hash = _slot_hash(hashes[i]);
+        const uint32_t word = _bloom_bits == 0 ? 0 : _bloom_hash(hashes[i]) >> (32 - _bloom_bits);
+        const uint64_t bloom_mask = _bloom_mask(slot_hash);
+        if ((_bloom[word] & bloom_mask) != bloom_mask) {
+            continue;
+        }
+        uint32_t slot = slot_hash >> (32 - _slot_bits);
+        while (_slots[slot] != 0) {
+            if (_equals(key_columns, i, _slots[slot])) {
+                (*matches)[i] = 1;
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+    }
+}
+
+} // namespace starrocks
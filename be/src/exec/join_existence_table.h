@@ -0,0 +1,77 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "column/column.h"
+#include "column/vectorized_fwd.h"
+
+namespace starrocks {
+
+// An existence-only hash table for LEFT SEMI/ANTI joins without other join conjuncts, which only need to know
+// whether a probe key exists on the build side.
+// Only the distinct build keys are indexed, in an open addressing table of row indexes into a copy of the distinct
+// keys, so neither the bucket chains nor the build rows are kept after the build.
+// A register-blocked bloom filter, whose bits of a key all live in one 64-bit word, sits in front of the table
+// and rejects most absent keys with a single memory access.
+class JoinExistenceTable {
+public:
+    // `key_columns` are the (non-nullable) data columns of the build keys, and row 0 of them is the unused default
+    // row of the hash table. A row with `is_nulls[i] != 0` never matches, `is_nulls` may be null.
+    // The distinct keys are copied, the table doesn't refer to `key_columns` after the build.
+    void build(const Columns& key_columns, const uint8_t* is_nulls, uint32_t row_count);
+
+    // Sets `matches[i]` to 1 if row `i` of `key_columns` exists in the table and 0 otherwise.
+    // `key_columns` must have the same types as the build key columns.
+    void probe(const Columns& key_columns, const uint8_t* is_nulls, uint32_t row_count, Filter* matches) const;
+
+    uint32_t num_keys() const { return _num_keys; }
+    size_t memory_usage() const;
+
+private:
+    static constexpr uint32_t HASH_SEED = 0x811C9DC5;
+    static constexpr uint32_t MIN_SLOT_BITS = 10;
+    static constexpr uint32_t BLOOM_BITS_PER_KEY = 8;
+
+    static void _hash(const Columns& key_columns, uint32_t row_count, Buffer<uint32_t>* hashes);
+    static uint32_t _slot_hash(uint32_t hash) { return (static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >> 32; }
+    static uint32_t _bloom_hash(uint32_t hash) {
+        uint32_t rotated = (hash << 16) | (hash >> 16);
+        return (static_cast<uint64_t>(rotated) * 0xC2B2AE3D27D4EB4FULL) >> 32;
+    }
+    // 4 bits picked from the low bits of the slot hash, the high bits of which choose the slot.
+    static uint64_t _bloom_mask(uint32_t slot_hash) {
+        return (1ULL << (slot_hash & 63)) | (1ULL << ((slot_hash >> 6) & 63)) | (1ULL << ((slot_hash >> 12) & 63)) |
+               (1ULL << ((slot_hash >> 18) & 63));
+    }
+
+    bool _equals(const Columns& key_columns, uint32_t row, uint32_t build_row) const;
+    void _resize_slots(uint32_t slot_bits, const Buffer<uint32_t>& hashes);
+    void _build_bloom(const Buffer<uint32_t>& hashes);
+    // Replaces `_key_columns` with the distinct keys, and the slots with their rows in the copy.
+    void _compact_keys();
+
+    // The build key columns during the build, and only the distinct keys after it.
+    Columns _key_columns;
+    // 0 is an empty slot, others are the row of a distinct key in `_key_columns`.
+    Buffer<uint32_t> _slots;
+    uint32_t _slot_bits = 0;
+    Buffer<uint64_t> _bloom;
+    uint32_t _bloom_bits = 0;
+    uint32_t _num_keys = 0;
+};
+
+} // namespace starrocks
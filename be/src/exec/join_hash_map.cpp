@@ -20,10 +20,14 @@
 #include <memory>
 
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/hash_join_node.h"
+#include "runtime/exec_env.h"
 #include "serde/column_array_serde.h"
 #include "simd/simd.h"
+#include "util/countdown_latch.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -73,6 +77,84 @@ void HashTableProbeState::consider_probe_time_locality() {
     ++probe_chunks;
 }
 
+bool JoinHashMapHelper::probe_prefetch_enabled(const JoinHashTableItems& table_items,
+                                               const HashTableProbeState& probe_state) {
+    return config::join_probe_prefetch_group_size > 0 && table_items.ht_cache_miss_serious() &&
+           probe_state.active_coroutines == 0;
+}
+
+bool JoinHashTableParallelLinker::enabled(const JoinHashTableItems& table_items) {
+    int64_t min_rows = config::join_hash_table_parallel_link_min_rows;
+    return min_rows > 0 && table_items.row_count >= min_rows && _num_partitions(table_items) > 1;
+}
+
+uint32_t JoinHashTableParallelLinker::_num_partitions(const JoinHashTableItems& table_items) {
+    // both the partition num and the bucket size are powers of two, so a partition is a range of buckets.
+    uint32_t num_partitions = std::max(config::join_hash_table_parallel_link_partition_num, 1);
+    num_partitions = 1U << (31 - __builtin_clz(num_partitions));
+    return std::min(num_partitions, table_items.bucket_size);
+}
+
+void JoinHashTableParallelLinker::link(JoinHashTableItems* table_items, const Buffer<uint32_t>& row_buckets) {
+    const uint32_t bucket_size = table_items->bucket_size;
+    const uint32_t row_count = table_items->row_count;
+    const uint32_t num_partitions = _num_partitions(*table_items);
+    const uint32_t shift = __builtin_ctz(bucket_size) - __builtin_ctz(num_partitions);
+    DCHECK_EQ(row_buckets.size(), row_count + 1);
+
+    // scatter the rows into partitions, keeping them in ascending order inside each partition.
+    std::vector<uint32_t> offsets(num_partitions + 1, 0);
+    for (uint32_t i = 1; i < row_count + 1; i++) {
+        if (row_buckets[i] != bucket_size) {
+            offsets[(row_buckets[i] >> shift) + 1]++;
+        }
+    }
+    for (uint32_t p = 0; p < num_partitions; p++) {
+        offsets[p + 1] += offsets[p];
+    }
+    Buffer<uint32_t> partition_rows(offsets[num_partitions]);
+    std::vector<uint32_t> cursors(offsets.begin(), offsets.end() - 1);
+    for (uint32_t i = 1; i < row_count + 1; i++) {
+        if (row_buckets[i] != bucket_size) {
+            partition_rows[cursors[row_buckets[i] >> shift]++] = i;
+        }
+    }
+
+    // link every partition, the caller claims partitions too, so the build never waits on an idle pool.
+    struct LinkState {
+        explicit LinkState(uint32_t num_partitions) : latch(num_partitions) {}
+        std::atomic<uint32_t> next_partition = 0;
+        CountDownLatch latch;
+    };
+    auto state = std::make_shared<LinkState>(num_partitions);
+    auto* first = table_items->first.data();
+    auto* next = table_items->next.data();
+    auto link_partitions = [=, &offsets, &partition_rows, &row_buckets]() {
+        uint32_t p;
+        while ((p = state->next_partition.fetch_add(1)) < num_partitions) {
+            for (uint32_t j = offsets[p]; j < offsets[p + 1]; j++) {
+                uint32_t row = partition_rows[j];
+                next[row] = first[row_buckets[row]];
+                first[row_buckets[row]] = row;
+            }
+            state->latch.count_down();
+        }
+    };
+
+    ThreadPool* pool = ExecEnv::GetInstance()->hash_join_build_pool();
+    if (pool != nullptr) {
+        int num_helpers = std::min<int>(pool->max_threads(), num_partitions) - 1;
+        for (int i = 0; i < num_helpers; i++) {
+            // a helper that starts after all partitions are claimed only touches `state`, which it keeps alive.
+            if (!pool->submit_func(link_partitions).ok()) {
+                break;
+            }
+        }
+    }
+    link_partitions();
+    state->latch.wait();
+}
+
 void SerializedJoinBuildFunc::prepare(RuntimeState* state, JoinHashTableItems* table_items) {
     table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
     table_items->first.resize(table_items->bucket_size, 0);
@@ -110,36 +192,50 @@ void SerializedJoinBuildFunc::construct_hash_table(RuntimeState* state, JoinHash
     }
     uint8_t* ptr = table_items->build_pool->allocate(serialize_size);
 
-    // serialize and build hash table
+    // serialize and build hash table, a large table only collects the buckets here and is linked in parallel.
     uint32_t quo = row_count / state->chunk_size();
     uint32_t rem = row_count % state->chunk_size();
+    Buffer<uint32_t> row_buckets;
+    Buffer<uint32_t>* row_buckets_ptr = nullptr;
+    if (JoinHashTableParallelLinker::enabled(*table_items)) {
+        row_buckets.resize(row_count + 1, JoinHashTableParallelLinker::skip_bucket(*table_items));
+        row_buckets_ptr = &row_buckets;
+    }
 
     if (!null_columns.empty()) {
         for (size_t i = 0; i < quo; i++) {
             _build_nullable_columns(table_items, probe_state, data_columns, null_columns, 1 + state->chunk_size() * i,
-                                    state->chunk_size(), &ptr);
+                                    state->chunk_size(), &ptr, row_buckets_ptr);
         }
         _build_nullable_columns(table_items, probe_state, data_columns, null_columns, 1 + state->chunk_size() * quo,
-                                rem, &ptr);
+                                rem, &ptr, row_buckets_ptr);
     } else {
         for (size_t i = 0; i < quo; i++) {
             _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * i, state->chunk_size(),
-                           &ptr);
+                           &ptr, row_buckets_ptr);
         }
-        _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * quo, rem, &ptr);
+        _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * quo, rem, &ptr,
+                       row_buckets_ptr);
+    }
+    if (row_buckets_ptr != nullptr) {
+        JoinHashTableParallelLinker::link(table_items, row_buckets);
     }
     table_items->calculate_ht_info(serialize_size);
 }
 
 void SerializedJoinBuildFunc::_build_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
                                              const Columns& data_columns, uint32_t start, uint32_t count,
-                                             uint8_t** ptr) {
+                                             uint8_t** ptr, Buffer<uint32_t>* row_buckets) {
     for (size_t i = 0; i < count; i++) {
         table_items->build_slice[start + i] = JoinHashMapHelper::get_hash_key(data_columns, start + i, *ptr);
         probe_state->buckets[i] = JoinHashMapHelper::calc_bucket_num<Slice>(table_items->build_slice[start + i],
                                                                             table_items->bucket_size);
         *ptr += table_items->build_slice[start + i].size;
     }
+    if (row_buckets != nullptr) {
+        std::copy_n(probe_state->buckets.begin(), count, row_buckets->begin() + start);
+        return;
+    }
 
     for (size_t i = 0; i < count; i++) {
         table_items->next[start + i] = table_items->first[probe_state->buckets[i]];
@@ -149,7 +245,8 @@ void SerializedJoinBuildFunc::_build_columns(JoinHashTableItems* table_items, Ha
 
 void SerializedJoinBuildFunc::_build_nullable_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
                                                       const Columns& data_columns, const NullColumns& null_columns,
-                                                      uint32_t start, uint32_t count, uint8_t** ptr) {
+                                                      uint32_t start, uint32_t count, uint8_t** ptr,
+                                                      Buffer<uint32_t>* row_buckets) {
     for (uint32_t i = 0; i < count; i++) {
         probe_state->is_nulls[i] = null_columns[0]->get_data()[start + i];
     }
@@ -167,6 +264,14 @@ void SerializedJoinBuildFunc::_build_nullable_columns(JoinHashTableItems* table_
             *ptr += table_items->build_slice[start + i].size;
         }
     }
+    if (row_buckets != nullptr) {
+        for (size_t i = 0; i < count; i++) {
+            if (probe_state->is_nulls[i] == 0) {
+                (*row_buckets)[start + i] = probe_state->buckets[i];
+            }
+        }
+        return;
+    }
 
     for (size_t i = 0; i < count; i++) {
         if (probe_state->is_nulls[i] == 0) {
@@ -224,6 +329,11 @@ void SerializedJoinProbeFunc::_probe_column(const JoinHashTableItems& table_item
         ptr += probe_state->probe_slice[i].size;
     }
 
+    if (JoinHashMapHelper::probe_prefetch_enabled(table_items, *probe_state)) {
+        JoinHashMapHelper::lookup_first_with_prefetch<Slice>(table_items, table_items.build_slice, probe_state->buckets,
+                                                             nullptr, row_count, &probe_state->next);
+        return;
+    }
     for (uint32_t i = 0; i < row_count; i++) {
         probe_state->next[i] = table_items.first[probe_state->buckets[i]];
     }
@@ -251,6 +361,21 @@ void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& t
         }
     }
 
+    if (JoinHashMapHelper::probe_prefetch_enabled(table_items, *probe_state)) {
+        for (uint32_t i = 0; i < row_count; i++) {
+            // the bucket of a null row is never read, but it is prefetched, so keep it in range.
+            if (probe_state->is_nulls[i] == 0) {
+                probe_state->buckets[i] =
+                        JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
+            } else {
+                probe_state->buckets[i] = 0;
+            }
+        }
+        JoinHashMapHelper::lookup_first_with_prefetch<Slice>(table_items, table_items.build_slice, probe_state->buckets,
+                                                             probe_state->is_nulls.data(), row_count,
+                                                             &probe_state->next);
+        return;
+    }
     for (uint32_t i = 0; i < row_count; i++) {
         if (probe_state->is_nulls[i] == 0) {
             probe_state->buckets[i] =
@@ -416,6 +541,18 @@ void JoinHashTable::create(const HashTableParam& param) {
     }
 }
 
+void JoinHashTable::release_build_data() {
+    if (_hash_map_type != JoinHashMapType::existence) {
+        return;
+    }
+    _table_items->build_chunk = _table_items->build_chunk->clone_empty_with_slot();
+    for (auto& column : _table_items->key_columns) {
+        if (column != nullptr) {
+            column = column->clone_empty();
+        }
+    }
+}
+
 int64_t JoinHashTable::mem_usage() const {
     int64_t usage = 0;
     if (_table_items->build_chunk != nullptr) {
@@ -433,6 +570,9 @@ int64_t JoinHashTable::mem_usage() const {
         usage += _table_items->build_key_column->memory_usage();
     }
     usage += _table_items->build_slice.size() * sizeof(Slice);
+    if (_table_items->existence_table != nullptr) {
+        usage += _table_items->existence_table->memory_usage();
+    }
     return usage;
 }
 
@@ -628,6 +768,145 @@ Status JoinHashTable::_upgrade_key_columns_if_overflow() {
     return Status::OK();
 }
 
+bool JoinHashMapForExistence::is_supported(const JoinHashTableItems& table_items) {
+    if (!config::enable_hash_join_existence_table || table_items.with_other_conjunct || table_items.mor_reader_mode) {
+        return false;
+    }
+    if (table_items.join_type != TJoinOp::LEFT_SEMI_JOIN && table_items.join_type != TJoinOp::LEFT_ANTI_JOIN) {
+        return false;
+    }
+    // the build rows are indexed with the high bits of a 32-bit hash.
+    if (table_items.row_count > (1U << 30)) {
+        return false;
+    }
+    if (table_items.join_keys.size() == 1) {
+        // a direct mapping table is smaller and faster for them.
+        LogicalType type = table_items.join_keys[0].type->type;
+        if (type == TYPE_BOOLEAN || type == TYPE_TINYINT || type == TYPE_SMALLINT) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < table_items.join_keys.size(); i++) {
+        if (table_items.join_keys[i].is_null_safe_equal) {
+            return false;
+        }
+        // the probe keys are compared with the build keys column by column, which requires the same column class.
+        const ColumnPtr& key_column = table_items.key_columns[i];
+        if (key_column->is_large_binary() ||
+            (key_column->is_nullable() &&
+             ColumnHelper::as_raw_column<NullableColumn>(key_column)->data_column()->is_large_binary())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool JoinHashMapForExistence::_prepare_key_columns(const Columns& key_columns, uint32_t row_count,
+                                                   Columns* data_columns, Buffer<uint8_t>* is_nulls) {
+    bool has_null = false;
+    data_columns->clear();
+    for (const auto& key_column : key_columns) {
+        if (!key_column->is_nullable()) {
+            data_columns->emplace_back(key_column);
+            continue;
+        }
+        auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(key_column);
+        data_columns->emplace_back(nullable_column->data_column());
+        if (!nullable_column->has_null()) {
+            continue;
+        }
+        const auto& null_data = nullable_column->null_column()->get_data();
+        if (!has_null) {
+            is_nulls->assign(null_data.begin(), null_data.begin() + row_count);
+            has_null = true;
+        } else {
+            for (uint32_t i = 0; i < row_count; i++) {
+                (*is_nulls)[i] |= null_data[i];
+            }
+        }
+    }
+    return has_null;
+}
+
+void JoinHashMapForExistence::probe_prepare(RuntimeState* state) {
+    _probe_state->probe_index.resize(state->chunk_size() + 8);
+    _probe_state->probe_match_filter.resize(state->chunk_size());
+    _probe_state->is_nulls.resize(state->chunk_size());
+}
+
+void JoinHashMapForExistence::build(RuntimeState* state) {
+    Columns data_columns;
+    Buffer<uint8_t> is_nulls;
+    bool has_null =
+            _prepare_key_columns(_table_items->key_columns, _table_items->row_count + 1, &data_columns, &is_nulls);
+    _table_items->existence_table = std::make_unique<JoinExistenceTable>();
+    _table_items->existence_table->build(data_columns, has_null ? is_nulls.data() : nullptr, _table_items->row_count);
+}
+
+void JoinHashMapForExistence::probe(RuntimeState* state, const Columns& key_columns, ChunkPtr* probe_chunk,
+                                    ChunkPtr* chunk, bool* has_remain) {
+    *has_remain = false;
+    {
+        SCOPED_TIMER(_probe_state->search_ht_timer);
+        uint32_t row_count = (*probe_chunk)->num_rows();
+        _probe_state->probe_row_count = row_count;
+        Columns data_columns;
+        bool has_null = _prepare_key_columns(key_columns, row_count, &data_columns, &_probe_state->is_nulls);
+        _table_items->existence_table->probe(data_columns, has_null ? _probe_state->is_nulls.data() : nullptr,
+                                             row_count, &_probe_state->probe_match_filter);
+
+        // a row with null keys never matches, so it is output by an anti join as well.
+        const uint8_t expected = _table_items->join_type == TJoinOp::LEFT_SEMI_JOIN ? 1 : 0;
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < row_count; i++) {
+            _probe_state->probe_index[count] = i;
+            count += _probe_state->probe_match_filter[i] == expected;
+        }
+        _probe_state->count = count;
+    }
+    if (_probe_state->count == 0) {
+        return;
+    }
+    {
+        SCOPED_TIMER(_probe_state->output_probe_column_timer);
+        _probe_output(probe_chunk, chunk);
+    }
+    {
+        SCOPED_TIMER(_probe_state->output_build_column_timer);
+        _build_default_output(chunk);
+    }
+}
+
+void JoinHashMapForExistence::_probe_output(ChunkPtr* probe_chunk, ChunkPtr* chunk) {
+    const uint32_t count = _probe_state->count;
+    const bool all_output = count == _probe_state->probe_row_count;
+    for (size_t i = 0; i < _table_items->probe_column_count; i++) {
+        HashTableSlotDescriptor hash_table_slot = _table_items->probe_slots[i];
+        SlotDescriptor* slot = hash_table_slot.slot;
+        auto& column = (*probe_chunk)->get_column_by_slot_id(slot->id());
+        if (!hash_table_slot.need_output) {
+            ColumnPtr default_column = ColumnHelper::create_column(slot->type(), column->is_nullable());
+            default_column->append_default(count);
+            (*chunk)->append_column(std::move(default_column), slot->id());
+        } else if (all_output) {
+            (*chunk)->append_column(column, slot->id());
+        } else {
+            ColumnPtr dest_column = column->clone_empty();
+            dest_column->append_selective(*column, _probe_state->probe_index.data(), 0, count);
+            (*chunk)->append_column(std::move(dest_column), slot->id());
+        }
+    }
+}
+
+void JoinHashMapForExistence::_build_default_output(ChunkPtr* chunk) {
+    for (size_t i = 0; i < _table_items->build_column_count; i++) {
+        SlotDescriptor* slot = _table_items->build_slots[i].slot;
+        ColumnPtr column = ColumnHelper::create_column(slot->type(), true);
+        column->append_nulls(_probe_state->count);
+        (*chunk)->append_column(std::move(column), slot->id());
+    }
+}
+
 JoinHashMapType JoinHashTable::_choose_join_hash_map() {
     if (_table_items->row_count == 0) {
         return JoinHashMapType::empty;
@@ -642,6 +921,10 @@ JoinHashMapType JoinHashTable::_choose_join_hash_map() {
         }
     }
 
+    if (JoinHashMapForExistence::is_supported(*_table_items)) {
+        return JoinHashMapType::existence;
+    }
+
     if (size == 1 && !_table_items->join_keys[0].is_null_safe_equal) {
         switch (_table_items->join_keys[0].type->type) {
         case LogicalType::TYPE_BOOLEAN:
@@ -28,6 +28,8 @@
 #include "column/column_hash.h"
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
+#include "exec/join_existence_table.h"
 #include "simd/simd.h"
 #include "util/phmap/phmap.h"
 
@@ -58,7 +60,8 @@ class ColumnRef;
     M(slice)                       \
     M(fixed32)                     \
     M(fixed64)                     \
-    M(fixed128)
+    M(fixed128)                    \
+    M(existence)
 
 enum class JoinHashMapType {
     empty,
@@ -80,7 +83,8 @@ enum class JoinHashMapType {
     slice,
     fixed32, // 4 bytes
     fixed64, // 8 bytes
-    fixed128 // 16 bytes
+    fixed128, // 16 bytes
+    existence // distinct keys only, for left semi/anti joins
 };
 
 enum class JoinMatchFlag { NORMAL, ALL_NOT_MATCH, ALL_MATCH_ONE, MOST_MATCH_ONE };
@@ -150,6 +154,8 @@ struct JoinHashTableItems {
 
     std::unique_ptr<MemPool> build_pool = nullptr;
     std::vector<JoinKeyDesc> join_keys;
+    // only built for JoinHashMapType::existence.
+    std::unique_ptr<JoinExistenceTable> existence_table = nullptr;
 };
 
 struct HashTableProbeState {
@@ -337,6 +343,39 @@ public:
         }
     }
 
+    // Whether the probe should prefetch the hash table, i.e. the table is much larger than the last level cache
+    // and the probe is not interleaved by coroutines, which prefetch by themselves.
+    static bool probe_prefetch_enabled(const JoinHashTableItems& table_items, const HashTableProbeState& probe_state);
+
+    // Group prefetching: while a group of probe rows reads its `first` slots and prefetches the chain heads they
+    // point to (the build key and the `next` slot), the `first` slots of the following group are prefetched, so
+    // the DRAM misses of a group overlap instead of stalling the probe row by row.
+    // A row with `is_nulls[i] != 0` gets an empty chain, `is_nulls` may be null if there is no null row.
+    template <typename CppType>
+    static void lookup_first_with_prefetch(const JoinHashTableItems& table_items, const Buffer<CppType>& build_data,
+                                           const Buffer<uint32_t>& buckets, const uint8_t* is_nulls,
+                                           uint32_t row_count, Buffer<uint32_t>* next) {
+        const uint32_t group_size = config::join_probe_prefetch_group_size;
+        const uint32_t* first = table_items.first.data();
+        for (uint32_t i = 0; i < std::min(group_size, row_count); i++) {
+            __builtin_prefetch(first + buckets[i]);
+        }
+        for (uint32_t start = 0; start < row_count; start += group_size) {
+            const uint32_t end = std::min(start + group_size, row_count);
+            for (uint32_t i = end; i < std::min(end + group_size, row_count); i++) {
+                __builtin_prefetch(first + buckets[i]);
+            }
+            for (uint32_t i = start; i < end; i++) {
+                uint32_t head = (is_nulls == nullptr || is_nulls[i] == 0) ? first[buckets[i]] : 0;
+                (*next)[i] = head;
+                if (head != 0) {
+                    __builtin_prefetch(build_data.data() + head);
+                    __builtin_prefetch(table_items.next.data() + head);
+                }
+            }
+        }
+    }
+
     static Slice get_hash_key(const Columns& key_columns, size_t row_idx, uint8_t* buffer) {
         size_t byte_size = 0;
         for (const auto& key_column : key_columns) {
@@ -364,6 +403,26 @@ public:
     }
 };
 
+// Links the build rows into the bucket chains (`first`/`next`) of a large hash table in parallel, after the
+// keys are hashed and serialized by the build driver. Only the linking is parallel, the table is not partitioned.
+// Rows are scattered by the high bits of their bucket number, so each partition owns a disjoint range of
+// `first` and a disjoint set of `next` slots, and the partitions are linked concurrently without locks.
+// Rows are linked in ascending order inside a partition, so the chains are identical to a sequential build
+// and the result is still one table that is probed as usual.
+class JoinHashTableParallelLinker {
+public:
+    // Marks a build row that must not be linked, e.g. a row with null join keys.
+    static uint32_t skip_bucket(const JoinHashTableItems& table_items) { return table_items.bucket_size; }
+
+    static bool enabled(const JoinHashTableItems& table_items);
+
+    // `row_buckets[i]` is the bucket of build row `i`, or skip_bucket() if the row must not be linked.
+    static void link(JoinHashTableItems* table_items, const Buffer<uint32_t>& row_buckets);
+
+private:
+    static uint32_t _num_partitions(const JoinHashTableItems& table_items);
+};
+
 template <LogicalType LT>
 class JoinBuildFunc {
 public:
@@ -403,12 +462,14 @@ public:
                                      HashTableProbeState* probe_state);
 
 private:
+    // If `row_buckets` is not null, the buckets of the rows are only collected into it instead of being linked.
     static void _build_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
-                               const Columns& data_columns, uint32_t start, uint32_t count);
+                               const Columns& data_columns, uint32_t start, uint32_t count,
+                               Buffer<uint32_t>* row_buckets);
 
     static void _build_nullable_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
                                         const Columns& data_columns, const NullColumns& null_columns, uint32_t start,
-                                        uint32_t count);
+                                        uint32_t count, Buffer<uint32_t>* row_buckets);
 };
 
 class SerializedJoinBuildFunc {
@@ -419,12 +480,14 @@ public:
                                      HashTableProbeState* probe_state);
 
 private:
+    // If `row_buckets` is not null, the buckets of the rows are only collected into it instead of being linked.
     static void _build_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
-                               const Columns& data_columns, uint32_t start, uint32_t count, uint8_t** ptr);
+                               const Columns& data_columns, uint32_t start, uint32_t count, uint8_t** ptr,
+                               Buffer<uint32_t>* row_buckets);
 
     static void _build_nullable_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
                                         const Columns& data_columns, const NullColumns& null_columns, uint32_t start,
-                                        uint32_t count, uint8_t** ptr);
+                                        uint32_t count, uint8_t** ptr, Buffer<uint32_t>* row_buckets);
 };
 
 template <LogicalType LT>
@@ -731,6 +794,35 @@ private:
     HashTableProbeState* _probe_state = nullptr;
 };
 
+// For LEFT SEMI/ANTI joins without other join conjuncts, only the existence of the probe keys matters,
+// so the hash table only indexes the distinct build keys, see JoinExistenceTable.
+class JoinHashMapForExistence {
+public:
+    explicit JoinHashMapForExistence(JoinHashTableItems* table_items, HashTableProbeState* probe_state)
+            : _table_items(table_items), _probe_state(probe_state) {}
+
+    void build_prepare(RuntimeState* state) {}
+    void probe_prepare(RuntimeState* state);
+    void build(RuntimeState* state);
+    void probe(RuntimeState* state, const Columns& key_columns, ChunkPtr* probe_chunk, ChunkPtr* chunk,
+               bool* has_remain);
+    void probe_remain(RuntimeState* state, ChunkPtr* chunk, bool* has_remain) { *has_remain = false; }
+
+    // Whether the join of `table_items` only needs the existence of the probe keys and can use this map.
+    static bool is_supported(const JoinHashTableItems& table_items);
+
+private:
+    // Splits `key_columns` into data columns and the rows that have a null key, returns whether any row has.
+    static bool _prepare_key_columns(const Columns& key_columns, uint32_t row_count, Columns* data_columns,
+                                     Buffer<uint8_t>* is_nulls);
+
+    void _probe_output(ChunkPtr* probe_chunk, ChunkPtr* chunk);
+    void _build_default_output(ChunkPtr* chunk);
+
+    JoinHashTableItems* _table_items = nullptr;
+    HashTableProbeState* _probe_state = nullptr;
+};
+
 #define JoinHashMapForOneKey(LT) JoinHashMap<LT, JoinBuildFunc<LT>, JoinProbeFunc<LT>>
 #define JoinHashMapForDirectMapping(LT) JoinHashMap<LT, DirectMappingJoinBuildFunc<LT>, DirectMappingJoinProbeFunc<LT>>
 #define JoinHashMapForFixedSizeKey(LT) JoinHashMap<LT, FixedSizeJoinBuildFunc<LT>, FixedSizeJoinProbeFunc<LT>>
@@ -764,6 +856,10 @@ public:
     [[nodiscard]] Status probe_remain(RuntimeState* state, ChunkPtr* chunk, bool* eos);
 
     void append_chunk(const ChunkPtr& chunk, const Columns& key_columns);
+    // The existence map keeps its own copy of the distinct keys and outputs no build column, so the build rows
+    // are released once the runtime filters, which hold the key columns they read, are built.
+    // Does nothing for the other maps.
+    void release_build_data();
     // convert input column to spill schema order
     [[nodiscard]] StatusOr<ChunkPtr> convert_to_spill_schema(const ChunkPtr& chunk) const;
 
@@ -812,6 +908,7 @@ private:
     std::unique_ptr<JoinHashMapForFixedSizeKey(TYPE_INT)> _fixed32 = nullptr;
     std::unique_ptr<JoinHashMapForFixedSizeKey(TYPE_BIGINT)> _fixed64 = nullptr;
     std::unique_ptr<JoinHashMapForFixedSizeKey(TYPE_LARGEINT)> _fixed128 = nullptr;
+    std::unique_ptr<JoinHashMapForExistence> _existence = nullptr;
 
     JoinHashMapType _hash_map_type = JoinHashMapType::empty;
 
@@ -54,7 +54,21 @@ template <LogicalType LT>
 void JoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
                                              HashTableProbeState* probe_state) {
     auto& data = get_key_data(*table_items);
-    if (table_items->key_columns[0]->is_nullable()) {
+    if (JoinHashTableParallelLinker::enabled(*table_items)) {
+        const uint8_t* null_data = nullptr;
+        if (table_items->key_columns[0]->is_nullable()) {
+            auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
+            null_data = nullable_column->null_column()->get_data().data();
+        }
+        Buffer<uint32_t> row_buckets(table_items->row_count + 1,
+                                     JoinHashTableParallelLinker::skip_bucket(*table_items));
+        for (size_t i = 1; i < table_items->row_count + 1; i++) {
+            if (null_data == nullptr || null_data[i] == 0) {
+                row_buckets[i] = JoinHashMapHelper::calc_bucket_num<CppType>(data[i], table_items->bucket_size);
+            }
+        }
+        JoinHashTableParallelLinker::link(table_items, row_buckets);
+    } else if (table_items->key_columns[0]->is_nullable()) {
         auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
         auto& null_array = nullable_column->null_column()->get_data();
         for (size_t i = 1; i < table_items->row_count + 1; i++) {
@@ -150,33 +164,51 @@ void FixedSizeJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinH
         }
     }
 
-    // serialize and build hash table
+    // serialize and build hash table, a large table only collects the buckets here and is linked in parallel.
     uint32_t quo = row_count / state->chunk_size();
     uint32_t rem = row_count % state->chunk_size();
+    Buffer<uint32_t> row_buckets;
+    Buffer<uint32_t>* row_buckets_ptr = nullptr;
+    if (JoinHashTableParallelLinker::enabled(*table_items)) {
+        row_buckets.resize(row_count + 1, JoinHashTableParallelLinker::skip_bucket(*table_items));
+        row_buckets_ptr = &row_buckets;
+    }
 
     if (!null_columns.empty()) {
         for (size_t i = 0; i < quo; i++) {
             _build_nullable_columns(table_items, probe_state, data_columns, null_columns, 1 + state->chunk_size() * i,
-                                    state->chunk_size());
+                                    state->chunk_size(), row_buckets_ptr);
         }
         _build_nullable_columns(table_items, probe_state, data_columns, null_columns, 1 + state->chunk_size() * quo,
-                                rem);
+                                rem, row_buckets_ptr);
     } else {
         for (size_t i = 0; i < quo; i++) {
-            _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * i, state->chunk_size());
+            _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * i, state->chunk_size(),
+                           row_buckets_ptr);
         }
-        _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * quo, rem);
+        _build_columns(table_items, probe_state, data_columns, 1 + state->chunk_size() * quo, rem, row_buckets_ptr);
+    }
+    if (row_buckets_ptr != nullptr) {
+        JoinHashTableParallelLinker::link(table_items, row_buckets);
     }
     table_items->calculate_ht_info(table_items->build_key_column->byte_size());
 }
 
 template <LogicalType LT>
 void FixedSizeJoinBuildFunc<LT>::_build_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
-                                                const Columns& data_columns, uint32_t start, uint32_t count) {
+                                                const Columns& data_columns, uint32_t start, uint32_t count,
+                                                Buffer<uint32_t>* row_buckets) {
     JoinHashMapHelper::serialize_fixed_size_key_column<LT>(data_columns, table_items->build_key_column.get(), start,
                                                            count);
 
     const auto& data = get_key_data(*table_items);
+    if (row_buckets != nullptr) {
+        for (uint32_t i = 0; i < count; i++) {
+            (*row_buckets)[start + i] =
+                    JoinHashMapHelper::calc_bucket_num<CppType>(data[start + i], table_items->bucket_size);
+        }
+        return;
+    }
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count);
 
     for (uint32_t i = 0; i < count; i++) {
@@ -189,7 +221,7 @@ template <LogicalType LT>
 void FixedSizeJoinBuildFunc<LT>::_build_nullable_columns(JoinHashTableItems* table_items,
                                                          HashTableProbeState* probe_state, const Columns& data_columns,
                                                          const NullColumns& null_columns, uint32_t start,
-                                                         uint32_t count) {
+                                                         uint32_t count, Buffer<uint32_t>* row_buckets) {
     for (uint32_t i = 0; i < count; i++) {
         probe_state->is_nulls[i] = null_columns[0]->get_data()[start + i];
     }
@@ -202,6 +234,15 @@ void FixedSizeJoinBuildFunc<LT>::_build_nullable_columns(JoinHashTableItems* tab
     JoinHashMapHelper::serialize_fixed_size_key_column<LT>(data_columns, table_items->build_key_column.get(), start,
                                                            count);
     const auto& data = get_key_data(*table_items);
+    if (row_buckets != nullptr) {
+        for (uint32_t i = 0; i < count; i++) {
+            if (probe_state->is_nulls[i] == 0) {
+                (*row_buckets)[start + i] =
+                        JoinHashMapHelper::calc_bucket_num<CppType>(data[start + i], table_items->bucket_size);
+            }
+        }
+        return;
+    }
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count);
 
     for (size_t i = 0; i < count; i++) {
@@ -265,6 +306,23 @@ void JoinProbeFunc<LT>::lookup_init(const JoinHashTableItems& table_items, HashT
     auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, data.size());
 
+    if (JoinHashMapHelper::probe_prefetch_enabled(table_items, *probe_state)) {
+        const uint8_t* is_nulls = nullptr;
+        probe_state->null_array = nullptr;
+        if ((*probe_state->key_columns)[0]->is_nullable()) {
+            auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>((*probe_state->key_columns)[0]);
+            if (nullable_column->has_null()) {
+                probe_state->null_array = &nullable_column->null_column()->get_data();
+                is_nulls = probe_state->null_array->data();
+            }
+        }
+        const auto& build_data = JoinBuildFunc<LT>::get_key_data(table_items);
+        JoinHashMapHelper::lookup_first_with_prefetch<CppType>(table_items, build_data, probe_state->buckets, is_nulls,
+                                                               probe_row_count, &probe_state->next);
+        probe_state->consider_probe_time_locality();
+        return;
+    }
+
     if ((*probe_state->key_columns)[0]->is_nullable()) {
         auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>((*probe_state->key_columns)[0]);
 
@@ -351,6 +409,12 @@ void FixedSizeJoinProbeFunc<LT>::_probe_column(const JoinHashTableItems& table_i
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
 
+    if (JoinHashMapHelper::probe_prefetch_enabled(table_items, *probe_state)) {
+        JoinHashMapHelper::lookup_first_with_prefetch<CppType>(
+                table_items, FixedSizeJoinBuildFunc<LT>::get_key_data(table_items), probe_state->buckets, nullptr,
+                row_count, &probe_state->next);
+        return;
+    }
     for (uint32_t i = 0; i < row_count; i++) {
         probe_state->next[i] = table_items.first[probe_state->buckets[i]];
     }
@@ -377,6 +441,12 @@ void FixedSizeJoinProbeFunc<LT>::_probe_nullable_column(const JoinHashTableItems
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
 
+    if (JoinHashMapHelper::probe_prefetch_enabled(table_items, *probe_state)) {
+        JoinHashMapHelper::lookup_first_with_prefetch<CppType>(
+                table_items, FixedSizeJoinBuildFunc<LT>::get_key_data(table_items), probe_state->buckets,
+                probe_state->is_nulls.data(), row_count, &probe_state->next);
+        return;
+    }
     for (uint32_t i = 0; i < row_count; i++) {
         if (probe_state->is_nulls[i] == 0) {
             probe_state->next[i] = table_items.first[probe_state->buckets[i]];
@@ -468,6 +468,18 @@ bool ExchangeSinkOperator::need_input() const {
     return !is_finished() && _buffer != nullptr && !_buffer->is_full();
 }
 
+void ExchangeSinkOperator::attach_observer(RuntimeState* state, const PipelineObserverPtr& observer) {
+    if (_buffer != nullptr) {
+        _buffer->attach_observer(observer);
+    }
+}
+
+void ExchangeSinkOperator::detach_observer(RuntimeState* state, const PipelineObserverPtr& observer) {
+    if (_buffer != nullptr) {
+        _buffer->detach_observer(observer);
+    }
+}
+
 bool ExchangeSinkOperator::pending_finish() const {
     return _buffer != nullptr && !_buffer->is_finished();
 }
@@ -65,6 +65,10 @@ public:
 
     bool is_finished() const override;
 
+    void attach_observer(RuntimeState* state, const PipelineObserverPtr& observer) override;
+    void detach_observer(RuntimeState* state, const PipelineObserverPtr& observer) override;
+    bool is_observing() const override { return _buffer != nullptr; }
+
     bool pending_finish() const override;
 
     Status set_finishing(RuntimeState* state) override;
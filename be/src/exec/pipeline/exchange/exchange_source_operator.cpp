@@ -37,6 +37,14 @@ bool ExchangeSourceOperator::is_finished() const {
     return _stream_recvr->is_finished();
 }
 
+void ExchangeSourceOperator::attach_observer(RuntimeState* state, const PipelineObserverPtr& observer) {
+    _stream_recvr->attach_observer(_driver_sequence, observer);
+}
+
+void ExchangeSourceOperator::detach_observer(RuntimeState* state, const PipelineObserverPtr& observer) {
+    _stream_recvr->detach_observer(_driver_sequence, observer);
+}
+
 Status ExchangeSourceOperator::set_finishing(RuntimeState* state) {
     _is_finishing = true;
     _stream_recvr->short_circuit_for_pipeline(_driver_sequence);
@@ -35,6 +35,10 @@ public:
 
     bool is_finished() const override;
 
+    void attach_observer(RuntimeState* state, const PipelineObserverPtr& observer) override;
+    void detach_observer(RuntimeState* state, const PipelineObserverPtr& observer) override;
+    bool is_observing() const override { return true; }
+
     Status set_finishing(RuntimeState* state) override;
 
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
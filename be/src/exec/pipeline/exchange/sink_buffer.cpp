@@ -387,6 +387,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
 
             _fragment_ctx->cancel(Status::ThriftRpcError(err_msg));
             LOG(WARNING) << err_msg;
+            _observable.notify_observers();
         });
         closure->addSuccessHandler([this](const ClosureContext& ctx, const PTransmitChunkResult& result) noexcept {
             // when _total_in_flight_rpc desc to 0, _fragment_ctx may be destructed
@@ -411,6 +412,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
                     _process_send_window(ctx.instance_id, ctx.sequence);
                 }));
             }
+            _observable.notify_observers();
         });
 
         ++_total_in_flight_rpc;
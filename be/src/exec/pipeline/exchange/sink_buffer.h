@@ -26,6 +26,7 @@
 #include "column/chunk.h"
 #include "common/compiler_util.h"
 #include "exec/pipeline/fragment_context.h"
+#include "exec/pipeline/pipeline_observer.h"
 #include "gen_cpp/BackendService.h"
 #include "runtime/current_thread.h"
 #include "runtime/query_statistics.h"
@@ -98,6 +99,10 @@ public:
 
     void incr_sinker(RuntimeState* state);
 
+    // The observer is notified when the RPCs complete, which may make the buffer not full.
+    void attach_observer(const PipelineObserverPtr& observer) { _observable.add_observer(observer); }
+    void detach_observer(const PipelineObserverPtr& observer) { _observable.remove_observer(observer); }
+
 private:
     using Mutex = bthread::Mutex;
 
@@ -190,6 +195,8 @@ private:
     int64_t _last_receive_time = -1;
     int64_t _rpc_http_min_size = 0;
 
+    Observable _observable;
+
     std::atomic<int64_t> _request_sequence = 0;
     int64_t _sent_audit_stats_frequency = 1;
     int64_t _sent_audit_stats_frequency_upper_limit = 64;
@@ -91,6 +91,7 @@ Status HashJoinBuildOperator::set_finishing(RuntimeState* state) {
         SCOPED_TIMER(_join_builder->build_metrics().build_runtime_filter_timer);
         RETURN_IF_ERROR(_join_builder->create_runtime_filters(state));
     }
+    _join_builder->hash_join_builder()->hash_table().release_build_data();
 
     auto ht_row_count = _join_builder->get_ht_row_count();
     auto& partial_in_filters = _join_builder->get_runtime_in_filters();
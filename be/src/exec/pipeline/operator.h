@@ -18,6 +18,7 @@
 
 #include "column/vectorized_fwd.h"
 #include "common/statusor.h"
+#include "exec/pipeline/pipeline_observer.h"
 #include "exec/pipeline/runtime_filter_types.h"
 #include "exec/spill/operator_mem_resource_manager.h"
 #include "exprs/runtime_filter_bank.h"
@@ -103,6 +104,15 @@ public:
     // output chunks will be produced
     virtual bool is_finished() const = 0;
 
+    // Attach the observer of the driver to the sources of the events which change has_output() or is_finished()
+    // of a source operator, or need_input() of a sink operator. It is invoked after prepare().
+    virtual void attach_observer(RuntimeState* state, const PipelineObserverPtr& observer) {}
+    // Detach the observer attached by attach_observer(). It is invoked when the driver is finalized, before close().
+    virtual void detach_observer(RuntimeState* state, const PipelineObserverPtr& observer) {}
+    // Whether the attached observer is notified, when the operator blocking the driver becomes unblocked.
+    // It is invoked after has_output() (for a source operator) or need_input() (for a sink operator) returns false.
+    virtual bool is_observing() const { return false; }
+
     // pending_finish returns whether this operator still has reference to the object owned by the operator or FragmentContext.
     // It can ONLY be called after calling set_finished().
     // When a driver's sink operator is finished, the driver should wait for pending i/o task completion.
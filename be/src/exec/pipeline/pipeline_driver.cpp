@@ -199,6 +199,15 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
         _operator_stages[op->get_id()] = OperatorStage::PREPARED;
     }
 
+    if (config::enable_pipeline_event_driven_wakeup) {
+        _observer = std::make_shared<PipelineObserver>(this);
+        source_op->attach_observer(runtime_state, _observer);
+        sink_operator()->attach_observer(runtime_state, _observer);
+        for (auto* rf_desc : _global_rf_descriptors) {
+            rf_desc->attach_observer(_observer);
+        }
+    }
+
     // Driver has no dependencies always sets _all_dependencies_ready to true;
     _all_dependencies_ready = _dependencies.empty() && !_pipeline->pipeline_event()->need_wait_dependencies_finished();
     // Driver has no local rf to wait for completion always sets _all_local_rf_ready to true;
@@ -217,6 +226,24 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
     return Status::OK();
 }
 
+bool PipelineDriver::is_observed_blocking() {
+    if (_observer == nullptr) {
+        return false;
+    }
+    switch (_state) {
+    case DriverState::INPUT_EMPTY:
+        return source_operator()->is_observing();
+    case DriverState::OUTPUT_FULL:
+        return sink_operator()->is_observing();
+    case DriverState::PRECONDITION_BLOCK:
+        // The dependencies and local runtime filters are ready, and it only waits for the global runtime filters,
+        // whose arrivals are notified and whose timeout is checked by the poller periodically.
+        return _wait_global_rf_ready;
+    default:
+        return false;
+    }
+}
+
 void PipelineDriver::update_peak_driver_queue_size_counter(size_t new_value) {
     if (_peak_driver_queue_size_counter != nullptr) {
         _peak_driver_queue_size_counter->set(new_value);
@@ -556,6 +583,18 @@ void PipelineDriver::cancel_operators(RuntimeState* runtime_state) {
     }
 }
 
+void PipelineDriver::_detach_observer(RuntimeState* runtime_state) {
+    if (_observer == nullptr) {
+        return;
+    }
+    // The observables may outlive the driver, e.g. the shared chunk buffer and the stream receiver.
+    source_operator()->detach_observer(runtime_state, _observer);
+    sink_operator()->detach_observer(runtime_state, _observer);
+    for (auto* rf_desc : _global_rf_descriptors) {
+        rf_desc->detach_observer(_observer);
+    }
+}
+
 void PipelineDriver::_close_operators(RuntimeState* runtime_state) {
     for (auto& op : _operators) {
         WARN_IF_ERROR(_mark_operator_closed(op, runtime_state),
@@ -653,6 +692,7 @@ void PipelineDriver::finalize(RuntimeState* runtime_state, DriverState state, in
     VLOG_ROW << "[Driver] finalize, driver=" << this;
     DCHECK(state == DriverState::FINISH || state == DriverState::CANCELED || state == DriverState::INTERNAL_ERROR);
     QUERY_TRACE_BEGIN("finalize", _driver_name);
+    _detach_observer(runtime_state);
     _close_operators(runtime_state);
 
     set_driver_state(state);
@@ -308,6 +308,10 @@ public:
     void cancel_operators(RuntimeState* runtime_state);
 
     Operator* sink_operator() { return _operators.back().get(); }
+    const PipelineObserverPtr& observer() const { return _observer; }
+    // Whether the blocked driver can only be unblocked by the events notified to its observer,
+    // apart from the timeouts and cancellations.
+    bool is_observed_blocking();
     bool is_ready() {
         return _state == DriverState::READY || _state == DriverState::RUNNING || _state == DriverState::LOCAL_WAITING;
     }
@@ -474,6 +478,7 @@ protected:
     [[nodiscard]] Status _mark_operator_cancelled(OperatorPtr& op, RuntimeState* runtime_state);
     [[nodiscard]] Status _mark_operator_closed(OperatorPtr& op, RuntimeState* runtime_state);
     void _close_operators(RuntimeState* runtime_state);
+    void _detach_observer(RuntimeState* runtime_state);
 
     void _adjust_memory_usage(RuntimeState* state, MemTracker* tracker, OperatorPtr& op, const ChunkPtr& chunk);
     void _try_to_release_buffer(RuntimeState* state, OperatorPtr& op);
@@ -497,6 +502,9 @@ protected:
     bool _all_global_rf_ready_or_timeout = false;
     int64_t _global_rf_wait_timeout_ns = -1;
 
+    // Null if the event-driven wakeup is disabled.
+    PipelineObserverPtr _observer = nullptr;
+
     size_t _first_unfinished{0};
     QueryContext* _query_ctx;
     FragmentContext* _fragment_ctx;
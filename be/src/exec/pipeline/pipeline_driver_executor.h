@@ -102,7 +102,7 @@ private:
     static constexpr int64_t LOCAL_MAX_WAIT_TIME_SPENT_NS = 1'000'000L;
 
     LimitSetter _num_threads_setter;
-    std::unique_ptr<DriverQueue> _driver_queue;
+    std::unique_ptr<WorkStealingDriverQueue> _driver_queue;
     // _thread_pool must be placed after _driver_queue, because worker threads in _thread_pool use _driver_queue.
     std::unique_ptr<ThreadPool> _thread_pool;
     PipelineDriverPollerPtr _blocked_driver_poller;
@@ -15,6 +15,10 @@
 #include "pipeline_driver_poller.h"
 
 #include <chrono>
+
+#include "common/config.h"
+#include "util/time.h"
+
 namespace starrocks::pipeline {
 
 void PipelineDriverPoller::start() {
@@ -40,105 +44,74 @@ void PipelineDriverPoller::shutdown() {
 void PipelineDriverPoller::run_internal() {
     this->_is_polling_thread_initialized.store(true, std::memory_order_release);
     DriverList tmp_blocked_drivers;
+    std::vector<DriverRawPtr> woken_drivers;
     int spin_count = 0;
     std::vector<DriverRawPtr> ready_drivers;
+    int64_t last_fallback_check_ns = MonotonicNanos();
     while (!_is_shutdown.load(std::memory_order_acquire)) {
         {
             std::unique_lock<std::mutex> lock(_global_mutex);
             tmp_blocked_drivers.splice(tmp_blocked_drivers.end(), _blocked_drivers);
-            if (_local_blocked_drivers.empty() && tmp_blocked_drivers.empty() && _blocked_drivers.empty()) {
-                std::cv_status cv_status = std::cv_status::no_timeout;
-                while (!_is_shutdown.load(std::memory_order_acquire) && this->_blocked_drivers.empty()) {
-                    cv_status = _cond.wait_for(lock, std::chrono::milliseconds(10));
-                }
-                if (cv_status == std::cv_status::timeout) {
-                    continue;
-                }
+            woken_drivers.swap(_woken_drivers);
+            if (_local_blocked_drivers.empty() && tmp_blocked_drivers.empty() && woken_drivers.empty()) {
+                // The observed drivers needn't be polled, so wait for the new blocked drivers, the woken drivers,
+                // or the next fallback check.
+                _cond.wait_for(lock, std::chrono::milliseconds(10), [this]() {
+                    return _is_shutdown.load(std::memory_order_acquire) || !_blocked_drivers.empty() ||
+                           !_woken_drivers.empty();
+                });
                 if (_is_shutdown.load(std::memory_order_acquire)) {
                     break;
                 }
                 tmp_blocked_drivers.splice(tmp_blocked_drivers.end(), _blocked_drivers);
+                woken_drivers.swap(_woken_drivers);
             }
         }
 
         {
             std::unique_lock write_lock(_local_mutex);
 
+            // The newly blocked drivers waiting for the notification are checked as the woken drivers below.
+            for (auto driver_it = tmp_blocked_drivers.begin(); driver_it != tmp_blocked_drivers.end();) {
+                auto* driver = *driver_it;
+                auto cur_it = driver_it++;
+                if (driver->is_observed_blocking()) {
+                    _observed_blocked_drivers.splice(_observed_blocked_drivers.end(), tmp_blocked_drivers, cur_it);
+                    _observed_driver_iters[driver] = cur_it;
+                    driver->observer()->start_observing(this);
+                    woken_drivers.emplace_back(driver);
+                }
+            }
             if (!tmp_blocked_drivers.empty()) {
                 _local_blocked_drivers.splice(_local_blocked_drivers.end(), tmp_blocked_drivers);
             }
 
             auto driver_it = _local_blocked_drivers.begin();
             while (driver_it != _local_blocked_drivers.end()) {
-                auto* driver = *driver_it;
+                auto cur_it = driver_it;
+                size_t num_ready_drivers = ready_drivers.size();
+                _check_blocked_driver(_local_blocked_drivers, driver_it, ready_drivers);
+                // The driver may wait for the notification now, e.g. its precondition only waits for global runtime
+                // filters. Check it again after observing it, in case the notification comes before observing.
+                if (ready_drivers.size() == num_ready_drivers && _try_observe_driver(cur_it)) {
+                    woken_drivers.emplace_back(*cur_it);
+                }
+            }
 
-                if (!driver->is_query_never_expired() && driver->query_ctx()->is_query_expired()) {
-                    // there are not any drivers belonging to a query context can make progress for an expiration period
-                    // indicates that some fragments are missing because of failed exec_plan_fragment invocation. in
-                    // this situation, query is failed finally, so drivers are marked PENDING_FINISH/FINISH.
-                    //
-                    // If the fragment is expired when the source operator is already pending i/o task,
-                    // The state of driver shouldn't be changed.
-                    size_t expired_log_count = driver->fragment_ctx()->expired_log_count();
-                    if (expired_log_count <= 10) {
-                        LOG(WARNING) << "[Driver] Timeout " << driver->to_readable_string();
-                        driver->fragment_ctx()->set_expired_log_count(++expired_log_count);
-                    }
-                    driver->fragment_ctx()->cancel(
-                            Status::TimedOut(fmt::format("Query exceeded time limit of {} seconds",
-                                                         driver->query_ctx()->get_query_expire_seconds())));
-                    on_cancel(driver, ready_drivers, _local_blocked_drivers, driver_it);
-                } else if (driver->fragment_ctx()->is_canceled()) {
-                    // If the fragment is cancelled when the source operator is already pending i/o task,
-                    // The state of driver shouldn't be changed.
-                    on_cancel(driver, ready_drivers, _local_blocked_drivers, driver_it);
-                } else if (driver->need_report_exec_state()) {
-                    // If the runtime profile is enabled, the driver should be rescheduled after the timeout for triggering
-                    // the profile report prcessing.
-                    remove_blocked_driver(_local_blocked_drivers, driver_it);
-                    ready_drivers.emplace_back(driver);
-                } else if (driver->pending_finish()) {
-                    if (driver->is_still_pending_finish()) {
-                        ++driver_it;
-                    } else {
-                        // driver->pending_finish() return true means that when a driver's sink operator is finished,
-                        // but its source operator still has pending io task that executed in io threads and has
-                        // reference to object outside(such as desc_tbl) owned by FragmentContext. So a driver in
-                        // PENDING_FINISH state should wait for pending io task's completion, then turn into FINISH state,
-                        // otherwise, pending tasks shall reference to destructed objects in FragmentContext since
-                        // FragmentContext is unregistered prematurely.
-                        driver->set_driver_state(driver->fragment_ctx()->is_canceled() ? DriverState::CANCELED
-                                                                                       : DriverState::FINISH);
-                        remove_blocked_driver(_local_blocked_drivers, driver_it);
-                        ready_drivers.emplace_back(driver);
-                    }
-                } else if (driver->is_epoch_finishing()) {
-                    if (driver->is_still_epoch_finishing()) {
-                        ++driver_it;
-                    } else {
-                        driver->set_driver_state(driver->fragment_ctx()->is_canceled() ? DriverState::CANCELED
-                                                                                       : DriverState::EPOCH_FINISH);
-                        remove_blocked_driver(_local_blocked_drivers, driver_it);
-                        ready_drivers.emplace_back(driver);
-                    }
-                } else if (driver->is_epoch_finished()) {
-                    remove_blocked_driver(_local_blocked_drivers, driver_it);
-                    ready_drivers.emplace_back(driver);
-                } else if (driver->is_finished()) {
-                    remove_blocked_driver(_local_blocked_drivers, driver_it);
-                    ready_drivers.emplace_back(driver);
-                } else {
-                    auto status_or_is_not_blocked = driver->is_not_blocked();
-                    if (!status_or_is_not_blocked.ok()) {
-                        driver->fragment_ctx()->cancel(status_or_is_not_blocked.status());
-                        on_cancel(driver, ready_drivers, _local_blocked_drivers, driver_it);
-                    } else if (status_or_is_not_blocked.value()) {
-                        driver->set_driver_state(DriverState::READY);
-                        remove_blocked_driver(_local_blocked_drivers, driver_it);
-                        ready_drivers.emplace_back(driver);
-                    } else {
-                        ++driver_it;
-                    }
+            for (auto* driver : woken_drivers) {
+                // The driver may have been removed or checked.
+                if (auto iter = _observed_driver_iters.find(driver); iter != _observed_driver_iters.end()) {
+                    _check_observed_driver(iter->second, ready_drivers);
+                }
+            }
+            woken_drivers.clear();
+
+            int64_t now_ns = MonotonicNanos();
+            if (now_ns - last_fallback_check_ns >= config::pipeline_poller_fallback_check_interval_ms * 1000000L) {
+                last_fallback_check_ns = now_ns;
+                for (auto observed_it = _observed_blocked_drivers.begin();
+                     observed_it != _observed_blocked_drivers.end();) {
+                    _check_observed_driver(observed_it++, ready_drivers);
                 }
             }
         }
@@ -175,6 +148,113 @@ void PipelineDriverPoller::run_internal() {
     }
 }
 
+void PipelineDriverPoller::_check_blocked_driver(DriverList& drivers, DriverList::iterator& driver_it,
+                                                 std::vector<DriverRawPtr>& ready_drivers) {
+    auto* driver = *driver_it;
+
+    if (!driver->is_query_never_expired() && driver->query_ctx()->is_query_expired()) {
+        // there are not any drivers belonging to a query context can make progress for an expiration period
+        // indicates that some fragments are missing because of failed exec_plan_fragment invocation. in
+        // this situation, query is failed finally, so drivers are marked PENDING_FINISH/FINISH.
+        //
+        // If the fragment is expired when the source operator is already pending i/o task,
+        // The state of driver shouldn't be changed.
+        size_t expired_log_count = driver->fragment_ctx()->expired_log_count();
+        if (expired_log_count <= 10) {
+            LOG(WARNING) << "[Driver] Timeout " << driver->to_readable_string();
+            driver->fragment_ctx()->set_expired_log_count(++expired_log_count);
+        }
+        driver->fragment_ctx()->cancel(
+                Status::TimedOut(fmt::format("Query exceeded time limit of {} seconds",
+                                             driver->query_ctx()->get_query_expire_seconds())));
+        on_cancel(driver, ready_drivers, drivers, driver_it);
+    } else if (driver->fragment_ctx()->is_canceled()) {
+        // If the fragment is cancelled when the source operator is already pending i/o task,
+        // The state of driver shouldn't be changed.
+        on_cancel(driver, ready_drivers, drivers, driver_it);
+    } else if (driver->need_report_exec_state()) {
+        // If the runtime profile is enabled, the driver should be rescheduled after the timeout for triggering
+        // the profile report prcessing.
+        remove_blocked_driver(drivers, driver_it);
+        ready_drivers.emplace_back(driver);
+    } else if (driver->pending_finish()) {
+        if (driver->is_still_pending_finish()) {
+            ++driver_it;
+        } else {
+            // driver->pending_finish() return true means that when a driver's sink operator is finished,
+            // but its source operator still has pending io task that executed in io threads and has
+            // reference to object outside(such as desc_tbl) owned by FragmentContext. So a driver in
+            // PENDING_FINISH state should wait for pending io task's completion, then turn into FINISH state,
+            // otherwise, pending tasks shall reference to destructed objects in FragmentContext since
+            // FragmentContext is unregistered prematurely.
+            driver->set_driver_state(driver->fragment_ctx()->is_canceled() ? DriverState::CANCELED
+                                                                           : DriverState::FINISH);
+            remove_blocked_driver(drivers, driver_it);
+            ready_drivers.emplace_back(driver);
+        }
+    } else if (driver->is_epoch_finishing()) {
+        if (driver->is_still_epoch_finishing()) {
+            ++driver_it;
+        } else {
+            driver->set_driver_state(driver->fragment_ctx()->is_canceled() ? DriverState::CANCELED
+                                                                           : DriverState::EPOCH_FINISH);
+            remove_blocked_driver(drivers, driver_it);
+            ready_drivers.emplace_back(driver);
+        }
+    } else if (driver->is_epoch_finished()) {
+        remove_blocked_driver(drivers, driver_it);
+        ready_drivers.emplace_back(driver);
+    } else if (driver->is_finished()) {
+        remove_blocked_driver(drivers, driver_it);
+        ready_drivers.emplace_back(driver);
+    } else {
+        auto status_or_is_not_blocked = driver->is_not_blocked();
+        if (!status_or_is_not_blocked.ok()) {
+            driver->fragment_ctx()->cancel(status_or_is_not_blocked.status());
+            on_cancel(driver, ready_drivers, drivers, driver_it);
+        } else if (status_or_is_not_blocked.value()) {
+            driver->set_driver_state(DriverState::READY);
+            remove_blocked_driver(drivers, driver_it);
+            ready_drivers.emplace_back(driver);
+        } else {
+            ++driver_it;
+        }
+    }
+}
+
+bool PipelineDriverPoller::_try_observe_driver(DriverList::iterator driver_it) {
+    auto* driver = *driver_it;
+    if (!driver->is_observed_blocking()) {
+        return false;
+    }
+    _observed_blocked_drivers.splice(_observed_blocked_drivers.end(), _local_blocked_drivers, driver_it);
+    _observed_driver_iters[driver] = driver_it;
+    driver->observer()->start_observing(this);
+    return true;
+}
+
+void PipelineDriverPoller::_check_observed_driver(DriverList::iterator driver_it,
+                                                  std::vector<DriverRawPtr>& ready_drivers) {
+    auto* driver = *driver_it;
+    size_t num_ready_drivers = ready_drivers.size();
+    auto next_it = driver_it;
+    _check_blocked_driver(_observed_blocked_drivers, next_it, ready_drivers);
+    if (ready_drivers.size() > num_ready_drivers) {
+        driver->observer()->stop_observing();
+        _observed_driver_iters.erase(driver);
+    } else if (!driver->is_observed_blocking()) {
+        driver->observer()->stop_observing();
+        _observed_driver_iters.erase(driver);
+        _local_blocked_drivers.splice(_local_blocked_drivers.end(), _observed_blocked_drivers, driver_it);
+    }
+}
+
+void PipelineDriverPoller::wake_up(const DriverRawPtr driver) {
+    std::lock_guard<std::mutex> lock(_global_mutex);
+    _woken_drivers.emplace_back(driver);
+    _cond.notify_one();
+}
+
 void PipelineDriverPoller::add_blocked_driver(const DriverRawPtr driver) {
     std::unique_lock<std::mutex> lock(_global_mutex);
     _blocked_drivers.push_back(driver);
@@ -251,6 +331,9 @@ void PipelineDriverPoller::iterate_immutable_driver(const IterateImmutableDriver
     for (auto* driver : _local_blocked_drivers) {
         call(driver);
     }
+    for (auto* driver : _observed_blocked_drivers) {
+        call(driver);
+    }
 }
 
 } // namespace starrocks::pipeline
@@ -19,6 +19,7 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 
 #include "pipeline_driver.h"
 #include "pipeline_driver_queue.h"
@@ -45,6 +46,9 @@ public:
     void shutdown();
     // add blocked driver to poller
     void add_blocked_driver(const DriverRawPtr driver);
+    // Wake up the driver waiting for the notification of its observer, see PipelineObserver.
+    // The driver is only checked if it is still observed by this poller.
+    void wake_up(const DriverRawPtr driver);
     // remove blocked driver from poller
     void remove_blocked_driver(DriverList& local_blocked_drivers, DriverList::iterator& driver_it);
     void on_cancel(DriverRawPtr driver, std::vector<DriverRawPtr>& ready_drivers, DriverList& local_blocked_drivers,
@@ -63,6 +67,16 @@ public:
 
 private:
     void run_internal();
+    // Check the blocked driver, and remove it from `drivers` and add it to `ready_drivers` if it is not blocked.
+    // `driver_it` is moved to the next driver.
+    void _check_blocked_driver(DriverList& drivers, DriverList::iterator& driver_it,
+                               std::vector<DriverRawPtr>& ready_drivers);
+    // Move the driver to _observed_blocked_drivers, if it only waits for the notification.
+    // Return true if the driver is moved.
+    bool _try_observe_driver(DriverList::iterator driver_it);
+    // Check the observed driver, and move it back to _local_blocked_drivers if it is still blocked
+    // but cannot be woken up by the notification anymore.
+    void _check_observed_driver(DriverList::iterator driver_it, std::vector<DriverRawPtr>& ready_drivers);
     PipelineDriverPoller(const PipelineDriverPoller&) = delete;
     PipelineDriverPoller& operator=(const PipelineDriverPoller&) = delete;
 
@@ -70,8 +84,15 @@ private:
     std::condition_variable _cond;
     DriverList _blocked_drivers;
 
+    // The drivers woken up by their observers, guarded by _global_mutex.
+    std::vector<DriverRawPtr> _woken_drivers;
+
     mutable std::shared_mutex _local_mutex;
     DriverList _local_blocked_drivers;
+    // The drivers waiting for the notification of their observers, which are only checked when they are woken up,
+    // or every pipeline_poller_fallback_check_interval_ms to find out the timeouts and cancellations.
+    DriverList _observed_blocked_drivers;
+    std::unordered_map<DriverRawPtr, DriverList::iterator> _observed_driver_iters;
 
     DriverQueue* _driver_queue;
     scoped_refptr<Thread> _polling_thread;
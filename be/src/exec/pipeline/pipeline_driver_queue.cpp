@@ -17,6 +17,7 @@
 #include "exec/pipeline/source_operator.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
+#include "util/defer_op.h"
 
 namespace starrocks::pipeline {
 
@@ -147,11 +148,14 @@ size_t QuerySharedDriverQueue::size() const {
 }
 
 void QuerySharedDriverQueue::update_statistics(const DriverRawPtr driver) {
-    std::lock_guard<std::mutex> lock(_global_mutex);
-
+    // The accumulated time of each level is atomic, so the executor thread needn't take _global_mutex.
     _queues[driver->get_driver_queue_level()].update_accu_time(driver);
 }
 
+bool QuerySharedDriverQueue::can_run_locally(const DriverRawPtr driver) const {
+    return _compute_driver_level(driver) == driver->get_driver_queue_level();
+}
+
 int QuerySharedDriverQueue::_compute_driver_level(const DriverRawPtr driver) const {
     int time_spent = driver->driver_acct().get_accumulated_time_spent();
     for (int i = driver->get_driver_queue_level(); i < QUEUE_SIZE; ++i) {
@@ -248,6 +252,7 @@ StatusOr<DriverRawPtr> WorkGroupDriverQueue::take(const bool block) {
         }
 
         _update_bandwidth_control_period();
+        _account_runtime();
 
         if (_wg_entities.empty()) {
             if (!block) {
@@ -295,29 +300,18 @@ void WorkGroupDriverQueue::cancel(DriverRawPtr driver) {
 }
 
 void WorkGroupDriverQueue::update_statistics(const DriverRawPtr driver) {
-    // TODO: reduce the lock scope
-    std::lock_guard<std::mutex> lock(_global_mutex);
-
     int64_t runtime_ns = driver->driver_acct().get_last_time_spent();
     auto* wg_entity = driver->workgroup()->driver_sched_entity();
 
     // Update bandwidth control information.
-    _update_bandwidth_control_period();
     if (!wg_entity->is_sq_wg()) {
         _bandwidth_usage_ns += runtime_ns;
     }
 
-    // Update sched entity information.
-    bool is_in_queue = _wg_entities.find(wg_entity) != _wg_entities.end();
-    if (is_in_queue) {
-        _wg_entities.erase(wg_entity);
-    }
-    DCHECK(_wg_entities.find(wg_entity) == _wg_entities.end());
-    wg_entity->incr_runtime_ns(runtime_ns);
-    if (is_in_queue) {
-        _wg_entities.emplace(wg_entity);
-        _update_min_wg();
-    }
+    // The vruntime orders _wg_entities, so it can only be changed under _global_mutex.
+    // Leave the runtime in the entity, and it is folded into vruntime by _account_runtime().
+    wg_entity->add_unaccounted_runtime_ns(runtime_ns);
+    _has_unaccounted_runtime.store(true, std::memory_order_release);
 
     wg_entity->queue()->update_statistics(driver);
 }
@@ -336,10 +330,20 @@ bool WorkGroupDriverQueue::should_yield(const DriverRawPtr driver, int64_t unacc
     // Return true, if the minimum-vruntime workgroup is not current workgroup anymore.
     auto* wg_entity = driver->workgroup()->driver_sched_entity();
     auto* min_entity = _min_wg_entity.load();
+    unaccounted_runtime_ns += wg_entity->unaccounted_runtime_ns();
     return min_entity != wg_entity && min_entity &&
            min_entity->vruntime_ns() < wg_entity->vruntime_ns() + unaccounted_runtime_ns / wg_entity->cpu_limit();
 }
 
+bool WorkGroupDriverQueue::can_run_locally(const DriverRawPtr driver) const {
+    auto* wg_entity = driver->workgroup()->driver_sched_entity();
+    // The drivers of a throttled workgroup must wait in this queue until the next bandwidth control period.
+    if (_throttled(wg_entity) || should_yield(driver, 0)) {
+        return false;
+    }
+    return wg_entity->queue()->can_run_locally(driver);
+}
+
 bool WorkGroupDriverQueue::_throttled(const workgroup::WorkGroupDriverSchedEntity* wg_entity,
                                       int64_t unaccounted_runtime_ns) const {
     if (wg_entity->is_sq_wg()) {
@@ -356,6 +360,7 @@ bool WorkGroupDriverQueue::_throttled(const workgroup::WorkGroupDriverSchedEntit
 template <bool from_executor>
 void WorkGroupDriverQueue::_put_back(const DriverRawPtr driver) {
     driver->update_peak_driver_queue_size_counter(_num_drivers);
+    _account_runtime();
 
     auto* wg_entity = driver->workgroup()->driver_sched_entity();
     wg_entity->set_in_queue(this);
@@ -363,6 +368,8 @@ void WorkGroupDriverQueue::_put_back(const DriverRawPtr driver) {
     driver->set_in_queue(this);
 
     if (_wg_entities.find(wg_entity) == _wg_entities.end()) {
+        // _account_runtime() only folds the entities in _wg_entities.
+        wg_entity->incr_runtime_ns(wg_entity->take_unaccounted_runtime_ns());
         _enqueue_workgroup<from_executor>(wg_entity);
     }
 
@@ -371,6 +378,28 @@ void WorkGroupDriverQueue::_put_back(const DriverRawPtr driver) {
     _cv.notify_one();
 }
 
+void WorkGroupDriverQueue::_account_runtime() {
+    if (!_has_unaccounted_runtime.exchange(false, std::memory_order_acquire)) {
+        return;
+    }
+
+    std::vector<workgroup::WorkGroupDriverSchedEntity*> wg_entities;
+    for (auto* wg_entity : _wg_entities) {
+        if (wg_entity->unaccounted_runtime_ns() != 0) {
+            wg_entities.emplace_back(wg_entity);
+        }
+    }
+    if (wg_entities.empty()) {
+        return;
+    }
+    for (auto* wg_entity : wg_entities) {
+        _wg_entities.erase(wg_entity);
+        wg_entity->incr_runtime_ns(wg_entity->take_unaccounted_runtime_ns());
+        _wg_entities.emplace(wg_entity);
+    }
+    _update_min_wg();
+}
+
 void WorkGroupDriverQueue::_update_min_wg() {
     auto* min_wg_entity = _take_next_wg();
     if (min_wg_entity == nullptr) {
@@ -432,14 +461,16 @@ void WorkGroupDriverQueue::_update_bandwidth_control_period() {
     if (_bandwidth_control_period_end_ns == 0 || _bandwidth_control_period_end_ns <= cur_ns) {
         _bandwidth_control_period_end_ns = cur_ns + BANDWIDTH_CONTROL_PERIOD_NS;
 
+        // Executor threads add to the usage without _global_mutex, so subtract from it rather than
+        // overwrite it, to keep the runtime added concurrently.
         int64_t bandwidth_quota = _bandwidth_quota_ns();
         int64_t bandwidth_usage = _bandwidth_usage_ns.load();
         if (bandwidth_usage <= bandwidth_quota) {
-            _bandwidth_usage_ns = 0;
+            _bandwidth_usage_ns -= bandwidth_usage;
         } else if (bandwidth_usage < 2 * bandwidth_quota) {
             _bandwidth_usage_ns -= bandwidth_quota;
         } else {
-            _bandwidth_usage_ns = bandwidth_quota;
+            _bandwidth_usage_ns -= bandwidth_usage - bandwidth_quota;
         }
     }
 }
@@ -448,4 +479,181 @@ int64_t WorkGroupDriverQueue::_bandwidth_quota_ns() const {
     return BANDWIDTH_CONTROL_PERIOD_NS * workgroup::WorkGroupManager::instance()->normal_workgroup_cpu_hard_limit();
 }
 
+/// WorkStealingDriverQueue.
+thread_local WorkStealingDriverQueue::LocalQueue* WorkStealingDriverQueue::_tls_local_queue = nullptr;
+
+void WorkStealingDriverQueue::close() {
+    _shared_queue->close();
+}
+
+void WorkStealingDriverQueue::put_back(const DriverRawPtr driver) {
+    _shared_queue->put_back(driver);
+}
+
+void WorkStealingDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers) {
+    _shared_queue->put_back(drivers);
+}
+
+void WorkStealingDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
+    auto* local_queue = _current_local_queue();
+    // Hand the driver over to the shared queue to wake up the waiting executor threads,
+    // otherwise they cannot run it until they are woken up by other drivers.
+    if (local_queue == nullptr || _num_waiting_workers.load(std::memory_order_acquire) > 0 ||
+        !_shared_queue->can_run_locally(driver)) {
+        _shared_queue->put_back_from_executor(driver);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(local_queue->mutex);
+        if (static_cast<int64_t>(local_queue->drivers.size()) < config::pipeline_driver_local_queue_size) {
+            local_queue->drivers.emplace_back(driver);
+            ++_num_local_drivers;
+            return;
+        }
+    }
+    _shared_queue->put_back_from_executor(driver);
+}
+
+StatusOr<DriverRawPtr> WorkStealingDriverQueue::take(const bool block) {
+    auto* local_queue = _current_local_queue();
+    if (local_queue != nullptr) {
+        if (local_queue->num_consecutive_takes < MAX_CONSECUTIVE_LOCAL_TAKES) {
+            if (auto* driver = _check_local_driver(_take_local(local_queue)); driver != nullptr) {
+                ++local_queue->num_consecutive_takes;
+                return driver;
+            }
+        }
+        local_queue->num_consecutive_takes = 0;
+    }
+
+    ASSIGN_OR_RETURN(auto* driver, _shared_queue->take(false));
+    if (driver != nullptr) {
+        return driver;
+    }
+    if (local_queue != nullptr) {
+        if (driver = _check_local_driver(_take_local(local_queue)); driver != nullptr) {
+            return driver;
+        }
+    }
+    if (driver = _check_local_driver(_steal(local_queue)); driver != nullptr) {
+        return driver;
+    }
+    if (!block) {
+        return nullptr;
+    }
+
+    // Once _num_waiting_workers is increased, the other threads stop keeping drivers in their local queues,
+    // so steal again to pick up the driver kept before that.
+    ++_num_waiting_workers;
+    DeferOp defer([this]() { --_num_waiting_workers; });
+    if (driver = _check_local_driver(_steal(local_queue)); driver != nullptr) {
+        return driver;
+    }
+    return _shared_queue->take(true);
+}
+
+void WorkStealingDriverQueue::cancel(DriverRawPtr driver) {
+    _shared_queue->cancel(driver);
+}
+
+void WorkStealingDriverQueue::update_statistics(const DriverRawPtr driver) {
+    _shared_queue->update_statistics(driver);
+}
+
+size_t WorkStealingDriverQueue::size() const {
+    return _shared_queue->size() + _num_local_drivers.load();
+}
+
+bool WorkStealingDriverQueue::should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const {
+    return _shared_queue->should_yield(driver, unaccounted_runtime_ns);
+}
+
+void WorkStealingDriverQueue::register_worker() {
+    DCHECK(_tls_local_queue == nullptr);
+    auto local_queue = std::make_unique<LocalQueue>(this);
+    _tls_local_queue = local_queue.get();
+
+    std::unique_lock<std::shared_mutex> lock(_local_queues_mutex);
+    _local_queues.emplace_back(std::move(local_queue));
+}
+
+void WorkStealingDriverQueue::unregister_worker() {
+    auto* local_queue = _current_local_queue();
+    if (local_queue == nullptr) {
+        return;
+    }
+    _tls_local_queue = nullptr;
+
+    std::unique_ptr<LocalQueue> removed_queue;
+    {
+        std::unique_lock<std::shared_mutex> lock(_local_queues_mutex);
+        auto it = std::find_if(_local_queues.begin(), _local_queues.end(),
+                               [local_queue](const auto& queue) { return queue.get() == local_queue; });
+        DCHECK(it != _local_queues.end());
+        removed_queue = std::move(*it);
+        _local_queues.erase(it);
+    }
+
+    // No other thread can steal from the removed queue now.
+    if (!removed_queue->drivers.empty()) {
+        _num_local_drivers -= removed_queue->drivers.size();
+        std::vector<DriverRawPtr> drivers(removed_queue->drivers.begin(), removed_queue->drivers.end());
+        _shared_queue->put_back(drivers);
+    }
+}
+
+WorkStealingDriverQueue::LocalQueue* WorkStealingDriverQueue::_current_local_queue() const {
+    if (_tls_local_queue == nullptr || _tls_local_queue->owner != this) {
+        return nullptr;
+    }
+    return _tls_local_queue;
+}
+
+DriverRawPtr WorkStealingDriverQueue::_take_local(LocalQueue* local_queue) {
+    std::lock_guard<std::mutex> lock(local_queue->mutex);
+    if (local_queue->drivers.empty()) {
+        return nullptr;
+    }
+    auto* driver = local_queue->drivers.front();
+    local_queue->drivers.pop_front();
+    --_num_local_drivers;
+    return driver;
+}
+
+DriverRawPtr WorkStealingDriverQueue::_check_local_driver(DriverRawPtr driver) {
+    if (driver == nullptr || _shared_queue->can_run_locally(driver)) {
+        return driver;
+    }
+    _shared_queue->put_back_from_executor(driver);
+    return nullptr;
+}
+
+DriverRawPtr WorkStealingDriverQueue::_steal(const LocalQueue* thief) {
+    if (_num_local_drivers.load() == 0) {
+        return nullptr;
+    }
+
+    std::shared_lock<std::shared_mutex> lock(_local_queues_mutex);
+    const size_t num_queues = _local_queues.size();
+    // Start from a different victim each time, to spread the stealing over the local queues.
+    const size_t start = _next_victim++;
+    for (size_t i = 0; i < num_queues; ++i) {
+        auto* victim = _local_queues[(start + i) % num_queues].get();
+        if (victim == thief) {
+            continue;
+        }
+        std::unique_lock<std::mutex> victim_lock(victim->mutex, std::try_to_lock);
+        if (!victim_lock.owns_lock() || victim->drivers.empty()) {
+            continue;
+        }
+        // Steal the one yielded earliest, which has waited the longest time.
+        auto* driver = victim->drivers.front();
+        victim->drivers.pop_front();
+        --_num_local_drivers;
+        return driver;
+    }
+    return nullptr;
+}
+
 } // namespace starrocks::pipeline
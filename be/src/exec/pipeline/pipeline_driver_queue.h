@@ -15,6 +15,7 @@
 #pragma once
 
 #include <queue>
+#include <shared_mutex>
 
 #include "exec/pipeline/pipeline_driver.h"
 #include "exec/workgroup/work_group_fwd.h"
@@ -40,12 +41,18 @@ public:
 
     // Update statistics of the driver's workgroup,
     // when yielding the driver in the executor thread.
+    // It is invoked after every driver run, so it doesn't take the global lock of the queue.
     virtual void update_statistics(const DriverRawPtr driver) = 0;
 
     virtual size_t size() const = 0;
     bool empty() const { return size() == 0; }
 
     virtual bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const = 0;
+
+    // Whether the driver yielded by an executor thread could be run again by the same thread
+    // without being put back to this queue, that is, the queue would not prefer other drivers to it.
+    // It is invoked without lock, after update_statistics().
+    virtual bool can_run_locally(const DriverRawPtr driver) const { return false; }
 };
 
 // SubQuerySharedDriverQueue is used to store the driver waiting to be executed.
@@ -117,6 +124,9 @@ public:
 
     bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const override { return false; }
 
+    // The driver can run locally until it uses up the time slice of its level.
+    bool can_run_locally(const DriverRawPtr driver) const override;
+
     static double ratio_of_adjacent_queue() { return config::pipeline_driver_queue_ratio_of_adjacent_queue; }
     static constexpr size_t QUEUE_SIZE = 8;
 
@@ -173,6 +183,10 @@ public:
 
     bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const override;
 
+    // The driver can run locally, if its workgroup is still the minimum-vruntime one and is not throttled,
+    // and the driver queue of its workgroup allows it.
+    bool can_run_locally(const DriverRawPtr driver) const override;
+
 private:
     /// These methods should be guarded by the outside _global_mutex.
     template <bool from_executor>
@@ -180,6 +194,8 @@ private:
     workgroup::WorkGroupDriverSchedEntity* _take_next_wg();
     // _update_min_wg is invoked when an entity is enqueued or dequeued from _wg_entities.
     void _update_min_wg();
+    // Fold the runtime reported by update_statistics() into the vruntime of the entities in _wg_entities.
+    void _account_runtime();
     // Apply hard bandwidth control to non-short-query workgroups, when there are queries of the short-query workgroup.
     bool _throttled(const workgroup::WorkGroupDriverSchedEntity* wg_entity, int64_t unaccounted_runtime_ns = 0) const;
     // _update_bandwidth_control_period resets period_end_ns and period_usage_ns, when a new period comes.
@@ -219,6 +235,8 @@ private:
 
     // Cache the minimum entity, used to check should_yield() without lock.
     std::atomic<workgroup::WorkGroupDriverSchedEntity*> _min_wg_entity = nullptr;
+    // Whether update_statistics() has reported runtime not folded by _account_runtime() yet.
+    std::atomic<bool> _has_unaccounted_runtime = false;
 
     // Hard bandwidth control to non-short-query workgroups.
     // - The control period is 100ms, and the total quota of non-short-query workgroups is 100ms*(vCPUs-rt_wg.cpu_limit).
@@ -234,4 +252,81 @@ private:
     std::atomic<int64_t> _bandwidth_usage_ns = 0;
 };
 
+// WorkStealingDriverQueue puts a bounded local queue of each executor thread in front of the shared queue,
+// which is either QuerySharedDriverQueue or WorkGroupDriverQueue.
+// - A driver yielded by an executor thread stays in the local queue of the thread, as long as the shared queue
+//   says it can run locally (see DriverQueue::can_run_locally) and no executor thread is waiting for drivers.
+//   Thus the common yield-and-rerun path needs neither the global mutex of the shared queue nor a wakeup.
+// - An executor thread takes drivers from its local queue first, but it turns to the shared queue after
+//   MAX_CONSECUTIVE_LOCAL_TAKES local takes, so the drivers in the shared queue are not starved.
+// - An executor thread steals a driver from the local queues of the other threads, before it waits for
+//   the shared queue.
+// The drivers from the poller and new drivers always go to the shared queue, and the statistics are always
+// updated to the shared queue, so the multi-level time slices and the workgroup vruntime are accounted as before.
+// The shared queues update the statistics without their global mutex, so the yield-and-rerun path takes no
+// global lock at all.
+// A driver in a local queue is not in the ready queue, so it is not cancelled by cancel(),
+// and the executor thread finds its fragment cancelled when taking it.
+class WorkStealingDriverQueue : public FactoryMethod<DriverQueue, WorkStealingDriverQueue> {
+    friend class FactoryMethod<DriverQueue, WorkStealingDriverQueue>;
+
+public:
+    explicit WorkStealingDriverQueue(DriverQueuePtr shared_queue) : _shared_queue(std::move(shared_queue)) {}
+    ~WorkStealingDriverQueue() override = default;
+    void close() override;
+
+    void put_back(const DriverRawPtr driver) override;
+    void put_back(const std::vector<DriverRawPtr>& drivers) override;
+    void put_back_from_executor(const DriverRawPtr driver) override;
+
+    // Return cancelled status, if the queue is closed.
+    StatusOr<DriverRawPtr> take(const bool block) override;
+
+    void cancel(DriverRawPtr driver) override;
+
+    void update_statistics(const DriverRawPtr driver) override;
+
+    size_t size() const override;
+
+    bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const override;
+
+    // Create and remove the local queue of the calling executor thread.
+    // The drivers left in the local queue are put back to the shared queue, when the thread is removed.
+    void register_worker();
+    void unregister_worker();
+
+private:
+    struct LocalQueue {
+        explicit LocalQueue(const WorkStealingDriverQueue* owner) : owner(owner) {}
+
+        const WorkStealingDriverQueue* const owner;
+        std::mutex mutex;
+        std::deque<DriverRawPtr> drivers;
+        // Only accessed by the owner thread.
+        int num_consecutive_takes = 0;
+    };
+
+    LocalQueue* _current_local_queue() const;
+    DriverRawPtr _take_local(LocalQueue* local_queue);
+    DriverRawPtr _steal(const LocalQueue* thief);
+    // The shared queue may stop allowing a driver to run locally while it waits in a local queue, e.g. its
+    // workgroup gets throttled. Such a driver is put back to the shared queue and nullptr is returned.
+    DriverRawPtr _check_local_driver(DriverRawPtr driver);
+
+private:
+    static constexpr int MAX_CONSECUTIVE_LOCAL_TAKES = 16;
+
+    static thread_local LocalQueue* _tls_local_queue;
+
+    DriverQueuePtr _shared_queue;
+
+    mutable std::shared_mutex _local_queues_mutex;
+    std::vector<std::unique_ptr<LocalQueue>> _local_queues;
+    std::atomic<size_t> _next_victim = 0;
+
+    std::atomic<size_t> _num_local_drivers = 0;
+    // The number of executor threads blocked in taking from the shared queue.
+    std::atomic<int> _num_waiting_workers = 0;
+};
+
 } // namespace starrocks::pipeline
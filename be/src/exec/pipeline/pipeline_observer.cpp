@@ -0,0 +1,67 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/pipeline_observer.h"
+
+#include <algorithm>
+
+#include "exec/pipeline/pipeline_driver_poller.h"
+
+namespace starrocks::pipeline {
+
+void PipelineObserver::start_observing(PipelineDriverPoller* poller) {
+    _poller.store(poller);
+    // Pairs with the fence in notify(). Either the poller checks the driver after the event, or the notifier
+    // sees the poller and wakes up the driver.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void PipelineObserver::stop_observing() {
+    _poller.store(nullptr);
+}
+
+bool PipelineObserver::notify() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (auto* poller = _poller.load(); poller != nullptr) {
+        poller->wake_up(_driver);
+        return true;
+    }
+    return false;
+}
+
+void Observable::add_observer(const PipelineObserverPtr& observer) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _observers.emplace_back(observer);
+}
+
+void Observable::remove_observer(const PipelineObserverPtr& observer) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _observers.erase(std::remove(_observers.begin(), _observers.end(), observer), _observers.end());
+}
+
+size_t Observable::num_observers() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _observers.size();
+}
+
+bool Observable::notify_observers() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    bool woken = false;
+    for (const auto& observer : _observers) {
+        woken |= observer->notify();
+    }
+    return woken;
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,69 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace starrocks::pipeline {
+
+class PipelineDriver;
+class PipelineDriverPoller;
+
+// PipelineObserver wakes up its driver, when the driver is blocked in PipelineDriverPoller and one of the events
+// which may unblock the driver happens, e.g. a chunk arrives at the DataStreamRecvr of an ExchangeSourceOperator.
+// The poller only checks such a driver when it is woken up, or when the fallback interval elapses for the timeouts.
+//
+// The observers are shared by the Observables, so an Observable outliving the driver never touches a freed
+// observer. The observer never dereferences the driver, and the poller only checks the woken driver if it is
+// still observed by the poller.
+class PipelineObserver {
+public:
+    explicit PipelineObserver(PipelineDriver* driver) : _driver(driver) {}
+
+    // Invoked by PipelineDriverPoller, when the driver starts or stops waiting for the notification.
+    void start_observing(PipelineDriverPoller* poller);
+    void stop_observing();
+
+    // Invoked by the Observables, after the event has taken effect.
+    // Return whether the driver is woken up, i.e. it is waiting for the notification.
+    bool notify();
+
+private:
+    PipelineDriver* const _driver;
+    // Not null, when the driver is waiting for the notification in the poller.
+    std::atomic<PipelineDriverPoller*> _poller = nullptr;
+};
+using PipelineObserverPtr = std::shared_ptr<PipelineObserver>;
+
+// Observable is the source of the events which the observers wait for.
+// The drivers detach their observers when they are finalized, see Operator::detach_observer.
+class Observable {
+public:
+    void add_observer(const PipelineObserverPtr& observer);
+    void remove_observer(const PipelineObserverPtr& observer);
+    size_t num_observers() const;
+
+    // Return whether any driver is woken up.
+    bool notify_observers();
+
+private:
+    mutable std::mutex _mutex;
+    std::vector<PipelineObserverPtr> _observers;
+};
+
+} // namespace starrocks::pipeline
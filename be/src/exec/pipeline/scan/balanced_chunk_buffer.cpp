@@ -24,6 +24,7 @@ BalancedChunkBuffer::BalancedChunkBuffer(BalanceStrategy strategy, int output_op
     DCHECK_GT(output_operators, 0);
     for (int i = 0; i < output_operators; i++) {
         _sub_buffers.emplace_back(std::make_unique<QueueT>());
+        _observables.emplace_back(std::make_unique<Observable>());
     }
 }
 
@@ -80,13 +81,14 @@ bool BalancedChunkBuffer::put(int buffer_index, ChunkPtr chunk, ChunkBufferToken
     if (!chunk || (!chunk->owner_info().is_last_chunk() && chunk->num_rows() == 0)) return true;
     bool ret;
     size_t memory_usage = chunk->memory_usage();
+    int target_index = buffer_index;
     if (_strategy == BalanceStrategy::kDirect) {
-        ret = _get_sub_buffer(buffer_index)->put(std::make_pair(std::move(chunk), std::move(chunk_token)));
+        ret = _get_sub_buffer(target_index)->put(std::make_pair(std::move(chunk), std::move(chunk_token)));
     } else if (_strategy == BalanceStrategy::kRoundRobin) {
         // TODO: try to balance data according to number of rows
         // But the hard part is, that may needs to maintain a min-heap to account the rows of each
         // output operator, which would introduce some extra overhead
-        int target_index = _output_index.fetch_add(1);
+        target_index = _output_index.fetch_add(1);
         target_index %= _output_operators;
         ret = _get_sub_buffer(target_index)->put(std::make_pair(std::move(chunk), std::move(chunk_token)));
     } else {
@@ -94,6 +96,7 @@ bool BalancedChunkBuffer::put(int buffer_index, ChunkPtr chunk, ChunkBufferToken
     }
     if (ret) {
         _memory_usage += memory_usage;
+        _observables[target_index % _output_operators]->notify_observers();
     }
     return ret;
 }
@@ -103,6 +106,16 @@ void BalancedChunkBuffer::set_finished(int buffer_index) {
     _get_sub_buffer(buffer_index)->clear();
 }
 
+void BalancedChunkBuffer::attach_observer(int buffer_index, const PipelineObserverPtr& observer) {
+    DCHECK_LT(buffer_index, _output_operators);
+    _observables[buffer_index % _output_operators]->add_observer(observer);
+}
+
+void BalancedChunkBuffer::detach_observer(int buffer_index, const PipelineObserverPtr& observer) {
+    DCHECK_LT(buffer_index, _output_operators);
+    _observables[buffer_index % _output_operators]->remove_observer(observer);
+}
+
 void BalancedChunkBuffer::update_limiter(Chunk* chunk) {
     static constexpr int UPDATE_AVG_ROW_BYTES_FREQUENCY = 8;
     // Update local counters.
@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "column/chunk.h"
+#include "exec/pipeline/pipeline_observer.h"
 #include "exec/pipeline/scan/chunk_buffer_limiter.h"
 #include "util/blocking_queue.hpp"
 
@@ -43,6 +44,10 @@ public:
     // Mark that it needn't produce any chunk anymore.
     void set_finished(int buffer_index);
 
+    // The observer of the output operator is notified when a chunk is put into its sub buffer.
+    void attach_observer(int buffer_index, const PipelineObserverPtr& observer);
+    void detach_observer(int buffer_index, const PipelineObserverPtr& observer);
+
     ChunkBufferLimiter* limiter() { return _limiter.get(); }
     void update_limiter(Chunk* chunk);
 
@@ -68,6 +73,7 @@ private:
     const int _output_operators;
     const BalanceStrategy _strategy;
     std::vector<SubBuffer> _sub_buffers;
+    std::vector<std::unique_ptr<Observable>> _observables;
     std::atomic_int64_t _output_index = 0;
     std::atomic_int64_t _memory_usage = 0;
 
@@ -376,6 +376,18 @@ void ConnectorScanOperator::set_buffer_finished() {
     buffer.set_finished(_driver_sequence);
 }
 
+void ConnectorScanOperator::attach_buffer_observer(const PipelineObserverPtr& observer) {
+    auto* factory = down_cast<ConnectorScanOperatorFactory*>(_factory);
+    auto& buffer = factory->get_chunk_buffer();
+    buffer.attach_observer(_driver_sequence, observer);
+}
+
+void ConnectorScanOperator::detach_buffer_observer(const PipelineObserverPtr& observer) {
+    auto* factory = down_cast<ConnectorScanOperatorFactory*>(_factory);
+    auto& buffer = factory->get_chunk_buffer();
+    buffer.detach_observer(_driver_sequence, observer);
+}
+
 connector::ConnectorType ConnectorScanOperator::connector_type() {
     auto* scan_node = down_cast<ConnectorScanNode*>(_scan_node);
     return scan_node->connector_type();
@@ -107,6 +107,8 @@ public:
     ChunkBufferTokenPtr pin_chunk(int num_chunks) override;
     bool is_buffer_full() const override;
     void set_buffer_finished() override;
+    void attach_buffer_observer(const PipelineObserverPtr& observer) override;
+    void detach_buffer_observer(const PipelineObserverPtr& observer) override;
 
     int available_pickup_morsel_count() override;
     void begin_pickup_morsels() override;
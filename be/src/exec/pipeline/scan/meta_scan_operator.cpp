@@ -102,4 +102,12 @@ void MetaScanOperator::set_buffer_finished() {
     _ctx->get_chunk_buffer().set_finished(_driver_sequence);
 }
 
+void MetaScanOperator::attach_buffer_observer(const PipelineObserverPtr& observer) {
+    _ctx->get_chunk_buffer().attach_observer(_driver_sequence, observer);
+}
+
+void MetaScanOperator::detach_buffer_observer(const PipelineObserverPtr& observer) {
+    _ctx->get_chunk_buffer().detach_observer(_driver_sequence, observer);
+}
+
 } // namespace starrocks::pipeline
\ No newline at end of file
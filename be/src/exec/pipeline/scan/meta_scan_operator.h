@@ -67,6 +67,8 @@ private:
     ChunkBufferTokenPtr pin_chunk(int num_chunks) override;
     bool is_buffer_full() const override;
     void set_buffer_finished() override;
+    void attach_buffer_observer(const PipelineObserverPtr& observer) override;
+    void detach_buffer_observer(const PipelineObserverPtr& observer) override;
 
     MetaScanContextPtr _ctx;
 };
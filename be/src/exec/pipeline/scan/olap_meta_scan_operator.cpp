@@ -107,4 +107,12 @@ void OlapMetaScanOperator::set_buffer_finished() {
     _ctx->get_chunk_buffer().set_finished(_driver_sequence);
 }
 
+void OlapMetaScanOperator::attach_buffer_observer(const PipelineObserverPtr& observer) {
+    _ctx->get_chunk_buffer().attach_observer(_driver_sequence, observer);
+}
+
+void OlapMetaScanOperator::detach_buffer_observer(const PipelineObserverPtr& observer) {
+    _ctx->get_chunk_buffer().detach_observer(_driver_sequence, observer);
+}
+
 } // namespace starrocks::pipeline
@@ -76,6 +76,8 @@ protected:
     ChunkBufferTokenPtr pin_chunk(int num_chunks) override;
     bool is_buffer_full() const override;
     void set_buffer_finished() override;
+    void attach_buffer_observer(const PipelineObserverPtr& observer) override;
+    void detach_buffer_observer(const PipelineObserverPtr& observer) override;
 
 private:
     OlapScanContextPtr _ctx;
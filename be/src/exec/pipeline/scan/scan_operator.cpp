@@ -402,7 +402,7 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_in
     task.peak_scan_task_queue_size_counter = _peak_scan_task_queue_size_counter;
     const auto io_task_start_nano = MonotonicNanos();
     task.work_function = [wp = _query_ctx, this, state, chunk_source_index, query_trace_ctx, driver_id,
-                          io_task_start_nano](auto& ctx) {
+                          io_task_start_nano, observable = _observable](auto& ctx) {
         if (auto sp = wp.lock()) {
             // set driver_id/query_id/fragment_instance_id to thread local
             // driver_id will be used in some Expr such as regex_replace
@@ -420,28 +420,40 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_in
             FAIL_POINT_SCOPE(mem_alloc_error);
 #endif
 
-            DeferOp timer_defer([chunk_source]() {
-                COUNTER_SET(chunk_source->scan_timer(),
-                            chunk_source->io_task_wait_timer()->value() + chunk_source->io_task_exec_timer()->value());
-            });
-            COUNTER_UPDATE(chunk_source->io_task_wait_timer(), MonotonicNanos() - io_task_start_nano);
-            SCOPED_TIMER(chunk_source->io_task_exec_timer());
-
-            int64_t prev_cpu_time = chunk_source->get_cpu_time_spent();
-            int64_t prev_scan_rows = chunk_source->get_scan_rows();
-            int64_t prev_scan_bytes = chunk_source->get_scan_bytes();
-            auto status = chunk_source->buffer_next_batch_chunks_blocking(state, kIOTaskBatchSize, _workgroup.get());
-
-            if (!status.ok() && !status.is_end_of_file()) {
-                LOG(ERROR) << "scan fragment " << print_id(state->fragment_instance_id()) << " driver "
-                           << get_driver_sequence() << " Scan tasks error: " << status.to_string();
-                _set_scan_status(status);
+            int64_t delta_cpu_time = 0;
+            int64_t delta_scan_rows = 0;
+            int64_t delta_scan_bytes = 0;
+            {
+                // The timers are stopped before the task is finished, since they live in the profiles of this
+                // operator.
+                DeferOp timer_defer([chunk_source]() {
+                    COUNTER_SET(chunk_source->scan_timer(), chunk_source->io_task_wait_timer()->value() +
+                                                                    chunk_source->io_task_exec_timer()->value());
+                });
+                COUNTER_UPDATE(chunk_source->io_task_wait_timer(), MonotonicNanos() - io_task_start_nano);
+                SCOPED_TIMER(chunk_source->io_task_exec_timer());
+
+                int64_t prev_cpu_time = chunk_source->get_cpu_time_spent();
+                int64_t prev_scan_rows = chunk_source->get_scan_rows();
+                int64_t prev_scan_bytes = chunk_source->get_scan_bytes();
+                auto status =
+                        chunk_source->buffer_next_batch_chunks_blocking(state, kIOTaskBatchSize, _workgroup.get());
+
+                if (!status.ok() && !status.is_end_of_file()) {
+                    LOG(ERROR) << "scan fragment " << print_id(state->fragment_instance_id()) << " driver "
+                               << get_driver_sequence() << " Scan tasks error: " << status.to_string();
+                    _set_scan_status(status);
+                }
+
+                delta_cpu_time = chunk_source->get_cpu_time_spent() - prev_cpu_time;
+                delta_scan_rows = chunk_source->get_scan_rows() - prev_scan_rows;
+                delta_scan_bytes = chunk_source->get_scan_bytes() - prev_scan_bytes;
             }
 
-            int64_t delta_cpu_time = chunk_source->get_cpu_time_spent() - prev_cpu_time;
-            _finish_chunk_source_task(state, chunk_source_index, delta_cpu_time,
-                                      chunk_source->get_scan_rows() - prev_scan_rows,
-                                      chunk_source->get_scan_bytes() - prev_scan_bytes);
+            _finish_chunk_source_task(state, chunk_source_index, delta_cpu_time, delta_scan_rows, delta_scan_bytes);
+            // The driver may be finalized and this operator destroyed once the task is finished, so only the
+            // observable held by the task is touched from here on.
+            observable->notify_observers();
 
             QUERY_TRACE_ASYNC_FINISH("io_task", category, query_trace_ctx);
             // make clang happy
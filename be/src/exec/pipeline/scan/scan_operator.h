@@ -52,6 +52,18 @@ public:
 
     bool is_finished() const override;
 
+    void attach_observer(RuntimeState* state, const PipelineObserverPtr& observer) override {
+        _observable->add_observer(observer);
+        attach_buffer_observer(observer);
+    }
+    void detach_observer(RuntimeState* state, const PipelineObserverPtr& observer) override {
+        _observable->remove_observer(observer);
+        detach_buffer_observer(observer);
+    }
+    // When all the io tasks are running, has_output() keeps false until a chunk is buffered into the buffer of this
+    // operator, or an io task finishes.
+    bool is_observing() const override { return is_running_all_io_tasks(); }
+
     [[nodiscard]] Status set_finishing(RuntimeState* state) override;
 
     [[nodiscard]] StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
@@ -110,6 +122,9 @@ protected:
     virtual ChunkBufferTokenPtr pin_chunk(int num_chunks) = 0;
     virtual bool is_buffer_full() const = 0;
     virtual void set_buffer_finished() = 0;
+    // The observer is notified when a chunk is put into the buffer of this operator.
+    virtual void attach_buffer_observer(const PipelineObserverPtr& observer) = 0;
+    virtual void detach_buffer_observer(const PipelineObserverPtr& observer) = 0;
 
     // This method is only invoked when current morsel is reached eof
     // and all cached chunk of this morsel has benn read out
@@ -156,6 +171,9 @@ protected:
     bool _is_finished = false;
 
     std::atomic<int> _num_running_io_tasks = 0;
+    // Shared with the io tasks, which notify the observers after the task is finished, when this operator may
+    // already be destroyed.
+    std::shared_ptr<Observable> _observable = std::make_shared<Observable>();
     mutable std::shared_mutex _task_mutex; // Protects the chunk-source from concurrent close and read
     std::vector<std::atomic<bool>> _is_io_task_running;
     std::vector<ChunkSourcePtr> _chunk_sources;
@@ -291,7 +291,10 @@ private:
     buffer_range buffer[2];
 };
 
-SortedStreamingAggregator::SortedStreamingAggregator(AggregatorParamsPtr params) : Aggregator(std::move(params)) {}
+SortedStreamingAggregator::SortedStreamingAggregator(AggregatorParamsPtr params) : Aggregator(std::move(params)) {
+    // The states of a group are created, updated and output through _agg_states_offsets.
+    _enable_columnar_states = false;
+}
 
 SortedStreamingAggregator::~SortedStreamingAggregator() {
     if (_state) {
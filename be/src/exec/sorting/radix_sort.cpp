@@ -0,0 +1,439 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+#include "column/array_column.h"
+#include "column/binary_column.h"
+#include "column/column_visitor_adapter.h"
+#include "column/const_column.h"
+#include "column/fixed_length_column_base.h"
+#include "column/json_column.h"
+#include "column/map_column.h"
+#include "column/nullable_column.h"
+#include "column/struct_column.h"
+#include "exec/sorting/sort_permute.h"
+#include "exec/sorting/sorting.h"
+#include "gutil/endian.h"
+#include "util/orlp/pdqsort.h"
+
+namespace starrocks {
+
+// The normalized keys are padded to a multiple of this many bytes.
+static constexpr size_t kNormalizedKeyAlignment = 8;
+static constexpr size_t kMaxNormalizedKeyWidth = 64;
+
+// Map a value to an unsigned integer of the same width, whose order is the order of the value.
+template <typename T>
+static inline auto to_ordered_unsigned(const T& value) {
+    if constexpr (std::is_same_v<T, DateValue>) {
+        return to_ordered_unsigned(value.julian());
+    } else if constexpr (std::is_same_v<T, TimestampValue>) {
+        return to_ordered_unsigned(value.timestamp());
+    } else if constexpr (std::is_same_v<T, int128_t>) {
+        return static_cast<uint128_t>(value) ^ (static_cast<uint128_t>(1) << 127);
+    } else if constexpr (std::is_signed_v<T>) {
+        using U = std::make_unsigned_t<T>;
+        return static_cast<U>(static_cast<U>(value) ^ (static_cast<U>(1) << (sizeof(T) * 8 - 1)));
+    } else {
+        return value;
+    }
+}
+
+template <typename T>
+static constexpr bool is_normalizable_v = std::is_integral_v<T> || std::is_same_v<T, int128_t> ||
+                                          std::is_same_v<T, DateValue> || std::is_same_v<T, TimestampValue>;
+
+template <typename U>
+static inline void store_big_endian(uint8_t* dst, U value) {
+    if constexpr (sizeof(U) == 1) {
+        *dst = value;
+    } else if constexpr (sizeof(U) == 2) {
+        BigEndian::Store16(dst, value);
+    } else if constexpr (sizeof(U) == 4) {
+        BigEndian::Store32(dst, value);
+    } else if constexpr (sizeof(U) == 8) {
+        BigEndian::Store64(dst, value);
+    } else {
+        static_assert(sizeof(U) == 16);
+        BigEndian::Store64(dst, static_cast<uint64_t>(value >> 64));
+        BigEndian::Store64(dst + 8, static_cast<uint64_t>(value));
+    }
+}
+
+// Encode a column into its part of the normalized keys, so that comparing the keys by memcmp is comparing
+// the rows in the order of the sort desc. Visiting with null |keys| only computes the width of the part.
+//
+// Fixed-length values are stored in big endian with the sign bit flipped, and strings are padded with zeros
+// to the longest one and followed by their lengths. A nullable column with nulls has a leading byte to order
+// the nulls, whose values are zeros. Bytes are inverted for the descending order.
+//
+// The part is at most |max_width| bytes. Longer strings keep only a prefix of |max_width| bytes, and a value
+// wider than that keeps nothing, in both cases the part is truncated, i.e. equal parts don't mean equal rows.
+class ColumnKeyNormalizer final : public ColumnVisitorAdapter<ColumnKeyNormalizer> {
+public:
+    ColumnKeyNormalizer(const SortDesc& sort_desc, uint8_t* keys, size_t stride, size_t max_width)
+            : ColumnVisitorAdapter(this), _sort_desc(sort_desc), _keys(keys), _stride(stride), _max_width(max_width) {}
+
+    size_t width() const { return _width; }
+    bool truncated() const { return _truncated; }
+
+    Status do_visit(const NullableColumn& column) {
+        if (!column.has_null()) {
+            return column.data_column_ref().accept(this);
+        }
+        if (_max_width == 0) {
+            _truncated = true;
+            return Status::OK();
+        }
+        ColumnKeyNormalizer data_normalizer(_sort_desc, _keys == nullptr ? nullptr : _keys + 1, _stride,
+                                            _max_width - 1);
+        RETURN_IF_ERROR(column.data_column_ref().accept(&data_normalizer));
+        _width = data_normalizer.width() + 1;
+        _truncated = data_normalizer.truncated();
+        if (_keys == nullptr) {
+            return Status::OK();
+        }
+        const NullData& nulls = column.immutable_null_column_data();
+        const uint8_t null_byte = _sort_desc.is_null_first() ? 0 : 2;
+        uint8_t* key = _keys;
+        for (size_t i = 0; i < column.size(); i++, key += _stride) {
+            if (nulls[i]) {
+                key[0] = null_byte;
+                memset(key + 1, 0, _width - 1);
+            } else {
+                key[0] = 1;
+            }
+        }
+        return Status::OK();
+    }
+
+    template <typename T>
+    Status do_visit(const FixedLengthColumnBase<T>& column) {
+        if constexpr (is_normalizable_v<T>) {
+            using U = decltype(to_ordered_unsigned(std::declval<T>()));
+            if (sizeof(U) > _max_width) {
+                _truncated = true;
+                return Status::OK();
+            }
+            _width = sizeof(U);
+            if (_keys == nullptr) {
+                return Status::OK();
+            }
+            const auto& data = column.get_data();
+            uint8_t* key = _keys;
+            for (size_t i = 0; i < data.size(); i++, key += _stride) {
+                U value = to_ordered_unsigned(data[i]);
+                store_big_endian(key, _sort_desc.asc_order() ? value : static_cast<U>(~value));
+            }
+            return Status::OK();
+        } else {
+            return Status::NotSupported("column can not be normalized");
+        }
+    }
+
+    template <typename T>
+    Status do_visit(const BinaryColumnBase<T>& column) {
+        const auto& offsets = column.get_offset();
+        size_t max_length = 0;
+        for (size_t i = 0; i < column.size(); i++) {
+            max_length = std::max<size_t>(max_length, offsets[i + 1] - offsets[i]);
+        }
+        const size_t length_bytes = max_length <= UINT8_MAX ? 1 : (max_length <= UINT16_MAX ? 2 : 4);
+        _width = max_length + length_bytes;
+        if (_width > _max_width) {
+            // Keep the prefixes only, which order the strings but for the ties.
+            _width = _max_width;
+            _truncated = true;
+        }
+        if (_keys == nullptr) {
+            return Status::OK();
+        }
+        const uint8_t* bytes = column.get_bytes().data();
+        uint8_t* key = _keys;
+        const size_t prefix_length = _truncated ? _width : max_length;
+        for (size_t i = 0; i < column.size(); i++, key += _stride) {
+            size_t length = offsets[i + 1] - offsets[i];
+            size_t copied = std::min(length, prefix_length);
+            memcpy(key, bytes + offsets[i], copied);
+            memset(key + copied, 0, prefix_length - copied);
+            if (_truncated) {
+                // The prefixes are followed by nothing, the lengths are left to the comparisons.
+            } else if (length_bytes == 1) {
+                key[max_length] = length;
+            } else if (length_bytes == 2) {
+                BigEndian::Store16(key + max_length, length);
+            } else {
+                BigEndian::Store32(key + max_length, length);
+            }
+            if (!_sort_desc.asc_order()) {
+                for (size_t j = 0; j < _width; j++) {
+                    key[j] = ~key[j];
+                }
+            }
+        }
+        return Status::OK();
+    }
+
+    // All the rows are equal.
+    Status do_visit(const ConstColumn& column) {
+        _width = 0;
+        return Status::OK();
+    }
+
+    Status do_visit(const ArrayColumn& column) { return Status::NotSupported("column can not be normalized"); }
+    Status do_visit(const MapColumn& column) { return Status::NotSupported("column can not be normalized"); }
+    Status do_visit(const StructColumn& column) { return Status::NotSupported("column can not be normalized"); }
+    Status do_visit(const JsonColumn& column) { return Status::NotSupported("column can not be normalized"); }
+    template <typename T>
+    Status do_visit(const ObjectColumn<T>& column) {
+        return Status::NotSupported("column can not be normalized");
+    }
+
+private:
+    const SortDesc _sort_desc;
+    uint8_t* _keys;
+    const size_t _stride;
+    const size_t _max_width;
+    size_t _width = 0;
+    bool _truncated = false;
+};
+
+template <size_t W>
+struct NormalizedKey {
+    uint8_t key[W];
+    uint32_t row;
+};
+
+// MSD radix sort of the normalized keys. The scatters are stable and the small buckets are sorted by
+// the rows on equal keys, so the result is the same as a stable sort of the keys.
+// Only the first |key_width| bytes of the keys are sorted, the rest of the W bytes are the zero padding.
+template <size_t W>
+class NormalizedKeyRadixSorter {
+public:
+    using Key = NormalizedKey<W>;
+
+    NormalizedKeyRadixSorter(const std::atomic<bool>& cancel, size_t key_width)
+            : _cancel(cancel), _key_width(key_width) {
+        DCHECK_LE(key_width, W);
+    }
+
+    Status sort(Key* keys, Key* buffer, size_t n, size_t byte) {
+        while (byte < _key_width) {
+            if (n <= kSmallSortSize) {
+                const size_t len = _key_width - byte;
+                ::pdqsort(keys, keys + n, [byte, len](const Key& lhs, const Key& rhs) {
+                    int r = memcmp(lhs.key + byte, rhs.key + byte, len);
+                    return r < 0 || (r == 0 && lhs.row < rhs.row);
+                });
+                return Status::OK();
+            }
+            if (UNLIKELY(_cancel.load(std::memory_order_acquire))) {
+                return Status::Cancelled("Sort cancelled");
+            }
+            size_t counts[256] = {};
+            for (size_t i = 0; i < n; i++) {
+                counts[keys[i].key[byte]]++;
+            }
+            // Skip the byte shared by all the keys.
+            if (counts[keys[0].key[byte]] == n) {
+                byte++;
+                continue;
+            }
+            size_t offsets[256];
+            size_t offset = 0;
+            for (size_t b = 0; b < 256; b++) {
+                offsets[b] = offset;
+                offset += counts[b];
+            }
+            for (size_t i = 0; i < n; i++) {
+                buffer[offsets[keys[i].key[byte]]++] = keys[i];
+            }
+            memcpy(keys, buffer, n * sizeof(Key));
+            offset = 0;
+            for (size_t b = 0; b < 256; b++) {
+                if (counts[b] > 1) {
+                    RETURN_IF_ERROR(sort(keys + offset, buffer + offset, counts[b], byte + 1));
+                }
+                offset += counts[b];
+            }
+            return Status::OK();
+        }
+        // All the keys are equal, and the rows are in order already.
+        return Status::OK();
+    }
+
+private:
+    static constexpr size_t kSmallSortSize = 64;
+
+    const std::atomic<bool>& _cancel;
+    const size_t _key_width;
+};
+
+// Radix sort the normalized keys of the leading |widths.size()| columns into |permutation|, and mark the rows
+// of equal keys in |tie| if it's not null. |key_width| is the sum of |widths|.
+template <size_t W>
+static Status radix_sort_normalized_keys(const std::atomic<bool>& cancel, const Columns& columns,
+                                         const SortDescs& sort_desc, const std::vector<size_t>& widths,
+                                         size_t key_width, SmallPermutation* permutation, Tie* tie) {
+    using Key = NormalizedKey<W>;
+    size_t num_rows = columns[0]->size();
+    if (num_rows == 0) {
+        if (tie != nullptr) {
+            tie->clear();
+        }
+        return Status::OK();
+    }
+    // Zero initialized, so that the padding bytes are equal.
+    std::vector<Key> keys(num_rows);
+    uint8_t* base = reinterpret_cast<uint8_t*>(keys.data());
+    size_t offset = 0;
+    for (size_t col = 0; col < widths.size(); col++) {
+        ColumnKeyNormalizer normalizer(sort_desc.get_column_desc(col), base + offset, sizeof(Key), widths[col]);
+        RETURN_IF_ERROR(columns[col]->accept(&normalizer));
+        offset += widths[col];
+    }
+    for (uint32_t i = 0; i < num_rows; i++) {
+        keys[i].row = i;
+    }
+
+    std::vector<Key> buffer(num_rows);
+    NormalizedKeyRadixSorter<W> sorter(cancel, key_width);
+    RETURN_IF_ERROR(sorter.sort(keys.data(), buffer.data(), num_rows, 0));
+    for (size_t i = 0; i < num_rows; i++) {
+        (*permutation)[i].index_in_chunk = keys[i].row;
+    }
+    if (tie != nullptr) {
+        tie->resize(num_rows);
+        for (size_t i = 1; i < num_rows; i++) {
+            (*tie)[i] = memcmp(keys[i - 1].key, keys[i].key, key_width) == 0;
+        }
+        (*tie)[0] = 1;
+    }
+    return Status::OK();
+}
+
+static Status do_sort_by_normalized_keys(const std::atomic<bool>& cancel, const Columns& columns,
+                                         const SortDescs& sort_desc, size_t max_key_width, bool stable,
+                                         SmallPermutation* permutation) {
+    DCHECK_EQ(columns[0]->size(), permutation->size());
+    max_key_width = std::min(max_key_width, kMaxNormalizedKeyWidth);
+    // The leading columns are normalized, and the columns from |first_compared_column| are compared, including
+    // the last normalized one if its part of the keys is truncated.
+    std::vector<size_t> widths;
+    size_t key_width = 0;
+    size_t first_compared_column = columns.size();
+    for (size_t col = 0; col < columns.size(); col++) {
+        ColumnKeyNormalizer normalizer(sort_desc.get_column_desc(col), nullptr, 0, max_key_width - key_width);
+        Status st = columns[col]->accept(&normalizer);
+        if (st.is_not_supported()) {
+            first_compared_column = col;
+            break;
+        }
+        RETURN_IF_ERROR(st);
+        widths.push_back(normalizer.width());
+        key_width += normalizer.width();
+        if (normalizer.truncated()) {
+            first_compared_column = col;
+            break;
+        }
+    }
+    if (key_width == 0 && first_compared_column < columns.size()) {
+        return Status::NotSupported("sort key can not be normalized");
+    }
+
+    const size_t num_rows = columns[0]->size();
+    Tie tie;
+    Tie* key_tie = first_compared_column < columns.size() ? &tie : nullptr;
+    switch ((key_width + kNormalizedKeyAlignment - 1) / kNormalizedKeyAlignment) {
+    case 0:
+    case 1:
+        RETURN_IF_ERROR(radix_sort_normalized_keys<8>(cancel, columns, sort_desc, widths, key_width, permutation,
+                                                      key_tie));
+        break;
+    case 2:
+        RETURN_IF_ERROR(radix_sort_normalized_keys<16>(cancel, columns, sort_desc, widths, key_width, permutation,
+                                                       key_tie));
+        break;
+    case 3:
+        RETURN_IF_ERROR(radix_sort_normalized_keys<24>(cancel, columns, sort_desc, widths, key_width, permutation,
+                                                       key_tie));
+        break;
+    case 4:
+        RETURN_IF_ERROR(radix_sort_normalized_keys<32>(cancel, columns, sort_desc, widths, key_width, permutation,
+                                                       key_tie));
+        break;
+    case 5:
+        RETURN_IF_ERROR(radix_sort_normalized_keys<40>(cancel, columns, sort_desc, widths, key_width, permutation,
+                                                       key_tie));
+        break;
+    case 6:
+        RETURN_IF_ERROR(radix_sort_normalized_keys<48>(cancel, columns, sort_desc, widths, key_width, permutation,
+                                                       key_tie));
+        break;
+    case 7:
+        RETURN_IF_ERROR(radix_sort_normalized_keys<56>(cancel, columns, sort_desc, widths, key_width, permutation,
+                                                       key_tie));
+        break;
+    default:
+        RETURN_IF_ERROR(radix_sort_normalized_keys<64>(cancel, columns, sort_desc, widths, key_width, permutation,
+                                                       key_tie));
+        break;
+    }
+    if (key_tie == nullptr || num_rows == 0) {
+        return Status::OK();
+    }
+
+    // Sort the rows of equal keys by comparing the rest of the columns, like sort_and_tie_columns.
+    std::pair<int, int> range{0, num_rows};
+    for (size_t col = first_compared_column; col < columns.size(); col++) {
+        ColumnPtr column = columns[col];
+        bool build_tie = stable || col != columns.size() - 1;
+        RETURN_IF_ERROR(sort_and_tie_column(cancel, column, sort_desc.get_column_desc(col), *permutation, tie, range,
+                                            build_tie));
+    }
+    if (stable) {
+        TieIterator ti(tie);
+        while (ti.next()) {
+            ::pdqsort(
+                    permutation->begin() + ti.range_first, permutation->begin() + ti.range_last,
+                    [](SmallPermuteItem lhs, SmallPermuteItem rhs) { return lhs.index_in_chunk < rhs.index_in_chunk; });
+        }
+    }
+    return Status::OK();
+}
+
+Status stable_sort_by_normalized_keys(const std::atomic<bool>& cancel, const Columns& columns,
+                                      const SortDescs& sort_desc, size_t max_key_width,
+                                      SmallPermutation* permutation) {
+    if (columns.empty()) {
+        return Status::OK();
+    }
+    return do_sort_by_normalized_keys(cancel, columns, sort_desc, max_key_width, true, permutation);
+}
+
+Status sort_by_normalized_keys(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
+                               size_t max_key_width, Permutation* permutation) {
+    if (columns.empty()) {
+        return Status::OK();
+    }
+    SmallPermutation small_perm(columns[0]->size());
+    RETURN_IF_ERROR(do_sort_by_normalized_keys(cancel, columns, sort_desc, max_key_width, false, &small_perm));
+    restore_small_permutation(small_perm, *permutation);
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -45,6 +45,19 @@ Status sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& colu
 Status stable_sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
                                    SmallPermutation* permutation);
 
+// Sort multiple columns stably, by radix sorting the normalized keys of the rows, which are the sort keys
+// encoded into fixed-width bytes compared by memcmp, at most |max_key_width| bytes.
+// The keys cover the leading columns which could be normalized, and the prefixes of long strings, the rows of
+// equal keys are then sorted by comparing the rest of the columns.
+// Return NotSupported if the first column could not be normalized into the key at all.
+Status stable_sort_by_normalized_keys(const std::atomic<bool>& cancel, const Columns& columns,
+                                      const SortDescs& sort_desc, size_t max_key_width,
+                                      SmallPermutation* permutation);
+
+// The same as stable_sort_by_normalized_keys, but not stable, output the order in permutation array
+Status sort_by_normalized_keys(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
+                               size_t max_key_width, Permutation* permutation);
+
 // Sort multiple columns in vertical
 Status sort_vertical_columns(const std::atomic<bool>& cancel, const std::vector<ColumnPtr>& columns,
                              const SortDesc& sort_desc, Permutation& permutation, Tie& tie, std::pair<int, int> range,
@@ -0,0 +1,745 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/spill/io_uring_block_manager.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+// IORING_OP_READ, IORING_OP_WRITE and IORING_REGISTER_PROBE are enumerators, so check IO_URING_OP_SUPPORTED
+// instead, which is defined by the same header version (linux 5.6).
+#if defined(IO_URING_OP_SUPPORTED) && defined(IORING_FEAT_SINGLE_MMAP) && defined(__NR_io_uring_setup) && \
+        defined(__NR_io_uring_enter) && defined(__NR_io_uring_register)
+#define STARROCKS_HAVE_IO_URING 1
+#endif
+#endif
+
+#include "common/config.h"
+#include "exec/spill/common.h"
+#include "exec/spill/serde.h"
+#include "fmt/format.h"
+#include "fs/fs.h"
+#include "gutil/casts.h"
+#include "gutil/port.h"
+#include "util/uid_util.h"
+
+namespace starrocks::spill {
+
+static constexpr size_t kPageSize = AlignedBuffer::PAGE_SIZE;
+
+static size_t io_uring_buffer_size() {
+    return std::max<size_t>(kPageSize, ALIGN_UP(config::spill_io_uring_buffer_size, kPageSize));
+}
+
+#ifdef STARROCKS_HAVE_IO_URING
+
+// IoUring is a minimal wrapper of the io_uring syscalls, so that no extra dependency is needed. It is not
+// thread-safe, and the owner of each ring only submits a few requests at a time, so SQPOLL and the registered
+// buffers are not used.
+class IoUring {
+public:
+    static StatusOr<std::unique_ptr<IoUring>> create(uint32_t entries);
+
+    ~IoUring();
+
+    // Prepare a read or write of fd at offset, the result is reaped by `wait` with the same user_data.
+    // The requests are only sent to the kernel by `submit`.
+    Status prepare_read(int fd, void* buf, uint32_t len, uint64_t offset, uint64_t user_data) {
+        return _prepare(IORING_OP_READ, fd, buf, len, offset, user_data);
+    }
+    Status prepare_write(int fd, const void* buf, uint32_t len, uint64_t offset, uint64_t user_data) {
+        return _prepare(IORING_OP_WRITE, fd, const_cast<void*>(buf), len, offset, user_data);
+    }
+
+    // Submit all the prepared requests without waiting for them.
+    Status submit() { return _enter(0); }
+
+    // Check the kernel supports the read and write opcodes used by the ring. IORING_OP_READ and IORING_OP_WRITE
+    // are only added in 5.6, while io_uring_setup may succeed on older kernels.
+    Status probe_ops() const;
+
+    // Wait for the completion of the request identified by user_data, and return its result,
+    // which is the number of bytes read or written.
+    StatusOr<int32_t> wait(uint64_t user_data);
+
+private:
+    IoUring() = default;
+
+    Status _prepare(uint8_t opcode, int fd, void* buf, uint32_t len, uint64_t offset, uint64_t user_data);
+    Status _enter(uint32_t min_complete);
+    void _reap_completions();
+
+    int _fd = -1;
+    io_uring_params _params{};
+
+    void* _sq_ring = nullptr;
+    size_t _sq_ring_size = 0;
+    void* _cq_ring = nullptr;
+    size_t _cq_ring_size = 0;
+    io_uring_sqe* _sqes = nullptr;
+    size_t _sqes_size = 0;
+
+    uint32_t* _sq_head = nullptr;
+    uint32_t* _sq_tail = nullptr;
+    uint32_t _sq_mask = 0;
+    uint32_t* _sq_array = nullptr;
+    uint32_t* _cq_head = nullptr;
+    uint32_t* _cq_tail = nullptr;
+    uint32_t _cq_mask = 0;
+    io_uring_cqe* _cqes = nullptr;
+
+    // The sqes in [_sqe_head, _sqe_tail) are prepared but not added to the submission queue.
+    uint32_t _sqe_head = 0;
+    uint32_t _sqe_tail = 0;
+    // The number of the requests added to the submission queue but not consumed by the kernel.
+    uint32_t _num_unsubmitted = 0;
+    // The results of the completed requests which are not waited yet.
+    std::unordered_map<uint64_t, int32_t> _completed;
+};
+
+StatusOr<std::unique_ptr<IoUring>> IoUring::create(uint32_t entries) {
+    std::unique_ptr<IoUring> ring(new IoUring());
+    ring->_fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &ring->_params));
+    if (ring->_fd < 0) {
+        return Status::NotSupported(fmt::format("io_uring_setup failed: {}", std::strerror(errno)));
+    }
+    const auto& params = ring->_params;
+
+    ring->_sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    ring->_cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+        ring->_sq_ring_size = ring->_cq_ring_size = std::max(ring->_sq_ring_size, ring->_cq_ring_size);
+    }
+
+    auto mmap_ring = [&](size_t size, off_t offset) -> StatusOr<void*> {
+        void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->_fd, offset);
+        if (ptr == MAP_FAILED) {
+            return Status::NotSupported(fmt::format("mmap io_uring failed: {}", std::strerror(errno)));
+        }
+        return ptr;
+    };
+    ASSIGN_OR_RETURN(ring->_sq_ring, mmap_ring(ring->_sq_ring_size, IORING_OFF_SQ_RING));
+    if (single_mmap) {
+        ring->_cq_ring = ring->_sq_ring;
+    } else {
+        ASSIGN_OR_RETURN(ring->_cq_ring, mmap_ring(ring->_cq_ring_size, IORING_OFF_CQ_RING));
+    }
+    ring->_sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    ASSIGN_OR_RETURN(void* sqes, mmap_ring(ring->_sqes_size, IORING_OFF_SQES));
+    ring->_sqes = reinterpret_cast<io_uring_sqe*>(sqes);
+
+    auto* sq = reinterpret_cast<uint8_t*>(ring->_sq_ring);
+    ring->_sq_head = reinterpret_cast<uint32_t*>(sq + params.sq_off.head);
+    ring->_sq_tail = reinterpret_cast<uint32_t*>(sq + params.sq_off.tail);
+    ring->_sq_mask = *reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_mask);
+    ring->_sq_array = reinterpret_cast<uint32_t*>(sq + params.sq_off.array);
+    auto* cq = reinterpret_cast<uint8_t*>(ring->_cq_ring);
+    ring->_cq_head = reinterpret_cast<uint32_t*>(cq + params.cq_off.head);
+    ring->_cq_tail = reinterpret_cast<uint32_t*>(cq + params.cq_off.tail);
+    ring->_cq_mask = *reinterpret_cast<uint32_t*>(cq + params.cq_off.ring_mask);
+    ring->_cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    return ring;
+}
+
+Status IoUring::probe_ops() const {
+    constexpr size_t kMaxOps = 256;
+    std::vector<uint8_t> buffer(sizeof(io_uring_probe) + kMaxOps * sizeof(io_uring_probe_op), 0);
+    auto* probe = reinterpret_cast<io_uring_probe*>(buffer.data());
+    // IORING_REGISTER_PROBE is added in the same kernel version as IORING_OP_READ and IORING_OP_WRITE
+    if (syscall(__NR_io_uring_register, _fd, IORING_REGISTER_PROBE, probe, kMaxOps) < 0) {
+        return Status::NotSupported(fmt::format("io_uring probe failed: {}", std::strerror(errno)));
+    }
+    for (uint8_t opcode : {IORING_OP_READ, IORING_OP_WRITE}) {
+        if (opcode > probe->last_op || !(probe->ops[opcode].flags & IO_URING_OP_SUPPORTED)) {
+            return Status::NotSupported(fmt::format("io_uring opcode {} is not supported", opcode));
+        }
+    }
+    return Status::OK();
+}
+
+IoUring::~IoUring() {
+    if (_sqes != nullptr) {
+        munmap(_sqes, _sqes_size);
+    }
+    if (_cq_ring != nullptr && _cq_ring != _sq_ring) {
+        munmap(_cq_ring, _cq_ring_size);
+    }
+    if (_sq_ring != nullptr) {
+        munmap(_sq_ring, _sq_ring_size);
+    }
+    if (_fd >= 0) {
+        ::close(_fd);
+    }
+}
+
+Status IoUring::_prepare(uint8_t opcode, int fd, void* buf, uint32_t len, uint64_t offset, uint64_t user_data) {
+    uint32_t head = __atomic_load_n(_sq_head, __ATOMIC_ACQUIRE);
+    if (_sqe_tail - head >= _params.sq_entries) {
+        return Status::ResourceBusy("io_uring submission queue is full");
+    }
+    io_uring_sqe* sqe = &_sqes[_sqe_tail & _sq_mask];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(buf);
+    sqe->len = len;
+    sqe->off = offset;
+    sqe->user_data = user_data;
+    _sqe_tail++;
+    return Status::OK();
+}
+
+Status IoUring::_enter(uint32_t min_complete) {
+    uint32_t tail = *_sq_tail;
+    for (; _sqe_head != _sqe_tail; _sqe_head++) {
+        _sq_array[tail & _sq_mask] = _sqe_head & _sq_mask;
+        tail++;
+        _num_unsubmitted++;
+    }
+    __atomic_store_n(_sq_tail, tail, __ATOMIC_RELEASE);
+
+    uint32_t flags = min_complete > 0 ? IORING_ENTER_GETEVENTS : 0;
+    while (_num_unsubmitted > 0 || min_complete > 0) {
+        int ret = static_cast<int>(
+                syscall(__NR_io_uring_enter, _fd, _num_unsubmitted, min_complete, flags, nullptr, 0));
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return Status::IOError(fmt::format("io_uring_enter failed: {}", std::strerror(errno)));
+        }
+        _num_unsubmitted -= ret;
+        // The waiting is done once all the requests are submitted.
+        if (_num_unsubmitted == 0) {
+            break;
+        }
+    }
+    return Status::OK();
+}
+
+void IoUring::_reap_completions() {
+    uint32_t head = *_cq_head;
+    uint32_t tail = __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE);
+    for (; head != tail; head++) {
+        const io_uring_cqe& cqe = _cqes[head & _cq_mask];
+        _completed[cqe.user_data] = cqe.res;
+    }
+    __atomic_store_n(_cq_head, head, __ATOMIC_RELEASE);
+}
+
+StatusOr<int32_t> IoUring::wait(uint64_t user_data) {
+    while (true) {
+        _reap_completions();
+        if (auto iter = _completed.find(user_data); iter != _completed.end()) {
+            int32_t res = iter->second;
+            _completed.erase(iter);
+            return res;
+        }
+        RETURN_IF_ERROR(_enter(1));
+    }
+}
+
+#else
+
+class IoUring {
+public:
+    static StatusOr<std::unique_ptr<IoUring>> create(uint32_t entries) {
+        return Status::NotSupported("io_uring is not supported");
+    }
+    Status prepare_read(int fd, void* buf, uint32_t len, uint64_t offset, uint64_t user_data) {
+        return Status::NotSupported("io_uring is not supported");
+    }
+    Status prepare_write(int fd, const void* buf, uint32_t len, uint64_t offset, uint64_t user_data) {
+        return Status::NotSupported("io_uring is not supported");
+    }
+    Status submit() { return Status::NotSupported("io_uring is not supported"); }
+    Status probe_ops() const { return Status::NotSupported("io_uring is not supported"); }
+    StatusOr<int32_t> wait(uint64_t user_data) { return Status::NotSupported("io_uring is not supported"); }
+};
+
+#endif
+
+// the number of requests in flight of a container or a reader never exceeds the number of its buffers
+static constexpr uint32_t kRingEntries = 4;
+static constexpr int kNumBuffers = 2;
+
+class IoUringBlockContainer {
+public:
+    IoUringBlockContainer(DirPtr dir, const TUniqueId& query_id, const TUniqueId& fragment_instance_id,
+                          int32_t plan_node_id, std::string plan_node_name, uint64_t id)
+            : _dir(std::move(dir)),
+              _query_id(query_id),
+              _fragment_instance_id(fragment_instance_id),
+              _plan_node_id(plan_node_id),
+              _plan_node_name(std::move(plan_node_name)),
+              _id(id) {}
+
+    ~IoUringBlockContainer() {
+        // the kernel may still access the buffers of the requests in flight
+        for (int i = 0; i < kNumBuffers; i++) {
+            WARN_IF_ERROR(_wait_buffer(i), fmt::format("cannot write spill container file: {}", path()));
+        }
+        _ring.reset();
+        if (_fd >= 0) {
+            ::close(_fd);
+        }
+        TRACE_SPILL_LOG << "delete spill container file: " << path();
+        WARN_IF_ERROR(_dir->fs()->delete_file(path()), fmt::format("cannot delete spill container file: {}", path()));
+        _dir->dec_size(_acquired_data_size);
+        // try to delete related dir, only the last one can success, we ignore the error
+        (void)(_dir->fs()->delete_dir(parent_path()));
+    }
+
+    Status open();
+
+    Dir* dir() const { return _dir.get(); }
+    int32_t plan_node_id() const { return _plan_node_id; }
+    int fd() const { return _fd; }
+    // the offset of the next block, which is always page-aligned
+    size_t size() const { return _file_size; }
+
+    std::string path() const {
+        return fmt::format("{}/{}/{}-{}-{}-{}", _dir->dir(), print_id(_query_id), print_id(_fragment_instance_id),
+                           _plan_node_name, _plan_node_id, _id);
+    }
+    std::string parent_path() const { return fmt::format("{}/{}", _dir->dir(), print_id(_query_id)); }
+
+    bool pre_allocate(size_t allocate_size) {
+        // the block is padded to the page size when it is flushed, only the last page of the block is charged
+        // for the padding.
+        size_t block_allocated_size = _block_allocated_size + allocate_size;
+        size_t charge_size = ALIGN_UP(block_allocated_size, kPageSize) - _block_charged_size;
+        if (charge_size == 0 || _dir->inc_size(charge_size)) {
+            _block_allocated_size = block_allocated_size;
+            _block_charged_size += charge_size;
+            _acquired_data_size += charge_size;
+            return true;
+        }
+        return false;
+    }
+
+    Status append_data(const std::vector<Slice>& data);
+
+    // pad the current block to the page size, and wait for all its data to be written
+    Status flush();
+
+private:
+    Status _submit_buffer(int index);
+    Status _wait_buffer(int index);
+
+    DirPtr _dir;
+    TUniqueId _query_id;
+    TUniqueId _fragment_instance_id;
+    int32_t _plan_node_id;
+    std::string _plan_node_name;
+    uint64_t _id;
+
+    int _fd = -1;
+    std::unique_ptr<IoUring> _ring;
+    AlignedBuffer _buffers[kNumBuffers];
+    size_t _buffer_used[kNumBuffers] = {0, 0};
+    size_t _buffer_written[kNumBuffers] = {0, 0};
+    bool _in_flight[kNumBuffers] = {false, false};
+    int _current = 0;
+
+    // the offset where the current buffer is written to
+    size_t _file_size = 0;
+    // acquired data size from Dir
+    size_t _acquired_data_size = 0;
+    // pre-allocated size of the current block, and the page-aligned size charged to Dir for it
+    size_t _block_allocated_size = 0;
+    size_t _block_charged_size = 0;
+};
+
+static StatusOr<int> open_spill_file(const std::string& path, int flags) {
+    int fd = -1;
+    if (config::spill_io_uring_direct_io) {
+        RETRY_ON_EINTR(fd, ::open(path.c_str(), flags | O_DIRECT, 0644));
+    }
+    // some file systems like tmpfs don't support O_DIRECT
+    if (fd < 0 && (!config::spill_io_uring_direct_io || errno == EINVAL)) {
+        RETRY_ON_EINTR(fd, ::open(path.c_str(), flags, 0644));
+    }
+    if (fd < 0) {
+        return Status::IOError(fmt::format("cannot open spill file {}: {}", path, std::strerror(errno)));
+    }
+    return fd;
+}
+
+Status IoUringBlockContainer::open() {
+    ASSIGN_OR_RETURN(_fd, open_spill_file(path(), O_CREAT | O_RDWR | O_CLOEXEC));
+    ASSIGN_OR_RETURN(_ring, IoUring::create(kRingEntries));
+    for (auto& buffer : _buffers) {
+        buffer.resize(io_uring_buffer_size());
+    }
+    TRACE_SPILL_LOG << "create new io_uring container file: " << path();
+    return Status::OK();
+}
+
+Status IoUringBlockContainer::append_data(const std::vector<Slice>& data) {
+    for (const auto& slice : data) {
+        const auto* src = reinterpret_cast<const uint8_t*>(slice.data);
+        size_t remaining = slice.size;
+        while (remaining > 0) {
+            auto& buffer = _buffers[_current];
+            size_t copy_size = std::min(remaining, buffer.size() - _buffer_used[_current]);
+            memcpy(buffer.data() + _buffer_used[_current], src, copy_size);
+            _buffer_used[_current] += copy_size;
+            src += copy_size;
+            remaining -= copy_size;
+            if (_buffer_used[_current] == buffer.size()) {
+                RETURN_IF_ERROR(_submit_buffer(_current));
+                _current = (_current + 1) % kNumBuffers;
+                RETURN_IF_ERROR(_wait_buffer(_current));
+            }
+        }
+    }
+    return Status::OK();
+}
+
+Status IoUringBlockContainer::flush() {
+    size_t used = _buffer_used[_current];
+    if (used > 0) {
+        size_t padded_size = ALIGN_UP(used, kPageSize);
+        memset(_buffers[_current].data() + used, 0, padded_size - used);
+        _buffer_used[_current] = padded_size;
+        RETURN_IF_ERROR(_submit_buffer(_current));
+        _current = (_current + 1) % kNumBuffers;
+    }
+    _block_allocated_size = 0;
+    _block_charged_size = 0;
+    for (int i = 0; i < kNumBuffers; i++) {
+        RETURN_IF_ERROR(_wait_buffer(i));
+    }
+    return Status::OK();
+}
+
+Status IoUringBlockContainer::_submit_buffer(int index) {
+    DCHECK(!_in_flight[index]);
+    RETURN_IF_ERROR(_ring->prepare_write(_fd, _buffers[index].data(), _buffer_used[index], _file_size, index));
+    RETURN_IF_ERROR(_ring->submit());
+    _in_flight[index] = true;
+    _buffer_written[index] = _buffer_used[index];
+    _file_size += _buffer_used[index];
+    return Status::OK();
+}
+
+Status IoUringBlockContainer::_wait_buffer(int index) {
+    if (!_in_flight[index]) {
+        return Status::OK();
+    }
+    ASSIGN_OR_RETURN(int32_t res, _ring->wait(index));
+    _in_flight[index] = false;
+    _buffer_used[index] = 0;
+    if (res < 0) {
+        return Status::IOError(fmt::format("cannot write spill file {}: {}", path(), std::strerror(-res)));
+    }
+    if (static_cast<size_t>(res) != _buffer_written[index]) {
+        return Status::IOError(
+                fmt::format("short write of spill file {}, expected: {}, actual: {}", path(), _buffer_written[index],
+                            res));
+    }
+    return Status::OK();
+}
+
+class IoUringBlockReader final : public BlockReader {
+public:
+    IoUringBlockReader(const Block* block, IoUringBlockContainerPtr container, size_t offset)
+            : BlockReader(block), _container(std::move(container)), _begin(offset) {}
+
+    ~IoUringBlockReader() override {
+        // the kernel may still access the buffers of the requests in flight
+        for (int i = 0; i < kNumBuffers; i++) {
+            if (_in_flight[i]) {
+                (void)_ring->wait(i);
+            }
+        }
+    }
+
+    Status read_fully(void* data, int64_t count) override;
+
+    std::string debug_string() override { return _block->debug_string(); }
+
+    const Block* block() const override { return _block; }
+
+private:
+    Status _open();
+    // read ahead the next range of the block into the buffer, if the block is not read to the end
+    Status _read_ahead(int index);
+    Status _wait_buffer(int index);
+
+    IoUringBlockContainerPtr _container;
+    // the offset of the block in the container file, which is page-aligned
+    const size_t _begin;
+
+    bool _opened = false;
+    // nullptr if no ring can be set up for this reader, e.g. the memlock limit is reached,
+    // and the ranges are read by the blocking pread like LogBlockReader.
+    std::unique_ptr<IoUring> _ring;
+    AlignedBuffer _buffers[kNumBuffers];
+    size_t _buffer_size[kNumBuffers] = {0, 0};
+    bool _in_flight[kNumBuffers] = {false, false};
+    int _current = 0;
+    size_t _current_pos = 0;
+
+    // the offset of the next range to read ahead
+    size_t _next_read_offset = 0;
+    // the bytes of the block consumed by read_fully
+    size_t _offset = 0;
+};
+
+Status IoUringBlockReader::_open() {
+    auto ring = IoUring::create(kRingEntries);
+    if (ring.ok()) {
+        _ring = std::move(ring.value());
+    } else {
+        LOG_EVERY_N(WARNING, 100) << "cannot set up io_uring for spill reader, fall back to blocking reads: "
+                                  << ring.status();
+    }
+    _opened = true;
+    for (auto& buffer : _buffers) {
+        buffer.resize(io_uring_buffer_size());
+    }
+    _next_read_offset = _begin;
+    for (int i = 0; i < kNumBuffers; i++) {
+        RETURN_IF_ERROR(_read_ahead(i));
+    }
+    _current = 0;
+    _current_pos = 0;
+    return _wait_buffer(_current);
+}
+
+Status IoUringBlockReader::_read_ahead(int index) {
+    DCHECK(!_in_flight[index]);
+    _buffer_size[index] = 0;
+    size_t end = _begin + ALIGN_UP(_block->size(), kPageSize);
+    if (_next_read_offset >= end) {
+        return Status::OK();
+    }
+    size_t len = std::min(_buffers[index].size(), end - _next_read_offset);
+    if (_ring == nullptr) {
+        ssize_t res = 0;
+        RETRY_ON_EINTR(res, ::pread(_container->fd(), _buffers[index].data(), len, _next_read_offset));
+        if (res < 0) {
+            return Status::IOError(
+                    fmt::format("cannot read spill file {}: {}", _container->path(), std::strerror(errno)));
+        }
+        _buffer_size[index] = res;
+        _next_read_offset += len;
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_ring->prepare_read(_container->fd(), _buffers[index].data(), len, _next_read_offset, index));
+    RETURN_IF_ERROR(_ring->submit());
+    _in_flight[index] = true;
+    _next_read_offset += len;
+    return Status::OK();
+}
+
+Status IoUringBlockReader::_wait_buffer(int index) {
+    if (!_in_flight[index]) {
+        return Status::OK();
+    }
+    ASSIGN_OR_RETURN(int32_t res, _ring->wait(index));
+    _in_flight[index] = false;
+    if (res < 0) {
+        return Status::IOError(
+                fmt::format("cannot read spill file {}: {}", _container->path(), std::strerror(-res)));
+    }
+    _buffer_size[index] = res;
+    return Status::OK();
+}
+
+Status IoUringBlockReader::read_fully(void* data, int64_t count) {
+    if (_offset + count > _block->size()) {
+        return Status::EndOfFile("no more data in this block");
+    }
+    if (!_opened) {
+        RETURN_IF_ERROR(_open());
+    }
+
+    auto* dst = reinterpret_cast<uint8_t*>(data);
+    size_t remaining = count;
+    while (remaining > 0) {
+        if (_current_pos == _buffer_size[_current]) {
+            // the current buffer is consumed, reuse it to read ahead and switch to the next one
+            RETURN_IF_ERROR(_read_ahead(_current));
+            _current = (_current + 1) % kNumBuffers;
+            _current_pos = 0;
+            RETURN_IF_ERROR(_wait_buffer(_current));
+            RETURN_IF(_buffer_size[_current] == 0,
+                      Status::InternalError(fmt::format("block's length is mismatched, expected: {}, actual: {}",
+                                                        _block->size(), _offset)));
+        }
+        size_t copy_size = std::min(remaining, _buffer_size[_current] - _current_pos);
+        memcpy(dst, _buffers[_current].data() + _current_pos, copy_size);
+        _current_pos += copy_size;
+        dst += copy_size;
+        remaining -= copy_size;
+        _offset += copy_size;
+    }
+    return Status::OK();
+}
+
+class IoUringBlock : public Block {
+public:
+    IoUringBlock(IoUringBlockContainerPtr container, size_t offset)
+            : _container(std::move(container)), _offset(offset) {}
+
+    ~IoUringBlock() override = default;
+
+    IoUringBlockContainerPtr container() const { return _container; }
+
+    Status append(const std::vector<Slice>& data) override {
+        RETURN_IF_ERROR(_container->append_data(data));
+        std::for_each(data.begin(), data.end(), [&](const Slice& slice) { _size += slice.size; });
+        return Status::OK();
+    }
+
+    Status flush() override { return _container->flush(); }
+
+    std::shared_ptr<BlockReader> get_reader() override {
+        return std::make_shared<IoUringBlockReader>(this, _container, _offset);
+    }
+
+    std::string debug_string() const override {
+        return fmt::format("IoUringBlock:{}[container={}, offset={}, len={}]", (void*)this, _container->path(),
+                           _offset, _size);
+    }
+
+    bool preallocate(size_t write_size) override { return _container->pre_allocate(write_size); }
+
+private:
+    IoUringBlockContainerPtr _container;
+    size_t _offset{};
+};
+
+IoUringBlockManager::IoUringBlockManager(TUniqueId query_id, DirManager* dir_mgr)
+        : _query_id(std::move(query_id)), _dir_mgr(dir_mgr) {
+    _max_container_bytes = config::spill_max_log_block_container_bytes > 0 ? config::spill_max_log_block_container_bytes
+                                                                           : kDefaultMaxContainerBytes;
+}
+
+IoUringBlockManager::~IoUringBlockManager() = default;
+
+// The blocks acquired from _fallback_block_mgr are LogBlocks.
+static bool is_io_uring_block(const BlockPtr& block) {
+    return dynamic_cast<IoUringBlock*>(block.get()) != nullptr;
+}
+
+Status IoUringBlockManager::open() {
+    return Status::OK();
+}
+
+void IoUringBlockManager::close() {
+    if (_fallback_block_mgr != nullptr) {
+        _fallback_block_mgr->close();
+    }
+}
+
+bool IoUringBlockManager::is_supported() {
+    static bool supported = []() {
+        auto ring = IoUring::create(kRingEntries);
+        Status st = ring.ok() ? ring.value()->probe_ops() : ring.status();
+        if (!st.ok()) {
+            LOG(WARNING) << "io_uring is not supported, fall back to LogBlockManager: " << st;
+        }
+        return st.ok();
+    }();
+    return supported;
+}
+
+StatusOr<BlockPtr> IoUringBlockManager::acquire_block(const AcquireBlockOptions& opts) {
+    DCHECK(opts.block_size > 0) << "block size should be larger than 0";
+    AcquireDirOptions acquire_dir_opts;
+    acquire_dir_opts.data_size = opts.block_size;
+    ASSIGN_OR_RETURN(auto dir, _dir_mgr->acquire_writable_dir(acquire_dir_opts));
+
+    auto maybe_container = get_or_create_container(dir, opts.fragment_instance_id, opts.plan_node_id, opts.name);
+    if (maybe_container.status().is_not_supported()) {
+        // is_supported() has probed io_uring, so the ring of a new container can only fail to be set up
+        // at runtime, e.g. too many rings or the memlock limit is reached. Spill it without io_uring then.
+        LOG_EVERY_N(WARNING, 100) << "cannot set up io_uring for spill container, fall back to LogBlockManager: "
+                                  << maybe_container.status();
+        // LogBlockManager acquires a dir by itself.
+        dir->dec_size(opts.block_size);
+        ASSIGN_OR_RETURN(auto* fallback_block_mgr, _get_fallback_block_manager());
+        return fallback_block_mgr->acquire_block(opts);
+    }
+    ASSIGN_OR_RETURN(auto container, std::move(maybe_container));
+    auto res = std::make_shared<IoUringBlock>(container, container->size());
+    res->set_is_remote(dir->is_remote());
+    return res;
+}
+
+Status IoUringBlockManager::release_block(const BlockPtr& block) {
+    if (!is_io_uring_block(block)) {
+        DCHECK(_fallback_block_mgr != nullptr);
+        return _fallback_block_mgr->release_block(block);
+    }
+    auto container = down_cast<IoUringBlock*>(block.get())->container();
+    TRACE_SPILL_LOG << "release block: " << block->debug_string();
+    std::lock_guard<std::mutex> l(_mutex);
+    if (container->size() >= _max_container_bytes) {
+        TRACE_SPILL_LOG << "mark container as full: " << container->path();
+        _full_containers.emplace_back(std::move(container));
+    } else {
+        TRACE_SPILL_LOG << "return container to the pool: " << container->path();
+        _available_containers[container->dir()][container->plan_node_id()].push(std::move(container));
+    }
+    return Status::OK();
+}
+
+StatusOr<LogBlockManager*> IoUringBlockManager::_get_fallback_block_manager() {
+    std::lock_guard<std::mutex> l(_mutex);
+    if (_fallback_block_mgr == nullptr) {
+        auto block_mgr = std::make_unique<LogBlockManager>(_query_id, _dir_mgr);
+        RETURN_IF_ERROR(block_mgr->open());
+        _fallback_block_mgr = std::move(block_mgr);
+    }
+    return _fallback_block_mgr.get();
+}
+
+StatusOr<IoUringBlockContainerPtr> IoUringBlockManager::get_or_create_container(
+        const DirPtr& dir, const TUniqueId& fragment_instance_id, int32_t plan_node_id,
+        const std::string& plan_node_name) {
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        auto& containers = _available_containers[dir.get()][plan_node_id];
+        if (!containers.empty()) {
+            auto container = std::move(containers.front());
+            containers.pop();
+            TRACE_SPILL_LOG << "return an existed container: " << container->path();
+            return container;
+        }
+    }
+    uint64_t id = _next_container_id++;
+    std::string container_dir = dir->dir() + "/" + print_id(_query_id);
+    RETURN_IF_ERROR(dir->fs()->create_dir_if_missing(container_dir));
+    auto container = std::make_shared<IoUringBlockContainer>(dir, _query_id, fragment_instance_id, plan_node_id,
+                                                             plan_node_name, id);
+    RETURN_IF_ERROR(container->open());
+    return container;
+}
+
+} // namespace starrocks::spill
@@ -0,0 +1,87 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+#include "exec/spill/block_manager.h"
+#include "exec/spill/dir_manager.h"
+#include "exec/spill/log_block_manager.h"
+
+namespace starrocks::spill {
+
+class IoUringBlockContainer;
+using IoUringBlockContainerPtr = std::shared_ptr<IoUringBlockContainer>;
+
+// IoUringBlockManager is an implementation of BlockManager for the local disks, which clusters the Blocks into
+// several large container files like LogBlockManager, but writes and reads them through io_uring instead of the
+// blocking syscalls.
+//
+// Each container owns a ring and two page-aligned write buffers. Block::append copies the data into the current
+// buffer, and a full buffer is submitted asynchronously while the other one is being filled, so the serialization
+// of the next chunks overlaps with the disk writes. Block::flush pads the last buffer to the page size and waits for
+// all the writes, so every Block starts at a page-aligned offset and the files can be opened with O_DIRECT.
+//
+// Each BlockReader owns a ring and two read buffers, and always keeps the next buffer being read ahead while
+// read_fully consumes the current one.
+//
+// It is only used when spill_enable_io_uring is true and the kernel supports io_uring, see `is_supported`.
+// A ring may still fail to be set up at runtime, e.g. the memlock limit is reached. Then the new blocks are
+// acquired from a LogBlockManager, and a reader without a ring reads the container by the blocking pread.
+class IoUringBlockManager : public BlockManager {
+public:
+    IoUringBlockManager(TUniqueId query_id, DirManager* dir_mgr);
+    ~IoUringBlockManager() override;
+
+    Status open() override;
+    void close() override;
+
+    StatusOr<BlockPtr> acquire_block(const AcquireBlockOptions& opts) override;
+    Status release_block(const BlockPtr& block) override;
+
+    // Whether io_uring can be set up in the current process and supports the read and write opcodes,
+    // the result is probed once and cached.
+    static bool is_supported();
+
+private:
+    StatusOr<LogBlockManager*> _get_fallback_block_manager();
+
+    StatusOr<IoUringBlockContainerPtr> get_or_create_container(const DirPtr& dir,
+                                                               const TUniqueId& fragment_instance_id,
+                                                               int32_t plan_node_id, const std::string& plan_node_name);
+
+    typedef std::queue<IoUringBlockContainerPtr> ContainerQueue;
+    typedef std::unordered_map<int32_t, ContainerQueue> PlanNodeContainerMap;
+
+    TUniqueId _query_id;
+    DirManager* _dir_mgr = nullptr;
+    int64_t _max_container_bytes;
+
+    std::atomic<uint64_t> _next_container_id = 0;
+    std::mutex _mutex;
+    std::unordered_map<Dir*, PlanNodeContainerMap> _available_containers;
+    std::vector<IoUringBlockContainerPtr> _full_containers;
+    // created on the first time a ring of a new container cannot be set up
+    std::unique_ptr<LogBlockManager> _fallback_block_mgr;
+
+    const static int64_t kDefaultMaxContainerBytes = 10L * 1024 * 1024 * 1024; // 10GB
+};
+
+} // namespace starrocks::spill
@@ -17,19 +17,28 @@
 #include <cstdint>
 #include <memory>
 
+#include "common/config.h"
 #include "exec/spill/dir_manager.h"
 #include "exec/spill/file_block_manager.h"
 #include "exec/spill/hybird_block_manager.h"
+#include "exec/spill/io_uring_block_manager.h"
 #include "exec/spill/log_block_manager.h"
 #include "runtime/exec_env.h"
 
 namespace starrocks::spill {
 
+static std::unique_ptr<BlockManager> create_local_block_manager(const TUniqueId& uid) {
+    if (config::spill_enable_io_uring && IoUringBlockManager::is_supported()) {
+        return std::make_unique<IoUringBlockManager>(uid, ExecEnv::GetInstance()->spill_dir_mgr());
+    }
+    return std::make_unique<LogBlockManager>(uid, ExecEnv::GetInstance()->spill_dir_mgr());
+}
+
 Status QuerySpillManager::init_block_manager(const TQueryOptions& query_options) {
     bool enable_spill_to_remote_storage =
             query_options.__isset.enable_spill_to_remote_storage && query_options.enable_spill_to_remote_storage;
     if (!enable_spill_to_remote_storage) {
-        _block_manager = std::make_unique<LogBlockManager>(_uid, ExecEnv::GetInstance()->spill_dir_mgr());
+        _block_manager = create_local_block_manager(_uid);
         return Status::OK();
     }
     DCHECK(query_options.__isset.spill_to_remote_storage_options);
@@ -61,7 +70,7 @@ Status QuerySpillManager::init_block_manager(const TQueryOptions& query_options)
     }
 
     // init block manager
-    auto local_block_manager = std::make_unique<LogBlockManager>(_uid, ExecEnv::GetInstance()->spill_dir_mgr());
+    auto local_block_manager = create_local_block_manager(_uid);
     auto remote_block_manager = std::make_unique<FileBlockManager>(_uid, _remote_dir_manager.get());
     _block_manager =
             std::make_unique<HyBirdBlockManager>(_uid, std::move(local_block_manager), std::move(remote_block_manager));
@@ -16,6 +16,7 @@
 
 #include <cstring>
 
+#include "common/config.h"
 #include "exec/spill/options.h"
 #include "exec/spill/spiller.h"
 #include "gen_cpp/types.pb.h"
@@ -23,22 +24,22 @@
 #include "runtime/runtime_state.h"
 #include "serde/column_array_serde.h"
 #include "serde/encode_context.h"
+#include "util/compression/block_compression.h"
 #include "util/raw_container.h"
 
 namespace starrocks::spill {
 
 class ColumnarSerde : public Serde {
 public:
-    ColumnarSerde(Spiller* parent, ChunkBuilder chunk_builder)
-            : Serde(parent), _chunk_builder(std::move(chunk_builder)) {}
+    ColumnarSerde(Spiller* parent, ChunkBuilder chunk_builder, int encode_level)
+            : Serde(parent), _chunk_builder(std::move(chunk_builder)), _encode_level(encode_level) {}
     ~ColumnarSerde() override = default;
 
     Status prepare() override {
         RACE_DETECT(detect_prepare);
         if (_encode_context == nullptr) {
             auto column_number = _parent->chunk_builder().column_number();
-            auto encode_level = _parent->options().encode_level;
-            _encode_context = serde::EncodeContext::get_encode_context_shared_ptr(column_number, encode_level);
+            _encode_context = serde::EncodeContext::get_encode_context_shared_ptr(column_number, _encode_level);
         }
         return Status::OK();
     }
@@ -47,6 +48,17 @@ public:
     Status serialize(RuntimeState* state, SerdeContext& ctx, const ChunkPtr& chunk,
                      const SpillOutputDataStreamPtr& output, bool aligned) override;
 
+protected:
+    size_t _max_serialized_size(const ChunkPtr& chunk) const;
+
+    // serialize the encode levels and the columns of chunk into buf, return the end of the serialized data.
+    // padding_size is set to the size of the padding required by the decoding after the serialized data.
+    StatusOr<uint8_t*> _serialize_columns(const ChunkPtr& chunk, uint8_t* buf, int* padding_size);
+    // deserialize the data serialized by _serialize_columns into the columns of chunk
+    void _deserialize_columns(const uint8_t* buf, Chunk* chunk);
+
+    ChunkBuilder _chunk_builder;
+
 private:
     // data format
     // header|encode levels|attachment...
@@ -57,8 +69,6 @@ private:
     static constexpr int32_t HEADER_SIZE = ATTACHMENT_SIZE_OFFSET + sizeof(int64_t);
     static constexpr int32_t SEQUENCE_MAGIC_ID = 0xface;
 
-    size_t _max_serialized_size(const ChunkPtr& chunk) const;
-
     inline const std::vector<uint32_t>& _get_encode_levels() {
         DCHECK(_encode_context != nullptr);
         std::shared_lock l(_mutex);
@@ -74,7 +84,7 @@ private:
         _encode_context->adjust_encode_levels();
     }
 
-    ChunkBuilder _chunk_builder;
+    const int _encode_level;
     // assuming that the chunks processed by the same Spiller are similar,
     // so we maintain a context for each ColumnarSerde, which may be accessed by multiple threads.
     // here a std::shared_mutex is used to ensure concurrency safety.
@@ -99,6 +109,44 @@ size_t ColumnarSerde::_max_serialized_size(const ChunkPtr& chunk) const {
     return total_size;
 }
 
+StatusOr<uint8_t*> ColumnarSerde::_serialize_columns(const ChunkPtr& chunk, uint8_t* buf, int* padding_size) {
+    const auto& columns = chunk->columns();
+    // acquire encode level
+    auto encode_levels = _get_encode_levels();
+    for (auto encode_level : encode_levels) {
+        UNALIGNED_STORE32(buf, encode_level);
+        buf += sizeof(uint32_t);
+    }
+
+    // used to record raw_bytes and encoded_bytes for each column
+    std::vector<std::pair<uint64_t, uint64_t>> column_stats;
+    column_stats.reserve(columns.size());
+    // serialize to io buffer
+    *padding_size = 0;
+    for (size_t i = 0; i < columns.size(); i++) {
+        uint8_t* begin = buf;
+        buf = serde::ColumnArraySerde::serialize(*columns[i], buf, false, encode_levels[i]);
+        if (UNLIKELY(buf == nullptr)) {
+            return Status::InternalError("unsupported column occurs in spill serialize phase");
+        }
+        column_stats.emplace_back(columns[i]->byte_size(), buf - begin);
+        if (serde::EncodeContext::enable_encode_integer(encode_levels[i])) {
+            *padding_size = serde::EncodeContext::STREAMVBYTE_PADDING_SIZE;
+        }
+    }
+    _update_encode_stats(column_stats);
+    return buf;
+}
+
+void ColumnarSerde::_deserialize_columns(const uint8_t* buf, Chunk* chunk) {
+    auto& columns = chunk->columns();
+    const auto* encode_levels = reinterpret_cast<const uint32_t*>(buf);
+    const uint8_t* read_cursor = buf + columns.size() * sizeof(uint32_t);
+    for (size_t i = 0; i < columns.size(); i++) {
+        read_cursor = serde::ColumnArraySerde::deserialize(read_cursor, columns[i].get(), false, encode_levels[i]);
+    }
+}
+
 Status ColumnarSerde::serialize(RuntimeState* state, SerdeContext& ctx, const ChunkPtr& chunk,
                                 const SpillOutputDataStreamPtr& output, bool aligned) {
     raw::RawString& serialize_buffer = ctx.serialize_buffer;
@@ -109,45 +157,19 @@ Status ColumnarSerde::serialize(RuntimeState* state, SerdeContext& ctx, const Ch
             ALIGNED_SIZE = AlignedBuffer::PAGE_SIZE;
         }
         ctx.serialize_buffer.clear();
-        const auto& columns = chunk->columns();
         // header|attachment...
         // i32 sequence_id|i64 chunk size|encode level|attachment(column data)...
         char header_buffer[HEADER_SIZE];
         UNALIGNED_STORE32(header_buffer + SEQUENCE_OFFSET, SEQUENCE_MAGIC_ID);
 
-        size_t encode_level_sizes = columns.size() * sizeof(int32_t);
+        size_t encode_level_sizes = chunk->num_columns() * sizeof(int32_t);
         size_t max_serialized_size = _max_serialized_size(chunk);
         ctx.serialize_buffer.resize(ALIGN_UP(HEADER_SIZE + encode_level_sizes + max_serialized_size, ALIGNED_SIZE));
         uint8_t* buf = reinterpret_cast<uint8_t*>(serialize_buffer.data());
         const uint8_t* head = buf;
 
-        // acquire encode level
-        auto encode_levels = _get_encode_levels();
-        {
-            buf = buf + HEADER_SIZE;
-            for (auto encode_level : encode_levels) {
-                UNALIGNED_STORE32(buf, encode_level);
-                buf += sizeof(uint32_t);
-            }
-        }
-
-        // used to record raw_bytes and encoded_bytes for each column
-        std::vector<std::pair<uint64_t, uint64_t>> column_stats;
-        column_stats.reserve(columns.size());
-        // serialize to io buffer
         int padding_size = 0;
-        for (size_t i = 0; i < columns.size(); i++) {
-            uint8_t* begin = buf;
-            buf = serde::ColumnArraySerde::serialize(*columns[i], buf, false, encode_levels[i]);
-            if (UNLIKELY(buf == nullptr)) {
-                return Status::InternalError("unsupported column occurs in spill serialize phase");
-            }
-            column_stats.emplace_back(columns[i]->byte_size(), buf - begin);
-            if (serde::EncodeContext::enable_encode_integer(encode_levels[i])) {
-                padding_size = serde::EncodeContext::STREAMVBYTE_PADDING_SIZE;
-            }
-        }
-        _update_encode_stats(column_stats);
+        ASSIGN_OR_RETURN(buf, _serialize_columns(chunk, buf + HEADER_SIZE, &padding_size));
         // total serialized size
         size_t content_length = buf - head;
         auto align_size = ALIGN_UP(content_length + padding_size, ALIGNED_SIZE);
@@ -179,7 +201,6 @@ StatusOr<ChunkUniquePtr> ColumnarSerde::deserialize(SerdeContext& ctx, BlockRead
     }
 
     auto chunk = _chunk_builder();
-    auto& columns = chunk->columns();
 
     auto& serialize_buffer = ctx.serialize_buffer;
     serialize_buffer.resize(attachment_size);
@@ -193,14 +214,9 @@ StatusOr<ChunkUniquePtr> ColumnarSerde::deserialize(SerdeContext& ctx, BlockRead
         RETURN_IF_ERROR(st);
     }
 
-    const uint32_t* encode_levels = nullptr;
-    const uint8_t* read_cursor = buf;
-    encode_levels = reinterpret_cast<uint32_t*>(serialize_buffer.data());
-
-    read_cursor += columns.size() * sizeof(uint32_t);
-    SCOPED_TIMER(_parent->metrics().deserialize_timer);
-    for (size_t i = 0; i < columns.size(); i++) {
-        read_cursor = serde::ColumnArraySerde::deserialize(read_cursor, columns[i].get(), false, encode_levels[i]);
+    {
+        SCOPED_TIMER(_parent->metrics().deserialize_timer);
+        _deserialize_columns(buf, chunk.get());
     }
 
     auto restore_bytes = GET_METRICS(is_read_from_remote, _parent->metrics(), restore_bytes);
@@ -210,7 +226,197 @@ StatusOr<ChunkUniquePtr> ColumnarSerde::deserialize(SerdeContext& ctx, BlockRead
     return chunk;
 }
 
+// CompressedColumnarSerde compresses the data serialized by ColumnarSerde with a block compression codec,
+// since the spilling is mostly bound by the disk bandwidth. The columns are still encoded by the lightweight
+// encodings chosen per column by EncodeContext. Like EncodeContext, the block compression is only kept if the
+// compression ratio of the first EncodeSamplingNum of every _frequency chunks is less than EncodeRatioLimit.
+class CompressedColumnarSerde final : public ColumnarSerde {
+public:
+    CompressedColumnarSerde(Spiller* parent, ChunkBuilder chunk_builder, int encode_level,
+                            const BlockCompressionCodec* codec)
+            : ColumnarSerde(parent, std::move(chunk_builder), encode_level), _codec(codec) {}
+    ~CompressedColumnarSerde() override = default;
+
+    StatusOr<ChunkUniquePtr> deserialize(SerdeContext& ctx, BlockReader* reader) override;
+    Status serialize(RuntimeState* state, SerdeContext& ctx, const ChunkPtr& chunk,
+                     const SpillOutputDataStreamPtr& output, bool aligned) override;
+
+private:
+    // data format
+    // header|attachment
+    // header:
+    // i32 sequence_id|i64 attachment size|i64 uncompressed size|i64 compressed size|i32 compression type
+    // attachment:
+    // encode levels|column data..., which is compressed unless the compression type is NO_COMPRESSION
+    static constexpr int32_t SEQUENCE_OFFSET = 0;
+    static constexpr int32_t ATTACHMENT_SIZE_OFFSET = SEQUENCE_OFFSET + sizeof(int32_t);
+    static constexpr int32_t UNCOMPRESSED_SIZE_OFFSET = ATTACHMENT_SIZE_OFFSET + sizeof(int64_t);
+    static constexpr int32_t COMPRESSED_SIZE_OFFSET = UNCOMPRESSED_SIZE_OFFSET + sizeof(int64_t);
+    static constexpr int32_t COMPRESSION_TYPE_OFFSET = COMPRESSED_SIZE_OFFSET + sizeof(int64_t);
+    static constexpr int32_t HEADER_SIZE = COMPRESSION_TYPE_OFFSET + sizeof(int32_t);
+    static constexpr int32_t SEQUENCE_MAGIC_ID = 0xfacf;
+
+    bool _should_compress() {
+        std::lock_guard l(_compress_stats_mutex);
+        return _enable_compress || _times % _frequency < serde::EncodeSamplingNum;
+    }
+
+    void _update_compress_stats(uint64_t uncompressed_bytes, uint64_t compressed_bytes) {
+        std::lock_guard l(_compress_stats_mutex);
+        if (_times % _frequency < serde::EncodeSamplingNum) {
+            _uncompressed_bytes += uncompressed_bytes;
+            _compressed_bytes += compressed_bytes;
+        }
+        ++_times;
+        if (_times % _frequency == serde::EncodeSamplingNum) {
+            _enable_compress = _compressed_bytes < _uncompressed_bytes * serde::EncodeRatioLimit;
+            _uncompressed_bytes = 0;
+            _compressed_bytes = 0;
+            _frequency = _frequency > 1000000000 ? _frequency : _frequency * 2;
+        }
+    }
+
+    const BlockCompressionCodec* _codec;
+
+    std::mutex _compress_stats_mutex;
+    bool _enable_compress = true;
+    uint64_t _times = 0;
+    uint64_t _frequency = 64;
+    uint64_t _uncompressed_bytes = 0;
+    uint64_t _compressed_bytes = 0;
+};
+
+Status CompressedColumnarSerde::serialize(RuntimeState* state, SerdeContext& ctx, const ChunkPtr& chunk,
+                                          const SpillOutputDataStreamPtr& output, bool aligned) {
+    raw::RawString* output_buffer = &ctx.serialize_buffer;
+    {
+        SCOPED_TIMER(_parent->metrics().serialize_timer);
+        size_t ALIGNED_SIZE = 1;
+        if (aligned) {
+            ALIGNED_SIZE = AlignedBuffer::PAGE_SIZE;
+        }
+        auto& serialize_buffer = ctx.serialize_buffer;
+        serialize_buffer.clear();
+        size_t encode_level_sizes = chunk->num_columns() * sizeof(int32_t);
+        size_t max_serialized_size = _max_serialized_size(chunk) + serde::EncodeContext::STREAMVBYTE_PADDING_SIZE;
+        serialize_buffer.resize(ALIGN_UP(HEADER_SIZE + encode_level_sizes + max_serialized_size, ALIGNED_SIZE));
+        uint8_t* content = reinterpret_cast<uint8_t*>(serialize_buffer.data()) + HEADER_SIZE;
+
+        int padding_size = 0;
+        ASSIGN_OR_RETURN(uint8_t* content_end, _serialize_columns(chunk, content, &padding_size));
+        size_t uncompressed_size = content_end - content;
+        size_t compressed_size = uncompressed_size;
+        size_t attachment_size = uncompressed_size + padding_size;
+        auto compression_type = CompressionTypePB::NO_COMPRESSION;
+
+        if (_should_compress() && !_codec->exceed_max_input_size(uncompressed_size)) {
+            auto& compress_buffer = ctx.compress_buffer;
+            compress_buffer.clear();
+            compress_buffer.resize(HEADER_SIZE + _codec->max_compressed_len(uncompressed_size));
+            Slice compressed(compress_buffer.data() + HEADER_SIZE, compress_buffer.size() - HEADER_SIZE);
+            {
+                SCOPED_TIMER(_parent->metrics().compress_timer);
+                RETURN_IF_ERROR(_codec->compress(Slice(content, uncompressed_size), &compressed));
+            }
+            _update_compress_stats(uncompressed_size, compressed.size);
+            // keep the uncompressed data if the compression doesn't pay off
+            if (compressed.size < attachment_size) {
+                compressed_size = compressed.size;
+                attachment_size = compressed.size;
+                compression_type = _codec->type();
+                output_buffer = &compress_buffer;
+            }
+        } else {
+            _update_compress_stats(uncompressed_size, uncompressed_size);
+        }
+        COUNTER_UPDATE(_parent->metrics().uncompressed_bytes, uncompressed_size);
+
+        output_buffer->resize(ALIGN_UP(HEADER_SIZE + attachment_size, ALIGNED_SIZE));
+        auto* header = reinterpret_cast<uint8_t*>(output_buffer->data());
+        UNALIGNED_STORE32(header + SEQUENCE_OFFSET, SEQUENCE_MAGIC_ID);
+        UNALIGNED_STORE64(header + ATTACHMENT_SIZE_OFFSET, output_buffer->size() - HEADER_SIZE);
+        UNALIGNED_STORE64(header + UNCOMPRESSED_SIZE_OFFSET, uncompressed_size);
+        UNALIGNED_STORE64(header + COMPRESSED_SIZE_OFFSET, compressed_size);
+        UNALIGNED_STORE32(header + COMPRESSION_TYPE_OFFSET, compression_type);
+    }
+    size_t written_bytes = output_buffer->size();
+    RETURN_IF_ERROR(output->append(state, {Slice(output_buffer->data(), written_bytes)}, written_bytes));
+    return Status::OK();
+}
+
+StatusOr<ChunkUniquePtr> CompressedColumnarSerde::deserialize(SerdeContext& ctx, BlockReader* reader) {
+    uint8_t header[HEADER_SIZE];
+    bool is_read_from_remote = reader->block()->is_remote();
+    auto read_io_timer = GET_METRICS(is_read_from_remote, _parent->metrics(), read_io_timer);
+    auto read_io_count = GET_METRICS(is_read_from_remote, _parent->metrics(), read_io_count);
+
+    {
+        SCOPED_TIMER(read_io_timer);
+        COUNTER_UPDATE(read_io_count, 1);
+        RETURN_IF_ERROR(reader->read_fully(header, HEADER_SIZE));
+    }
+
+    int32_t sequence_id = UNALIGNED_LOAD32(header + SEQUENCE_OFFSET);
+    if (sequence_id != SEQUENCE_MAGIC_ID) {
+        return Status::InternalError(fmt::format("sequence id mismatch {} vs {}", sequence_id, SEQUENCE_MAGIC_ID));
+    }
+    int64_t attachment_size = UNALIGNED_LOAD64(header + ATTACHMENT_SIZE_OFFSET);
+    int64_t uncompressed_size = UNALIGNED_LOAD64(header + UNCOMPRESSED_SIZE_OFFSET);
+    int64_t compressed_size = UNALIGNED_LOAD64(header + COMPRESSED_SIZE_OFFSET);
+    auto compression_type = static_cast<CompressionTypePB>(UNALIGNED_LOAD32(header + COMPRESSION_TYPE_OFFSET));
+    bool is_compressed = compression_type != CompressionTypePB::NO_COMPRESSION;
+
+    // the uncompressed data is read into serialize_buffer directly
+    auto& read_buffer = is_compressed ? ctx.compress_buffer : ctx.serialize_buffer;
+    read_buffer.resize(attachment_size);
+    {
+        SCOPED_TIMER(read_io_timer);
+        COUNTER_UPDATE(read_io_count, 1);
+        auto st = reader->read_fully(read_buffer.data(), attachment_size);
+        RETURN_IF(st.is_end_of_file(), Status::InternalError("not found enough data in block"));
+        RETURN_IF_ERROR(st);
+    }
+
+    if (is_compressed) {
+        const BlockCompressionCodec* codec = nullptr;
+        RETURN_IF_ERROR(get_block_compression_codec(compression_type, &codec));
+        if (codec == nullptr) {
+            return Status::InternalError(
+                    fmt::format("unknown spill compression type {}", static_cast<int>(compression_type)));
+        }
+        // the decoding of the encoded integers may read the padding after the data
+        ctx.serialize_buffer.resize(uncompressed_size + serde::EncodeContext::STREAMVBYTE_PADDING_SIZE);
+        Slice uncompressed(ctx.serialize_buffer.data(), uncompressed_size);
+        SCOPED_TIMER(_parent->metrics().decompress_timer);
+        RETURN_IF_ERROR(codec->decompress(Slice(read_buffer.data(), compressed_size), &uncompressed));
+        if (UNLIKELY(uncompressed.size != uncompressed_size)) {
+            return Status::InternalError(fmt::format("uncompressed size mismatch {} vs {}", uncompressed.size,
+                                                     uncompressed_size));
+        }
+    }
+
+    auto chunk = _chunk_builder();
+    {
+        SCOPED_TIMER(_parent->metrics().deserialize_timer);
+        _deserialize_columns(reinterpret_cast<const uint8_t*>(ctx.serialize_buffer.data()), chunk.get());
+    }
+
+    auto restore_bytes = GET_METRICS(is_read_from_remote, _parent->metrics(), restore_bytes);
+    COUNTER_UPDATE(restore_bytes, attachment_size);
+    TRACE_SPILL_LOG << "deserialize chunk from block: " << reader->debug_string()
+                    << ", compressed size: " << compressed_size << ", encoded size: " << uncompressed_size
+                    << ", original size: " << chunk->bytes_usage();
+    return chunk;
+}
+
 StatusOr<SerdePtr> Serde::create_serde(Spiller* parent) {
-    return std::make_shared<ColumnarSerde>(parent, parent->chunk_builder());
+    const auto& options = parent->options();
+    if (config::enable_spill_compression && options.compress_type != CompressionTypePB::NO_COMPRESSION) {
+        const BlockCompressionCodec* codec = nullptr;
+        RETURN_IF_ERROR(get_block_compression_codec(options.compress_type, &codec));
+        return std::make_shared<CompressedColumnarSerde>(parent, parent->chunk_builder(), options.encode_level,
+                                                         codec);
+    }
+    return std::make_shared<ColumnarSerde>(parent, parent->chunk_builder(), options.encode_level);
 }
 } // namespace starrocks::spill
@@ -86,6 +86,8 @@ private:
 
 struct SerdeContext {
     raw::RawString serialize_buffer;
+    // only used by CompressedColumnarSerde
+    raw::RawString compress_buffer;
 };
 class Spiller;
 // Serde is used to serialize and deserialize spilled data.
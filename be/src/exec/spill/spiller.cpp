@@ -72,6 +72,9 @@ SpillProcessMetrics::SpillProcessMetrics(RuntimeProfile* profile, std::atomic_in
 
     serialize_timer = ADD_CHILD_TIMER(profile, "SerializeTime", parent);
     deserialize_timer = ADD_CHILD_TIMER(profile, "DeserializeTime", parent);
+    compress_timer = ADD_CHILD_TIMER(profile, "CompressTime", "SerializeTime");
+    decompress_timer = ADD_CHILD_TIMER(profile, "DecompressTime", parent);
+    uncompressed_bytes = ADD_CHILD_COUNTER(profile, "BytesBeforeCompression", TUnit::BYTES, parent);
     mem_table_peak_memory_usage = profile->AddHighWaterMarkCounter(
             "MemTablePeakMemoryBytes", TUnit::BYTES, RuntimeProfile::Counter::create_strategy(TUnit::BYTES), parent);
     input_stream_peak_memory_usage = profile->AddHighWaterMarkCounter(
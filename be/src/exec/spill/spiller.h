@@ -88,6 +88,12 @@ public:
     RuntimeProfile::Counter* serialize_timer = nullptr;
     // time spent to deserialize data after read it from disk
     RuntimeProfile::Counter* deserialize_timer = nullptr;
+    // time spent to compress the serialized data, included in serialize_timer
+    RuntimeProfile::Counter* compress_timer = nullptr;
+    // time spent to decompress data after read it from disk
+    RuntimeProfile::Counter* decompress_timer = nullptr;
+    // serialized data bytes before compression, compared with flush_bytes for the compression ratio
+    RuntimeProfile::Counter* uncompressed_bytes = nullptr;
     // peak memory usage of mem table
     RuntimeProfile::HighWaterMarkCounter* mem_table_peak_memory_usage = nullptr;
     // peak memory usage of input stream
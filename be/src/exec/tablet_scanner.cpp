@@ -374,6 +374,7 @@ void TabletScanner::update_counter() {
 
     COUNTER_UPDATE(_parent->_read_pages_num_counter, _reader->stats().total_pages_num);
     COUNTER_UPDATE(_parent->_cached_pages_num_counter, _reader->stats().cached_pages_num);
+    COUNTER_UPDATE(_parent->_decoded_cached_pages_num_counter, _reader->stats().decoded_cached_pages_num);
 
     COUNTER_UPDATE(_parent->_bi_filtered_counter, _reader->stats().rows_bitmap_index_filtered);
     COUNTER_UPDATE(_parent->_bi_filter_timer, _reader->stats().bitmap_index_filter_timer);
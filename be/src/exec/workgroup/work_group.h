@@ -87,6 +87,14 @@ public:
     void incr_runtime_ns(int64_t runtime_ns);
     void adjust_runtime_ns(int64_t runtime_ns);
 
+    /// The runtime reported by executor threads without the lock of the queue.
+    /// The queue folds it into vruntime by incr_runtime_ns() under its lock, since vruntime orders its entities.
+    void add_unaccounted_runtime_ns(int64_t runtime_ns) {
+        _unaccounted_runtime_ns.fetch_add(runtime_ns, std::memory_order_relaxed);
+    }
+    int64_t unaccounted_runtime_ns() const { return _unaccounted_runtime_ns.load(std::memory_order_relaxed); }
+    int64_t take_unaccounted_runtime_ns() { return _unaccounted_runtime_ns.exchange(0, std::memory_order_relaxed); }
+
 private:
     WorkGroup* _workgroup; // The workgroup owning this entity.
 
@@ -98,6 +106,8 @@ private:
     int64_t _unadjusted_runtime_ns = 0;
     int64_t _curr_unadjusted_runtime_ns = 0;
     int64_t _last_unadjusted_runtime_ns = 0;
+
+    std::atomic<int64_t> _unaccounted_runtime_ns = 0;
 };
 
 using WorkGroupDriverSchedEntity = WorkGroupSchedEntity<pipeline::DriverQueue>;
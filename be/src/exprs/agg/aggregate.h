@@ -214,6 +214,23 @@ public:
     virtual void merge_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column* column,
                                           size_t start, size_t size) const = 0;
 
+    // Whether the states could be kept in a dense column indexed by group id, see ColumnarAggStates.
+    // Only the functions of trivially destructible states which are cheap to create qualify.
+    virtual bool support_columnar_state() const { return false; }
+
+    // Update the i-th row into the state of group_ids[i], the states of all groups are stored
+    // consecutively from |states|, size() bytes each.
+    virtual void update_batch_columnar(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                       const uint32_t* group_ids, AggDataPtr __restrict states) const {
+        throw std::runtime_error("update_batch_columnar function in aggregate is not supported for now.");
+    }
+
+    // Merge the i-th row into the state of group_ids[i], see update_batch_columnar.
+    virtual void merge_batch_columnar(FunctionContext* ctx, size_t chunk_size, const Column* column,
+                                      const uint32_t* group_ids, AggDataPtr __restrict states) const {
+        throw std::runtime_error("merge_batch_columnar function in aggregate is not supported for now.");
+    }
+
     ///////////////// STREAM MV METHODS /////////////////
 
     // Return stream agg function's state table kind, see AggStateTableKind's description.
@@ -404,6 +421,20 @@ public:
         }
     }
 
+    void update_batch_columnar(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                               const uint32_t* group_ids, AggDataPtr __restrict states) const override {
+        for (size_t i = 0; i < chunk_size; ++i) {
+            static_cast<const Derived*>(this)->update(ctx, columns, states + group_ids[i] * sizeof(State), i);
+        }
+    }
+
+    void merge_batch_columnar(FunctionContext* ctx, size_t chunk_size, const Column* column, const uint32_t* group_ids,
+                              AggDataPtr __restrict states) const override {
+        for (size_t i = 0; i < chunk_size; ++i) {
+            static_cast<const Derived*>(this)->merge(ctx, column, states + group_ids[i] * sizeof(State), i);
+        }
+    }
+
     void batch_serialize(FunctionContext* ctx, size_t chunk_size, const Buffer<AggDataPtr>& agg_states,
                          size_t state_offset, Column* to) const override {
         for (size_t i = 0; i < chunk_size; i++) {
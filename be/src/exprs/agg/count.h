@@ -60,6 +60,16 @@ public:
         this->data(state).count += chunk_size;
     }
 
+    bool support_columnar_state() const override { return true; }
+
+    void update_batch_columnar(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                               const uint32_t* group_ids, AggDataPtr __restrict states) const override {
+        auto* counts = reinterpret_cast<AggregateCountFunctionState<IsWindowFunc>*>(states);
+        for (size_t i = 0; i < chunk_size; ++i) {
+            counts[group_ids[i]].count++;
+        }
+    }
+
     void update_batch_single_state_with_frame(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
                                               int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                               int64_t frame_end) const override {
@@ -198,6 +208,24 @@ public:
         }
     }
 
+    bool support_columnar_state() const override { return true; }
+
+    void update_batch_columnar(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                               const uint32_t* group_ids, AggDataPtr __restrict states) const override {
+        auto* counts = reinterpret_cast<AggregateCountFunctionState<IsWindowFunc>*>(states);
+        if (columns[0]->has_null()) {
+            const auto* nullable_column = down_cast<const NullableColumn*>(columns[0]);
+            const uint8_t* null_data = nullable_column->immutable_null_column_data().data();
+            for (size_t i = 0; i < chunk_size; ++i) {
+                counts[group_ids[i]].count += !null_data[i];
+            }
+        } else {
+            for (size_t i = 0; i < chunk_size; ++i) {
+                counts[group_ids[i]].count++;
+            }
+        }
+    }
+
     void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
                                    AggDataPtr __restrict state) const override {
         if (columns[0]->is_nullable()) {
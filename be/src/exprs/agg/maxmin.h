@@ -166,6 +166,8 @@ public:
         OP()(this->data(state), value);
     }
 
+    bool support_columnar_state() const override { return this->pod_state(); }
+
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         DCHECK(!to->is_nullable() && !to->is_binary());
         AggDataTypeTraits<LT>::append_value(down_cast<InputColumnType*>(to), this->data(state).result);
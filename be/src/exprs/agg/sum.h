@@ -80,6 +80,26 @@ public:
         }
     }
 
+    bool support_columnar_state() const override { return true; }
+
+    void update_batch_columnar(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                               const uint32_t* group_ids, AggDataPtr __restrict states) const override {
+        const auto* data = down_cast<const InputColumnType*>(columns[0])->get_data().data();
+        auto* sums = reinterpret_cast<SumAggregateState<ResultType>*>(states);
+        for (size_t i = 0; i < chunk_size; ++i) {
+            sums[group_ids[i]].sum += data[i];
+        }
+    }
+
+    void merge_batch_columnar(FunctionContext* ctx, size_t chunk_size, const Column* column, const uint32_t* group_ids,
+                              AggDataPtr __restrict states) const override {
+        const auto* data = down_cast<const ResultColumnType*>(column)->get_data().data();
+        auto* sums = reinterpret_cast<SumAggregateState<ResultType>*>(states);
+        for (size_t i = 0; i < chunk_size; ++i) {
+            sums[group_ids[i]].sum += data[i];
+        }
+    }
+
     void update_batch_single_state_with_frame(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
                                               int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                               int64_t frame_end) const override {
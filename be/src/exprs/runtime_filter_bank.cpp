@@ -717,11 +717,14 @@ void RuntimeFilterProbeCollector::wait(bool on_scan_node) {
 
 void RuntimeFilterProbeDescriptor::set_runtime_filter(const JoinRuntimeFilter* rf) {
     const JoinRuntimeFilter* expected = nullptr;
-    _runtime_filter.compare_exchange_strong(expected, rf, std::memory_order_seq_cst, std::memory_order_seq_cst);
+    if (!_runtime_filter.compare_exchange_strong(expected, rf, std::memory_order_seq_cst, std::memory_order_seq_cst)) {
+        return;
+    }
     if (_ready_timestamp == 0 && rf != nullptr && _latency_timer != nullptr) {
         _ready_timestamp = UnixMillis();
         _latency_timer->set((_ready_timestamp - _open_timestamp) * 1000);
     }
+    _observable.notify_observers();
 }
 
 void RuntimeFilterProbeDescriptor::set_shared_runtime_filter(const std::shared_ptr<const JoinRuntimeFilter>& rf) {
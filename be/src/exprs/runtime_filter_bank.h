@@ -21,6 +21,7 @@
 #include "column/column.h"
 #include "common/global_types.h"
 #include "common/object_pool.h"
+#include "exec/pipeline/pipeline_observer.h"
 #include "exprs/column_ref.h"
 #include "exprs/expr.h"
 #include "exprs/expr_context.h"
@@ -189,6 +190,9 @@ public:
     }
     void set_runtime_filter(const JoinRuntimeFilter* rf);
     void set_shared_runtime_filter(const std::shared_ptr<const JoinRuntimeFilter>& rf);
+    // The observer is notified when the runtime filter arrives.
+    void attach_observer(const pipeline::PipelineObserverPtr& observer) { _observable.add_observer(observer); }
+    void detach_observer(const pipeline::PipelineObserverPtr& observer) { _observable.remove_observer(observer); }
 
 private:
     friend class HashJoinNode;
@@ -212,6 +216,7 @@ private:
 
     std::atomic<const JoinRuntimeFilter*> _runtime_filter = nullptr;
     std::shared_ptr<const JoinRuntimeFilter> _shared_runtime_filter = nullptr;
+    pipeline::Observable _observable;
 };
 
 // RuntimeFilterProbeCollector::do_evaluate function apply runtime bloom filter to Operators to filter chunk.
@@ -332,6 +332,10 @@ StatusOr<bool> FileReader::_filter_group(const tparquet::RowGroup& row_group) {
         }
     }
 
+    return _filter_group_with_runtime_filters(row_group);
+}
+
+StatusOr<bool> FileReader::_filter_group_with_runtime_filters(const tparquet::RowGroup& row_group) {
     // filter by min/max in runtime filter.
     if (_scanner_ctx->runtime_filter_collector) {
         std::vector<SlotDescriptor*> min_max_slots(1);
@@ -591,6 +595,7 @@ Status FileReader::_init_group_readers() {
     // for pageIndex
     _group_reader_param.min_max_conjunct_ctxs = fd_scanner_ctx.min_max_conjunct_ctxs;
 
+    _runtime_filters_version = _get_runtime_filters_version();
     int64_t row_group_first_row = 0;
     // select and create row group readers.
     for (size_t i = 0; i < _file_metadata->t_metadata().row_groups.size(); i++) {
@@ -647,6 +652,41 @@ Status FileReader::_init_group_readers() {
     return Status::OK();
 }
 
+size_t FileReader::_get_runtime_filters_version() const {
+    size_t version = 0;
+    if (_scanner_ctx->runtime_filter_collector) {
+        for (auto& it : _scanner_ctx->runtime_filter_collector->descriptors()) {
+            const JoinRuntimeFilter* filter = it.second->runtime_filter(-1);
+            if (filter != nullptr) {
+                version += filter->rf_version() + 1;
+            }
+        }
+    }
+    return version;
+}
+
+Status FileReader::_filter_remaining_groups_with_runtime_filters() {
+    size_t version = _get_runtime_filters_version();
+    if (version == _runtime_filters_version) {
+        return Status::OK();
+    }
+    _runtime_filters_version = version;
+
+    size_t num_groups = _cur_row_group_idx;
+    for (size_t i = _cur_row_group_idx; i < _row_group_size; i++) {
+        ASSIGN_OR_RETURN(bool filtered,
+                         _filter_group_with_runtime_filters(*_row_group_readers[i]->row_group_metadata()));
+        if (filtered) {
+            DLOG(INFO) << "row group of file has been filtered by updated runtime filter";
+            continue;
+        }
+        _row_group_readers[num_groups++] = std::move(_row_group_readers[i]);
+    }
+    _row_group_readers.resize(num_groups);
+    _row_group_size = num_groups;
+    return Status::OK();
+}
+
 Status FileReader::_prepare_cur_row_group() {
     auto& r = _row_group_readers[_cur_row_group_idx];
     // prepare row group
@@ -695,6 +735,7 @@ Status FileReader::get_next(ChunkPtr* chunk) {
             if (status.is_end_of_file()) {
                 _row_group_readers[_cur_row_group_idx]->close();
                 _cur_row_group_idx++;
+                RETURN_IF_ERROR(_filter_remaining_groups_with_runtime_filters());
                 if (_cur_row_group_idx < _row_group_size) {
                     // prepare new group
                     RETURN_IF_ERROR(_prepare_cur_row_group());
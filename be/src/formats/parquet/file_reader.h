@@ -76,6 +76,17 @@ private:
     // filter row group by min/max conjuncts
     StatusOr<bool> _filter_group(const tparquet::RowGroup& row_group);
 
+    // filter row group by min/max in runtime filters
+    StatusOr<bool> _filter_group_with_runtime_filters(const tparquet::RowGroup& row_group);
+
+    // Runtime filters may arrive or be tightened during the scan, e.g. the runtime filter of a TopN
+    // is tightened as its top rows get updated, so drop the row groups not read yet which can be
+    // filtered by them now.
+    Status _filter_remaining_groups_with_runtime_filters();
+
+    // changed once a runtime filter arrives or gets updated
+    size_t _get_runtime_filters_version() const;
+
     // get row group to read
     // if scan range conatain the first byte in the row group, will be read
     // TODO: later modify the larger block should be read
@@ -121,6 +132,8 @@ private:
     std::vector<std::shared_ptr<GroupReader>> _row_group_readers;
     size_t _cur_row_group_idx = 0;
     size_t _row_group_size = 0;
+    // version of runtime filters when the row groups were filtered last time
+    size_t _runtime_filters_version = 0;
 
     size_t _total_row_count = 0;
     size_t _scan_row_count = 0;
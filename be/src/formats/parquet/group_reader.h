@@ -102,6 +102,7 @@ public:
     void collect_io_ranges(std::vector<io::SharedBufferedInputStream::IORange>* ranges, int64_t* end_offset,
                            ColumnIOType type = ColumnIOType::PAGES);
     void set_end_offset(int64_t value) { _end_offset = value; }
+    const tparquet::RowGroup* row_group_metadata() const { return _row_group_metadata; }
 
     void _use_as_dict_filter_column(int col_idx, SlotId slot_id, std::vector<std::string>& sub_field_path);
     Status _rewrite_conjunct_ctxs_to_predicates(bool* is_group_filtered);
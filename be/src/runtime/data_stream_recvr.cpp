@@ -188,6 +188,10 @@ DataStreamRecvr::DataStreamRecvr(DataStreamMgr* stream_mgr, RuntimeState* runtim
     }
 
     _metrics.resize(degree_of_parallelism);
+    _observables.reserve(degree_of_parallelism);
+    for (int i = 0; i < degree_of_parallelism; ++i) {
+        _observables.emplace_back(std::make_unique<pipeline::Observable>());
+    }
 
     _pass_through_context.init();
     if (runtime_state->query_options().__isset.transmission_encode_level) {
@@ -247,23 +251,74 @@ Status DataStreamRecvr::add_chunks(const PTransmitChunkParams& request, ::google
     int use_sender_id = _is_merging ? request.sender_id() : 0;
     // Add all batches to the same queue if _is_merging is false.
 
+    Status status;
     if (_keep_order) {
         DCHECK(_is_pipeline);
-        return _sender_queues[use_sender_id]->add_chunks_and_keep_order(request, metrics, done);
+        status = _sender_queues[use_sender_id]->add_chunks_and_keep_order(request, metrics, done);
     } else {
-        return _sender_queues[use_sender_id]->add_chunks(request, metrics, done);
+        status = _sender_queues[use_sender_id]->add_chunks(request, metrics, done);
     }
+    _notify_observers_with_chunks();
+    return status;
 }
 
 void DataStreamRecvr::remove_sender(int sender_id, int be_number) {
     int use_sender_id = _is_merging ? sender_id : 0;
     _sender_queues[use_sender_id]->decrement_senders(be_number);
+    _notify_all_observers();
 }
 
 void DataStreamRecvr::cancel_stream() {
     for (auto& _sender_queue : _sender_queues) {
         _sender_queue->cancel();
     }
+    _notify_all_observers();
+}
+
+void DataStreamRecvr::attach_observer(const int32_t driver_sequence, const pipeline::PipelineObserverPtr& observer) {
+    DCHECK_LT(driver_sequence, _observables.size());
+    _observables[driver_sequence]->add_observer(observer);
+}
+
+void DataStreamRecvr::detach_observer(const int32_t driver_sequence, const pipeline::PipelineObserverPtr& observer) {
+    DCHECK_LT(driver_sequence, _observables.size());
+    _observables[driver_sequence]->remove_observer(observer);
+}
+
+void DataStreamRecvr::_notify_all_observers() {
+    for (auto& observable : _observables) {
+        observable->notify_observers();
+    }
+}
+
+void DataStreamRecvr::_notify_observers_with_chunks() {
+    if (!_is_pipeline || _is_merging) {
+        _notify_all_observers();
+        return;
+    }
+    auto* sender_queue = static_cast<PipelineSenderQueue*>(_sender_queues[0]);
+    if (sender_queue->is_pipeline_level_shuffle()) {
+        // Each driver has its own queue, so only wake up the drivers whose queues have chunks.
+        for (size_t i = 0; i < _observables.size(); ++i) {
+            if (sender_queue->has_chunk(i)) {
+                _observables[i]->notify_observers();
+            }
+        }
+    } else if (sender_queue->has_chunk(0)) {
+        // All the drivers share one queue, so only wake up one of them. The woken driver wakes up the next one
+        // if it leaves chunks in the queue, see get_chunk_for_pipeline().
+        _notify_one_observer();
+    }
+}
+
+void DataStreamRecvr::_notify_one_observer() {
+    const size_t num_observables = _observables.size();
+    const size_t start = _next_wakeup_index.fetch_add(1);
+    for (size_t i = 0; i < num_observables; ++i) {
+        if (_observables[(start + i) % num_observables]->notify_observers()) {
+            return;
+        }
+    }
 }
 
 void DataStreamRecvr::close() {
@@ -305,6 +360,15 @@ Status DataStreamRecvr::get_chunk_for_pipeline(std::unique_ptr<Chunk>* chunk, co
     Chunk* tmp_chunk = nullptr;
     Status status = _sender_queues[0]->get_chunk(&tmp_chunk, driver_sequence);
     chunk->reset(tmp_chunk);
+    if (tmp_chunk != nullptr) {
+        auto* sender_queue = static_cast<PipelineSenderQueue*>(_sender_queues[0]);
+        if (is_finished()) {
+            // The other drivers waiting for the finish of the receiver.
+            _notify_all_observers();
+        } else if (!sender_queue->is_pipeline_level_shuffle() && sender_queue->has_chunk(0)) {
+            _notify_one_observer();
+        }
+    }
     return status;
 }
 
@@ -39,6 +39,7 @@
 #include "column/vectorized_fwd.h"
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "exec/pipeline/pipeline_observer.h"
 #include "exec/sorting/merge_path.h"
 #include "gen_cpp/Types_types.h" // for TUniqueId
 #include "runtime/descriptors.h"
@@ -128,6 +129,11 @@ public:
 
     bool is_finished() const;
 
+    // The observer of the driver is notified when the chunks for the driver arrive,
+    // or the receiver is finished or cancelled.
+    void attach_observer(const int32_t driver_sequence, const pipeline::PipelineObserverPtr& observer);
+    void detach_observer(const int32_t driver_sequence, const pipeline::PipelineObserverPtr& observer);
+
     bool is_data_ready();
 
     bool get_encode_level() const { return _encode_level; }
@@ -162,6 +168,12 @@ private:
     // Return a metrics for current rpc in round-robin manner.
     Metrics& get_metrics_round_robin() { return _metrics[_rpc_round_roubin_index++ % _metrics.size()]; }
 
+    void _notify_all_observers();
+    // Wake up the drivers which can take the arrived chunks.
+    void _notify_observers_with_chunks();
+    // Wake up one of the drivers blocked by the receiver, in round-robin manner.
+    void _notify_one_observer();
+
     // DataStreamMgr instance used to create this recvr. (Not owned)
     DataStreamMgr* _mgr;
 
@@ -197,6 +209,10 @@ private:
     // Pool of sender queues.
     ObjectPool _sender_queue_pool;
 
+    // One observable for each driver sequence.
+    std::vector<std::unique_ptr<pipeline::Observable>> _observables;
+    std::atomic<size_t> _next_wakeup_index = 0;
+
     // instance profile and mem_tracker
     std::shared_ptr<RuntimeProfile> _instance_profile;
     std::shared_ptr<MemTracker> _query_mem_tracker;
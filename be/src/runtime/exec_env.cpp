@@ -343,6 +343,28 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .build(&_automatic_partition_pool));
 
+    int num_jni_prefetch_threads = config::jni_scanner_prefetch_thread_num;
+    if (num_jni_prefetch_threads <= 0) {
+        num_jni_prefetch_threads = CpuInfo::num_cores();
+    }
+    RETURN_IF_ERROR(ThreadPoolBuilder("jni_prefetch") // prefetch off-heap chunks for jni scanners
+                            .set_min_threads(0)
+                            .set_max_threads(num_jni_prefetch_threads)
+                            .set_max_queue_size(INT32_MAX)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_jni_scanner_prefetch_pool));
+
+    int num_join_build_threads = config::join_hash_table_parallel_link_thread_num;
+    if (num_join_build_threads <= 0) {
+        num_join_build_threads = CpuInfo::num_cores();
+    }
+    RETURN_IF_ERROR(ThreadPoolBuilder("join_build") // link the bucket chains of large join hash tables
+                            .set_min_threads(0)
+                            .set_max_threads(num_join_build_threads)
+                            .set_max_queue_size(INT32_MAX)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_hash_join_build_pool));
+
     int num_prepare_threads = config::pipeline_prepare_thread_pool_thread_num;
     if (num_prepare_threads == 0) {
         num_prepare_threads = CpuInfo::num_cores();
@@ -617,6 +639,14 @@ void ExecEnv::stop() {
         _automatic_partition_pool->shutdown();
     }
 
+    if (_jni_scanner_prefetch_pool) {
+        _jni_scanner_prefetch_pool->shutdown();
+    }
+
+    if (_hash_join_build_pool) {
+        _hash_join_build_pool->shutdown();
+    }
+
     if (_query_rpc_pool) {
         _query_rpc_pool->shutdown();
     }
@@ -715,6 +745,8 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_cache_mgr);
     _dictionary_cache_pool.reset();
     _automatic_partition_pool.reset();
+    _jni_scanner_prefetch_pool.reset();
+    _hash_join_build_pool.reset();
     _metrics = nullptr;
 }
 
@@ -299,6 +299,10 @@ public:
 
     ThreadPool* automatic_partition_pool() { return _automatic_partition_pool.get(); }
 
+    ThreadPool* jni_scanner_prefetch_pool() { return _jni_scanner_prefetch_pool.get(); }
+
+    ThreadPool* hash_join_build_pool() { return _hash_join_build_pool.get(); }
+
     RuntimeFilterWorker* runtime_filter_worker() { return _runtime_filter_worker; }
 
     RuntimeFilterCache* runtime_filter_cache() { return _runtime_filter_cache; }
@@ -388,6 +392,8 @@ private:
     HeartbeatFlags* _heartbeat_flags = nullptr;
 
     std::unique_ptr<ThreadPool> _automatic_partition_pool;
+    std::unique_ptr<ThreadPool> _jni_scanner_prefetch_pool;
+    std::unique_ptr<ThreadPool> _hash_join_build_pool;
 
     RuntimeFilterWorker* _runtime_filter_worker = nullptr;
     RuntimeFilterCache* _runtime_filter_cache = nullptr;
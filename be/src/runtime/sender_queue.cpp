@@ -893,6 +893,14 @@ bool DataStreamRecvr::PipelineSenderQueue::has_output(const int32_t driver_seque
     return chunk_queue_state.blocked_closure_num > 0;
 }
 
+bool DataStreamRecvr::PipelineSenderQueue::has_chunk(const int32_t driver_sequence) const {
+    if (_is_cancelled.load()) {
+        return false;
+    }
+    size_t index = _is_pipeline_level_shuffle ? driver_sequence : 0;
+    return _chunk_queues[index].size_approx() > 0;
+}
+
 bool DataStreamRecvr::PipelineSenderQueue::is_finished() const {
     return _is_cancelled || (_num_remaining_senders == 0 && _total_chunks == 0);
 }
@@ -174,6 +174,12 @@ public:
 
     bool has_output(const int32_t driver_sequence);
 
+    // Whether the queue of the driver has chunks. Unlike has_output(), it has no side effect on the unplug state,
+    // so it can be invoked out of the pipeline execution threads.
+    bool has_chunk(const int32_t driver_sequence) const;
+
+    bool is_pipeline_level_shuffle() const { return _is_pipeline_level_shuffle; }
+
     bool is_finished() const;
 
 private:
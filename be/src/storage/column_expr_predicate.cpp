@@ -38,9 +38,45 @@ StatusOr<ColumnExprPredicate*> ColumnExprPredicate::make_column_expr_predicate(T
     if (expr_ctx != nullptr) {
         expr_predicate->set_index_filter_only(expr_ctx->is_index_only_filter());
     }
+    auto st = expr_predicate->_try_to_init_like_predicate();
+    if (!st.ok()) {
+        delete expr_predicate;
+        return st;
+    }
     return expr_predicate;
 }
 
+Status ColumnExprPredicate::_try_to_init_like_predicate() {
+    if (_expr_ctxs.size() != 1 || _type_info->type() != TYPE_VARCHAR) {
+        return Status::OK();
+    }
+    Expr* expr = _expr_ctxs[0]->root();
+    if (expr->node_type() != TExprNodeType::FUNCTION_CALL || expr->get_num_children() != 2 ||
+        expr->get_child(0)->node_type() != TExprNodeType::SLOT_REF ||
+        expr->get_child(1)->node_type() != TExprNodeType::STRING_LITERAL) {
+        return Status::OK();
+    }
+    auto* function_call = down_cast<VectorizedFunctionCallExpr*>(expr);
+    if (function_call->get_function_desc() == nullptr ||
+        LIKE_FN_NAME != boost::to_lower_copy(function_call->get_function_desc()->name)) {
+        return Status::OK();
+    }
+    auto* pattern = dynamic_cast<VectorizedLiteral*>(expr->get_child(1));
+    if (pattern == nullptr) {
+        return Status::OK();
+    }
+    ASSIGN_OR_RETURN(auto pattern_col, pattern->evaluate_checked(_expr_ctxs[0], nullptr));
+    Datum datum = pattern_col->get(0);
+    if (datum.is_null()) {
+        return Status::OK();
+    }
+    ColumnPredicate* like_predicate = new_column_like_predicate(_type_info, _column_id, datum.get_slice());
+    if (like_predicate != nullptr) {
+        _like_predicate = _pool.add(like_predicate);
+    }
+    return Status::OK();
+}
+
 ColumnExprPredicate::~ColumnExprPredicate() {
     for (ExprContext* ctx : _expr_ctxs) {
         ctx->close(_state);
@@ -66,6 +66,10 @@ public:
 
     const std::vector<ExprContext*>& get_expr_ctxs() const { return _expr_ctxs; }
 
+    // The native predicate equivalent to `col LIKE 'pattern'` if the pattern is simple enough, see
+    // new_column_like_predicate(), which can be evaluated on the encoded strings. Otherwise nullptr.
+    const ColumnPredicate* like_predicate() const { return _like_predicate; }
+
 private:
     ColumnExprPredicate(TypeInfoPtr type_info, ColumnId column_id, RuntimeState* state,
                         const SlotDescriptor* slot_desc);
@@ -78,12 +82,15 @@ private:
     // Share the ownership, is necessary to clone it
     void _add_expr_ctx(ExprContext* expr_ctx);
 
+    Status _try_to_init_like_predicate();
+
     ObjectPool _pool;
     RuntimeState* _state;
     std::vector<ExprContext*> _expr_ctxs;
     const SlotDescriptor* _slot_desc;
     bool _monotonic;
     mutable std::vector<uint8_t> _tmp_select;
+    const ColumnPredicate* _like_predicate = nullptr;
 };
 
 class ColumnTruePredicate : public ColumnPredicate {
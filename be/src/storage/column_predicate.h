@@ -47,6 +47,7 @@ class ExprContext;
 class RuntimeState;
 class SlotDescriptor;
 class BitmapIndexIterator;
+class FsstSymbolTable;
 struct NgramBloomFilterReaderOptions;
 } // namespace starrocks
 
@@ -79,6 +80,7 @@ enum class PredicateType {
     kExpr = 13,
     kTrue = 14,
     kMap = 15,
+    kLike = 16,
 };
 
 std::ostream& operator<<(std::ostream& os, PredicateType p);
@@ -180,6 +182,37 @@ public:
         return Status::Cancelled("not implemented");
     }
 
+    // Return true if this predicate can be evaluated on the strings compressed by FSST without
+    // decompressing them, see evaluate_fsst().
+    virtual bool support_fsst_evaluate() const { return false; }
+
+    // Evaluate this predicate on |count| strings compressed by |table|, the result is AND-ed into
+    // |selection|. NULL values are not taken into account, they should be filtered out by the caller.
+    [[nodiscard]] virtual Status evaluate_fsst(const FsstSymbolTable& table, const Slice* values, size_t count,
+                                               uint8_t* selection) const {
+        return Status::NotSupported("evaluate_fsst() not supported");
+    }
+
+    // Return true if the result of this predicate on a row only depends on the value of the row and
+    // NULL never matches, so that it can be evaluated once for a distinct value, a run or the bounds
+    // of a frame of an encoded page, see PageDecoder::next_batch_with_filter().
+    bool support_encoded_evaluate() const {
+        switch (type()) {
+        case PredicateType::kEQ:
+        case PredicateType::kNE:
+        case PredicateType::kGT:
+        case PredicateType::kGE:
+        case PredicateType::kLT:
+        case PredicateType::kLE:
+        case PredicateType::kInList:
+        case PredicateType::kNotInList:
+        case PredicateType::kNotNull:
+            return true;
+        default:
+            return false;
+        }
+    }
+
     // Indicate whether or not the evaluate can be vectorized.
     // If this function return true, evaluate function will be vectorized and can achieve
     // good performance.
@@ -243,6 +276,8 @@ ColumnPredicate* new_column_gt_predicate(const TypeInfoPtr& type, ColumnId id, c
 ColumnPredicate* new_column_ge_predicate(const TypeInfoPtr& type, ColumnId id, const Slice& operand);
 ColumnPredicate* new_column_cmp_predicate(PredicateType predicate, const TypeInfoPtr& type, ColumnId id,
                                           const Slice& operand);
+// Return nullptr if the column is not VARCHAR or the pattern has '%' in the middle, '_' or escapes.
+ColumnPredicate* new_column_like_predicate(const TypeInfoPtr& type, ColumnId id, const Slice& pattern);
 
 ColumnPredicate* new_column_in_predicate(const TypeInfoPtr& type, ColumnId id,
                                          const std::vector<std::string>& operands);
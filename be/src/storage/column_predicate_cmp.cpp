@@ -14,9 +14,12 @@
 
 #include <cstdint>
 #include <functional>
+#include <string_view>
 #include <vector>
 
+#include "column/binary_column.h"
 #include "column/column.h" // Column
+#include "column/column_helper.h"
 #include "column/datum.h"
 #include "common/object_pool.h"
 #include "storage/column_predicate.h"
@@ -24,6 +27,7 @@
 #include "storage/range.h"
 #include "storage/rowset/bitmap_index_reader.h"
 #include "storage/rowset/bloom_filter.h"
+#include "storage/rowset/fsst.h"
 #include "storage/types.h"
 #include "storage/zone_map_detail.h"
 #include "util/string_parser.hpp"
@@ -515,6 +519,17 @@ public:
     }
 };
 
+template <bool equal>
+static void fsst_evaluate_eq(const FsstSymbolTable& table, const Slice& operand, const Slice* values, size_t count,
+                             uint8_t* selection) {
+    faststring compressed;
+    table.compress(operand, &compressed);
+    Slice target(compressed);
+    for (size_t i = 0; i < count; i++) {
+        selection[i] &= (values[i] == target) == equal;
+    }
+}
+
 // Base class for binary column predicate
 template <LogicalType field_type, class Eval>
 class BinaryColumnPredicateCmpBase : public ColumnPredicate {
@@ -643,6 +658,15 @@ public:
     BinaryColumnEqPredicate(const TypeInfoPtr& type_info, ColumnId id, ValueType value)
             : Base(PredicateType::kEQ, type_info, id, value) {}
 
+    // CHAR values are stored with trailing zeros, which the operand does not have.
+    bool support_fsst_evaluate() const override { return field_type == TYPE_VARCHAR; }
+
+    Status evaluate_fsst(const FsstSymbolTable& table, const Slice* values, size_t count,
+                         uint8_t* selection) const override {
+        fsst_evaluate_eq<true>(table, this->_value, values, count, selection);
+        return Status::OK();
+    }
+
     bool zone_map_filter(const ZoneMapDetail& detail) const override {
         const auto& min = detail.min_or_null_value();
         const auto& max = detail.max_value();
@@ -860,6 +884,14 @@ public:
     BinaryColumnNePredicate(const TypeInfoPtr& type_info, ColumnId id, ValueType value)
             : Base(PredicateType::kNE, type_info, id, value) {}
 
+    bool support_fsst_evaluate() const override { return field_type == TYPE_VARCHAR; }
+
+    Status evaluate_fsst(const FsstSymbolTable& table, const Slice* values, size_t count,
+                         uint8_t* selection) const override {
+        fsst_evaluate_eq<false>(table, this->_value, values, count, selection);
+        return Status::OK();
+    }
+
     bool zone_map_filter(const ZoneMapDetail& detail) const override { return true; }
 
     Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange<>* range) const override {
@@ -877,6 +909,120 @@ public:
     }
 };
 
+// LIKE predicate whose pattern only has '%' at the beginning or the end, i.e. 'abc', 'abc%', '%abc'
+// and '%abc%', which are evaluated by comparing bytes instead of the regular expressions.
+template <LogicalType field_type>
+class BinaryColumnLikePredicate : public ColumnPredicate {
+public:
+    enum Mode { EXACT, PREFIX, SUFFIX, CONTAINS };
+
+    BinaryColumnLikePredicate(const TypeInfoPtr& type_info, ColumnId id, Mode mode, std::string needle)
+            : ColumnPredicate(type_info, id), _mode(mode), _needle(std::move(needle)) {}
+
+    template <typename Op>
+    inline void t_evaluate(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const {
+        const auto* binary_column = down_cast<const BinaryColumn*>(ColumnHelper::get_data_column(column));
+        if (!column->has_null()) {
+            for (size_t i = from; i < to; i++) {
+                selection[i] = Op::apply(selection[i], (uint8_t)_match(binary_column->get_slice(i)));
+            }
+        } else {
+            const uint8_t* is_null = down_cast<const NullableColumn*>(column)->immutable_null_column_data().data();
+            for (size_t i = from; i < to; i++) {
+                selection[i] =
+                        Op::apply(selection[i], (uint8_t)((!is_null[i]) && _match(binary_column->get_slice(i))));
+            }
+        }
+    }
+
+    Status evaluate(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const override {
+        t_evaluate<ColumnPredicateAssignOp>(column, selection, from, to);
+        return Status::OK();
+    }
+
+    Status evaluate_and(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const override {
+        t_evaluate<ColumnPredicateAndOp>(column, selection, from, to);
+        return Status::OK();
+    }
+
+    Status evaluate_or(const Column* column, uint8_t* selection, uint16_t from, uint16_t to) const override {
+        t_evaluate<ColumnPredicateOrOp>(column, selection, from, to);
+        return Status::OK();
+    }
+
+    bool support_fsst_evaluate() const override { return true; }
+
+    Status evaluate_fsst(const FsstSymbolTable& table, const Slice* values, size_t count,
+                         uint8_t* selection) const override {
+        if (_mode == EXACT) {
+            fsst_evaluate_eq<true>(table, Slice(_needle), values, count, selection);
+            return Status::OK();
+        }
+        static_assert(static_cast<int>(PREFIX) == FsstMatcher::PREFIX);
+        static_assert(static_cast<int>(SUFFIX) == FsstMatcher::SUFFIX);
+        static_assert(static_cast<int>(CONTAINS) == FsstMatcher::CONTAINS);
+        FsstMatcher matcher;
+        if (matcher.init(table, static_cast<FsstMatcher::Mode>(_mode), Slice(_needle))) {
+            for (size_t i = 0; i < count; i++) {
+                selection[i] &= matcher.match(reinterpret_cast<const uint8_t*>(values[i].data), values[i].size);
+            }
+            return Status::OK();
+        }
+        // The needle is too long to build the matcher, decompress the strings selected.
+        std::vector<uint8_t> buffer;
+        for (size_t i = 0; i < count; i++) {
+            if (selection[i]) {
+                const auto* codes = reinterpret_cast<const uint8_t*>(values[i].data);
+                buffer.resize(table.decompressed_size(codes, values[i].size) + FsstSymbolTable::kDecompressPadding);
+                size_t size = table.decompress(codes, values[i].size, buffer.data());
+                selection[i] = _match(Slice(buffer.data(), size));
+            }
+        }
+        return Status::OK();
+    }
+
+    PredicateType type() const override { return PredicateType::kLike; }
+
+    bool can_vectorized() const override { return true; }
+
+    Status convert_to(const ColumnPredicate** output, const TypeInfoPtr& target_type_info,
+                      ObjectPool* obj_pool) const override {
+        const auto to_type = target_type_info->type();
+        if (to_type == field_type) {
+            *output = this;
+            return Status::OK();
+        }
+        CHECK(false) << "Not support, from_type=" << field_type << ", to_type=" << to_type;
+        return Status::OK();
+    }
+
+    std::string debug_string() const override {
+        std::stringstream ss;
+        ss << "(columnId(" << _column_id << ")LIKE" << (_mode == SUFFIX || _mode == CONTAINS ? "%" : "") << _needle
+           << (_mode == PREFIX || _mode == CONTAINS ? "%" : "") << ")";
+        return ss.str();
+    }
+
+private:
+    bool _match(const Slice& s) const {
+        switch (_mode) {
+        case EXACT:
+            return s == Slice(_needle);
+        case PREFIX:
+            return s.starts_with(Slice(_needle));
+        case SUFFIX:
+            return s.size >= _needle.size() &&
+                   memcmp(s.data + s.size - _needle.size(), _needle.data(), _needle.size()) == 0;
+        case CONTAINS:
+            return std::string_view(s.data, s.size).find(_needle) != std::string_view::npos;
+        }
+        return false;
+    }
+
+    Mode _mode;
+    std::string _needle;
+};
+
 ColumnPredicate* new_column_ne_predicate(const TypeInfoPtr& type_info, ColumnId id, const Slice& operand) {
     return new_column_predicate<ColumnNePredicate, BinaryColumnNePredicate>(type_info, id, operand);
 }
@@ -901,6 +1047,32 @@ ColumnPredicate* new_column_ge_predicate(const TypeInfoPtr& type_info, ColumnId
     return new_column_predicate<ColumnGePredicate, BinaryColumnGePredicate>(type_info, id, operand);
 }
 
+ColumnPredicate* new_column_like_predicate(const TypeInfoPtr& type_info, ColumnId id, const Slice& pattern) {
+    if (type_info->type() != TYPE_VARCHAR) {
+        return nullptr;
+    }
+    using Predicate = BinaryColumnLikePredicate<TYPE_VARCHAR>;
+    std::string_view p(pattern.data, pattern.size);
+    if (p.find_first_of("_\\") != std::string_view::npos) {
+        return nullptr;
+    }
+    size_t begin = p.find_first_not_of('%');
+    if (begin == std::string_view::npos) {
+        // '' matches the empty strings, and '%' matches all strings.
+        return new Predicate(type_info, id, p.empty() ? Predicate::EXACT : Predicate::CONTAINS, "");
+    }
+    size_t end = p.find_last_not_of('%') + 1;
+    std::string_view needle = p.substr(begin, end - begin);
+    if (needle.find('%') != std::string_view::npos) {
+        return nullptr;
+    }
+    bool leading = begin > 0;
+    bool trailing = end < p.size();
+    auto mode = leading ? (trailing ? Predicate::CONTAINS : Predicate::SUFFIX)
+                        : (trailing ? Predicate::PREFIX : Predicate::EXACT);
+    return new Predicate(type_info, id, mode, std::string(needle));
+}
+
 ColumnPredicate* new_column_cmp_predicate(PredicateType predicate, const TypeInfoPtr& type, ColumnId id,
                                           const Slice& operand) {
     switch (predicate) {
@@ -972,6 +1144,9 @@ std::ostream& operator<<(std::ostream& os, PredicateType p) {
     case PredicateType::kMap:
         os << "map";
         break;
+    case PredicateType::kLike:
+        os << "LIKE";
+        break;
     default:
         CHECK(false) << "unknown predicate " << p;
     }
@@ -95,7 +95,8 @@ Status LakePersistentIndex::init(const PersistentIndexSstableMetaPB& sstable_met
             return Status::InternalError("Block cache is null.");
         }
         auto sstable = std::make_unique<PersistentIndexSstable>();
-        RETURN_IF_ERROR(sstable->init(std::move(rf), sstable_pb, block_cache->cache()));
+        RETURN_IF_ERROR(sstable->init(std::move(rf), sstable_pb, block_cache->cache(), true,
+                                      _tablet_mgr->update_mgr()->sst_read_thread_pool()));
         _sstables.emplace_back(std::move(sstable));
     }
     return Status::OK();
@@ -133,7 +134,8 @@ Status LakePersistentIndex::minor_compact() {
     if (block_cache == nullptr) {
         return Status::InternalError("Block cache is null.");
     }
-    RETURN_IF_ERROR(sstable->init(std::move(rf), sstable_pb, block_cache->cache()));
+    RETURN_IF_ERROR(sstable->init(std::move(rf), sstable_pb, block_cache->cache(), true,
+                                  _tablet_mgr->update_mgr()->sst_read_thread_pool()));
     _sstables.emplace_back(std::move(sstable));
     return Status::OK();
 }
@@ -318,8 +320,9 @@ Status LakePersistentIndex::major_compact(const TabletMetadata& metadata, int64_
     ASSIGN_OR_RETURN(auto wf, fs::new_writable_file(location));
     sstable::Options options;
     std::unique_ptr<sstable::FilterPolicy> filter_policy;
-    filter_policy.reset(const_cast<sstable::FilterPolicy*>(sstable::NewBloomFilterPolicy(10)));
+    filter_policy.reset(const_cast<sstable::FilterPolicy*>(sstable::NewXorFilterPolicy()));
     options.filter_policy = filter_policy.get();
+    options.partition_filters = true;
     sstable::TableBuilder builder(options, wf.get());
     RETURN_IF_ERROR(merge_sstables(std::move(merging_iter_ptr), &builder));
     RETURN_IF_ERROR(wf->close());
@@ -344,7 +347,8 @@ Status LakePersistentIndex::apply_opcompaction(const TxnLogPB_OpCompaction& op_c
     if (block_cache == nullptr) {
         return Status::InternalError("Block cache is null.");
     }
-    RETURN_IF_ERROR(sstable->init(std::move(rf), sstable_pb, block_cache->cache()));
+    RETURN_IF_ERROR(sstable->init(std::move(rf), sstable_pb, block_cache->cache(), true,
+                                  _tablet_mgr->update_mgr()->sst_read_thread_pool()));
 
     std::unordered_set<std::string> filenames;
     for (const auto& input_sstable : op_compaction.input_sstables()) {
@@ -23,13 +23,16 @@
 namespace starrocks::lake {
 
 Status PersistentIndexSstable::init(std::unique_ptr<RandomAccessFile> rf, const PersistentIndexSstablePB& sstable_pb,
-                                    Cache* cache, bool need_filter) {
+                                    Cache* cache, bool need_filter, ThreadPool* read_pool) {
     sstable::Options options;
     if (need_filter) {
-        _filter_policy.reset(const_cast<sstable::FilterPolicy*>(sstable::NewBloomFilterPolicy(10)));
+        _filter_policy.reset(const_cast<sstable::FilterPolicy*>(sstable::NewXorFilterPolicy()));
+        _bloom_filter_policy.reset(const_cast<sstable::FilterPolicy*>(sstable::NewBloomFilterPolicy(10)));
         options.filter_policy = _filter_policy.get();
+        options.fallback_filter_policies.push_back(_bloom_filter_policy.get());
     }
     options.block_cache = cache;
+    _read_pool = read_pool;
     sstable::Table* table;
     RETURN_IF_ERROR(sstable::Table::Open(options, rf.get(), sstable_pb.filesize(), &table));
     _sst.reset(table);
@@ -42,9 +45,10 @@ Status PersistentIndexSstable::build_sstable(
         const phmap::btree_map<std::string, std::list<IndexValueWithVer>, std::less<>>& map, WritableFile* wf,
         uint64_t* filesz) {
     std::unique_ptr<sstable::FilterPolicy> filter_policy;
-    filter_policy.reset(const_cast<sstable::FilterPolicy*>(sstable::NewBloomFilterPolicy(10)));
+    filter_policy.reset(const_cast<sstable::FilterPolicy*>(sstable::NewXorFilterPolicy()));
     sstable::Options options;
     options.filter_policy = filter_policy.get();
+    options.partition_filters = true;
     sstable::TableBuilder builder(options, wf);
     for (const auto& [k, v] : map) {
         IndexValueWithVerPB index_value_pb;
@@ -63,6 +67,7 @@ Status PersistentIndexSstable::multi_get(const Slice* keys, const KeyIndexSet& k
                                          IndexValue* values, KeyIndexSet* found_key_indexes) const {
     std::vector<std::string> index_value_with_vers(key_indexes.size());
     sstable::ReadOptions options;
+    options.read_pool = _read_pool;
     auto start_ts = butil::gettimeofday_us();
     RETURN_IF_ERROR(_sst->MultiGet(options, keys, key_indexes.begin(), key_indexes.end(), &index_value_with_vers));
     auto end_ts = butil::gettimeofday_us();
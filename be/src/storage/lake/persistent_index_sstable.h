@@ -27,6 +27,7 @@ namespace starrocks {
 
 class WritableFile;
 class PersistentIndexSstablePB;
+class ThreadPool;
 
 namespace lake {
 using KeyIndex = size_t;
@@ -39,8 +40,9 @@ public:
     PersistentIndexSstable() = default;
     ~PersistentIndexSstable() = default;
 
+    // |read_pool|, if not null, reads the blocks of a multi_get in parallel.
     Status init(std::unique_ptr<RandomAccessFile> rf, const PersistentIndexSstablePB& sstable_pb, Cache* cache,
-                bool need_filter = true);
+                bool need_filter = true, ThreadPool* read_pool = nullptr);
 
     static Status build_sstable(const phmap::btree_map<std::string, std::list<IndexValueWithVer>, std::less<>>& map,
                                 WritableFile* wf, uint64_t* filesz);
@@ -61,6 +63,9 @@ public:
 private:
     std::unique_ptr<sstable::Table> _sst{nullptr};
     std::unique_ptr<sstable::FilterPolicy> _filter_policy{nullptr};
+    // Policy of the filters of the sstables written by older versions
+    std::unique_ptr<sstable::FilterPolicy> _bloom_filter_policy{nullptr};
+    ThreadPool* _read_pool = nullptr;
     std::unique_ptr<RandomAccessFile> _rf{nullptr};
     PersistentIndexSstablePB _sstable_pb;
 };
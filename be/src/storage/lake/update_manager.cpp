@@ -56,9 +56,21 @@ UpdateManager::UpdateManager(LocationProvider* location_provider, MemTracker* me
     const int64_t block_cache_mem_limit =
             update_mem_limit * std::max(std::min(100, config::lake_pk_index_block_cache_limit_percent), 0) / 100;
     _block_cache = std::make_unique<PersistentIndexBlockCache>(mem_tracker, block_cache_mem_limit);
+
+    if (config::lake_pk_index_sst_read_threads > 0) {
+        auto st = ThreadPoolBuilder("lake_pk_sst_read")
+                          .set_max_threads(config::lake_pk_index_sst_read_threads)
+                          .build(&_sst_read_thread_pool);
+        if (!st.ok()) {
+            LOG(WARNING) << "Failed to create lake pk sst read thread pool, read sequentially: " << st;
+        }
+    }
 }
 
 UpdateManager::~UpdateManager() {
+    if (_sst_read_thread_pool != nullptr) {
+        _sst_read_thread_pool->shutdown();
+    }
     _index_cache.clear();
     _update_state_cache.clear();
     _compaction_cache.clear();
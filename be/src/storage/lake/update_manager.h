@@ -178,6 +178,9 @@ public:
 
     PersistentIndexBlockCache* block_cache() { return _block_cache.get(); }
 
+    // Pool reading the blocks of the PK index sstables in parallel, null if disabled.
+    ThreadPool* sst_read_thread_pool() { return _sst_read_thread_pool.get(); }
+
 private:
     // print memory tracker state
     void _print_memory_stats();
@@ -228,6 +231,7 @@ private:
     std::vector<PkIndexShard> _pk_index_shards;
 
     std::unique_ptr<PersistentIndexBlockCache> _block_cache;
+    std::unique_ptr<ThreadPool> _sst_read_thread_pool;
 };
 
 } // namespace lake
@@ -531,6 +531,13 @@ Status MemTable::_sort_column_inc(bool by_sort_key) {
         }
     }
 
+    if (config::memtable_radix_sort_max_key_width > 0) {
+        Status st = stable_sort_by_normalized_keys(false, columns, sort_descs,
+                                                   config::memtable_radix_sort_max_key_width, &_permutations);
+        if (!st.is_not_supported()) {
+            return st;
+        }
+    }
     Status st = stable_sort_and_tie_columns(false, columns, sort_descs, &_permutations);
     return st;
 }
@@ -36,6 +36,9 @@
 
 #include <malloc.h>
 
+#include <functional>
+
+#include "common/config.h"
 #include "runtime/current_thread.h"
 #include "runtime/mem_tracker.h"
 #include "util/defer_op.h"
@@ -85,8 +88,19 @@ static void init_metrics() {
     });
 }
 
+static CacheEvictionPolicy page_cache_eviction_policy() {
+    CacheEvictionPolicy policy = CacheEvictionPolicy::LRU;
+    if (!parse_cache_eviction_policy(config::storage_page_cache_eviction_policy, &policy)) {
+        LOG(WARNING) << "unknown storage_page_cache_eviction_policy: " << config::storage_page_cache_eviction_policy
+                     << ", use lru instead";
+    }
+    return policy;
+}
+
 StoragePageCache::StoragePageCache(MemTracker* mem_tracker, size_t capacity)
-        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity, ChargeMode::MEMSIZE)) {
+        : _mem_tracker(mem_tracker),
+          _cache(new_lru_cache(capacity, ChargeMode::MEMSIZE, page_cache_eviction_policy())),
+          _decoded_freq(kDecodedFreqWidth) {
     init_metrics();
 }
 
@@ -149,4 +163,32 @@ void StoragePageCache::insert(const CacheKey& key, const Slice& data, PageCacheH
     *handle = PageCacheHandle(_cache.get(), lru_handle);
 }
 
+bool StoragePageCache::lookup_decoded(const CacheKey& key, int32_t encoding, PageCacheHandle* handle) {
+    auto* lru_handle = _cache->lookup(key.encode_decoded(encoding));
+    if (lru_handle == nullptr) {
+        return false;
+    }
+    *handle = PageCacheHandle(_cache.get(), lru_handle);
+    return true;
+}
+
+bool StoragePageCache::admit_decoded(const CacheKey& key, int32_t encoding) {
+    uint64_t hash = std::hash<std::string>()(key.encode_decoded(encoding));
+    std::lock_guard<std::mutex> l(_decoded_freq_lock);
+    _decoded_freq.increment(hash);
+    return _decoded_freq.frequency(hash) >= config::decoded_page_cache_admit_frequency;
+}
+
+void StoragePageCache::insert_decoded(const CacheKey& key, int32_t encoding, void* value, size_t charge,
+                                      void (*deleter)(const starrocks::CacheKey& key, void* value),
+                                      PageCacheHandle* handle) {
+#ifndef BE_TEST
+    tls_thread_status.mem_release(charge);
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+    tls_thread_status.mem_consume(charge);
+#endif
+    auto* lru_handle = _cache->insert(key.encode_decoded(encoding), value, charge, deleter, CachePriority::NORMAL);
+    *handle = PageCacheHandle(_cache.get(), lru_handle);
+}
+
 } // namespace starrocks
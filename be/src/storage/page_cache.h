@@ -35,6 +35,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 
@@ -42,6 +43,7 @@
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
 #include "util/defer_op.h"
+#include "util/frequency_sketch.h"
 #include "util/lru_cache.h"
 
 namespace starrocks {
@@ -75,6 +77,15 @@ public:
             key_buf.append((char*)&offset, sizeof(offset));
             return key_buf;
         }
+
+        // The key of the page decoded from |encoding|, which starts with '\0' so that it never
+        // collides with the key of a page.
+        std::string encode_decoded(int32_t encoding) const {
+            std::string key_buf(1, '\0');
+            key_buf.append((char*)&encoding, sizeof(encoding));
+            key_buf.append(encode());
+            return key_buf;
+        }
     };
 
     // Create global instance of this class
@@ -104,6 +115,20 @@ public:
     // The in_memory page will have higher priority.
     void insert(const CacheKey& key, const Slice& data, PageCacheHandle* handle, bool in_memory = false);
 
+    // The decoded tier keeps the data pages decoded into plain values, so that the scans of the hot
+    // pages skip decoding. The decoded pages share the capacity and the memory tracker of the pages.
+
+    // Lookup the page of |key| decoded from |encoding|, the decoded page is PageCacheHandle::value().
+    bool lookup_decoded(const CacheKey& key, int32_t encoding, PageCacheHandle* handle);
+
+    // Record a request of the page of |key| decoded from |encoding|, and return true if it's requested
+    // often enough recently to be inserted, see config::decoded_page_cache_admit_frequency.
+    bool admit_decoded(const CacheKey& key, int32_t encoding);
+
+    // Insert the page |value| of |charge| bytes decoded from |encoding|, which is freed by |deleter|.
+    void insert_decoded(const CacheKey& key, int32_t encoding, void* value, size_t charge,
+                        void (*deleter)(const starrocks::CacheKey& key, void* value), PageCacheHandle* handle);
+
     size_t memory_usage() const { return _cache->get_memory_usage(); }
 
     void set_capacity(size_t capacity);
@@ -123,6 +148,11 @@ private:
 
     MemTracker* _mem_tracker = nullptr;
     std::unique_ptr<Cache> _cache = nullptr;
+
+    // How often the decoded pages are requested recently.
+    static constexpr size_t kDecodedFreqWidth = 1 << 16;
+    std::mutex _decoded_freq_lock;
+    FrequencySketch _decoded_freq;
 };
 
 // A handle for StoragePageCache entry. This class make it easy to handle
@@ -157,6 +187,7 @@ public:
 
     Cache* cache() const { return _cache; }
     Slice data() const { return _cache->value_slice(_handle); }
+    void* value() const { return _cache->value(_handle); }
 
 private:
     Cache* _cache = nullptr;
@@ -0,0 +1,661 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <type_traits>
+#include <vector>
+
+#include "column/column.h"
+#include "gutil/strings/substitute.h"
+#include "storage/range.h"
+#include "storage/rowset/options.h"      // for PageBuilderOptions/PageDecoderOptions
+#include "storage/rowset/page_builder.h" // for PageBuilder
+#include "storage/rowset/page_decoder.h" // for PageDecoder
+#include "storage/type_traits.h"
+#include "util/bit_packing.inline.h"
+#include "util/bit_stream_utils.inline.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+
+namespace starrocks {
+
+enum class AlpVectorScheme : uint8_t { ALP = 0, XOR = 1 };
+
+static constexpr size_t ALP_PAGE_HEADER_SIZE = 8;
+static constexpr size_t ALP_VECTOR_SIZE = 1024;
+// scheme, exponent, factor, bit width, number of exceptions and the frame of reference
+static constexpr size_t ALP_VECTOR_HEADER_SIZE = 1 + 1 + 1 + 1 + 2 + 8;
+
+template <typename T>
+struct AlpConstants {};
+
+template <>
+struct AlpConstants<double> {
+    using UnsignedType = uint64_t;
+    static constexpr int kMaxExponent = 18;
+    // Adding and then subtracting 2^52 + 2^51 rounds a double in (-2^51, 2^51) to the nearest integer.
+    static constexpr double kMagicNumber = 6755399441055744.0;
+    static constexpr double kMaxEncodable = 2251799813685248.0; // 2^51
+    static constexpr int kLeadingZerosBits = 6;
+    static constexpr int kLengthBits = 6;
+    static constexpr double kExponents[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8, 1e9,
+                                            1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+    static constexpr double kFractions[] = {1e0,   1e-1,  1e-2,  1e-3,  1e-4,  1e-5,  1e-6,  1e-7,  1e-8, 1e-9,
+                                            1e-10, 1e-11, 1e-12, 1e-13, 1e-14, 1e-15, 1e-16, 1e-17, 1e-18};
+};
+
+template <>
+struct AlpConstants<float> {
+    using UnsignedType = uint32_t;
+    static constexpr int kMaxExponent = 10;
+    // Adding and then subtracting 2^23 + 2^22 rounds a float in (-2^22, 2^22) to the nearest integer.
+    static constexpr float kMagicNumber = 12582912.0f;
+    static constexpr float kMaxEncodable = 4194304.0f; // 2^22
+    static constexpr int kLeadingZerosBits = 5;
+    static constexpr int kLengthBits = 5;
+    static constexpr float kExponents[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+    static constexpr float kFractions[] = {1e0f,  1e-1f, 1e-2f, 1e-3f, 1e-4f, 1e-5f,
+                                           1e-6f, 1e-7f, 1e-8f, 1e-9f, 1e-10f};
+};
+
+// AlpPageBuilder encodes the FLOAT and DOUBLE values of a page losslessly, in vectors of 1024 values.
+//
+// Most of the floating-point values in the tables are decimals with a few digits, e.g. prices and sensor
+// readings. The ALP scheme turns them into integers by `digits = round(v * 10^e * 10^-f)`, which are packed
+// with frame-of-reference and bit-packing, and decodes them by `v = digits * 10^f * 10^-e`. The values which
+// can not be restored exactly, e.g. NaN, -0.0 and the values with too many digits, are stored as exceptions.
+// The exponent e and the factor f are sampled for every vector from the best few combinations of the page.
+//
+// If the values are not decimals, e.g. computed ratios, the vector falls back to the XOR scheme of Gorilla,
+// which stores the XOR of every value with the previous one, and only the meaningful bits of it.
+//
+// The page format is as follows:
+//
+// 1. Header: (8 bytes total)
+//
+//    <num_elements> [32-bit]
+//      The number of elements encoded in the page.
+//
+//    <elem_size_bytes> [8-bit]
+//      The size of the elements, in bytes.
+//
+//    <reserved> [24-bit]
+//
+// 2. Vector offsets: <num_vectors> [32-bit]
+//      The offsets of the vectors relative to the end of the vector offsets.
+//
+// 3. Vectors, each starts with a <scheme> [8-bit] of AlpVectorScheme, then
+//
+//    ALP:
+//      <exponent> [8-bit] <factor> [8-bit] <bit_width> [8-bit] <num_exceptions> [16-bit]
+//      <frame_of_reference> [64-bit]
+//      <packed digits> [ceil(num_values * bit_width / 8) bytes]
+//      <exception positions> [16-bit * num_exceptions]
+//      <exception values> [elem_size_bytes * num_exceptions]
+//
+//    XOR:
+//      The first value, and then for every following value with XOR x against the previous value:
+//        '0'                          if x is 0,
+//        '10' + meaningful bits       if the leading and trailing zeros of x cover the previous meaningful bits,
+//        '11' + leading zeros + length - 1 + meaningful bits otherwise.
+//
+//   NOTE: all on-disk ints are encoded little-endian
+//
+template <LogicalType Type>
+class AlpPageBuilder final : public PageBuilder {
+    typedef typename TypeTraits<Type>::CppType CppType;
+    typedef AlpConstants<CppType> Constants;
+    typedef typename Constants::UnsignedType UnsignedType;
+    static_assert(std::is_floating_point_v<CppType>, "alp encoding only supports FLOAT and DOUBLE");
+
+public:
+    explicit AlpPageBuilder(const PageBuilderOptions& options)
+            : _max_count(std::max<uint32_t>(1, options.data_page_size / sizeof(CppType))) {}
+
+    ~AlpPageBuilder() override = default;
+
+    bool is_page_full() override { return _values.size() >= _max_count; }
+
+    uint32_t add(const uint8_t* vals, uint32_t count) override {
+        DCHECK(!_finished);
+        uint32_t to_add = std::min<uint32_t>(_max_count - _values.size(), count);
+        auto new_vals = reinterpret_cast<const CppType*>(vals);
+        _values.insert(_values.end(), new_vals, new_vals + to_add);
+        return to_add;
+    }
+
+    faststring* finish() override {
+        DCHECK(!_finished);
+        _finished = true;
+        _buf.clear();
+        _num_alp_vectors = 0;
+
+        const size_t num_vectors = (_values.size() + ALP_VECTOR_SIZE - 1) / ALP_VECTOR_SIZE;
+        put_fixed32_le(&_buf, static_cast<uint32_t>(_values.size()));
+        _buf.push_back(static_cast<uint8_t>(sizeof(CppType)));
+        // reserved
+        _buf.push_back(0);
+        _buf.push_back(0);
+        _buf.push_back(0);
+        const size_t offsets_pos = _buf.size();
+        _buf.resize(offsets_pos + num_vectors * sizeof(uint32_t));
+        const size_t vectors_pos = _buf.size();
+
+        std::vector<Combination> combinations = _sample_combinations();
+        faststring alp_vector;
+        faststring xor_vector;
+        for (size_t i = 0; i < num_vectors; i++) {
+            encode_fixed32_le(&_buf[offsets_pos + i * sizeof(uint32_t)], _buf.size() - vectors_pos);
+            const CppType* values = _values.data() + i * ALP_VECTOR_SIZE;
+            size_t size = std::min(ALP_VECTOR_SIZE, _values.size() - i * ALP_VECTOR_SIZE);
+            _encode_alp(values, size, _choose_combination(values, size, combinations), &alp_vector);
+            _encode_xor(values, size, &xor_vector);
+            if (alp_vector.size() <= xor_vector.size()) {
+                _buf.append(alp_vector.data(), alp_vector.size());
+                _num_alp_vectors++;
+            } else {
+                _buf.append(xor_vector.data(), xor_vector.size());
+            }
+        }
+        return &_buf;
+    }
+
+    void reset() override {
+        _values.clear();
+        _buf.clear();
+        _finished = false;
+    }
+
+    uint32_t count() const override { return _values.size(); }
+
+    uint64_t size() const override { return _finished ? _buf.size() : _values.size() * sizeof(CppType); }
+
+    Status get_first_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values.front(), sizeof(CppType));
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values.back(), sizeof(CppType));
+        return Status::OK();
+    }
+
+    // The number of vectors encoded with the ALP scheme by the last `finish`.
+    size_t num_alp_vectors() const { return _num_alp_vectors; }
+
+private:
+    struct Combination {
+        uint8_t exponent;
+        uint8_t factor;
+    };
+
+    static constexpr size_t kSampleVectors = 8;
+    static constexpr size_t kSampleValues = 32;
+    static constexpr size_t kMaxCombinations = 5;
+
+    // Encode |value| to digits with |combination|, return false if the digits can not be decoded to the same value.
+    static bool _encode_value(CppType value, Combination combination, int64_t* digits) {
+        CppType scaled = value * Constants::kExponents[combination.exponent] * Constants::kFractions[combination.factor];
+        if (!(std::abs(scaled) < Constants::kMaxEncodable)) {
+            return false;
+        }
+        CppType rounded = (scaled + Constants::kMagicNumber) - Constants::kMagicNumber;
+        *digits = static_cast<int64_t>(rounded);
+        CppType decoded = static_cast<CppType>(*digits) * Constants::kExponents[combination.factor] *
+                          Constants::kFractions[combination.exponent];
+        return memcmp(&decoded, &value, sizeof(CppType)) == 0;
+    }
+
+    // The estimated bits to encode the sampled values of |values| with |combination|.
+    static size_t _estimate_bits(const CppType* values, size_t size, Combination combination) {
+        // An odd step, so that the samples of the regularly spaced values, e.g. i * 0.25, are not all integers.
+        const size_t step = std::max<size_t>(1, size / kSampleValues) | 1;
+        size_t num_samples = 0;
+        size_t num_exceptions = 0;
+        int64_t min_digits = std::numeric_limits<int64_t>::max();
+        int64_t max_digits = std::numeric_limits<int64_t>::min();
+        for (size_t i = 0; i < size; i += step) {
+            num_samples++;
+            int64_t digits;
+            if (_encode_value(values[i], combination, &digits)) {
+                min_digits = std::min(min_digits, digits);
+                max_digits = std::max(max_digits, digits);
+            } else {
+                num_exceptions++;
+            }
+        }
+        size_t bit_width = _bit_width(min_digits, max_digits);
+        return num_samples * bit_width + num_exceptions * (sizeof(uint16_t) + sizeof(CppType)) * 8;
+    }
+
+    static size_t _bit_width(int64_t min_digits, int64_t max_digits) {
+        if (min_digits >= max_digits) {
+            return 0;
+        }
+        auto range = static_cast<uint64_t>(max_digits) - static_cast<uint64_t>(min_digits);
+        return 64 - __builtin_clzll(range);
+    }
+
+    // Find the best combination for a few sampled vectors among all the combinations, and keep the
+    // combinations which are chosen most frequently, so that every vector only needs to try a few of them.
+    std::vector<Combination> _sample_combinations() const {
+        const size_t num_vectors = (_values.size() + ALP_VECTOR_SIZE - 1) / ALP_VECTOR_SIZE;
+        const size_t step = std::max<size_t>(1, num_vectors / kSampleVectors);
+        std::map<std::pair<uint8_t, uint8_t>, size_t> counts;
+        for (size_t i = 0; i < num_vectors; i += step) {
+            const CppType* values = _values.data() + i * ALP_VECTOR_SIZE;
+            size_t size = std::min(ALP_VECTOR_SIZE, _values.size() - i * ALP_VECTOR_SIZE);
+            Combination best{0, 0};
+            size_t best_bits = std::numeric_limits<size_t>::max();
+            for (int e = Constants::kMaxExponent; e >= 0; e--) {
+                for (int f = e; f >= 0; f--) {
+                    Combination combination{static_cast<uint8_t>(e), static_cast<uint8_t>(f)};
+                    size_t bits = _estimate_bits(values, size, combination);
+                    if (bits < best_bits) {
+                        best = combination;
+                        best_bits = bits;
+                    }
+                }
+            }
+            counts[{best.exponent, best.factor}]++;
+        }
+
+        std::vector<std::pair<size_t, Combination>> sorted;
+        for (const auto& [key, count] : counts) {
+            sorted.emplace_back(count, Combination{key.first, key.second});
+        }
+        std::stable_sort(sorted.begin(), sorted.end(),
+                         [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+        std::vector<Combination> combinations;
+        for (size_t i = 0; i < sorted.size() && i < kMaxCombinations; i++) {
+            combinations.emplace_back(sorted[i].second);
+        }
+        return combinations;
+    }
+
+    static Combination _choose_combination(const CppType* values, size_t size,
+                                           const std::vector<Combination>& combinations) {
+        DCHECK(!combinations.empty());
+        Combination best = combinations[0];
+        size_t best_bits = std::numeric_limits<size_t>::max();
+        for (size_t i = 0; combinations.size() > 1 && i < combinations.size(); i++) {
+            size_t bits = _estimate_bits(values, size, combinations[i]);
+            if (bits < best_bits) {
+                best = combinations[i];
+                best_bits = bits;
+            }
+        }
+        return best;
+    }
+
+    static void _encode_alp(const CppType* values, size_t size, Combination combination, faststring* out) {
+        out->clear();
+        std::vector<int64_t> digits(size);
+        std::vector<uint16_t> exception_positions;
+        std::vector<CppType> exception_values;
+        for (size_t i = 0; i < size; i++) {
+            if (!_encode_value(values[i], combination, &digits[i])) {
+                exception_positions.push_back(i);
+                exception_values.push_back(values[i]);
+            }
+        }
+        // Replace the exceptions with a valid digits, so that they do not widen the bit width.
+        int64_t filler = 0;
+        for (size_t i = 0, j = 0; i < size; i++) {
+            if (j < exception_positions.size() && exception_positions[j] == i) {
+                j++;
+            } else {
+                filler = digits[i];
+                break;
+            }
+        }
+        for (auto position : exception_positions) {
+            digits[position] = filler;
+        }
+        int64_t min_digits = size > 0 ? *std::min_element(digits.begin(), digits.end()) : 0;
+        int64_t max_digits = size > 0 ? *std::max_element(digits.begin(), digits.end()) : 0;
+        const int bit_width = _bit_width(min_digits, max_digits);
+
+        out->push_back(static_cast<uint8_t>(AlpVectorScheme::ALP));
+        out->push_back(combination.exponent);
+        out->push_back(combination.factor);
+        out->push_back(static_cast<uint8_t>(bit_width));
+        uint16_t num_exceptions = exception_positions.size();
+        out->append(&num_exceptions, sizeof(num_exceptions));
+        out->append(&min_digits, sizeof(min_digits));
+
+        if (bit_width > 0) {
+            faststring packed;
+            BitWriter writer(&packed);
+            for (size_t i = 0; i < size; i++) {
+                writer.PutValue(static_cast<uint64_t>(digits[i]) - static_cast<uint64_t>(min_digits), bit_width);
+            }
+            writer.Flush();
+            out->append(packed.data(), writer.bytes_written());
+        }
+        out->append(exception_positions.data(), exception_positions.size() * sizeof(uint16_t));
+        out->append(exception_values.data(), exception_values.size() * sizeof(CppType));
+    }
+
+    static void _encode_xor(const CppType* values, size_t size, faststring* out) {
+        out->clear();
+        out->push_back(static_cast<uint8_t>(AlpVectorScheme::XOR));
+        if (size == 0) {
+            return;
+        }
+        constexpr int kBits = sizeof(UnsignedType) * 8;
+        faststring packed;
+        BitWriter writer(&packed);
+        UnsignedType prev;
+        memcpy(&prev, &values[0], sizeof(UnsignedType));
+        writer.PutValue(prev, kBits);
+        int prev_leading = -1;
+        int prev_trailing = 0;
+        for (size_t i = 1; i < size; i++) {
+            UnsignedType value;
+            memcpy(&value, &values[i], sizeof(UnsignedType));
+            UnsignedType x = value ^ prev;
+            prev = value;
+            if (x == 0) {
+                writer.PutValue(0, 1);
+                continue;
+            }
+            int leading = __builtin_clzll(x) - (64 - kBits);
+            int trailing = __builtin_ctzll(x);
+            if (prev_leading >= 0 && leading >= prev_leading && trailing >= prev_trailing) {
+                writer.PutValue(0b01, 2);
+                writer.PutValue(x >> prev_trailing, kBits - prev_leading - prev_trailing);
+            } else {
+                int length = kBits - leading - trailing;
+                writer.PutValue(0b11, 2);
+                writer.PutValue(leading, Constants::kLeadingZerosBits);
+                writer.PutValue(length - 1, Constants::kLengthBits);
+                writer.PutValue(x >> trailing, length);
+                prev_leading = leading;
+                prev_trailing = trailing;
+            }
+        }
+        writer.Flush();
+        out->append(packed.data(), writer.bytes_written());
+    }
+
+    const uint32_t _max_count;
+    bool _finished{false};
+    size_t _num_alp_vectors{0};
+    std::vector<CppType> _values;
+    faststring _buf;
+};
+
+template <LogicalType Type>
+class AlpPageDecoder final : public PageDecoder {
+    typedef typename TypeTraits<Type>::CppType CppType;
+    typedef AlpConstants<CppType> Constants;
+    typedef typename Constants::UnsignedType UnsignedType;
+    static_assert(std::is_floating_point_v<CppType>, "alp encoding only supports FLOAT and DOUBLE");
+
+public:
+    explicit AlpPageDecoder(Slice data) : _data(data) {}
+
+    ~AlpPageDecoder() override = default;
+
+    [[nodiscard]] Status init() override {
+        CHECK(!_parsed);
+        if (_data.size < ALP_PAGE_HEADER_SIZE) {
+            return Status::Corruption(strings::Substitute("invalid alp page size: $0, header size: $1", _data.size,
+                                                          ALP_PAGE_HEADER_SIZE));
+        }
+        const auto* data = reinterpret_cast<const uint8_t*>(_data.data);
+        _num_elements = decode_fixed32_le(data);
+        if (data[4] != sizeof(CppType)) {
+            return Status::Corruption(strings::Substitute("invalid alp page elem size: $0", data[4]));
+        }
+
+        const size_t num_vectors = (_num_elements + ALP_VECTOR_SIZE - 1) / ALP_VECTOR_SIZE;
+        if (ALP_PAGE_HEADER_SIZE + num_vectors * sizeof(uint32_t) > _data.size) {
+            return Status::Corruption("The alp page metadata maybe broken");
+        }
+        _vectors = data + ALP_PAGE_HEADER_SIZE + num_vectors * sizeof(uint32_t);
+        const size_t vectors_size = data + _data.size - _vectors;
+        _vector_offsets.resize(num_vectors + 1);
+        for (size_t i = 0; i < num_vectors; i++) {
+            _vector_offsets[i] = decode_fixed32_le(data + ALP_PAGE_HEADER_SIZE + i * sizeof(uint32_t));
+        }
+        _vector_offsets[num_vectors] = vectors_size;
+        for (size_t i = 0; i < num_vectors; i++) {
+            RETURN_IF_ERROR(_check_vector(i));
+        }
+
+        _parsed = true;
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status seek_to_position_in_page(uint32_t pos) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        DCHECK_LE(pos, _num_elements) << "Tried to seek to " << pos << " which is > number of elements ("
+                                      << _num_elements << ") in the block!";
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status next_batch(size_t* n, Column* dst) override {
+        SparseRange<> read_range;
+        uint32_t begin = current_index();
+        read_range.add(Range<>(begin, begin + *n));
+        RETURN_IF_ERROR(next_batch(read_range, dst));
+        *n = current_index() - begin;
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status next_batch(const SparseRange<>& range, Column* dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (PREDICT_FALSE(range.span_size() == 0 || _cur_index >= _num_elements)) {
+            return Status::OK();
+        }
+
+        size_t to_read =
+                std::min(static_cast<size_t>(range.span_size()), static_cast<size_t>(_num_elements - _cur_index));
+        SparseRangeIterator<> iter = range.new_iterator();
+        while (to_read > 0 && _cur_index < _num_elements) {
+            RETURN_IF_ERROR(seek_to_position_in_page(iter.begin()));
+            Range<> r = iter.next(to_read);
+            const size_t ori_size = dst->size();
+            dst->resize(ori_size + r.span_size());
+            auto* p = reinterpret_cast<CppType*>(dst->mutable_raw_data()) + ori_size;
+            _copy_values(r.begin(), r.span_size(), p);
+            _cur_index += r.span_size();
+            to_read -= r.span_size();
+        }
+        return Status::OK();
+    }
+
+    uint32_t count() const override { return _num_elements; }
+
+    uint32_t current_index() const override { return _cur_index; }
+
+    EncodingTypePB encoding_type() const override { return ALP_ENCODING; }
+
+private:
+    size_t _vector_size(size_t vector) const {
+        return std::min<size_t>(ALP_VECTOR_SIZE, _num_elements - vector * ALP_VECTOR_SIZE);
+    }
+
+    Status _check_vector(size_t vector) const {
+        if (_vector_offsets[vector] >= _vector_offsets[vector + 1]) {
+            return Status::Corruption(strings::Substitute("invalid alp vector offset: $0", _vector_offsets[vector]));
+        }
+        const uint8_t* data = _vectors + _vector_offsets[vector];
+        const size_t data_size = _vector_offsets[vector + 1] - _vector_offsets[vector];
+        if (data[0] == static_cast<uint8_t>(AlpVectorScheme::XOR)) {
+            return Status::OK();
+        }
+        if (data[0] != static_cast<uint8_t>(AlpVectorScheme::ALP) || data_size < ALP_VECTOR_HEADER_SIZE) {
+            return Status::Corruption(strings::Substitute("invalid alp vector, scheme: $0, size: $1", data[0],
+                                                          data_size));
+        }
+        uint8_t exponent = data[1];
+        uint8_t factor = data[2];
+        uint8_t bit_width = data[3];
+        uint16_t num_exceptions;
+        memcpy(&num_exceptions, data + 4, sizeof(num_exceptions));
+        size_t expected_size = ALP_VECTOR_HEADER_SIZE + BitUtil::Ceil(_vector_size(vector) * bit_width, 8) +
+                               num_exceptions * (sizeof(uint16_t) + sizeof(CppType));
+        if (exponent > Constants::kMaxExponent || factor > exponent || bit_width > sizeof(UnsignedType) * 8 ||
+            expected_size != data_size) {
+            return Status::Corruption(strings::Substitute("invalid alp vector, e: $0, f: $1, bit width: $2", exponent,
+                                                          factor, bit_width));
+        }
+        for (size_t i = 0; i < num_exceptions; i++) {
+            uint16_t position;
+            memcpy(&position, data + data_size - num_exceptions * (sizeof(uint16_t) + sizeof(CppType)) +
+                                      i * sizeof(uint16_t),
+                   sizeof(position));
+            if (position >= _vector_size(vector)) {
+                return Status::Corruption(strings::Substitute("invalid alp exception position: $0", position));
+            }
+        }
+        return Status::OK();
+    }
+
+    // Copy |n| values starting at |pos| to |dst|. The vectors read entirely are decoded into |dst| directly,
+    // and the others are decoded into |_decoded_values| which is reused by the following reads.
+    void _copy_values(size_t pos, size_t n, CppType* dst) {
+        while (n > 0) {
+            size_t vector = pos / ALP_VECTOR_SIZE;
+            size_t offset = pos % ALP_VECTOR_SIZE;
+            size_t vector_size = _vector_size(vector);
+            size_t count = std::min(n, vector_size - offset);
+            if (offset == 0 && count == vector_size) {
+                _decode_vector(vector, dst);
+            } else {
+                if (_decoded_vector != vector) {
+                    _decoded_values.resize(ALP_VECTOR_SIZE);
+                    _decode_vector(vector, _decoded_values.data());
+                    _decoded_vector = vector;
+                }
+                memcpy(dst, _decoded_values.data() + offset, count * sizeof(CppType));
+            }
+            pos += count;
+            dst += count;
+            n -= count;
+        }
+    }
+
+    void _decode_vector(size_t vector, CppType* values) {
+        const uint8_t* data = _vectors + _vector_offsets[vector];
+        const size_t data_size = _vector_offsets[vector + 1] - _vector_offsets[vector];
+        const size_t size = _vector_size(vector);
+        if (data[0] == static_cast<uint8_t>(AlpVectorScheme::ALP)) {
+            _decode_alp(data, data_size, size, values);
+        } else {
+            _decode_xor(data + 1, data_size - 1, size, values);
+        }
+    }
+
+    void _decode_alp(const uint8_t* data, size_t data_size, size_t size, CppType* values) {
+        const CppType factor = Constants::kExponents[data[2]];
+        const CppType fraction = Constants::kFractions[data[1]];
+        const int bit_width = data[3];
+        uint16_t num_exceptions;
+        memcpy(&num_exceptions, data + 4, sizeof(num_exceptions));
+        int64_t frame_of_reference;
+        memcpy(&frame_of_reference, data + 6, sizeof(frame_of_reference));
+
+        _digits.resize(ALP_VECTOR_SIZE);
+        UnsignedType* digits = _digits.data();
+        const uint8_t* packed = data + ALP_VECTOR_HEADER_SIZE;
+        const size_t packed_size = BitUtil::Ceil(size * bit_width, 8);
+        BitPacking::UnpackValues(bit_width, packed, packed_size, size, digits);
+
+        // The digits are less than kMaxEncodable, so they are converted to floating-point exactly, and the
+        // loops are vectorized by the compiler.
+        if constexpr (std::is_same_v<CppType, double>) {
+            // Convert the int64 to double by the magic number, which has no vectorized instruction before AVX-512.
+            int64_t magic_bits;
+            memcpy(&magic_bits, &Constants::kMagicNumber, sizeof(magic_bits));
+            const auto base = static_cast<uint64_t>(frame_of_reference) + static_cast<uint64_t>(magic_bits);
+            for (size_t i = 0; i < size; i++) {
+                uint64_t bits = digits[i] + base;
+                double value;
+                memcpy(&value, &bits, sizeof(value));
+                values[i] = (value - Constants::kMagicNumber) * factor * fraction;
+            }
+        } else {
+            const auto base = static_cast<int32_t>(frame_of_reference);
+            for (size_t i = 0; i < size; i++) {
+                values[i] = static_cast<CppType>(static_cast<int32_t>(digits[i]) + base) * factor * fraction;
+            }
+        }
+
+        const uint8_t* exceptions = data + data_size - num_exceptions * (sizeof(uint16_t) + sizeof(CppType));
+        const uint8_t* exception_values = exceptions + num_exceptions * sizeof(uint16_t);
+        for (size_t i = 0; i < num_exceptions; i++) {
+            uint16_t position;
+            memcpy(&position, exceptions + i * sizeof(uint16_t), sizeof(position));
+            memcpy(&values[position], exception_values + i * sizeof(CppType), sizeof(CppType));
+        }
+    }
+
+    static void _decode_xor(const uint8_t* data, size_t data_size, size_t size, CppType* values) {
+        constexpr int kBits = sizeof(UnsignedType) * 8;
+        BitReader reader(data, data_size);
+        UnsignedType prev = 0;
+        reader.GetValue(kBits, &prev);
+        memcpy(&values[0], &prev, sizeof(CppType));
+        int leading = 0;
+        int trailing = 0;
+        for (size_t i = 1; i < size; i++) {
+            uint8_t control = 0;
+            reader.GetValue(1, &control);
+            if (control != 0) {
+                reader.GetValue(1, &control);
+                if (control != 0) {
+                    int length = 0;
+                    reader.GetValue(Constants::kLeadingZerosBits, &leading);
+                    reader.GetValue(Constants::kLengthBits, &length);
+                    trailing = kBits - leading - length - 1;
+                }
+                UnsignedType x = 0;
+                reader.GetValue(kBits - leading - trailing, &x);
+                prev ^= x << trailing;
+            }
+            memcpy(&values[i], &prev, sizeof(CppType));
+        }
+    }
+
+    Slice _data;
+    bool _parsed{false};
+    uint32_t _num_elements{0};
+    uint32_t _cur_index{0};
+
+    const uint8_t* _vectors = nullptr;
+    std::vector<uint32_t> _vector_offsets;
+
+    std::vector<UnsignedType> _digits;
+    size_t _decoded_vector = -1;
+    std::vector<CppType> _decoded_values;
+};
+
+} // namespace starrocks
@@ -36,12 +36,14 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "gutil/casts.h"
 #include "gutil/strings/substitute.h" // for Substitute
 #include "storage/chunk_helper.h"
 #include "storage/range.h"
 #include "storage/rowset/bitshuffle_page.h"
+#include "storage/rowset/fsst_page.h"
 #include "util/slice.h" // for Slice
 #include "util/unaligned_access.h"
 
@@ -61,6 +63,8 @@ BinaryDictPageBuilder::BinaryDictPageBuilder(const PageBuilderOptions& options)
     PageBuilderOptions dict_builder_options;
     dict_builder_options.data_page_size = _options.dict_page_size;
     _dict_builder = std::make_unique<BinaryPlainPageBuilder>(dict_builder_options);
+    _max_page_dict_codes = std::max(config::zone_map_max_dict_codes, 0);
+    _page_dict_codes.resize((_max_page_dict_codes + 7) / 8);
     reset();
 }
 
@@ -99,10 +103,16 @@ uint32_t BinaryDictPageBuilder::add(const uint8_t* vals, uint32_t count) {
             if (code_page->add_one(reinterpret_cast<const uint8_t*>(&value_code)) < 1) {
                 return i;
             }
+            if (value_code < _max_page_dict_codes) {
+                _page_dict_codes[value_code / 8] |= 1 << (value_code % 8);
+                _page_dict_codes_size = std::max<size_t>(_page_dict_codes_size, value_code / 8 + 1);
+            } else {
+                _page_dict_codes_overflow = true;
+            }
         }
         return count;
     } else {
-        DCHECK_EQ(_encoding_type, PLAIN_ENCODING);
+        DCHECK_NE(_encoding_type, DICT_ENCODING);
         return _data_page_builder->add(vals, count);
     }
 }
@@ -118,10 +128,18 @@ faststring* BinaryDictPageBuilder::finish() {
 
 void BinaryDictPageBuilder::reset() {
     _finished = false;
+    memset(_page_dict_codes.data(), 0, _page_dict_codes_size);
+    _page_dict_codes_size = 0;
+    _page_dict_codes_overflow = false;
     if (_encoding_type == DICT_ENCODING && _dict_builder->is_page_full()) {
-        _data_page_builder = std::make_unique<BinaryPlainPageBuilder>(_options);
+        if (config::enable_string_fsst_encoding) {
+            _data_page_builder = std::make_unique<FsstPageBuilder>(_options);
+            _encoding_type = FSST_ENCODING;
+        } else {
+            _data_page_builder = std::make_unique<BinaryPlainPageBuilder>(_options);
+            _encoding_type = PLAIN_ENCODING;
+        }
         _data_page_builder->reserve_head(BINARY_DICT_PAGE_HEADER_SIZE);
-        _encoding_type = PLAIN_ENCODING;
     } else {
         _data_page_builder->reset();
     }
@@ -166,6 +184,14 @@ Status BinaryDictPageBuilder::get_last_value(void* value) const {
     return Status::OK();
 }
 
+bool BinaryDictPageBuilder::get_dict_codes(faststring* codes) const {
+    if (_encoding_type != DICT_ENCODING || _max_page_dict_codes == 0 || _page_dict_codes_overflow) {
+        return false;
+    }
+    codes->assign_copy(_page_dict_codes.data(), _page_dict_codes_size);
+    return true;
+}
+
 bool BinaryDictPageBuilder::is_valid_global_dict(const GlobalDictMap* global_dict) const {
     for (const auto& it : _dictionary) {
         if (auto iter = global_dict->find(it.first); iter == global_dict->end()) {
@@ -196,6 +222,8 @@ Status BinaryDictPageDecoder<Type>::init() {
     } else if (_encoding_type == PLAIN_ENCODING) {
         DCHECK_EQ(_encoding_type, PLAIN_ENCODING);
         _data_page_decoder.reset(new BinaryPlainPageDecoder<Type>(_data));
+    } else if (_encoding_type == FSST_ENCODING) {
+        _data_page_decoder = std::make_unique<FsstPageDecoder<Type>>(_data);
     } else {
         LOG(WARNING) << "invalid encoding type:" << _encoding_type;
         return Status::Corruption(strings::Substitute("invalid encoding type:$0", _encoding_type));
@@ -229,7 +257,7 @@ Status BinaryDictPageDecoder<Type>::next_batch(size_t* n, Column* dst) {
 
 template <LogicalType Type>
 Status BinaryDictPageDecoder<Type>::next_batch(const SparseRange<>& range, Column* dst) {
-    if (_encoding_type == PLAIN_ENCODING) {
+    if (_encoding_type != DICT_ENCODING) {
         return _data_page_decoder->next_batch(range, dst);
     }
 
@@ -265,6 +293,16 @@ Status BinaryDictPageDecoder<Type>::next_batch(const SparseRange<>& range, Colum
     return Status::OK();
 }
 
+template <LogicalType Type>
+Status BinaryDictPageDecoder<Type>::next_batch_with_filter(const SparseRange<>& range,
+                                                           const std::vector<const ColumnPredicate*>& preds,
+                                                           uint8_t* selection, Column* dst) {
+    if (_encoding_type != FSST_ENCODING) {
+        return Status::NotSupported("only the FSST data pages can be filtered before decoding");
+    }
+    return _data_page_decoder->next_batch_with_filter(range, preds, selection, dst);
+}
+
 template <LogicalType Type>
 Status BinaryDictPageDecoder<Type>::next_dict_codes(size_t* n, Column* dst) {
     DCHECK(_encoding_type == DICT_ENCODING);
@@ -37,6 +37,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "gen_cpp/segment.pb.h"
 #include "gutil/hash/string_hash.h"
@@ -58,9 +59,10 @@ namespace starrocks {
 // Either header + embedded codeword page, which can be encoded with any
 //        int PageBuilder, when mode_ = DICT_ENCODING.
 // Or     header + embedded BinaryPlainPage, when mode_ = PLAIN_ENCOING.
+// Or     header + embedded FsstPage, when mode_ = FSST_ENCODING.
 // Data pages start with mode_ = DICT_ENCODING, when the the size of dictionary
 // page go beyond the option_->dict_page_size, the subsequent data pages will switch
-// to string plain page automatically.
+// to string plain page automatically, or FSST page if enable_string_fsst_encoding is true.
 class BinaryDictPageBuilder final : public PageBuilder {
 public:
     explicit BinaryDictPageBuilder(const PageBuilderOptions& options);
@@ -85,6 +87,8 @@ public:
 
     bool is_valid_global_dict(const GlobalDictMap* global_dict) const override;
 
+    bool get_dict_codes(faststring* codes) const override;
+
     // Return true iff all pages so far are encoded by dictionary encoding.
     // this method normally should be called after all data pages finish
     // write, i.e, after `finish` has been called.
@@ -118,6 +122,14 @@ private:
     // query for dict item -> dict id
     phmap::flat_hash_map<std::string, uint32_t, HashOfSlice, Eq> _dictionary;
     faststring _first_value;
+
+    // bitmap of the dictionary codes in the current page, less than |_max_page_dict_codes|.
+    std::vector<uint8_t> _page_dict_codes;
+    uint32_t _max_page_dict_codes = 0;
+    // the size of |_page_dict_codes| in use.
+    size_t _page_dict_codes_size = 0;
+    // true if the current page has a code not less than |_max_page_dict_codes|.
+    bool _page_dict_codes_overflow = false;
 };
 
 template <LogicalType Type>
@@ -133,6 +145,10 @@ public:
 
     [[nodiscard]] Status next_batch(const SparseRange<>& range, Column* dst) override;
 
+    [[nodiscard]] Status next_batch_with_filter(const SparseRange<>& range,
+                                                const std::vector<const ColumnPredicate*>& preds, uint8_t* selection,
+                                                Column* dst) override;
+
     uint32_t count() const override { return _data_page_decoder->count(); }
 
     uint32_t current_index() const override { return _data_page_decoder->current_index(); }
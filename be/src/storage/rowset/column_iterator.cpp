@@ -36,6 +36,7 @@
 
 #include "column/fixed_length_column.h"
 #include "column/nullable_column.h"
+#include "storage/column_predicate.h"
 
 namespace starrocks {
 
@@ -88,4 +89,16 @@ Status ColumnIterator::fetch_values_by_rowid(const rowid_t* rowids, size_t size,
     return Status::OK();
 }
 
+Status ColumnIterator::next_batch_with_filter(const SparseRange<>& range,
+                                              const std::vector<const ColumnPredicate*>& preds, uint8_t* selection,
+                                              Column* dst) {
+    size_t from = dst->size();
+    RETURN_IF_ERROR(next_batch(range, dst));
+    size_t to = dst->size();
+    for (const ColumnPredicate* pred : preds) {
+        RETURN_IF_ERROR(pred->evaluate_and(dst, selection, from, to));
+    }
+    return Status::OK();
+}
+
 } // namespace starrocks
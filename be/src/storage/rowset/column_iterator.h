@@ -104,6 +104,15 @@ public:
 
     virtual Status next_batch(const SparseRange<>& range, Column* dst);
 
+    // Return true if next_batch_with_filter() may evaluate the predicates on the encoded values,
+    // e.g. the strings compressed by FSST or the dictionary of a page, instead of decoding all values first.
+    virtual bool support_filter_on_encoded_pages() const { return false; }
+
+    // Read the rows of |range| like next_batch(range, dst), and AND the result of |preds| into |selection|,
+    // which is indexed by the row of |dst|. The rows not selected may be read as arbitrary values.
+    virtual Status next_batch_with_filter(const SparseRange<>& range, const std::vector<const ColumnPredicate*>& preds,
+                                          uint8_t* selection, Column* dst);
+
     Status convert_sparse_range_to_io_range(const SparseRange<>& range) {
         if (auto sharedBufferStream = dynamic_cast<io::SharedBufferedInputStream*>(_opts.read_file);
             sharedBufferStream == nullptr) {
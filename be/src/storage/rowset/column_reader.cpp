@@ -505,17 +505,35 @@ Status ColumnReader::seek_by_page_index(int page_index, OrdinalPageIndexIterator
 
 Status ColumnReader::zone_map_filter(const std::vector<const ColumnPredicate*>& predicates,
                                      const ColumnPredicate* del_predicate,
+                                     const std::vector<uint8_t>* dict_code_selection,
                                      std::unordered_set<uint32_t>* del_partial_filtered_pages,
                                      SparseRange<>* row_ranges, const IndexReadOptions& opts) {
     RETURN_IF_ERROR(_load_zonemap_index(opts));
     std::vector<uint32_t> page_indexes;
-    RETURN_IF_ERROR(_zone_map_filter(predicates, del_predicate, del_partial_filtered_pages, &page_indexes));
+    RETURN_IF_ERROR(_zone_map_filter(predicates, del_predicate, dict_code_selection, del_partial_filtered_pages,
+                                     &page_indexes));
     RETURN_IF_ERROR(_calculate_row_ranges(page_indexes, row_ranges));
     return Status::OK();
 }
 
+// Return true if any code in the bitmap |codes| is selected, the codes out of |selection| are taken as selected.
+static bool has_selected_dict_code(const std::string& codes, const std::vector<uint8_t>& selection) {
+    for (size_t i = 0; i < codes.size(); i++) {
+        uint32_t bits = static_cast<uint8_t>(codes[i]);
+        while (bits != 0) {
+            size_t code = i * 8 + __builtin_ctz(bits);
+            if (code >= selection.size() || selection[code]) {
+                return true;
+            }
+            bits &= bits - 1;
+        }
+    }
+    return false;
+}
+
 Status ColumnReader::_zone_map_filter(const std::vector<const ColumnPredicate*>& predicates,
                                       const ColumnPredicate* del_predicate,
+                                      const std::vector<uint8_t>* dict_code_selection,
                                       std::unordered_set<uint32_t>* del_partial_filtered_pages,
                                       std::vector<uint32_t>* pages) {
     // The type of the predicate may be different from the data type in the segment
@@ -545,6 +563,11 @@ Status ColumnReader::_zone_map_filter(const std::vector<const ColumnPredicate*>&
         if (!matched) {
             continue;
         }
+        // The values of the page are all null or not selected.
+        if (dict_code_selection != nullptr && zm.has_dict_codes() &&
+            !has_selected_dict_code(zm.dict_codes(), *dict_code_selection)) {
+            continue;
+        }
         pages->emplace_back(i);
 
         if (del_predicate && del_predicate->zone_map_filter(detail)) {
@@ -587,6 +587,10 @@ Status ScalarColumnWriter::_write_data_page(Page* page) {
 
 Status ScalarColumnWriter::finish_current_page() {
     if (_zone_map_index_builder != nullptr) {
+        faststring dict_codes;
+        if (_page_builder->get_dict_codes(&dict_codes)) {
+            _zone_map_index_builder->set_dict_codes(Slice(dict_codes));
+        }
         RETURN_IF_ERROR(_zone_map_index_builder->flush());
     }
 
@@ -875,7 +879,7 @@ inline EncodingTypePB StringColumnWriter::speculate_string_encoding(const Binary
             size_t hash = SliceHash()(bin_col.get_slice(i));
             hash_set.insert(hash);
             if (hash_set.size() > max_card) {
-                return PLAIN_ENCODING;
+                return config::enable_string_fsst_encoding ? FSST_ENCODING : PLAIN_ENCODING;
             }
         }
     }
@@ -1034,6 +1038,12 @@ inline EncodingTypePB DictColumnWriter::speculate_encoding(const Column& column)
             CppType value = numerical_col->get_data()[i];
             hash_set.insert(value);
             if (hash_set.size() > max_card) {
+                if (config::enable_integer_delta_encoding && integer_types_support_delta_encoding(Type)) {
+                    return DELTA_ENCODING;
+                }
+                if (config::enable_float_alp_encoding && float_types_support_alp_encoding(Type)) {
+                    return ALP_ENCODING;
+                }
                 return BIT_SHUFFLE;
             }
         }
@@ -0,0 +1,483 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "column/column.h"
+#include "gutil/strings/substitute.h"
+#include "storage/range.h"
+#include "storage/rowset/options.h"      // for PageBuilderOptions/PageDecoderOptions
+#include "storage/rowset/page_builder.h" // for PageBuilder
+#include "storage/rowset/page_decoder.h" // for PageDecoder
+#include "storage/type_traits.h"
+#include "util/bit_packing.inline.h"
+#include "util/bit_stream_utils.inline.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+
+namespace starrocks {
+
+enum class DeltaPageMode : uint8_t { FOR = 0, DELTA = 1, DELTA_OF_DELTA = 2 };
+
+static constexpr size_t DELTA_PAGE_HEADER_SIZE = 8;
+static constexpr size_t DELTA_PAGE_MINIBLOCK_SIZE = 128;
+
+// DeltaPageBuilder bit-packs the integers of a page in miniblocks of 128 values, after transforming them
+// with one of the following modes:
+//
+//   FOR:            v[i]
+//   DELTA:          v[i] - v[i-1]
+//   DELTA_OF_DELTA: (v[i] - v[i-1]) - (v[i-1] - v[i-2])
+//
+// and subtracting the minimum of the transformed values of the miniblock. The mode is chosen for every page
+// by the encoded size computed from the values of the page, so the sorted sort keys and the regularly spaced
+// event times usually get DELTA, the values with a steadily changing step get DELTA_OF_DELTA, and the
+// unordered values fall back to FOR.
+//
+// The transformation restarts from the first values of every miniblock, so a miniblock can be decoded
+// without the previous ones, and seeking in a page decodes at most one miniblock.
+//
+// The page format is as follows:
+//
+// 1. Header: (8 bytes total)
+//
+//    <num_elements> [32-bit]
+//      The number of elements encoded in the page.
+//
+//    <mode> [8-bit]
+//      The DeltaPageMode of the page.
+//
+//    <elem_size_bytes> [8-bit]
+//      The size of the elements, in bytes.
+//
+//    <reserved> [16-bit]
+//
+// 2. Miniblock headers, each of which is an array of <num_miniblocks> elements:
+//
+//    <first_values> [elem_size_bytes]
+//      The first value of every miniblock, absent for FOR.
+//
+//    <first_deltas> [elem_size_bytes]
+//      The first delta of every miniblock, only present for DELTA_OF_DELTA.
+//
+//    <min_values> [elem_size_bytes]
+//      The minimum of the transformed values of every miniblock.
+//
+//    <bit_widths> [8-bit]
+//      The bit width of the packed values of every miniblock.
+//
+// 3. Miniblock data
+//
+//    Every miniblock packs its transformed values minus the minimum with its own bit width. The leading
+//    values which are stored in the miniblock headers instead are packed as zero. All the miniblocks
+//    except the last one have 128 values, so they all start at a byte boundary.
+//
+//   NOTE: all on-disk ints are encoded little-endian
+//
+template <LogicalType Type>
+class DeltaPageBuilder final : public PageBuilder {
+    typedef typename TypeTraits<Type>::CppType CppType;
+    typedef std::make_unsigned_t<CppType> UnsignedType;
+    static_assert(std::is_integral_v<CppType> && (sizeof(CppType) == 4 || sizeof(CppType) == 8),
+                  "delta encoding only supports 32-bit and 64-bit integers");
+
+public:
+    explicit DeltaPageBuilder(const PageBuilderOptions& options)
+            : _max_count(std::max<uint32_t>(1, options.data_page_size / sizeof(CppType))) {}
+
+    ~DeltaPageBuilder() override = default;
+
+    bool is_page_full() override { return _values.size() >= _max_count; }
+
+    uint32_t add(const uint8_t* vals, uint32_t count) override {
+        DCHECK(!_finished);
+        uint32_t to_add = std::min<uint32_t>(_max_count - _values.size(), count);
+        auto new_vals = reinterpret_cast<const CppType*>(vals);
+        _values.insert(_values.end(), new_vals, new_vals + to_add);
+        return to_add;
+    }
+
+    faststring* finish() override {
+        DCHECK(!_finished);
+        _finished = true;
+        _buf.clear();
+
+        std::vector<MiniBlock> miniblocks;
+        _mode = DeltaPageMode::FOR;
+        size_t encoded_size = _analyze(DeltaPageMode::FOR, &miniblocks);
+        for (auto mode : {DeltaPageMode::DELTA, DeltaPageMode::DELTA_OF_DELTA}) {
+            std::vector<MiniBlock> candidate;
+            size_t size = _analyze(mode, &candidate);
+            if (size < encoded_size) {
+                _mode = mode;
+                encoded_size = size;
+                miniblocks.swap(candidate);
+            }
+        }
+        _buf.reserve(encoded_size);
+
+        put_fixed32_le(&_buf, static_cast<uint32_t>(_values.size()));
+        _buf.push_back(static_cast<uint8_t>(_mode));
+        _buf.push_back(static_cast<uint8_t>(sizeof(CppType)));
+        // reserved
+        _buf.push_back(0);
+        _buf.push_back(0);
+
+        const size_t num_miniblocks = miniblocks.size();
+        if (_mode != DeltaPageMode::FOR) {
+            for (size_t i = 0; i < num_miniblocks; i++) {
+                _put_value(_values[i * DELTA_PAGE_MINIBLOCK_SIZE]);
+            }
+        }
+        if (_mode == DeltaPageMode::DELTA_OF_DELTA) {
+            for (size_t i = 0; i < num_miniblocks; i++) {
+                size_t start = i * DELTA_PAGE_MINIBLOCK_SIZE;
+                // A miniblock with a single value has no delta, keep zero for it.
+                _put_value(start + 1 < _values.size() ? _transform(DeltaPageMode::DELTA, start, 1) : 0);
+            }
+        }
+        for (const auto& miniblock : miniblocks) {
+            _put_value(miniblock.min_value);
+        }
+        for (const auto& miniblock : miniblocks) {
+            _buf.push_back(miniblock.bit_width);
+        }
+
+        faststring packed;
+        BitWriter writer(&packed);
+        const size_t first = _first_transformed(_mode);
+        for (size_t i = 0; i < num_miniblocks; i++) {
+            const int bit_width = miniblocks[i].bit_width;
+            if (bit_width == 0) {
+                continue;
+            }
+            size_t start = i * DELTA_PAGE_MINIBLOCK_SIZE;
+            size_t size = std::min(DELTA_PAGE_MINIBLOCK_SIZE, _values.size() - start);
+            for (size_t j = 0; j < size; j++) {
+                UnsignedType packed_value = 0;
+                if (j >= first) {
+                    packed_value = _transform(_mode, start, j) - static_cast<UnsignedType>(miniblocks[i].min_value);
+                }
+                writer.PutValue(packed_value, bit_width);
+            }
+        }
+        writer.Flush();
+        _buf.append(packed.data(), writer.bytes_written());
+        DCHECK_EQ(encoded_size, _buf.size());
+
+        return &_buf;
+    }
+
+    void reset() override {
+        _values.clear();
+        _buf.clear();
+        _finished = false;
+    }
+
+    uint32_t count() const override { return _values.size(); }
+
+    uint64_t size() const override { return _finished ? _buf.size() : _values.size() * sizeof(CppType); }
+
+    Status get_first_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values.front(), sizeof(CppType));
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, &_values.back(), sizeof(CppType));
+        return Status::OK();
+    }
+
+    // The mode chosen by the last `finish`.
+    DeltaPageMode mode() const { return _mode; }
+
+private:
+    struct MiniBlock {
+        CppType min_value;
+        uint8_t bit_width;
+    };
+
+    static size_t _first_transformed(DeltaPageMode mode) { return static_cast<size_t>(mode); }
+
+    // The |j|-th transformed value of the miniblock starting at |start|, computed in unsigned integers so
+    // that the overflow wraps around and is reverted by the decoding.
+    UnsignedType _transform(DeltaPageMode mode, size_t start, size_t j) const {
+        const auto* values = reinterpret_cast<const UnsignedType*>(_values.data()) + start;
+        switch (mode) {
+        case DeltaPageMode::DELTA:
+            return values[j] - values[j - 1];
+        case DeltaPageMode::DELTA_OF_DELTA:
+            return values[j] - 2 * values[j - 1] + values[j - 2];
+        default:
+            return values[j];
+        }
+    }
+
+    // Compute the bit widths of the miniblocks for |mode|, and return the encoded size of the page.
+    size_t _analyze(DeltaPageMode mode, std::vector<MiniBlock>* miniblocks) const {
+        const size_t num_miniblocks = (_values.size() + DELTA_PAGE_MINIBLOCK_SIZE - 1) / DELTA_PAGE_MINIBLOCK_SIZE;
+        const size_t first = _first_transformed(mode);
+        miniblocks->resize(num_miniblocks);
+
+        size_t packed_bytes = 0;
+        for (size_t i = 0; i < num_miniblocks; i++) {
+            size_t start = i * DELTA_PAGE_MINIBLOCK_SIZE;
+            size_t size = std::min(DELTA_PAGE_MINIBLOCK_SIZE, _values.size() - start);
+            CppType min_value = 0;
+            CppType max_value = 0;
+            for (size_t j = first; j < size; j++) {
+                auto value = static_cast<CppType>(_transform(mode, start, j));
+                min_value = j == first ? value : std::min(min_value, value);
+                max_value = j == first ? value : std::max(max_value, value);
+            }
+            auto range = static_cast<UnsignedType>(max_value) - static_cast<UnsignedType>(min_value);
+            auto bit_width = static_cast<uint8_t>(range == 0 ? 0 : 64 - __builtin_clzll(range));
+            (*miniblocks)[i] = {min_value, bit_width};
+            packed_bytes += BitUtil::Ceil(size * bit_width, 8);
+        }
+
+        size_t header_values = 1 + (mode != DeltaPageMode::FOR) + (mode == DeltaPageMode::DELTA_OF_DELTA);
+        return DELTA_PAGE_HEADER_SIZE + num_miniblocks * (header_values * sizeof(CppType) + 1) + packed_bytes;
+    }
+
+    void _put_value(UnsignedType value) { _buf.append(&value, sizeof(value)); }
+
+    const uint32_t _max_count;
+    bool _finished{false};
+    DeltaPageMode _mode{DeltaPageMode::FOR};
+    std::vector<CppType> _values;
+    faststring _buf;
+};
+
+template <LogicalType Type>
+class DeltaPageDecoder final : public PageDecoder {
+    typedef typename TypeTraits<Type>::CppType CppType;
+    typedef std::make_unsigned_t<CppType> UnsignedType;
+    static_assert(std::is_integral_v<CppType> && (sizeof(CppType) == 4 || sizeof(CppType) == 8),
+                  "delta encoding only supports 32-bit and 64-bit integers");
+
+public:
+    explicit DeltaPageDecoder(Slice data) : _data(data) {}
+
+    ~DeltaPageDecoder() override = default;
+
+    [[nodiscard]] Status init() override {
+        CHECK(!_parsed);
+        if (_data.size < DELTA_PAGE_HEADER_SIZE) {
+            return Status::Corruption(
+                    strings::Substitute("invalid delta page size: $0, header size: $1", _data.size,
+                                        DELTA_PAGE_HEADER_SIZE));
+        }
+        const auto* data = reinterpret_cast<const uint8_t*>(_data.data);
+        _num_elements = decode_fixed32_le(data);
+        uint8_t mode = data[4];
+        uint8_t elem_size = data[5];
+        if (mode > static_cast<uint8_t>(DeltaPageMode::DELTA_OF_DELTA) || elem_size != sizeof(CppType)) {
+            return Status::Corruption(strings::Substitute("invalid delta page, mode: $0, elem size: $1", mode,
+                                                          elem_size));
+        }
+        _mode = static_cast<DeltaPageMode>(mode);
+
+        const size_t num_miniblocks = (_num_elements + DELTA_PAGE_MINIBLOCK_SIZE - 1) / DELTA_PAGE_MINIBLOCK_SIZE;
+        const uint8_t* pos = data + DELTA_PAGE_HEADER_SIZE;
+        if (_mode != DeltaPageMode::FOR) {
+            _first_values = pos;
+            pos += num_miniblocks * sizeof(CppType);
+        }
+        if (_mode == DeltaPageMode::DELTA_OF_DELTA) {
+            _first_deltas = pos;
+            pos += num_miniblocks * sizeof(CppType);
+        }
+        _min_values = pos;
+        pos += num_miniblocks * sizeof(CppType);
+        _bit_widths = pos;
+        pos += num_miniblocks;
+        if (pos > data + _data.size) {
+            return Status::Corruption("The delta page metadata maybe broken");
+        }
+
+        _packed_data = pos;
+        _miniblock_offsets.resize(num_miniblocks + 1);
+        _miniblock_offsets[0] = 0;
+        for (size_t i = 0; i < num_miniblocks; i++) {
+            if (_bit_widths[i] > sizeof(CppType) * 8) {
+                return Status::Corruption(strings::Substitute("invalid delta page bit width: $0", _bit_widths[i]));
+            }
+            size_t size = std::min<size_t>(DELTA_PAGE_MINIBLOCK_SIZE, _num_elements - i * DELTA_PAGE_MINIBLOCK_SIZE);
+            _miniblock_offsets[i + 1] = _miniblock_offsets[i] + BitUtil::Ceil(size * _bit_widths[i], 8);
+        }
+        if (_packed_data + _miniblock_offsets[num_miniblocks] > data + _data.size) {
+            return Status::Corruption("The delta page data maybe broken");
+        }
+
+        _parsed = true;
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status seek_to_position_in_page(uint32_t pos) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        DCHECK_LE(pos, _num_elements) << "Tried to seek to " << pos << " which is > number of elements ("
+                                      << _num_elements << ") in the block!";
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status next_batch(size_t* n, Column* dst) override {
+        SparseRange<> read_range;
+        uint32_t begin = current_index();
+        read_range.add(Range<>(begin, begin + *n));
+        RETURN_IF_ERROR(next_batch(read_range, dst));
+        *n = current_index() - begin;
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status next_batch(const SparseRange<>& range, Column* dst) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (PREDICT_FALSE(range.span_size() == 0 || _cur_index >= _num_elements)) {
+            return Status::OK();
+        }
+
+        size_t to_read =
+                std::min(static_cast<size_t>(range.span_size()), static_cast<size_t>(_num_elements - _cur_index));
+        SparseRangeIterator<> iter = range.new_iterator();
+        while (to_read > 0 && _cur_index < _num_elements) {
+            RETURN_IF_ERROR(seek_to_position_in_page(iter.begin()));
+            Range<> r = iter.next(to_read);
+            const size_t ori_size = dst->size();
+            dst->resize(ori_size + r.span_size());
+            auto* p = reinterpret_cast<CppType*>(dst->mutable_raw_data()) + ori_size;
+            _copy_values(r.begin(), r.span_size(), p);
+            _cur_index += r.span_size();
+            to_read -= r.span_size();
+        }
+        return Status::OK();
+    }
+
+    uint32_t count() const override { return _num_elements; }
+
+    uint32_t current_index() const override { return _cur_index; }
+
+    EncodingTypePB encoding_type() const override { return DELTA_ENCODING; }
+
+private:
+    size_t _miniblock_size(size_t miniblock) const {
+        return std::min<size_t>(DELTA_PAGE_MINIBLOCK_SIZE, _num_elements - miniblock * DELTA_PAGE_MINIBLOCK_SIZE);
+    }
+
+    static UnsignedType _load(const uint8_t* values, size_t idx) {
+        UnsignedType value;
+        memcpy(&value, values + idx * sizeof(UnsignedType), sizeof(UnsignedType));
+        return value;
+    }
+
+    // Copy |n| values starting at |pos| to |dst|. The miniblocks read entirely are decoded into |dst| directly,
+    // and the others are decoded into |_decoded_values| which is reused by the following reads.
+    void _copy_values(size_t pos, size_t n, CppType* dst) {
+        while (n > 0) {
+            size_t miniblock = pos / DELTA_PAGE_MINIBLOCK_SIZE;
+            size_t offset = pos % DELTA_PAGE_MINIBLOCK_SIZE;
+            size_t miniblock_size = _miniblock_size(miniblock);
+            size_t count = std::min(n, miniblock_size - offset);
+            if (offset == 0 && count == miniblock_size) {
+                _decode_miniblock(miniblock, reinterpret_cast<UnsignedType*>(dst));
+            } else {
+                if (_decoded_miniblock != miniblock) {
+                    _decode_miniblock(miniblock, _decoded_values);
+                    _decoded_miniblock = miniblock;
+                }
+                memcpy(dst, _decoded_values + offset, count * sizeof(CppType));
+            }
+            pos += count;
+            dst += count;
+            n -= count;
+        }
+    }
+
+    void _decode_miniblock(size_t miniblock, UnsignedType* values) const {
+        const size_t size = _miniblock_size(miniblock);
+        const uint8_t* packed = _packed_data + _miniblock_offsets[miniblock];
+        const int64_t packed_bytes = _miniblock_offsets[miniblock + 1] - _miniblock_offsets[miniblock];
+        BitPacking::UnpackValues(_bit_widths[miniblock], packed, packed_bytes, size, values);
+
+        const UnsignedType min_value = _load(_min_values, miniblock);
+        const size_t first = static_cast<size_t>(_mode);
+        for (size_t j = first; j < size; j++) {
+            values[j] += min_value;
+        }
+        if (_mode == DeltaPageMode::FOR) {
+            return;
+        }
+        values[0] = _load(_first_values, miniblock);
+        if (_mode == DeltaPageMode::DELTA_OF_DELTA && size > 1) {
+            values[1] = _load(_first_deltas, miniblock);
+            _prefix_sum(values + 1, size - 1);
+        }
+        _prefix_sum(values, size);
+    }
+
+    // values[i] += values[i - 1] for all the values in order.
+    static void _prefix_sum(UnsignedType* values, size_t size) {
+        size_t i = 1;
+#ifdef __SSE2__
+        if constexpr (sizeof(UnsignedType) == 4) {
+            // Sum up every 4 values with two shifted additions, then carry the last sum of the previous 4 values.
+            __m128i carry = _mm_set1_epi32(values[0]);
+            for (; i + 4 <= size; i += 4) {
+                __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+                x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+                x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+                x = _mm_add_epi32(x, carry);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(values + i), x);
+                carry = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+            }
+        }
+#endif
+        for (; i < size; i++) {
+            values[i] += values[i - 1];
+        }
+    }
+
+    Slice _data;
+    bool _parsed{false};
+    DeltaPageMode _mode{DeltaPageMode::FOR};
+    uint32_t _num_elements{0};
+    uint32_t _cur_index{0};
+
+    const uint8_t* _first_values = nullptr;
+    const uint8_t* _first_deltas = nullptr;
+    const uint8_t* _min_values = nullptr;
+    const uint8_t* _bit_widths = nullptr;
+    const uint8_t* _packed_data = nullptr;
+    std::vector<uint32_t> _miniblock_offsets;
+
+    size_t _decoded_miniblock = -1;
+    UnsignedType _decoded_values[DELTA_PAGE_MINIBLOCK_SIZE];
+};
+
+} // namespace starrocks
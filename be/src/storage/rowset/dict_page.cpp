@@ -21,6 +21,7 @@
 #include "gutil/casts.h"
 #include "gutil/strings/substitute.h" // for Substitute
 #include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
 #include "storage/range.h"
 #include "storage/rowset/bitshuffle_page.h"
 #include "util/slice.h" // for Slice
@@ -243,6 +244,76 @@ Status DictPageDecoder<Type>::next_batch(const SparseRange<>& range, Column* dst
     return Status::OK();
 }
 
+template <LogicalType Type>
+Status DictPageDecoder<Type>::next_batch_with_filter(const SparseRange<>& range,
+                                                     const std::vector<const ColumnPredicate*>& preds,
+                                                     uint8_t* selection, Column* dst) {
+    if (_encoding_type != DICT_ENCODING) {
+        return Status::NotSupported("next_batch_with_filter() not supported by plain pages");
+    }
+    for (const ColumnPredicate* pred : preds) {
+        if (!pred->support_encoded_evaluate()) {
+            return Status::NotSupported("predicate can not be evaluated on dictionary codes");
+        }
+    }
+    DCHECK(_parsed);
+    DCHECK(_dict_decoder != nullptr) << "dict decoder pointer is nullptr";
+    if (_vec_code_buf == nullptr) {
+        _vec_code_buf = ChunkHelper::column_from_field_type(DataTypeTraits<Type>::type, false);
+    }
+    _vec_code_buf->resize(0);
+    _vec_code_buf->reserve(range.span_size());
+
+    RETURN_IF_ERROR(_data_page_decoder->next_batch(range, _vec_code_buf.get()));
+    size_t nread = _vec_code_buf->size();
+    using cast_type = typename CppTypeTraits<DataTypeTraits<Type>::type>::CppType;
+    const auto* codewords = reinterpret_cast<const cast_type*>(_vec_code_buf->raw_data());
+    if (_code_matches.empty() || _match_preds != preds) {
+        _code_matches.assign(_dict_decoder->count(), kUnknownMatch);
+        _match_preds = preds;
+    }
+
+    // Evaluate the predicates on the values of the codes seen for the first time.
+    std::vector<ValueType> numbers;
+    raw::stl_vector_resize_uninitialized(&numbers, nread);
+    std::vector<uint32_t> new_codes;
+    for (size_t i = 0; i < nread; ++i) {
+        uint32_t code = codewords[i];
+        DCHECK_LT(code, _code_matches.size());
+        if (_code_matches[code] == kUnknownMatch) {
+            _code_matches[code] = 0;
+            _dict_decoder->at_index(code, &numbers[new_codes.size()]);
+            new_codes.push_back(code);
+        }
+    }
+    if (!new_codes.empty()) {
+        auto values = dst->clone_empty();
+        values->append_numbers(numbers.data(), new_codes.size() * SIZE_OF_TYPE);
+        std::vector<uint8_t> matches(new_codes.size(), 1);
+        for (const ColumnPredicate* pred : preds) {
+            RETURN_IF_ERROR(pred->evaluate_and(values.get(), matches.data(), 0, new_codes.size()));
+        }
+        for (size_t i = 0; i < new_codes.size(); ++i) {
+            _code_matches[new_codes[i]] = matches[i];
+        }
+    }
+
+    for (size_t i = 0; i < nread; ++i) {
+        selection[i] &= _code_matches[codewords[i]];
+        if (selection[i]) {
+            _dict_decoder->at_index(codewords[i], &numbers[i]);
+        } else {
+            numbers[i] = ValueType();
+        }
+    }
+    size_t nappend = dst->append_numbers(numbers.data(), numbers.size() * SIZE_OF_TYPE);
+    if (UNLIKELY(nappend != numbers.size())) {
+        return Status::InternalError(
+                fmt::format("append_numbers failed, expected rows[{}], actual rows[{}]", numbers.size(), nappend));
+    }
+    return Status::OK();
+}
+
 template <LogicalType Type>
 Status DictPageDecoder<Type>::next_dict_codes(size_t* n, Column* dst) {
     DCHECK(_encoding_type == DICT_ENCODING);
@@ -137,6 +137,11 @@ public:
 
     Status next_batch(const SparseRange<>& range, Column* dst) override;
 
+    // The predicates are evaluated once for each distinct code of the page, and only the values
+    // selected are looked up in the dictionary.
+    Status next_batch_with_filter(const SparseRange<>& range, const std::vector<const ColumnPredicate*>& preds,
+                                  uint8_t* selection, Column* dst) override;
+
     uint32_t count() const override { return _data_page_decoder->count(); }
 
     uint32_t current_index() const override { return _data_page_decoder->current_index(); }
@@ -157,6 +162,10 @@ private:
     bool _parsed;
     EncodingTypePB _encoding_type;
     std::shared_ptr<Column> _vec_code_buf;
+    // The result of |_match_preds| on each code of the dictionary, or kUnknownMatch if not evaluated yet.
+    static constexpr uint8_t kUnknownMatch = 2;
+    std::vector<uint8_t> _code_matches;
+    std::vector<const ColumnPredicate*> _match_preds;
 };
 
 } // namespace starrocks
@@ -38,12 +38,15 @@
 
 #include "gutil/strings/substitute.h"
 #include "storage/olap_common.h"
+#include "storage/rowset/alp_page.h"
 #include "storage/rowset/binary_dict_page.h"
 #include "storage/rowset/binary_plain_page.h"
 #include "storage/rowset/binary_prefix_page.h"
 #include "storage/rowset/bitshuffle_page.h"
+#include "storage/rowset/delta_page.h"
 #include "storage/rowset/dict_page.h"
 #include "storage/rowset/frame_of_reference_page.h"
+#include "storage/rowset/fsst_page.h"
 #include "storage/rowset/plain_page.h"
 #include "storage/rowset/rle_page.h"
 
@@ -156,6 +159,44 @@ struct TypeEncodingTraits<type, FOR_ENCODING, CppType,
     }
 };
 
+template <LogicalType type, typename CppType>
+struct TypeEncodingTraits<type, DELTA_ENCODING, CppType,
+                          typename std::enable_if<std::is_integral<CppType>::value>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new DeltaPageBuilder<type>(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, PageDecoder** decoder) {
+        *decoder = new DeltaPageDecoder<type>(data);
+        return Status::OK();
+    }
+};
+
+template <LogicalType type, typename CppType>
+struct TypeEncodingTraits<type, ALP_ENCODING, CppType,
+                          typename std::enable_if<std::is_floating_point<CppType>::value>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new AlpPageBuilder<type>(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, PageDecoder** decoder) {
+        *decoder = new AlpPageDecoder<type>(data);
+        return Status::OK();
+    }
+};
+
+template <LogicalType type>
+struct TypeEncodingTraits<type, FSST_ENCODING, Slice> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new FsstPageBuilder(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, PageDecoder** decoder) {
+        *decoder = new FsstPageDecoder<type>(data);
+        return Status::OK();
+    }
+};
+
 template <LogicalType type>
 struct TypeEncodingTraits<type, PREFIX_ENCODING, Slice> {
     static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
@@ -183,13 +224,24 @@ public:
     // This function is used to obtain the default encoding based on the field type, considering the following scenarios:
     // 1. If the user has enabled dictionary encoding for number types, the field supports dictionary encoding,
     //    and it is not for optimizing value seek, return DICT_ENCODING.
-    // 2. If optimization for value seek is required, retrieve the encoding method from _value_seek_encoding_map.
-    // 3. In the last scenario, directly retrieve it from _default_encoding_type_map.
+    // 2. If the user has enabled delta encoding for integer types, the field supports delta encoding, and it is
+    //    not for optimizing value seek, return DELTA_ENCODING.
+    // 3. Likewise, return ALP_ENCODING for the floating-point types if the user has enabled it.
+    // 4. If optimization for value seek is required, retrieve the encoding method from _value_seek_encoding_map.
+    // 5. In the last scenario, directly retrieve it from _default_encoding_type_map.
     EncodingTypePB get_default_encoding(LogicalType type, bool optimize_value_seek) const {
         if (enable_non_string_column_dict_encoding() && numeric_types_support_dict_encoding(delegate_type(type)) &&
             !optimize_value_seek) {
             return DICT_ENCODING;
         }
+        if (config::enable_integer_delta_encoding && integer_types_support_delta_encoding(delegate_type(type)) &&
+            !optimize_value_seek) {
+            return DELTA_ENCODING;
+        }
+        if (config::enable_float_alp_encoding && float_types_support_alp_encoding(delegate_type(type)) &&
+            !optimize_value_seek) {
+            return ALP_ENCODING;
+        }
         auto& encoding_map = optimize_value_seek ? _value_seek_encoding_map : _default_encoding_type_map;
         auto it = encoding_map.find(delegate_type(type));
         if (it != encoding_map.end()) {
@@ -309,6 +361,19 @@ EncodingInfoResolver::EncodingInfoResolver() {
     _add_map<TYPE_DATE, DICT_ENCODING>();
     _add_map<TYPE_DATETIME, DICT_ENCODING>();
     _add_map<TYPE_DECIMALV2, DICT_ENCODING>();
+
+    // These integer types support delta encoding, if you need to change this, please
+    // change integer_types_support_delta_encoding function as same time.
+    _add_map<TYPE_INT, DELTA_ENCODING>();
+    _add_map<TYPE_BIGINT, DELTA_ENCODING>();
+    _add_map<TYPE_DATE, DELTA_ENCODING>();
+    _add_map<TYPE_DATETIME, DELTA_ENCODING>();
+
+    _add_map<TYPE_FLOAT, ALP_ENCODING>();
+    _add_map<TYPE_DOUBLE, ALP_ENCODING>();
+
+    _add_map<TYPE_CHAR, FSST_ENCODING>();
+    _add_map<TYPE_VARCHAR, FSST_ENCODING>();
 }
 
 EncodingInfoResolver::~EncodingInfoResolver() {
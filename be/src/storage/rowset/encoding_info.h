@@ -77,6 +77,25 @@ inline bool numeric_types_support_dict_encoding(LogicalType type) {
     }
 }
 
+// The integer types which are usually sorted or increasing, e.g. the sort keys and the event times. The page
+// builder chooses between FOR, delta and delta-of-delta for each page, see DeltaPageBuilder.
+inline bool integer_types_support_delta_encoding(LogicalType type) {
+    switch (type) {
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_DATE:
+    case TYPE_DATETIME:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// The floating-point types, which are encoded losslessly by ALP, see AlpPageBuilder.
+inline bool float_types_support_alp_encoding(LogicalType type) {
+    return type == TYPE_FLOAT || type == TYPE_DOUBLE;
+}
+
 inline bool supports_dict_encoding(LogicalType type) {
     if (type == TYPE_VARCHAR || type == TYPE_CHAR) {
         return true;
@@ -35,10 +35,12 @@
 #pragma once
 
 #include "column/column.h"
+#include "storage/column_predicate.h"
 #include "storage/rowset/options.h"      // for PageBuilderOptions/PageDecoderOptions
 #include "storage/rowset/page_builder.h" // for PageBuilder
 #include "storage/rowset/page_decoder.h" // for PageDecoder
 #include "storage/type_traits.h"
+#include "storage/zone_map_detail.h"
 #include "util/frame_of_reference_coding.h"
 
 namespace starrocks {
@@ -204,6 +206,69 @@ public:
         return Status::OK();
     }
 
+    // The predicates are evaluated on the bounds of each frame from its header first, like a zone map,
+    // and the frames where no value can match are skipped without decoding.
+    [[nodiscard]] Status next_batch_with_filter(const SparseRange<>& range,
+                                                const std::vector<const ColumnPredicate*>& preds, uint8_t* selection,
+                                                Column* dst) override {
+        // clang-format off
+        if constexpr (!(Type == TYPE_TINYINT ||
+                        Type == TYPE_SMALLINT ||
+                        Type == TYPE_INT ||
+                        Type == TYPE_BIGINT ||
+                        Type == TYPE_DATE ||
+                        Type == TYPE_DATETIME ||
+                        Type == TYPE_DECIMAL32 ||
+                        Type == TYPE_DECIMAL64)) {
+            // clang-format on
+            return Status::NotSupported("next_batch_with_filter() not supported");
+        } else {
+            DCHECK(_parsed) << "Must call init() firstly";
+            for (const ColumnPredicate* pred : preds) {
+                if (!pred->support_encoded_evaluate()) {
+                    return Status::NotSupported("predicate can not be evaluated on frame of reference pages");
+                }
+            }
+            if (PREDICT_FALSE(range.span_size() == 0 || _cur_index >= _num_elements)) {
+                return Status::OK();
+            }
+            if (_values == nullptr) {
+                _values = dst->clone_empty();
+            }
+
+            const uint32_t frame_size = _decoder.max_frame_size();
+            size_t offset = 0;
+            size_t to_read =
+                    std::min(static_cast<size_t>(range.span_size()), static_cast<size_t>(_num_elements - _cur_index));
+            SparseRangeIterator<> iter = range.new_iterator();
+            while (to_read > 0 && _cur_index < _num_elements) {
+                RETURN_IF_ERROR(seek_to_position_in_page(iter.begin()));
+                // Read at most to the end of the current frame.
+                uint32_t frame_index = _cur_index / frame_size;
+                Range<> r = iter.next(std::min<size_t>(to_read, (frame_index + 1) * frame_size - _cur_index));
+                size_t n = r.span_size();
+                if (_frame_may_match(frame_index, preds)) {
+                    _values->resize(n);
+                    bool res = _decoder.get_batch(reinterpret_cast<CppType*>(_values->mutable_raw_data()), n);
+                    DCHECK(res);
+                    for (const ColumnPredicate* pred : preds) {
+                        RETURN_IF_ERROR(pred->evaluate_and(_values.get(), selection + offset, 0, n));
+                    }
+                    dst->append(*_values, 0, n);
+                } else {
+                    memset(selection + offset, 0, n);
+                    dst->resize(dst->size() + n);
+                    bool res = _decoder.skip(n);
+                    DCHECK(res);
+                }
+                _cur_index += n;
+                offset += n;
+                to_read -= n;
+            }
+            return Status::OK();
+        }
+    }
+
     uint32_t count() const override { return _num_elements; }
 
     uint32_t current_index() const override { return _cur_index; }
@@ -213,11 +278,30 @@ public:
 private:
     typedef typename TypeTraits<Type>::CppType CppType;
 
+    // Return false if no value of the frame |frame_index| can satisfy all of |preds|.
+    bool _frame_may_match(uint32_t frame_index, const std::vector<const ColumnPredicate*>& preds) {
+        CppType bounds[2];
+        if (!_decoder.frame_value_range(frame_index, &bounds[0], &bounds[1])) {
+            return true;
+        }
+        _values->reset_column();
+        _values->append_numbers(bounds, sizeof(bounds));
+        ZoneMapDetail detail(_values->get(0), _values->get(1));
+        for (const ColumnPredicate* pred : preds) {
+            if (!pred->zone_map_filter(detail)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     bool _parsed{false};
     Slice _data;
     uint32_t _num_elements{0};
     uint32_t _cur_index{0};
     ForDecoder<CppType> _decoder;
+    // Buffer for the frame bounds and the values decoded by next_batch_with_filter().
+    MutableColumnPtr _values;
 };
 
 } // namespace starrocks
@@ -0,0 +1,303 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/fsst.h"
+
+#include <algorithm>
+
+#include "gutil/strings/substitute.h"
+
+namespace starrocks {
+
+// The symbol table is built from at most this many bytes of the input.
+static constexpr size_t kSampleBytes = 16 * 1024;
+// The number of times the symbol table is refined, as suggested by the paper.
+static constexpr int kBuildRounds = 5;
+// Codes [0, 255) are symbols, and [256, 512) stand for the escaped bytes while building.
+static constexpr size_t kNumBuildCodes = 512;
+
+static inline uint64_t symbol_mask(size_t len) {
+    return len >= sizeof(uint64_t) ? ~0ULL : (1ULL << (len * 8)) - 1;
+}
+
+static inline uint64_t load_word(const uint8_t* pos, size_t remaining) {
+    uint64_t word = 0;
+    memcpy(&word, pos, std::min(remaining, sizeof(uint64_t)));
+    return word;
+}
+
+namespace {
+struct SymbolCandidate {
+    uint64_t value;
+    uint32_t len;
+    uint64_t gain;
+};
+} // namespace
+
+int FsstSymbolTable::_longest_match(const uint8_t* pos, size_t remaining) const {
+    uint64_t word = load_word(pos, remaining);
+    for (uint32_t i = _first_byte_begin[*pos]; i < _first_byte_begin[*pos + 1]; i++) {
+        uint8_t code = _sorted_codes[i];
+        size_t len = _lengths[code];
+        if (len <= remaining && ((word ^ _symbols[code]) & symbol_mask(len)) == 0) {
+            return code;
+        }
+    }
+    return -1;
+}
+
+void FsstSymbolTable::build(const std::vector<Slice>& samples) {
+    _num_symbols = 0;
+    _build_index();
+
+    // Take every step-th string, so that the sample covers the whole input.
+    size_t total_bytes = 0;
+    for (const Slice& s : samples) {
+        total_bytes += s.size;
+    }
+    if (total_bytes == 0) {
+        return;
+    }
+    size_t step = std::max<size_t>(1, total_bytes / kSampleBytes);
+    std::vector<Slice> sample;
+    for (size_t i = 0; i < samples.size(); i += step) {
+        sample.push_back(samples[i]);
+    }
+
+    // The pair counts take 1MB, so they are allocated once per thread and kept zeroed between the rounds,
+    // only the pairs seen in the sample are visited and cleared.
+    static thread_local std::vector<uint32_t> count2(kNumBuildCodes * kNumBuildCodes);
+    std::vector<uint32_t> pairs;
+    std::vector<uint32_t> count1(kNumBuildCodes);
+    std::vector<SymbolCandidate> candidates;
+    for (int round = 0; round < kBuildRounds; round++) {
+        std::fill(count1.begin(), count1.end(), 0);
+        pairs.clear();
+        // Compress the sample with the current table, and count the codes and the pairs of adjacent codes.
+        for (const Slice& s : sample) {
+            const auto* pos = reinterpret_cast<const uint8_t*>(s.data);
+            const uint8_t* end = pos + s.size;
+            int prev = -1;
+            while (pos < end) {
+                int code = _longest_match(pos, end - pos);
+                size_t len = 1;
+                if (code < 0) {
+                    code = 256 + *pos;
+                } else {
+                    len = _lengths[code];
+                }
+                count1[code]++;
+                if (prev >= 0) {
+                    uint32_t pair = prev * kNumBuildCodes + code;
+                    if (count2[pair]++ == 0) {
+                        pairs.push_back(pair);
+                    }
+                }
+                prev = code;
+                pos += len;
+            }
+        }
+
+        // The candidates are the current symbols, the escaped bytes, and the concatenations of adjacent
+        // symbols, the gain of a candidate is the number of bytes it covers in the sample.
+        auto symbol_of = [this](size_t code, uint64_t* value, uint32_t* len) {
+            if (code >= 256) {
+                *value = code - 256;
+                *len = 1;
+            } else {
+                *value = _symbols[code];
+                *len = _lengths[code];
+            }
+        };
+        candidates.clear();
+        for (size_t c1 = 0; c1 < kNumBuildCodes; c1++) {
+            if (count1[c1] == 0) {
+                continue;
+            }
+            uint64_t value1;
+            uint32_t len1;
+            symbol_of(c1, &value1, &len1);
+            candidates.push_back({value1, len1, static_cast<uint64_t>(count1[c1]) * len1});
+        }
+        for (uint32_t pair : pairs) {
+            uint64_t value1;
+            uint32_t len1;
+            symbol_of(pair / kNumBuildCodes, &value1, &len1);
+            if (len1 == kMaxSymbolLength) {
+                continue;
+            }
+            uint64_t value2;
+            uint32_t len2;
+            symbol_of(pair % kNumBuildCodes, &value2, &len2);
+            uint32_t len = std::min<uint32_t>(len1 + len2, kMaxSymbolLength);
+            uint64_t value = (value1 | (value2 << (len1 * 8))) & symbol_mask(len);
+            candidates.push_back({value, len, static_cast<uint64_t>(count2[pair]) * len});
+        }
+        for (uint32_t pair : pairs) {
+            count2[pair] = 0;
+        }
+
+        // Merge the duplicated candidates, and keep the ones with the largest gains.
+        std::sort(candidates.begin(), candidates.end(), [](const SymbolCandidate& a, const SymbolCandidate& b) {
+            return a.len != b.len ? a.len < b.len : a.value < b.value;
+        });
+        size_t n = 0;
+        for (size_t i = 0; i < candidates.size(); i++) {
+            if (n > 0 && candidates[n - 1].len == candidates[i].len && candidates[n - 1].value == candidates[i].value) {
+                candidates[n - 1].gain += candidates[i].gain;
+            } else {
+                candidates[n++] = candidates[i];
+            }
+        }
+        candidates.resize(n);
+        n = std::min(n, kMaxSymbols);
+        std::partial_sort(candidates.begin(), candidates.begin() + n, candidates.end(),
+                          [](const SymbolCandidate& a, const SymbolCandidate& b) {
+                              if (a.gain != b.gain) {
+                                  return a.gain > b.gain;
+                              }
+                              return a.len != b.len ? a.len > b.len : a.value < b.value;
+                          });
+
+        _num_symbols = n;
+        for (size_t code = 0; code < n; code++) {
+            _symbols[code] = candidates[code].value;
+            _lengths[code] = candidates[code].len;
+        }
+        _build_index();
+    }
+}
+
+void FsstSymbolTable::_build_index() {
+    for (size_t code = _num_symbols; code < 256; code++) {
+        _symbols[code] = 0;
+        _lengths[code] = 0;
+    }
+    uint16_t counts[256] = {};
+    for (size_t code = 0; code < _num_symbols; code++) {
+        counts[_symbols[code] & 0xFF]++;
+    }
+    _first_byte_begin[0] = 0;
+    for (size_t b = 0; b < 256; b++) {
+        _first_byte_begin[b + 1] = _first_byte_begin[b] + counts[b];
+    }
+    uint16_t next[256];
+    memcpy(next, _first_byte_begin, sizeof(next));
+    for (size_t code = 0; code < _num_symbols; code++) {
+        _sorted_codes[next[_symbols[code] & 0xFF]++] = code;
+    }
+    for (size_t b = 0; b < 256; b++) {
+        std::stable_sort(_sorted_codes + _first_byte_begin[b], _sorted_codes + _first_byte_begin[b + 1],
+                         [this](uint8_t c1, uint8_t c2) { return _lengths[c1] > _lengths[c2]; });
+    }
+}
+
+void FsstSymbolTable::serialize(faststring* buf) const {
+    buf->push_back(static_cast<uint8_t>(_num_symbols));
+    buf->append(_lengths, _num_symbols);
+    buf->append(_symbols, _num_symbols * sizeof(uint64_t));
+}
+
+Status FsstSymbolTable::deserialize(const Slice& data, size_t* size) {
+    if (data.size < 1) {
+        return Status::Corruption("not enough bytes for the FSST symbol table");
+    }
+    const auto* p = reinterpret_cast<const uint8_t*>(data.data);
+    size_t num_symbols = p[0];
+    *size = 1 + num_symbols + num_symbols * sizeof(uint64_t);
+    if (data.size < *size) {
+        return Status::Corruption(strings::Substitute("invalid FSST symbol table size: $0, num symbols: $1",
+                                                      data.size, num_symbols));
+    }
+    _num_symbols = num_symbols;
+    for (size_t code = 0; code < num_symbols; code++) {
+        _lengths[code] = p[1 + code];
+        if (_lengths[code] == 0 || _lengths[code] > kMaxSymbolLength) {
+            return Status::Corruption(strings::Substitute("invalid FSST symbol length: $0", _lengths[code]));
+        }
+    }
+    memcpy(_symbols, p + 1 + num_symbols, num_symbols * sizeof(uint64_t));
+    _build_index();
+    return Status::OK();
+}
+
+void FsstSymbolTable::compress(const Slice& value, faststring* dst) const {
+    const auto* pos = reinterpret_cast<const uint8_t*>(value.data);
+    const uint8_t* end = pos + value.size;
+    while (pos < end) {
+        int code = _longest_match(pos, end - pos);
+        if (code >= 0) {
+            dst->push_back(static_cast<uint8_t>(code));
+            pos += _lengths[code];
+        } else {
+            dst->push_back(kEscapeCode);
+            dst->push_back(*pos++);
+        }
+    }
+}
+
+bool FsstMatcher::init(const FsstSymbolTable& table, Mode mode, const Slice& needle) {
+    const size_t m = needle.size;
+    if (m > kMaxNeedleLength) {
+        return false;
+    }
+    const auto* p = reinterpret_cast<const uint8_t*>(needle.data);
+    // The states are the number of matched bytes, plus a dead state for PREFIX.
+    const uint32_t dead_state = m + 1;
+    const size_t num_states = mode == PREFIX ? m + 2 : m + 1;
+    _accept_state = m;
+    _final.assign(num_states, 0);
+    _byte_transitions.assign(num_states * 256, 0);
+
+    // The KMP automaton, state m restarts like a mismatch after the whole needle.
+    uint16_t* t = _byte_transitions.data();
+    if (m > 0) {
+        t[p[0]] = 1;
+        uint32_t restart = 0;
+        for (uint32_t s = 1; s <= m; s++) {
+            memcpy(t + s * 256, t + restart * 256, 256 * sizeof(uint16_t));
+            if (s < m) {
+                t[s * 256 + p[s]] = s + 1;
+                restart = t[restart * 256 + p[s]];
+            }
+        }
+    }
+    if (mode == PREFIX) {
+        for (uint32_t s = 0; s < m; s++) {
+            std::fill(t + s * 256, t + s * 256 + 256, dead_state);
+            t[s * 256 + p[s]] = s + 1;
+        }
+        std::fill(t + dead_state * 256, t + dead_state * 256 + 256, dead_state);
+        _final[dead_state] = 1;
+    }
+    if (mode == PREFIX || mode == CONTAINS) {
+        std::fill(t + m * 256, t + m * 256 + 256, m);
+        _final[m] = 1;
+    }
+
+    _code_transitions.assign(num_states * 256, 0);
+    for (uint32_t s = 0; s < num_states; s++) {
+        for (size_t code = 0; code < table.num_symbols(); code++) {
+            uint32_t state = s;
+            const uint8_t* symbol = table.symbol(code);
+            for (size_t i = 0; i < table.symbol_length(code); i++) {
+                state = t[state * 256 + symbol[i]];
+            }
+            _code_transitions[s * 256 + code] = state;
+        }
+    }
+    return true;
+}
+
+} // namespace starrocks
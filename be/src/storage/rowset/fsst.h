@@ -0,0 +1,152 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// FSST (Fast Static Symbol Table) string compression, see "FSST: Fast Random Access String
+// Compression" (VLDB 2020).
+//
+// A symbol table maps up to 255 one-byte codes to symbols of 1 to 8 bytes. Every string is
+// compressed on its own by replacing the longest symbol that matches at each position with its
+// code, bytes not covered by any symbol are stored as the escape code followed by the byte itself.
+// So any value can be decompressed without touching its neighbours, and because the compression
+// is deterministic, two strings are equal iff their compressed bytes are equal.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "common/status.h"
+#include "util/faststring.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+class FsstSymbolTable {
+public:
+    static constexpr uint8_t kEscapeCode = 255;
+    static constexpr size_t kMaxSymbols = 255;
+    static constexpr size_t kMaxSymbolLength = 8;
+    // The decompressed bytes of one code are written with a single 8-byte store, so the output
+    // buffer of decompress() must have this many bytes of slack.
+    static constexpr size_t kDecompressPadding = 8;
+
+    FsstSymbolTable() { _build_index(); }
+
+    // Build the symbol table from |samples|, the strings of a page normally.
+    void build(const std::vector<Slice>& samples);
+
+    size_t num_symbols() const { return _num_symbols; }
+
+    uint8_t symbol_length(uint8_t code) const { return _lengths[code]; }
+
+    const uint8_t* symbol(uint8_t code) const { return reinterpret_cast<const uint8_t*>(&_symbols[code]); }
+
+    // Layout: num symbols (1 byte), symbol lengths (1 byte each), symbols (8 bytes each, zero padded).
+    void serialize(faststring* buf) const;
+
+    // Parse a symbol table written by serialize() from the beginning of |data|, and set |*size| to
+    // the number of bytes it occupies.
+    Status deserialize(const Slice& data, size_t* size);
+
+    // Append the compressed |value| to |dst|, which is at most 2 * |value.size| bytes.
+    void compress(const Slice& value, faststring* dst) const;
+
+    // Decompress |size| bytes of codes into |dst|, and return the size of the decompressed string.
+    // |dst| must have room for the decompressed string plus kDecompressPadding bytes.
+    size_t decompress(const uint8_t* codes, size_t size, uint8_t* dst) const {
+        const uint8_t* end = codes + size;
+        uint8_t* out = dst;
+        while (codes < end) {
+            uint8_t code = *codes++;
+            if (code != kEscapeCode) {
+                memcpy(out, &_symbols[code], sizeof(uint64_t));
+                out += _lengths[code];
+            } else {
+                *out++ = *codes++;
+            }
+        }
+        return out - dst;
+    }
+
+    // Return the size of the string decompressed from the |size| bytes of codes.
+    size_t decompressed_size(const uint8_t* codes, size_t size) const {
+        const uint8_t* end = codes + size;
+        size_t n = 0;
+        while (codes < end) {
+            uint8_t code = *codes++;
+            if (code != kEscapeCode) {
+                n += _lengths[code];
+            } else {
+                codes++;
+                n++;
+            }
+        }
+        return n;
+    }
+
+private:
+    // Sort the codes by the first byte of the symbol, and longest first for the same first byte,
+    // so that compress() takes the first match as the longest one.
+    void _build_index();
+
+    // Return the code of the longest symbol which is a prefix of [pos, pos + remaining), or -1.
+    int _longest_match(const uint8_t* pos, size_t remaining) const;
+
+    size_t _num_symbols = 0;
+    uint64_t _symbols[256] = {};
+    uint8_t _lengths[256] = {};
+    // The codes of the symbols starting with byte b are _sorted_codes[_first_byte_begin[b], _first_byte_begin[b + 1]).
+    uint16_t _first_byte_begin[257] = {};
+    uint8_t _sorted_codes[256] = {};
+};
+
+// Match the strings compressed by a symbol table against a needle without decompressing them.
+// The matcher runs a KMP automaton over the bytes of the needle, which is lifted to an automaton
+// over the codes of the symbol table, so that each code is consumed with a single lookup.
+class FsstMatcher {
+public:
+    enum Mode { PREFIX, SUFFIX, CONTAINS };
+
+    // Longer needles make the transition tables too large to build for every page.
+    static constexpr size_t kMaxNeedleLength = 128;
+
+    // Return false if the needle is longer than kMaxNeedleLength.
+    bool init(const FsstSymbolTable& table, Mode mode, const Slice& needle);
+
+    bool match(const uint8_t* codes, size_t size) const {
+        const uint16_t* code_transitions = _code_transitions.data();
+        const uint16_t* byte_transitions = _byte_transitions.data();
+        const uint8_t* end = codes + size;
+        uint32_t state = 0;
+        while (codes < end && !_final[state]) {
+            uint8_t code = *codes++;
+            if (code != FsstSymbolTable::kEscapeCode) {
+                state = code_transitions[state * 256 + code];
+            } else {
+                state = byte_transitions[state * 256 + *codes++];
+            }
+        }
+        return state == _accept_state;
+    }
+
+private:
+    uint32_t _accept_state = 0;
+    // Once reached, the result does not change by the following bytes.
+    std::vector<uint8_t> _final;
+    std::vector<uint16_t> _byte_transitions;
+    std::vector<uint16_t> _code_transitions;
+};
+
+} // namespace starrocks
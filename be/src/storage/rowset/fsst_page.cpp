@@ -0,0 +1,230 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/fsst_page.h"
+
+#include <cstring>
+
+#include "column/binary_column.h"
+#include "gutil/casts.h"
+#include "gutil/strings/substitute.h"
+#include "storage/column_predicate.h"
+
+namespace starrocks {
+
+uint32_t FsstPageBuilder::add(const uint8_t* vals, uint32_t count) {
+    DCHECK(!_finished);
+    const auto* slices = reinterpret_cast<const Slice*>(vals);
+    for (uint32_t i = 0; i < count; i++) {
+        if (is_page_full()) {
+            return i;
+        }
+        _offsets.push_back(_values.size());
+        _values.append(slices[i].data, slices[i].size);
+        _size_estimate += slices[i].size + sizeof(uint32_t);
+    }
+    return count;
+}
+
+faststring* FsstPageBuilder::finish() {
+    DCHECK(!_finished);
+    std::vector<Slice> values;
+    values.reserve(_offsets.size());
+    for (size_t i = 0; i < _offsets.size(); i++) {
+        values.emplace_back(_value_at(i));
+    }
+    _table.build(values);
+
+    _buffer.resize(_reserved_head_size);
+    put_fixed32_le(&_buffer, _offsets.size());
+    _table.serialize(&_buffer);
+    size_t codes_begin = _buffer.size();
+    std::vector<uint32_t> code_offsets;
+    code_offsets.reserve(values.size() + 1);
+    for (const Slice& value : values) {
+        code_offsets.push_back(_buffer.size() - codes_begin);
+        _table.compress(value, &_buffer);
+    }
+    code_offsets.push_back(_buffer.size() - codes_begin);
+    for (uint32_t offset : code_offsets) {
+        put_fixed32_le(&_buffer, offset);
+    }
+    _finished = true;
+    return &_buffer;
+}
+
+void FsstPageBuilder::reset() {
+    _values.clear();
+    _offsets.clear();
+    _buffer.clear();
+    _size_estimate = sizeof(uint32_t);
+    _finished = false;
+}
+
+Status FsstPageBuilder::get_first_value(void* value) const {
+    DCHECK(_finished);
+    if (_offsets.empty()) {
+        return Status::NotFound("page is empty");
+    }
+    *reinterpret_cast<Slice*>(value) = _value_at(0);
+    return Status::OK();
+}
+
+Status FsstPageBuilder::get_last_value(void* value) const {
+    DCHECK(_finished);
+    if (_offsets.empty()) {
+        return Status::NotFound("page is empty");
+    }
+    *reinterpret_cast<Slice*>(value) = _value_at(_offsets.size() - 1);
+    return Status::OK();
+}
+
+template <LogicalType Type>
+Status FsstPageDecoder<Type>::init() {
+    RETURN_IF(_parsed, Status::OK());
+    if (_data.size < sizeof(uint32_t)) {
+        return Status::Corruption(strings::Substitute("invalid FSST page size: $0", _data.size));
+    }
+    const auto* p = reinterpret_cast<const uint8_t*>(_data.data);
+    _num_elems = decode_fixed32_le(p);
+    size_t table_size = 0;
+    RETURN_IF_ERROR(_table.deserialize(Slice(p + sizeof(uint32_t), _data.size - sizeof(uint32_t)), &table_size));
+    size_t codes_begin = sizeof(uint32_t) + table_size;
+    size_t trailer_size = (static_cast<size_t>(_num_elems) + 1) * sizeof(uint32_t);
+    if (_data.size < codes_begin + trailer_size) {
+        return Status::Corruption(
+                strings::Substitute("invalid FSST page size: $0, num elements: $1", _data.size, _num_elems));
+    }
+    _codes = p + codes_begin;
+    _offsets_ptr = reinterpret_cast<const uint32_t*>(p + _data.size - trailer_size);
+    if (_offset(_num_elems) != _data.size - trailer_size - codes_begin) {
+        return Status::Corruption(strings::Substitute("invalid FSST codes size: $0", _offset(_num_elems)));
+    }
+    _parsed = true;
+    return Status::OK();
+}
+
+template <LogicalType Type>
+void FsstPageDecoder<Type>::_append_range(uint32_t begin, uint32_t end, const uint8_t* selection, Column* dst) const {
+    auto* column = down_cast<BinaryColumn*>(dst);
+    auto& bytes = column->get_bytes();
+    auto& offsets = column->get_offset();
+    size_t old_bytes_size = bytes.size();
+    size_t max_size = 0;
+    if (selection == nullptr) {
+        max_size = _table.decompressed_size(_codes + _offset(begin), _offset(end) - _offset(begin));
+    } else {
+        for (uint32_t i = begin; i < end; i++) {
+            if (selection[i - begin]) {
+                max_size += _table.decompressed_size(_codes + _offset(i), _offset(i + 1) - _offset(i));
+            }
+        }
+    }
+    bytes.resize(old_bytes_size + max_size + FsstSymbolTable::kDecompressPadding);
+
+    uint8_t* out = bytes.data() + old_bytes_size;
+    size_t offset_pos = offsets.size();
+    offsets.resize(offset_pos + end - begin);
+    for (uint32_t i = begin; i < end; i++) {
+        if (selection == nullptr || selection[i - begin]) {
+            size_t size = _table.decompress(_codes + _offset(i), _offset(i + 1) - _offset(i), out);
+            if constexpr (Type == TYPE_CHAR) {
+                // Strip trailing '\x00'
+                size = strnlen(reinterpret_cast<const char*>(out), size);
+            }
+            out += size;
+        }
+        offsets[offset_pos++] = out - bytes.data();
+    }
+    bytes.resize(out - bytes.data());
+}
+
+template <LogicalType Type>
+Status FsstPageDecoder<Type>::next_batch(size_t* n, Column* dst) {
+    SparseRange<> read_range;
+    uint32_t begin = current_index();
+    read_range.add(Range<>(begin, begin + *n));
+    RETURN_IF_ERROR(next_batch(read_range, dst));
+    *n = current_index() - begin;
+    return Status::OK();
+}
+
+template <LogicalType Type>
+Status FsstPageDecoder<Type>::next_batch(const SparseRange<>& range, Column* dst) {
+    DCHECK(_parsed);
+    if (PREDICT_FALSE(_cur_idx >= _num_elems)) {
+        return Status::OK();
+    }
+    size_t to_read = std::min(range.span_size(), _num_elems - _cur_idx);
+    SparseRangeIterator<> iter = range.new_iterator();
+    while (to_read > 0) {
+        _cur_idx = iter.begin();
+        Range<> r = iter.next(to_read);
+        uint32_t end = _cur_idx + r.span_size();
+        _append_range(_cur_idx, end, nullptr, dst);
+        to_read -= r.span_size();
+        _cur_idx = end;
+    }
+    return Status::OK();
+}
+
+template <LogicalType Type>
+Status FsstPageDecoder<Type>::next_batch_with_filter(const SparseRange<>& range,
+                                                     const std::vector<const ColumnPredicate*>& preds,
+                                                     uint8_t* selection, Column* dst) {
+    DCHECK(_parsed);
+    for (const ColumnPredicate* pred : preds) {
+        if (!pred->support_fsst_evaluate()) {
+            return Status::NotSupported("predicate can not be evaluated on FSST compressed strings");
+        }
+    }
+    if (PREDICT_FALSE(_cur_idx >= _num_elems)) {
+        return Status::OK();
+    }
+
+    // Evaluate the predicates on the compressed strings of all ranges at once.
+    size_t to_read = std::min(range.span_size(), _num_elems - _cur_idx);
+    std::vector<Slice> values;
+    values.reserve(to_read);
+    SparseRangeIterator<> iter = range.new_iterator();
+    size_t remaining = to_read;
+    while (remaining > 0) {
+        Range<> r = iter.next(remaining);
+        for (uint32_t i = r.begin(); i < r.end(); i++) {
+            values.emplace_back(_codes + _offset(i), _offset(i + 1) - _offset(i));
+        }
+        remaining -= r.span_size();
+    }
+    for (const ColumnPredicate* pred : preds) {
+        RETURN_IF_ERROR(pred->evaluate_fsst(_table, values.data(), values.size(), selection));
+    }
+
+    iter = range.new_iterator();
+    size_t offset = 0;
+    while (to_read > 0) {
+        _cur_idx = iter.begin();
+        Range<> r = iter.next(to_read);
+        uint32_t end = _cur_idx + r.span_size();
+        _append_range(_cur_idx, end, selection + offset, dst);
+        offset += r.span_size();
+        to_read -= r.span_size();
+        _cur_idx = end;
+    }
+    return Status::OK();
+}
+
+template class FsstPageDecoder<TYPE_CHAR>;
+template class FsstPageDecoder<TYPE_VARCHAR>;
+
+} // namespace starrocks
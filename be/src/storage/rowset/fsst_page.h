@@ -0,0 +1,155 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// FSST page encoding for strings, see storage/rowset/fsst.h.
+//
+// The page consists of:
+// Header
+//   num_elems (32-bit fixed)
+//   symbol table of the page
+// Codes
+//   the compressed strings
+// Trailer
+//   offsets of each compressed string relative to the beginning of codes, plus
+//   the total size of codes (32-bit fixed each)
+//
+// Every value can be decompressed on its own, and the equality and LIKE predicates
+// are evaluated on the compressed strings, so that only the values selected are
+// decompressed, see next_batch_with_filter().
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storage/range.h"
+#include "storage/rowset/fsst.h"
+#include "storage/rowset/options.h"
+#include "storage/rowset/page_builder.h"
+#include "storage/rowset/page_decoder.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+
+namespace starrocks {
+
+class Column;
+
+class FsstPageBuilder final : public PageBuilder {
+public:
+    explicit FsstPageBuilder(const PageBuilderOptions& options) : _options(options) { reset(); }
+
+    void reserve_head(uint8_t head_size) override {
+        CHECK_EQ(0, _reserved_head_size);
+        _reserved_head_size = head_size;
+    }
+
+    // The page size is limited by the size of the strings before compression, like BinaryPlainPageBuilder,
+    // so that the number of values in a page does not depend on how well the strings are compressed.
+    bool is_page_full() override {
+        return (_options.data_page_size != 0) & (_size_estimate > _options.data_page_size);
+    }
+
+    uint32_t add(const uint8_t* vals, uint32_t count) override;
+
+    faststring* finish() override;
+
+    void reset() override;
+
+    uint32_t count() const override { return _offsets.size(); }
+
+    uint64_t size() const override { return _size_estimate; }
+
+    Status get_first_value(void* value) const override;
+
+    Status get_last_value(void* value) const override;
+
+    // Return the number of symbols in the symbol table of the last page finished.
+    size_t num_symbols() const { return _table.num_symbols(); }
+
+private:
+    Slice _value_at(size_t idx) const {
+        size_t end = (idx + 1) < _offsets.size() ? _offsets[idx + 1] : _values.size();
+        return {_values.data() + _offsets[idx], end - _offsets[idx]};
+    }
+
+    PageBuilderOptions _options;
+    uint8_t _reserved_head_size{0};
+    size_t _size_estimate{0};
+    // The strings added, which are compressed when the page is finished.
+    faststring _values;
+    std::vector<uint32_t> _offsets;
+    FsstSymbolTable _table;
+    faststring _buffer;
+    bool _finished{false};
+};
+
+template <LogicalType Type>
+class FsstPageDecoder final : public PageDecoder {
+public:
+    explicit FsstPageDecoder(Slice data) : _data(data) {}
+
+    [[nodiscard]] Status init() override;
+
+    [[nodiscard]] Status seek_to_position_in_page(uint32_t pos) override {
+        DCHECK_LE(pos, _num_elems);
+        _cur_idx = pos;
+        return Status::OK();
+    }
+
+    [[nodiscard]] Status next_batch(size_t* n, Column* dst) override;
+
+    [[nodiscard]] Status next_batch(const SparseRange<>& range, Column* dst) override;
+
+    [[nodiscard]] Status next_batch_with_filter(const SparseRange<>& range,
+                                                const std::vector<const ColumnPredicate*>& preds, uint8_t* selection,
+                                                Column* dst) override;
+
+    uint32_t count() const override {
+        DCHECK(_parsed);
+        return _num_elems;
+    }
+
+    uint32_t current_index() const override {
+        DCHECK(_parsed);
+        return _cur_idx;
+    }
+
+    EncodingTypePB encoding_type() const override { return FSST_ENCODING; }
+
+    const FsstSymbolTable& symbol_table() const { return _table; }
+
+private:
+    uint32_t _offset(uint32_t idx) const {
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        return _offsets_ptr[idx];
+#else
+        return decode_fixed32_le(reinterpret_cast<const uint8_t*>(_offsets_ptr + idx));
+#endif
+    }
+
+    // Decompress the values [begin, end) to |dst|, the values not selected by |selection| are
+    // appended as empty strings if |selection| is not null.
+    void _append_range(uint32_t begin, uint32_t end, const uint8_t* selection, Column* dst) const;
+
+    Slice _data;
+    bool _parsed{false};
+    uint32_t _num_elems{0};
+    FsstSymbolTable _table;
+    const uint8_t* _codes{nullptr};
+    const uint32_t* _offsets_ptr{nullptr};
+    // Index of the currently seeked element in the page.
+    uint32_t _cur_idx{0};
+};
+
+} // namespace starrocks
@@ -83,6 +83,11 @@ public:
     // Get the dictionary page for dictionary encoding mode column.
     virtual faststring* get_dictionary_page() { return nullptr; }
 
+    // Set |codes| to the bitmap of the dictionary codes of the values in the current page and return true,
+    // or return false if the page is not encoded by dictionary encoding.
+    // This method could only be called before finish().
+    virtual bool get_dict_codes(faststring* codes) const { return false; }
+
     // check global dict valid for dictionary encoding mode column.
     virtual bool is_valid_global_dict(const GlobalDictMap* global_dict) const { return true; }
 
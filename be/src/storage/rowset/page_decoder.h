@@ -34,6 +34,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "common/status.h" // for Status
 #include "gen_cpp/segment.pb.h"
 #include "storage/range.h"
@@ -42,6 +44,7 @@
 
 namespace starrocks {
 class Column;
+class ColumnPredicate;
 }
 
 namespace starrocks {
@@ -91,6 +94,16 @@ public:
         return Status::NotSupported("PageDecoder Not Support");
     }
 
+    // Read the values in |range| like next_batch(), and evaluate |preds| on the encoded values before
+    // decoding them. The result is AND-ed into |selection|, one byte for each value read. The values
+    // not selected may be left undecoded, they are appended to |column| as empty or arbitrary values.
+    // Return NotSupported without reading anything if |preds| can not be evaluated on the encoded values.
+    [[nodiscard]] virtual Status next_batch_with_filter(const SparseRange<>& range,
+                                                        const std::vector<const ColumnPredicate*>& preds,
+                                                        uint8_t* selection, Column* column) {
+        return Status::NotSupported("next_batch_with_filter() not supported");
+    }
+
     // Return the number of elements in this page.
     virtual uint32_t count() const = 0;
 
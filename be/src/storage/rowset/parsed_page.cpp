@@ -36,11 +36,13 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <memory>
 
 #include "column/nullable_column.h"
 #include "common/status.h"
 #include "gutil/strings/substitute.h"
+#include "storage/column_predicate.h"
 #include "storage/rowset/binary_dict_page.h"
 #include "storage/rowset/bitshuffle_page.h"
 #include "storage/rowset/encoding_info.h"
@@ -51,6 +53,17 @@
 
 namespace starrocks {
 
+Status ParsedPage::read_with_filter(Column* column, const SparseRange<>& range,
+                                    const std::vector<const ColumnPredicate*>& preds, uint8_t* selection) {
+    size_t from = column->size();
+    RETURN_IF_ERROR(read(column, range));
+    size_t to = column->size();
+    for (const ColumnPredicate* pred : preds) {
+        RETURN_IF_ERROR(pred->evaluate_and(column, selection, from, to));
+    }
+    return Status::OK();
+}
+
 namespace {
 class ByteIterator {
 public:
@@ -265,6 +278,41 @@ public:
         return Status::OK();
     }
 
+    Status read_with_filter(Column* column, const SparseRange<>& range,
+                            const std::vector<const ColumnPredicate*>& preds, uint8_t* selection) override {
+        DCHECK_EQ(_offset_in_page, range.begin());
+        DCHECK_EQ(_offset_in_page, _data_decoder->current_index());
+        size_t from = column->size();
+        Column* data_column =
+                _null_flags.size() == 0 ? column : down_cast<NullableColumn*>(column)->data_column().get();
+        Status st = _data_decoder->next_batch_with_filter(range, preds, selection + from, data_column);
+        if (st.is_not_supported()) {
+            return ParsedPage::read_with_filter(column, range, preds, selection);
+        }
+        RETURN_IF_ERROR(st);
+        if (_null_flags.size() == 0) {
+            _offset_in_page = range.end();
+        } else {
+            auto nc = down_cast<NullableColumn*>(column);
+            SparseRangeIterator<> iter = range.new_iterator();
+            size_t size = range.span_size();
+            while (iter.has_more()) {
+                _offset_in_page = iter.begin();
+                Range<> r = iter.next(size);
+                nc->null_column()->append_numbers(_null_flags.data() + _offset_in_page, r.span_size());
+                _offset_in_page += r.span_size();
+                size -= r.span_size();
+            }
+            nc->update_has_null();
+            // The predicates are evaluated on the values stored for the null records.
+            const uint8_t* is_null = nc->immutable_null_column_data().data();
+            for (size_t i = from; i < column->size(); i++) {
+                selection[i] &= !is_null[i];
+            }
+        }
+        return Status::OK();
+    }
+
     Status read_dict_codes(Column* column, size_t* count) override {
         if (_null_flags.size() == 0) {
             RETURN_IF_ERROR(_data_decoder->next_dict_codes(count, column));
@@ -302,7 +350,23 @@ public:
         return Status::OK();
     }
 
+    Status decode_all(Column* values, faststring* null_flags) override {
+        DCHECK_EQ(0, _offset_in_page);
+        size_t count = _num_rows;
+        RETURN_IF_ERROR(_data_decoder->next_batch(&count, values));
+        if (count != _num_rows) {
+            return Status::Corruption(
+                    strings::Substitute("decoded $0 values from the page of $1 records", count, _num_rows));
+        }
+        RETURN_IF_ERROR(_data_decoder->seek_to_position_in_page(0));
+        null_flags->assign_copy(_null_flags.data(), _null_flags.size());
+        return Status::OK();
+    }
+
 private:
+    friend Status parse_decoded_page(std::unique_ptr<ParsedPage>* result, PageHandle handle,
+                                     const DecodedPage& decoded, const PagePointer& page_pointer,
+                                     uint32_t page_index);
     friend Status parse_page_v2(std::unique_ptr<ParsedPage>* result, PageHandle handle, const Slice& body,
                                 const DataPageFooterPB& footer, const EncodingInfo* encoding,
                                 const PagePointer& page_pointer, uint32_t page_index);
@@ -395,6 +459,83 @@ Status parse_page_v2(std::unique_ptr<ParsedPage>* result, PageHandle handle, con
     return Status::OK();
 }
 
+namespace {
+// Read the plain values of a DecodedPage.
+class DecodedPageDecoder final : public PageDecoder {
+public:
+    explicit DecodedPageDecoder(const Column& values)
+            : _data(values.raw_data()), _value_size(values.type_size()), _num_elems(values.size()) {}
+
+    Status init() override { return Status::OK(); }
+
+    Status seek_to_position_in_page(uint32_t pos) override {
+        DCHECK_LE(pos, _num_elems);
+        _cur_idx = pos;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, Column* dst) override {
+        SparseRange<> read_range;
+        uint32_t begin = current_index();
+        read_range.add(Range<>(begin, begin + *n));
+        RETURN_IF_ERROR(next_batch(read_range, dst));
+        *n = current_index() - begin;
+        return Status::OK();
+    }
+
+    Status next_batch(const SparseRange<>& range, Column* dst) override {
+        if (PREDICT_FALSE(_cur_idx >= _num_elems)) {
+            return Status::OK();
+        }
+        size_t to_read = std::min(static_cast<size_t>(range.span_size()), static_cast<size_t>(_num_elems - _cur_idx));
+        SparseRangeIterator<> iter = range.new_iterator();
+        while (to_read > 0) {
+            _cur_idx = iter.begin();
+            Range<> r = iter.next(to_read);
+            [[maybe_unused]] size_t n =
+                    dst->append_numbers(_data + _cur_idx * _value_size, r.span_size() * _value_size);
+            DCHECK_EQ(r.span_size(), n);
+            _cur_idx += r.span_size();
+            to_read -= r.span_size();
+        }
+        return Status::OK();
+    }
+
+    uint32_t count() const override { return _num_elems; }
+
+    uint32_t current_index() const override { return _cur_idx; }
+
+    EncodingTypePB encoding_type() const override { return PLAIN_ENCODING; }
+
+private:
+    const uint8_t* _data;
+    const size_t _value_size;
+    const uint32_t _num_elems;
+    uint32_t _cur_idx{0};
+};
+} // namespace
+
+size_t DecodedPage::memory_usage() const {
+    return sizeof(DecodedPage) + values->memory_usage() + null_flags.capacity();
+}
+
+Status parse_decoded_page(std::unique_ptr<ParsedPage>* result, PageHandle handle, const DecodedPage& decoded,
+                          const PagePointer& page_pointer, uint32_t page_index) {
+    auto page = std::make_unique<ParsedPageV2>();
+    page->_page_handle = std::move(handle);
+    page->_null_flags.assign_copy(decoded.null_flags.data(), decoded.null_flags.size());
+    page->_data_decoder = std::make_unique<DecodedPageDecoder>(*decoded.values);
+
+    page->_first_ordinal = decoded.first_ordinal;
+    page->_num_rows = decoded.num_rows;
+    page->_page_pointer = page_pointer;
+    page->_page_index = page_index;
+    page->_corresponding_element_ordinal = decoded.corresponding_element_ordinal;
+
+    *result = std::move(page);
+    return Status::OK();
+}
+
 Status parse_page(std::unique_ptr<ParsedPage>* result, PageHandle handle, const Slice& body,
                   const DataPageFooterPB& footer, const EncodingInfo* encoding, const PagePointer& page_pointer,
                   uint32_t page_index) {
@@ -35,16 +35,19 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "storage/range.h"
 #include "storage/rowset/common.h" // ordinal_t
 #include "storage/rowset/page_decoder.h"
 #include "storage/rowset/page_pointer.h"
+#include "util/faststring.h"
 
 namespace starrocks {
 class Slice;
 class Status;
 class Column;
+class ColumnPredicate;
 class DataPageFooterPB;
 class EncodingInfo;
 class PageHandle;
@@ -98,6 +101,13 @@ public:
         return Status::NotSupported("Read by range Not Support");
     }
 
+    // Read the records of |range| like read(column, range), and AND the result of |preds| into
+    // |selection|, which is indexed by the row of |column| like ColumnPredicate::evaluate_and().
+    // The records not selected may be read as arbitrary values, if the predicates can be evaluated
+    // before decoding, see PageDecoder::next_batch_with_filter().
+    virtual Status read_with_filter(Column* column, const SparseRange<>& range,
+                                    const std::vector<const ColumnPredicate*>& preds, uint8_t* selection);
+
     // prerequisite: encoding_type() is `DICT_ENCODING`.
     // Attempts to read up to |*count| dictionary codes from this page into the |column|.
     // On success, `Status::OK` is returned, and the number of codes read will be updated to
@@ -112,6 +122,13 @@ public:
 
     virtual Status read_dict_codes(Column* column, const SparseRange<>& range) = 0;
 
+    // Decode all the records of this page into |values|, and copy the null flags into |null_flags|, which
+    // is left empty if the page has no null. The page must be at offset 0, and it's still at offset 0 after.
+    // Return NotSupported if the values of the null records are not stored in the page, i.e, the format v1.
+    virtual Status decode_all(Column* values, faststring* null_flags) {
+        return Status::NotSupported("Decode all Not Support");
+    }
+
 protected:
     uint32_t _page_index{0};
     uint64_t _num_rows{0};
@@ -130,4 +147,21 @@ Status parse_page(std::unique_ptr<ParsedPage>* result, PageHandle handle, const
                   const DataPageFooterPB& footer, const EncodingInfo* encoding, const PagePointer& page_pointer,
                   uint32_t page_index);
 
+// A data page decoded into plain values, which is kept in the decoded tier of StoragePageCache,
+// see ParsedPage::decode_all().
+struct DecodedPage {
+    // The values of all the records, including the null records.
+    std::shared_ptr<Column> values;
+    faststring null_flags;
+    ordinal_t first_ordinal{0};
+    uint64_t num_rows{0};
+    ordinal_t corresponding_element_ordinal{0};
+
+    size_t memory_usage() const;
+};
+
+// Create a page reading the values of |decoded|, which must be kept alive by |handle|.
+Status parse_decoded_page(std::unique_ptr<ParsedPage>* result, PageHandle handle, const DecodedPage& decoded,
+                          const PagePointer& page_pointer, uint32_t page_index);
+
 } // namespace starrocks
@@ -35,6 +35,7 @@
 #pragma once
 
 #include "column/column.h"
+#include "storage/column_predicate.h"
 #include "storage/range.h"
 #include "storage/rowset/options.h"
 #include "storage/rowset/page_builder.h"
@@ -240,6 +241,59 @@ public:
         return Status::OK();
     }
 
+    // The predicates are evaluated once for each of the two boolean values, and the result is applied
+    // to the whole run of a value.
+    [[nodiscard]] Status next_batch_with_filter(const SparseRange<>& range,
+                                                const std::vector<const ColumnPredicate*>& preds, uint8_t* selection,
+                                                Column* dst) override {
+        if constexpr (Type != TYPE_BOOLEAN) {
+            return Status::NotSupported("next_batch_with_filter() only supports BOOLEAN");
+        } else {
+            DCHECK(_parsed);
+            for (const ColumnPredicate* pred : preds) {
+                if (!pred->support_encoded_evaluate()) {
+                    return Status::NotSupported("predicate can not be evaluated on RLE runs");
+                }
+            }
+            if (PREDICT_FALSE(_cur_index >= _num_elements)) {
+                return Status::OK();
+            }
+            CppType candidates[2] = {false, true};
+            auto values = dst->clone_empty();
+            values->append_numbers(candidates, sizeof(candidates));
+            uint8_t matches[2] = {1, 1};
+            for (const ColumnPredicate* pred : preds) {
+                RETURN_IF_ERROR(pred->evaluate_and(values.get(), matches, 0, 2));
+            }
+
+            CppType value{};
+            size_t offset = 0;
+            size_t to_read =
+                    std::min(static_cast<size_t>(range.span_size()), static_cast<size_t>(_num_elements - _cur_index));
+            SparseRangeIterator<> iter = range.new_iterator();
+            while (to_read > 0) {
+                RETURN_IF_ERROR(seek_to_position_in_page(iter.begin()));
+                Range<> r = iter.next(to_read);
+                size_t remaining = r.span_size();
+                while (remaining > 0) {
+                    size_t run = _rle_decoder.GetNextRun(&value, remaining);
+                    if (PREDICT_FALSE(run == 0)) {
+                        return Status::Corruption("RLE decode failed");
+                    }
+                    if (!matches[value]) {
+                        memset(selection + offset, 0, run);
+                    }
+                    dst->append_value_multiple_times(&value, run);
+                    offset += run;
+                    remaining -= run;
+                }
+                _cur_index += r.span_size();
+                to_read -= r.span_size();
+            }
+            return Status::OK();
+        }
+    }
+
     uint32_t count() const override { return _num_elements; }
 
     uint32_t current_index() const override { return _cur_index; }
@@ -34,7 +34,11 @@
 
 #include "storage/rowset/scalar_column_iterator.h"
 
+#include "column/binary_column.h"
+#include "common/config.h"
+#include "storage/chunk_helper.h"
 #include "storage/column_predicate.h"
+#include "storage/page_cache.h"
 #include "storage/rowset/binary_dict_page.h"
 #include "storage/rowset/bitshuffle_page.h"
 #include "storage/rowset/column_reader.h"
@@ -231,6 +235,40 @@ Status ScalarColumnIterator::next_batch(size_t* n, Column* dst) {
 }
 
 Status ScalarColumnIterator::next_batch(const SparseRange<>& range, Column* dst) {
+    return _do_next_batch(range, dst,
+                          [this, dst](const SparseRange<>& read_range) { return _page->read(dst, read_range); });
+}
+
+bool ScalarColumnIterator::support_filter_on_encoded_pages() const {
+    // The FSST pages of VARCHAR are written for FSST_ENCODING, and for the pages falling back from
+    // dict encoding.
+    EncodingTypePB encoding = _reader->encoding_info()->encoding();
+    LogicalType type = delegate_type(_reader->column_type());
+    switch (encoding) {
+    case FSST_ENCODING:
+        return type == TYPE_VARCHAR;
+    case DICT_ENCODING:
+        return type == TYPE_VARCHAR ? !_all_dict_encoded : !is_string_type(type);
+    case FOR_ENCODING:
+        return type == TYPE_TINYINT || type == TYPE_SMALLINT || type == TYPE_INT || type == TYPE_BIGINT ||
+               type == TYPE_DATE || type == TYPE_DATETIME || type == TYPE_DECIMAL32 || type == TYPE_DECIMAL64;
+    case RLE:
+        return type == TYPE_BOOLEAN;
+    default:
+        return false;
+    }
+}
+
+Status ScalarColumnIterator::next_batch_with_filter(const SparseRange<>& range,
+                                                    const std::vector<const ColumnPredicate*>& preds,
+                                                    uint8_t* selection, Column* dst) {
+    return _do_next_batch(range, dst, [this, dst, &preds, selection](const SparseRange<>& read_range) {
+        return _page->read_with_filter(dst, read_range, preds, selection);
+    });
+}
+
+template <typename ReadPageFunc>
+Status ScalarColumnIterator::_do_next_batch(const SparseRange<>& range, Column* dst, ReadPageFunc&& read_page) {
     size_t prev_bytes = dst->byte_size();
     SparseRangeIterator<> iter = range.new_iterator();
     size_t end_ord = _page->first_ordinal() + _page->num_rows();
@@ -282,7 +320,7 @@ Status ScalarColumnIterator::next_batch(const SparseRange<>& range, Column* dst)
             // current page have been added in read range
             // read current page data first
             contain_deleted_row = contain_deleted_row || _contains_deleted_row(_page->page_index());
-            RETURN_IF_ERROR(_page->read(dst, read_range));
+            RETURN_IF_ERROR(read_page(read_range));
             read_range.clear();
         }
     }
@@ -290,7 +328,7 @@ Status ScalarColumnIterator::next_batch(const SparseRange<>& range, Column* dst)
     if (!read_range.empty()) {
         // read data left if read range is not empty
         contain_deleted_row = contain_deleted_row || _contains_deleted_row(_page->page_index());
-        RETURN_IF_ERROR(_page->read(dst, read_range));
+        RETURN_IF_ERROR(read_page(read_range));
         read_range.clear();
     }
     dst->set_delete_state(contain_deleted_row ? DEL_PARTIAL_SATISFIED : DEL_NOT_SATISFIED);
@@ -330,6 +368,40 @@ Status ScalarColumnIterator::_load_dict_page() {
     return _dict_decoder->init();
 }
 
+template <LogicalType Type>
+StatusOr<bool> ScalarColumnIterator::_select_dict_codes(const std::vector<const ColumnPredicate*>& predicates,
+                                                        std::vector<uint8_t>* selection) {
+    std::vector<const ColumnPredicate*> preds;
+    for (const ColumnPredicate* pred : predicates) {
+        PredicateType type = pred->type();
+        if (type == PredicateType::kEQ || type == PredicateType::kNE || type == PredicateType::kInList ||
+            type == PredicateType::kNotInList) {
+            preds.emplace_back(pred);
+        }
+    }
+    if (preds.empty()) {
+        return false;
+    }
+    if (_dict_decoder == nullptr) {
+        RETURN_IF_ERROR(_load_dict_page<Type>());
+    }
+    std::vector<Slice> words;
+    RETURN_IF_ERROR(_fetch_all_dict_words<Type>(&words));
+    // The bitmaps only have the codes less than config::zone_map_max_dict_codes when the segment is written,
+    // and the others are taken as selected.
+    words.resize(std::min<size_t>(words.size(), config::zone_map_max_dict_codes));
+    auto column = BinaryColumn::create();
+    for (const Slice& word : words) {
+        column->append(word);
+    }
+    selection->resize(words.size());
+    RETURN_IF_ERROR(preds[0]->evaluate(column.get(), selection->data(), 0, words.size()));
+    for (size_t i = 1; i < preds.size(); i++) {
+        RETURN_IF_ERROR(preds[i]->evaluate_and(column.get(), selection->data(), 0, words.size()));
+    }
+    return true;
+}
+
 template <LogicalType Type>
 Status ScalarColumnIterator::_do_init_dict_decoder() {
     if constexpr (Type == TYPE_CHAR || Type == TYPE_VARCHAR) {
@@ -353,6 +425,15 @@ Status ScalarColumnIterator::_do_init_dict_decoder() {
 }
 
 Status ScalarColumnIterator::_read_data_page(const OrdinalPageIndexIterator& iter) {
+    const bool use_decoded_page_cache = _use_decoded_page_cache();
+    if (use_decoded_page_cache) {
+        bool found = false;
+        RETURN_IF_ERROR(_read_decoded_page(iter, &found));
+        if (found) {
+            return Status::OK();
+        }
+    }
+
     PageHandle handle;
     Slice page_body;
     PageFooterPB footer;
@@ -368,9 +449,84 @@ Status ScalarColumnIterator::_read_data_page(const OrdinalPageIndexIterator& ite
     if (_init_dict_decoder_func != nullptr) {
         RETURN_IF_ERROR((this->*_init_dict_decoder_func)());
     }
+    if (use_decoded_page_cache) {
+        RETURN_IF_ERROR(_cache_decoded_page(iter));
+    }
     return Status::OK();
 }
 
+bool ScalarColumnIterator::_use_decoded_page_cache() const {
+    if (!config::enable_decoded_page_cache || !_opts.use_page_cache) {
+        return false;
+    }
+    // The pages of the other encodings are plain values already once in the page cache.
+    switch (_reader->encoding_info()->encoding()) {
+    case RLE:
+    case DICT_ENCODING:
+    case FOR_ENCODING:
+    case DELTA_ENCODING:
+    case ALP_ENCODING:
+        break;
+    default:
+        return false;
+    }
+    switch (delegate_type(_reader->column_type())) {
+    case TYPE_BOOLEAN:
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_LARGEINT:
+    case TYPE_FLOAT:
+    case TYPE_DOUBLE:
+    case TYPE_DATE:
+    case TYPE_DATETIME:
+        return true;
+    default:
+        return false;
+    }
+}
+
+Status ScalarColumnIterator::_read_decoded_page(const OrdinalPageIndexIterator& iter, bool* found) {
+    StoragePageCache::CacheKey key(_opts.read_file->filename(), iter.page().offset);
+    PageCacheHandle cache_handle;
+    *found = StoragePageCache::instance()->lookup_decoded(key, _reader->encoding_info()->encoding(), &cache_handle);
+    if (!*found) {
+        return Status::OK();
+    }
+    _opts.stats->total_pages_num++;
+    _opts.stats->decoded_cached_pages_num++;
+    const auto* decoded = static_cast<const DecodedPage*>(cache_handle.value());
+    return parse_decoded_page(&_page, PageHandle(std::move(cache_handle)), *decoded, iter.page(), iter.page_index());
+}
+
+Status ScalarColumnIterator::_cache_decoded_page(const OrdinalPageIndexIterator& iter) {
+    auto* cache = StoragePageCache::instance();
+    const int32_t encoding = _reader->encoding_info()->encoding();
+    StoragePageCache::CacheKey key(_opts.read_file->filename(), iter.page().offset);
+    if (!cache->admit_decoded(key, encoding)) {
+        return Status::OK();
+    }
+
+    auto decoded = std::make_unique<DecodedPage>();
+    decoded->values = ChunkHelper::column_from_field_type(delegate_type(_reader->column_type()), false);
+    Status st = _page->decode_all(decoded->values.get(), &decoded->null_flags);
+    if (st.is_not_supported()) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(st);
+    decoded->first_ordinal = _page->first_ordinal();
+    decoded->num_rows = _page->num_rows();
+    decoded->corresponding_element_ordinal = _page->corresponding_element_ordinal();
+
+    PageCacheHandle cache_handle;
+    cache->insert_decoded(
+            key, encoding, decoded.get(), decoded->memory_usage(),
+            [](const CacheKey& /*key*/, void* value) { delete static_cast<DecodedPage*>(value); }, &cache_handle);
+    const DecodedPage* cached = decoded.release();
+    return parse_decoded_page(&_page, PageHandle(std::move(cache_handle)), *cached, iter.page(), iter.page_index());
+}
+
 Status ScalarColumnIterator::get_row_ranges_by_zone_map(const std::vector<const ColumnPredicate*>& predicates,
                                                         const ColumnPredicate* del_predicate,
                                                         SparseRange<>* row_ranges) {
@@ -386,8 +542,21 @@ Status ScalarColumnIterator::get_row_ranges_by_zone_map(const std::vector<const
         opts.lake_io_opts = _opts.lake_io_opts;
         opts.read_file = _opts.read_file;
         opts.stats = _opts.stats;
-        RETURN_IF_ERROR(_reader->zone_map_filter(predicates, del_predicate, &_delete_partial_satisfied_pages.value(),
-                                                 row_ranges, opts));
+
+        // The zone maps of the dict encoded pages may have the bitmaps of their dictionary codes.
+        std::vector<uint8_t> dict_code_selection;
+        bool use_dict_codes = false;
+        if (_reader->encoding_info()->encoding() == DICT_ENCODING && config::zone_map_max_dict_codes > 0) {
+            LogicalType type = delegate_type(_reader->column_type());
+            if (type == TYPE_VARCHAR) {
+                ASSIGN_OR_RETURN(use_dict_codes, _select_dict_codes<TYPE_VARCHAR>(predicates, &dict_code_selection));
+            } else if (type == TYPE_CHAR) {
+                ASSIGN_OR_RETURN(use_dict_codes, _select_dict_codes<TYPE_CHAR>(predicates, &dict_code_selection));
+            }
+        }
+        RETURN_IF_ERROR(_reader->zone_map_filter(predicates, del_predicate,
+                                                 use_dict_codes ? &dict_code_selection : nullptr,
+                                                 &_delete_partial_satisfied_pages.value(), row_ranges, opts));
     } else {
         row_ranges->add({0, static_cast<rowid_t>(_reader->num_rows())});
     }
@@ -61,6 +61,12 @@ public:
 
     [[nodiscard]] Status next_batch(const SparseRange<>& range, Column* dst) override;
 
+    bool support_filter_on_encoded_pages() const override;
+
+    [[nodiscard]] Status next_batch_with_filter(const SparseRange<>& range,
+                                                const std::vector<const ColumnPredicate*>& preds, uint8_t* selection,
+                                                Column* dst) override;
+
     ordinal_t get_current_ordinal() const override { return _current_ordinal; }
 
     ordinal_t num_rows() const override { return _reader->num_rows(); }
@@ -105,6 +111,17 @@ private:
     Status _load_next_page(bool* eos);
     Status _read_data_page(const OrdinalPageIndexIterator& iter);
 
+    // Whether the data pages are kept decoded in StoragePageCache, see config::enable_decoded_page_cache.
+    bool _use_decoded_page_cache() const;
+    // Read the page of |iter| from the decoded tier of StoragePageCache, |*found| is false on miss.
+    Status _read_decoded_page(const OrdinalPageIndexIterator& iter, bool* found);
+    // Decode the current page and insert it into the decoded tier of StoragePageCache if it's admitted.
+    Status _cache_decoded_page(const OrdinalPageIndexIterator& iter);
+
+    // Read the rows of |range| page by page, |read_page| reads a range of the current page into |dst|.
+    template <typename ReadPageFunc>
+    Status _do_next_batch(const SparseRange<>& range, Column* dst, ReadPageFunc&& read_page);
+
     template <LogicalType Type>
     int _do_dict_lookup(const Slice& word);
 
@@ -129,6 +146,12 @@ private:
     template <LogicalType Type>
     Status _load_dict_page();
 
+    // Evaluate the `=`, `!=`, `IN` and `NOT IN` predicates of |predicates| on the first words of the dictionary,
+    // and set |selection| to whether each code is selected. Return false if there is no such predicate.
+    template <LogicalType Type>
+    StatusOr<bool> _select_dict_codes(const std::vector<const ColumnPredicate*>& predicates,
+                                      std::vector<uint8_t>* selection);
+
     bool _contains_deleted_row(uint32_t page_index) const;
 
     ColumnReader* _reader;
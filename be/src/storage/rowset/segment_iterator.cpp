@@ -15,6 +15,7 @@
 #include "segment_iterator.h"
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <stack>
 #include <unordered_map>
@@ -132,7 +133,9 @@ private:
             return Status::OK();
         }
 
-        Status read_columns(Chunk* chunk, const SparseRange<>& range) {
+        // |encoded_preds| are evaluated while reading the columns, and the result is AND-ed into |selection|.
+        Status read_columns(Chunk* chunk, const SparseRange<>& range, const ColumnPredicateMap& encoded_preds,
+                            uint8_t* selection) {
             bool may_has_del_row = chunk->delete_state() != DEL_NOT_SATISFIED;
             for (size_t i = 0; i < _column_iterators.size(); i++) {
                 const ColumnPtr& col = chunk->get_column_by_index(i);
@@ -141,7 +144,13 @@ private:
                     col->resize(range.span_size());
                     continue;
                 }
-                RETURN_IF_ERROR(_column_iterators[i]->next_batch(range, col.get()));
+                auto iter = _is_dict_column[i] ? encoded_preds.end() : encoded_preds.find(_read_schema.field(i)->id());
+                if (iter != encoded_preds.end()) {
+                    RETURN_IF_ERROR(_column_iterators[i]->next_batch_with_filter(range, iter->second, selection,
+                                                                                 col.get()));
+                } else {
+                    RETURN_IF_ERROR(_column_iterators[i]->next_batch(range, col.get()));
+                }
                 may_has_del_row |= (col->delete_state() != DEL_NOT_SATISFIED);
             }
             chunk->set_delete_state(may_has_del_row ? DEL_PARTIAL_SATISFIED : DEL_NOT_SATISFIED);
@@ -222,7 +231,16 @@ private:
     StatusOr<uint16_t> _filter(Chunk* chunk, vector<rowid_t>* rowid, uint16_t from, uint16_t to);
     StatusOr<uint16_t> _filter_by_expr_predicates(Chunk* chunk, vector<rowid_t>* rowid);
 
+    // Read the predicate columns of the late materialization context one by one, in the order of
+    // |_progressive_columns|, each of them only for the rows selected by the previous ones. Return the
+    // number of rows in |chunk| after filtering.
+    StatusOr<uint16_t> _read_progressively(Chunk* chunk, vector<rowid_t>* rowid, size_t n);
+
     void _init_column_predicates();
+    // Return true if all predicates of the column |cid| are pushed down to be evaluated on the encoded values.
+    bool _init_encoded_predicates(ColumnId cid, const PredicateList& preds);
+
+    void _init_progressive_columns();
 
     Status _init_context();
 
@@ -312,12 +330,47 @@ private:
     std::vector<const ColumnPredicate*> _vectorized_preds;
     std::vector<const ColumnPredicate*> _branchless_preds;
     std::vector<const ColumnPredicate*> _expr_ctx_preds; // predicates using ExprContext*
+    // predicates evaluated on the encoded values while reading the columns, e.g. on the FSST compressed strings
+    // or the dictionary of numeric pages, whose result is saved in |_encoded_selection|.
+    ColumnPredicateMap _encoded_preds;
+    Buffer<uint8_t> _encoded_selection;
     // _selection is used to accelerate
     Buffer<uint8_t> _selection;
 
     // _selected_idx is used to store selected index when evaluating branchless predicate
     Buffer<uint16_t> _selected_idx;
 
+    // A predicate column of the late materialization context read by `_read_progressively`.
+    struct ProgressiveColumn {
+        // index in |ScanContext::_read_schema|
+        size_t index = 0;
+        std::vector<const ColumnPredicate*> preds;
+        // the predicates evaluated while reading the column, or nullptr.
+        const PredicateList* encoded_preds = nullptr;
+        // the estimated cost to read and evaluate a value before the column has been read.
+        double prior_cost_ns = 0;
+        // decayed statistics of the previous reads.
+        double rows_in = 0;
+        double rows_out = 0;
+        double cost_ns = 0;
+
+        bool has_filter() const { return !preds.empty() || encoded_preds != nullptr; }
+
+        // The columns are read in the ascending order of cost / (1 - selectivity), which is the optimal order
+        // of independent conjunctive predicates, see "Predicate Migration: Optimizing Queries with Expensive
+        // Predicates" (SIGMOD 1993).
+        double rank() const {
+            if (!has_filter()) {
+                return std::numeric_limits<double>::max();
+            }
+            double cost = rows_in > 0 ? cost_ns / rows_in : prior_cost_ns;
+            double selectivity = (rows_out + 1) / (rows_in + 2);
+            return cost / std::max(1 - selectivity, 1e-3);
+        }
+    };
+    // empty if the predicate columns are read all at once.
+    std::vector<ProgressiveColumn> _progressive_columns;
+
     ScanContext _context_list[2];
     // points to |_context_list[0]| or |_context_list[1]| after `_init_context`.
     ScanContext* _context = nullptr;
@@ -423,6 +476,7 @@ Status SegmentIterator::_init() {
     }
 
     _selection.resize(_reserve_chunk_size);
+    _encoded_selection.resize(_reserve_chunk_size);
     _selected_idx.resize(_reserve_chunk_size);
 
     StarRocksMetrics::instance()->segment_read_total.increment(1);
@@ -451,6 +505,7 @@ Status SegmentIterator::_init() {
     RETURN_IF_ERROR(_rewrite_predicates());
     RETURN_IF_ERROR(_init_context());
     _init_column_predicates();
+    _init_progressive_columns();
 
     // reverse scan_range
     if (!_opts.asc_hint) {
@@ -656,6 +711,9 @@ bool SegmentIterator::need_early_materialize_subfield(const FieldPtr& field) {
 void SegmentIterator::_init_column_predicates() {
     DCHECK_EQ(_predicate_columns, _cid_to_predicates.size());
     for (const auto& pair : _cid_to_predicates) {
+        if (_init_encoded_predicates(pair.first, pair.second)) {
+            continue;
+        }
         for (const ColumnPredicate* pred : pair.second) {
             // If this predicate is generated by join runtime filter,
             // We only use it to compute segment row range.
@@ -671,11 +729,86 @@ void SegmentIterator::_init_column_predicates() {
             }
         }
     }
-    if (_vectorized_preds.empty() && _branchless_preds.empty()) {
+    if (_vectorized_preds.empty() && _branchless_preds.empty() && _encoded_preds.empty()) {
         _cid_to_predicates.clear();
     }
 }
 
+void SegmentIterator::_init_progressive_columns() {
+    const ScanContext* ctx = &_context_list[0];
+    // The pruned columns are not read at all, and the subfields are filled by the row ids of all the rows read.
+    if (!config::enable_progressive_late_materialization || !ctx->_late_materialize || _cid_to_predicates.empty() ||
+        !ctx->_subfield_columns.empty() || (ctx->_prune_column_after_index_filter && !ctx->_prune_cols.empty())) {
+        return;
+    }
+    // the last column is the row id column.
+    const size_t num_pred_columns = ctx->_column_iterators.size() - 1;
+    if (num_pred_columns < 2) {
+        return;
+    }
+    std::vector<ProgressiveColumn> columns(num_pred_columns);
+    for (size_t i = 0; i < num_pred_columns; i++) {
+        const FieldPtr& f = ctx->_read_schema.field(i);
+        ProgressiveColumn& column = columns[i];
+        column.index = i;
+        for (const auto* preds : {&_vectorized_preds, &_branchless_preds}) {
+            for (const ColumnPredicate* pred : *preds) {
+                if (pred->column_id() == f->id()) {
+                    column.preds.emplace_back(pred);
+                }
+            }
+        }
+        if (!ctx->_is_dict_column[i]) {
+            auto iter = _encoded_preds.find(f->id());
+            if (iter != _encoded_preds.end()) {
+                column.encoded_preds = &iter->second;
+            }
+        }
+        // Before any statistics, the fixed length values and the ones filtered while reading go first.
+        LogicalType type = f->type()->type();
+        column.prior_cost_ns = is_scalar_field_type(type) && !is_string_type(type) ? 1 : 4;
+        if (column.encoded_preds != nullptr) {
+            column.prior_cost_ns /= 2;
+        }
+    }
+    _progressive_columns = std::move(columns);
+}
+
+bool SegmentIterator::_init_encoded_predicates(ColumnId cid, const PredicateList& preds) {
+    auto it = std::find_if(_schema.fields().begin(), _schema.fields().end(),
+                           [cid](const FieldPtr& f) { return f->id() == cid; });
+    if (it == _schema.fields().end()) {
+        return false;
+    }
+    const FieldPtr& field = *it;
+    if (_can_using_dict_code(field) || _can_using_global_dict(field) ||
+        _prune_cols_candidate_by_inverted_index.count(cid) ||
+        !_column_iterators[cid]->support_filter_on_encoded_pages()) {
+        return false;
+    }
+    // All predicates of the column are pushed down, or none of them, because the values not selected by
+    // the predicates pushed down are not decoded.
+    const bool is_varchar = field->type()->type() == TYPE_VARCHAR;
+    std::vector<const ColumnPredicate*> encoded_preds;
+    for (const ColumnPredicate* pred : preds) {
+        if (pred->is_index_filter_only()) {
+            continue;
+        }
+        if (is_varchar && pred->is_expr_predicate()) {
+            pred = down_cast<const ColumnExprPredicate*>(pred)->like_predicate();
+        }
+        if (pred == nullptr || !(is_varchar ? pred->support_fsst_evaluate() : pred->support_encoded_evaluate())) {
+            return false;
+        }
+        encoded_preds.emplace_back(pred);
+    }
+    if (encoded_preds.empty()) {
+        return false;
+    }
+    _encoded_preds[cid] = std::move(encoded_preds);
+    return true;
+}
+
 Status SegmentIterator::_get_row_ranges_by_keys() {
     if (_opts.is_first_split_of_segment) {
         StarRocksMetrics::instance()->segment_row_total.increment(num_rows());
@@ -1008,7 +1141,10 @@ inline Status SegmentIterator::_read(Chunk* chunk, vector<rowid_t>* rowids, size
     {
         _opts.stats->blocks_load += 1;
         SCOPED_RAW_TIMER(&_opts.stats->block_fetch_ns);
-        RETURN_IF_ERROR(_context->read_columns(chunk, range));
+        if (!_encoded_preds.empty()) {
+            memset(_encoded_selection.data() + chunk->num_rows(), 1, range.span_size());
+        }
+        RETURN_IF_ERROR(_context->read_columns(chunk, range, _encoded_preds, _encoded_selection.data()));
         chunk->check_or_die();
     }
 
@@ -1081,14 +1217,22 @@ Status SegmentIterator::_do_get_next(Chunk* result, vector<rowid_t>* rowid) {
     Chunk* chunk = _context->_read_chunk.get();
     uint16_t chunk_start = chunk->num_rows();
 
-    while ((chunk_start < return_chunk_threshold) & _range_iter.has_more()) {
-        RETURN_IF_ERROR(_read(chunk, rowid, chunk_capacity - chunk_start));
-        chunk->check_or_die();
-        size_t next_start = chunk->num_rows();
+    const bool read_progressively = _context->_late_materialize && !_progressive_columns.empty();
 
-        if (has_predicate) {
-            ASSIGN_OR_RETURN(next_start, _filter(chunk, rowid, chunk_start, next_start));
+    while ((chunk_start < return_chunk_threshold) & _range_iter.has_more()) {
+        size_t next_start;
+        if (read_progressively) {
+            ASSIGN_OR_RETURN(next_start, _read_progressively(chunk, rowid, chunk_capacity - chunk_start));
+            chunk->check_or_die();
+        } else {
+            RETURN_IF_ERROR(_read(chunk, rowid, chunk_capacity - chunk_start));
             chunk->check_or_die();
+            next_start = chunk->num_rows();
+
+            if (has_predicate) {
+                ASSIGN_OR_RETURN(next_start, _filter(chunk, rowid, chunk_start, next_start));
+                chunk->check_or_die();
+            }
         }
         chunk_start = next_start;
         DCHECK_EQ(chunk_start, chunk->num_rows());
@@ -1178,7 +1322,8 @@ Status SegmentIterator::_do_get_next(Chunk* result, vector<rowid_t>* rowid) {
 
 Status SegmentIterator::_switch_context(ScanContext* to) {
     if (_context != nullptr) {
-        const ordinal_t ordinal = _context->_column_iterators[0]->get_current_ordinal();
+        // The column iterators of a context read progressively may stop before |_cur_rowid|.
+        const ordinal_t ordinal = _cur_rowid;
         for (ColumnIterator* iter : to->_column_iterators) {
             RETURN_IF_ERROR(iter->seek_to_ordinal(ordinal));
         }
@@ -1241,17 +1386,26 @@ Status SegmentIterator::_switch_context(ScanContext* to) {
 }
 
 StatusOr<uint16_t> SegmentIterator::_filter(Chunk* chunk, vector<rowid_t>* rowid, uint16_t from, uint16_t to) {
-    // There must be one predicate, either vectorized or branchless.
-    DCHECK(_vectorized_preds.size() + _branchless_preds.size() > 0 || _del_vec);
+    // There must be one predicate, either vectorized, branchless or evaluated while reading.
+    DCHECK(_vectorized_preds.size() + _branchless_preds.size() + _encoded_preds.size() > 0 || _del_vec);
 
     SCOPED_RAW_TIMER(&_opts.stats->vec_cond_ns);
 
+    // the predicates evaluated while reading
+    if (!_encoded_preds.empty()) {
+        memcpy(&_selection[from], &_encoded_selection[from], to - from);
+    }
+
     // first evaluate
     if (!_vectorized_preds.empty()) {
         SCOPED_RAW_TIMER(&_opts.stats->vec_cond_evaluate_ns);
         const ColumnPredicate* pred = _vectorized_preds[0];
         Column* c = chunk->get_column_by_id(pred->column_id()).get();
-        RETURN_IF_ERROR(pred->evaluate(c, _selection.data(), from, to));
+        if (_encoded_preds.empty()) {
+            RETURN_IF_ERROR(pred->evaluate(c, _selection.data(), from, to));
+        } else {
+            RETURN_IF_ERROR(pred->evaluate_and(c, _selection.data(), from, to));
+        }
         for (int i = 1; i < _vectorized_preds.size(); ++i) {
             pred = _vectorized_preds[i];
             c = chunk->get_column_by_id(pred->column_id()).get();
@@ -1264,7 +1418,7 @@ StatusOr<uint16_t> SegmentIterator::_filter(Chunk* chunk, vector<rowid_t>* rowid
         SCOPED_RAW_TIMER(&_opts.stats->branchless_cond_evaluate_ns);
 
         uint16_t selected_size = 0;
-        if (!_vectorized_preds.empty()) {
+        if (!_vectorized_preds.empty() || !_encoded_preds.empty()) {
             for (uint16_t i = from; i < to; ++i) {
                 _selected_idx[selected_size] = i;
                 selected_size += _selection[i];
@@ -1310,6 +1464,119 @@ StatusOr<uint16_t> SegmentIterator::_filter(Chunk* chunk, vector<rowid_t>* rowid
     return chunk_size;
 }
 
+StatusOr<uint16_t> SegmentIterator::_read_progressively(Chunk* chunk, vector<rowid_t>* rowid, size_t n) {
+    // Decay the statistics every this many rows of a column, so that the order follows the data.
+    static constexpr double kStatsDecayRows = 1 << 20;
+
+    SparseRange<> range;
+    _range_iter.next_range(n, &range);
+    _cur_rowid = range.end();
+    const size_t num_rows = range.span_size();
+    _opts.stats->raw_rows_read += num_rows;
+    _opts.stats->blocks_load += 1;
+
+    std::stable_sort(_progressive_columns.begin(), _progressive_columns.end(),
+                     [](const ProgressiveColumn& a, const ProgressiveColumn& b) { return a.rank() < b.rank(); });
+
+    const uint16_t from = chunk->num_rows();
+    uint16_t to = from + num_rows;
+    bool may_has_del_row = chunk->delete_state() != DEL_NOT_SATISFIED;
+    // last column of |_read_chunk| is filled by `RowIdColumnIterator`, and is filtered along with the predicate
+    // columns to give the rows to read next.
+    const size_t rowid_index = _context->_column_iterators.size() - 1;
+    ColumnPtr& rowid_column = chunk->get_column_by_index(rowid_index);
+    {
+        SCOPED_RAW_TIMER(&_opts.stats->block_fetch_ns);
+        RETURN_IF_ERROR(_context->_column_iterators[rowid_index]->next_batch(range, rowid_column.get()));
+    }
+
+    size_t values_read = 0;
+    for (size_t i = 0; i < _progressive_columns.size() && to > from; i++) {
+        ProgressiveColumn& column = _progressive_columns[i];
+        ColumnIterator* iter = _context->_column_iterators[column.index];
+        Column* col = chunk->get_column_by_index(column.index).get();
+        const size_t rows = to - from;
+        values_read += rows;
+
+        int64_t read_ns = 0;
+        {
+            SCOPED_RAW_TIMER(&read_ns);
+            // the iterators have not been positioned before reading the first rows of the segment.
+            if (range.begin() == 0 || iter->get_current_ordinal() != range.begin()) {
+                _opts.stats->block_seek_num += 1;
+                RETURN_IF_ERROR(iter->seek_to_ordinal(range.begin()));
+            }
+            if (column.encoded_preds != nullptr) {
+                memset(&_selection[from], 1, rows);
+                RETURN_IF_ERROR(iter->next_batch_with_filter(range, *column.encoded_preds, _selection.data(), col));
+            } else {
+                RETURN_IF_ERROR(iter->next_batch(range, col));
+            }
+            may_has_del_row |= (col->delete_state() != DEL_NOT_SATISFIED);
+        }
+        _opts.stats->block_fetch_ns += read_ns;
+        if (!column.has_filter()) {
+            continue;
+        }
+
+        int64_t evaluate_ns = 0;
+        size_t hit_count = 0;
+        {
+            SCOPED_RAW_TIMER(&evaluate_ns);
+            for (size_t j = 0; j < column.preds.size(); j++) {
+                if (j == 0 && column.encoded_preds == nullptr) {
+                    RETURN_IF_ERROR(column.preds[j]->evaluate(col, _selection.data(), from, to));
+                } else {
+                    RETURN_IF_ERROR(column.preds[j]->evaluate_and(col, _selection.data(), from, to));
+                }
+            }
+            hit_count = SIMD::count_nonzero(&_selection[from], rows);
+        }
+        _opts.stats->vec_cond_ns += evaluate_ns;
+
+        column.rows_in += rows;
+        column.rows_out += hit_count;
+        column.cost_ns += read_ns + evaluate_ns;
+        if (column.rows_in >= kStatsDecayRows) {
+            column.rows_in /= 2;
+            column.rows_out /= 2;
+            column.cost_ns /= 2;
+        }
+        if (hit_count == rows) {
+            continue;
+        }
+
+        // Drop the rows filtered out from the columns read, and read the next column only for the rows left.
+        SCOPED_RAW_TIMER(&_opts.stats->vec_cond_chunk_copy_ns);
+        for (size_t j = 0; j <= i; j++) {
+            chunk->get_column_by_index(_progressive_columns[j].index)->filter_range(_selection, from, to);
+        }
+        rowid_column->filter_range(_selection, from, to);
+        to = from + hit_count;
+
+        range.clear();
+        const rowid_t* ordinals = down_cast<FixedLengthColumn<rowid_t>*>(rowid_column.get())->get_data().data();
+        for (size_t j = from; j < to;) {
+            size_t k = j + 1;
+            while (k < to && ordinals[k] == ordinals[k - 1] + 1) {
+                k++;
+            }
+            range.add(Range<>(ordinals[j], ordinals[k - 1] + 1));
+            j = k;
+        }
+    }
+    // The columns not read are left with |from| rows if all rows are filtered out.
+    chunk->set_delete_state(may_has_del_row ? DEL_PARTIAL_SATISFIED : DEL_NOT_SATISFIED);
+
+    if (rowid != nullptr) {
+        const rowid_t* ordinals = down_cast<FixedLengthColumn<rowid_t>*>(rowid_column.get())->get_data().data();
+        rowid->insert(rowid->end(), ordinals + from, ordinals + to);
+    }
+    _opts.stats->rows_vec_cond_filtered += num_rows - (to - from);
+    _opts.stats->rows_pred_column_skipped += num_rows * _progressive_columns.size() - values_read;
+    return to;
+}
+
 StatusOr<uint16_t> SegmentIterator::_filter_by_expr_predicates(Chunk* chunk, vector<rowid_t>* rowid) {
     size_t chunk_size = chunk->num_rows();
     if (_expr_ctx_preds.size() != 0 && chunk_size > 0) {
@@ -102,12 +102,13 @@ public:
                             std::unique_ptr<char[]>* page, Slice* page_slice) override {
         // When the dictionary page is not full, the header of the binary dictionary's data
         // page is DICT_ENCODING, and bitshuffle decode is needed at this point. When the
-        // dictionary page is full, the header of the binary dictionary's data page is PLAIN_ENCODING.
+        // dictionary page is full, the header of the binary dictionary's data page is PLAIN_ENCODING,
+        // or FSST_ENCODING if enable_string_fsst_encoding is true.
         // For the newly introduced dictionary data page, the header is BIT_SHUFFLE.
         size_t type = decode_fixed32_le((const uint8_t*)&(page_slice->data[0]));
         if (type == DICT_ENCODING || type == BIT_SHUFFLE) {
             return _bit_shuffle_decoder->decode_page_data(footer, footer_size, encoding, page, page_slice);
-        } else if (type == PLAIN_ENCODING) {
+        } else if (type == PLAIN_ENCODING || type == FSST_ENCODING) {
             return Status::OK();
         } else {
             LOG(WARNING) << "invalid encoding type:" << type;
@@ -133,6 +134,9 @@ DataDecoder* DataDecoder::get_data_decoder(EncodingTypePB encoding) {
         return &g_binary_dict_decoder;
     }
     case FOR_ENCODING:
+    case DELTA_ENCODING:
+    case ALP_ENCODING:
+    case FSST_ENCODING:
     case PLAIN_ENCODING:
     case PREFIX_ENCODING:
     case RLE: {
@@ -147,6 +147,11 @@ public:
 
     void add_nulls(uint32_t count) override { _page_zone_map.has_null |= count > 0; }
 
+    void set_dict_codes(const Slice& codes) override {
+        _page_dict_codes.assign(codes.data, codes.size);
+        _has_page_dict_codes = true;
+    }
+
     // mark the end of one data page so that we can finalize the corresponding zone map
     Status flush() override;
 
@@ -167,6 +172,8 @@ private:
     // memory will be managed by MemPool
     ZoneMap<type> _page_zone_map;
     ZoneMap<type> _segment_zone_map;
+    std::string _page_dict_codes;
+    bool _has_page_dict_codes = false;
 
     // serialized ZoneMapPB for each data page
     std::vector<std::string> _values;
@@ -235,6 +242,10 @@ Status ZoneMapIndexWriterImpl<type>::flush() {
     ZoneMapPB zone_map_pb;
     _page_zone_map.to_proto(&zone_map_pb, _type_info);
     _reset_zone_map(&_page_zone_map);
+    if (_has_page_dict_codes) {
+        zone_map_pb.set_dict_codes(_page_dict_codes);
+        _has_page_dict_codes = false;
+    }
 
     std::string serialized_zone_map;
     bool ret = zone_map_pb.SerializeToString(&serialized_zone_map);
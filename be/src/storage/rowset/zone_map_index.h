@@ -66,6 +66,9 @@ public:
 
     virtual void add_nulls(uint32_t count) = 0;
 
+    // Set the bitmap of the dictionary codes of the values in the current data page.
+    virtual void set_dict_codes(const Slice& codes) = 0;
+
     // mark the end of one data page so that we can finalize the corresponding zone map
     virtual Status flush() = 0;
 
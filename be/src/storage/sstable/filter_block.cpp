@@ -71,6 +71,34 @@ void FilterBlockBuilder::GenerateFilter() {
     start_.clear();
 }
 
+PartitionedFilterBlockBuilder::PartitionedFilterBlockBuilder(const FilterPolicy* policy, size_t keys_per_partition)
+        : policy_(policy), keys_per_partition_(keys_per_partition) {}
+
+void PartitionedFilterBlockBuilder::AddKey(const Slice& key) {
+    if (start_.empty()) {
+        keys_.clear();
+    }
+    start_.push_back(keys_.size());
+    keys_.append(key.get_data(), key.get_size());
+}
+
+Slice PartitionedFilterBlockBuilder::FinishPartition() {
+    assert(!start_.empty());
+    const size_t num_keys = start_.size();
+    start_.push_back(keys_.size()); // Simplify length computation
+    tmp_keys_.resize(num_keys);
+    for (size_t i = 0; i < num_keys; i++) {
+        tmp_keys_[i] = Slice(keys_.data() + start_[i], start_[i + 1] - start_[i]);
+    }
+    last_key_ = tmp_keys_[num_keys - 1].to_string();
+    result_.clear();
+    policy_->CreateFilter(&tmp_keys_[0], static_cast<int>(num_keys), &result_);
+
+    tmp_keys_.clear();
+    start_.clear();
+    return {result_};
+}
+
 FilterBlockReader::FilterBlockReader(const FilterPolicy* policy, const Slice& contents)
         : policy_(policy), data_(nullptr), offset_(nullptr), num_(0), base_lg_(0) {
     size_t n = contents.get_size();
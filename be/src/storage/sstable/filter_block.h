@@ -43,6 +43,44 @@ private:
     std::vector<uint32_t> filter_offsets_;
 };
 
+// A PartitionedFilterBlockBuilder splits the keys of a Table into partitions
+// of consecutive keys, and builds a filter for each partition.  The filters
+// are stored as separate blocks, located by an index block which maps the
+// last key of each partition to the handle of its filter, so that a reader
+// only loads the filters of the keys it looks up.
+//
+// The sequence of calls to PartitionedFilterBlockBuilder must match the regexp:
+//      (AddKey* FinishPartition)*
+class PartitionedFilterBlockBuilder {
+public:
+    PartitionedFilterBlockBuilder(const FilterPolicy*, size_t keys_per_partition);
+
+    PartitionedFilterBlockBuilder(const PartitionedFilterBlockBuilder&) = delete;
+    PartitionedFilterBlockBuilder& operator=(const PartitionedFilterBlockBuilder&) = delete;
+
+    void AddKey(const Slice& key);
+
+    // Return true iff the current partition has enough keys to be finished.
+    bool PartitionFull() const { return start_.size() >= keys_per_partition_; }
+    bool PartitionEmpty() const { return start_.empty(); }
+
+    // Build the filter of the current partition, and start a new one.  The
+    // returned slice and LastKey() remain valid until the next call to AddKey().
+    Slice FinishPartition();
+
+    // The last key of the last finished partition.
+    const std::string& LastKey() const { return last_key_; }
+
+private:
+    const FilterPolicy* policy_;
+    const size_t keys_per_partition_;
+    std::string keys_;          // Flattened key contents
+    std::vector<size_t> start_; // Starting index in keys_ of each key
+    std::string last_key_;
+    std::string result_;
+    std::vector<Slice> tmp_keys_;
+};
+
 class FilterBlockReader {
 public:
     // REQUIRES: "contents" and *policy must stay live while *this is live.
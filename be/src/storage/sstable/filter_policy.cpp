@@ -4,6 +4,11 @@
 
 #include "storage/sstable/filter_policy.h"
 
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "storage/sstable/coding.h"
 #include "util/murmur_hash3.h"
 #include "util/slice.h"
 
@@ -89,4 +94,151 @@ const FilterPolicy* NewBloomFilterPolicy(int bits_per_key) {
     return new BloomFilterPolicy(bits_per_key);
 }
 
+// The xor filter of "Xor Filters: Faster and Smaller Than Bloom and Cuckoo Filters" (JEA 2020), with 8-bit
+// fingerprints. It takes about 9.84 bits per key for a false positive rate of 0.39%, and a lookup reads
+// 3 bytes. The filter is stored as:
+//    fingerprints: uint8[3 * block_length]
+//    seed: fixed64
+//    block_length: fixed32
+class XorFilterPolicy : public FilterPolicy {
+public:
+    const char* Name() const override { return "starrocks.XorFilter8"; }
+
+    void CreateFilter(const Slice* keys, int n, std::string* dst) const override {
+        std::vector<uint64_t> hashes(n);
+        for (int i = 0; i < n; i++) {
+            hashes[i] = KeyHash(keys[i]);
+        }
+        // The keys of a table are unique, but their hashes may collide.
+        std::sort(hashes.begin(), hashes.end());
+        hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+        if (hashes.empty()) {
+            PutFixed64(dst, 0);
+            PutFixed32(dst, 0);
+            return;
+        }
+
+        const size_t size = hashes.size();
+        const uint32_t block_length = (32 + static_cast<size_t>(1.23 * size)) / 3;
+        const size_t capacity = 3 * block_length;
+        std::vector<uint64_t> xor_masks(capacity);
+        std::vector<uint32_t> counts(capacity);
+        std::vector<uint32_t> queue;
+        std::vector<std::pair<uint32_t, uint64_t>> stack;
+        uint64_t seed = 0x9E3779B97F4A7C15ULL;
+        for (int attempt = 0; attempt < kMaxAttempts; attempt++, seed = Mix(seed)) {
+            std::fill(xor_masks.begin(), xor_masks.end(), 0);
+            std::fill(counts.begin(), counts.end(), 0);
+            for (uint64_t hash : hashes) {
+                uint64_t h = Mix(hash + seed);
+                for (uint32_t slot : Slots(h, block_length)) {
+                    xor_masks[slot] ^= h;
+                    counts[slot]++;
+                }
+            }
+            // Peel the slots with a single key, until no slot is left.
+            queue.clear();
+            stack.clear();
+            for (uint32_t slot = 0; slot < capacity; slot++) {
+                if (counts[slot] == 1) {
+                    queue.push_back(slot);
+                }
+            }
+            while (!queue.empty()) {
+                uint32_t slot = queue.back();
+                queue.pop_back();
+                if (counts[slot] != 1) {
+                    continue;
+                }
+                uint64_t h = xor_masks[slot];
+                stack.emplace_back(slot, h);
+                for (uint32_t other : Slots(h, block_length)) {
+                    xor_masks[other] ^= h;
+                    if (--counts[other] == 1) {
+                        queue.push_back(other);
+                    }
+                }
+            }
+            if (stack.size() == size) {
+                break;
+            }
+        }
+        if (stack.size() != size) {
+            // Give up, and match all the keys.
+            PutFixed64(dst, 0);
+            PutFixed32(dst, kMatchAll);
+            return;
+        }
+
+        const size_t init_size = dst->size();
+        dst->resize(init_size + capacity, 0);
+        auto* fingerprints = reinterpret_cast<uint8_t*>(&(*dst)[init_size]);
+        for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
+            auto [slot, h] = *it;
+            auto slots = Slots(h, block_length);
+            // The fingerprint of the slot is still 0.
+            fingerprints[slot] =
+                    Fingerprint(h) ^ fingerprints[slots[0]] ^ fingerprints[slots[1]] ^ fingerprints[slots[2]];
+        }
+        PutFixed64(dst, seed);
+        PutFixed32(dst, block_length);
+    }
+
+    bool KeyMayMatch(const Slice& key, const Slice& filter) const override {
+        const size_t len = filter.get_size();
+        if (len < kTrailerSize) return false;
+        const char* data = filter.get_data();
+        const uint64_t seed = DecodeFixed64(data + len - kTrailerSize);
+        const uint32_t block_length = DecodeFixed32(data + len - sizeof(uint32_t));
+        if (block_length == kMatchAll) return true;
+        if (block_length == 0) return false;
+        if (len != 3 * static_cast<size_t>(block_length) + kTrailerSize) {
+            // Corrupted filter, consider it a match.
+            return true;
+        }
+        const auto* fingerprints = reinterpret_cast<const uint8_t*>(data);
+        uint64_t h = Mix(KeyHash(key) + seed);
+        auto slots = Slots(h, block_length);
+        return Fingerprint(h) == (fingerprints[slots[0]] ^ fingerprints[slots[1]] ^ fingerprints[slots[2]]);
+    }
+
+private:
+    static constexpr int kMaxAttempts = 64;
+    static constexpr size_t kTrailerSize = sizeof(uint64_t) + sizeof(uint32_t);
+    static constexpr uint32_t kMatchAll = UINT32_MAX;
+
+    static uint64_t KeyHash(const Slice& key) {
+        uint64_t hash = 0;
+        murmur_hash3_x64_64(key.get_data(), key.get_size(), 0, &hash);
+        return hash;
+    }
+
+    // The finalizer of murmur hash 3.
+    static uint64_t Mix(uint64_t h) {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    static uint8_t Fingerprint(uint64_t h) { return static_cast<uint8_t>(h ^ (h >> 32)); }
+
+    static uint32_t Reduce(uint32_t h, uint32_t n) {
+        return static_cast<uint32_t>((static_cast<uint64_t>(h) * n) >> 32);
+    }
+
+    // Each key has a slot in each of the three blocks.
+    static std::array<uint32_t, 3> Slots(uint64_t h, uint32_t block_length) {
+        return {Reduce(static_cast<uint32_t>(h), block_length),
+                Reduce(static_cast<uint32_t>((h << 21) | (h >> 43)), block_length) + block_length,
+                Reduce(static_cast<uint32_t>((h << 42) | (h >> 22)), block_length) + 2 * block_length};
+    }
+};
+
+const FilterPolicy* NewXorFilterPolicy() {
+    return new XorFilterPolicy();
+}
+
 } // namespace starrocks::sstable
\ No newline at end of file
@@ -53,5 +53,12 @@ public:
 // trailing spaces in keys.
 const FilterPolicy* NewBloomFilterPolicy(int bits_per_key);
 
+// Return a new filter policy that uses an xor filter with 8-bit fingerprints, which takes about
+// 9.84 bits per key for a false positive rate of about 0.39%, smaller and more accurate than a
+// bloom filter of 10 bits per key. The same caveat about custom comparators applies.
+//
+// Callers must delete the result after any table that is using the result has been closed.
+const FilterPolicy* NewXorFilterPolicy();
+
 } // namespace sstable
 } // namespace starrocks
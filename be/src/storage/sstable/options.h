@@ -5,9 +5,11 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 namespace starrocks {
 class Cache;
+class ThreadPool;
 
 namespace sstable {
 
@@ -92,6 +94,17 @@ struct Options {
     // Many applications will benefit from passing the result of
     // NewBloomFilterPolicy() here.
     const FilterPolicy* filter_policy = nullptr;
+
+    // Policies of the filters written by older versions, tried in order when
+    // opening a table which has no filter of filter_policy.
+    std::vector<const FilterPolicy*> fallback_filter_policies;
+
+    // If true, split the filter into partitions of filter_partition_keys
+    // consecutive keys, each stored as a separate block located by a filter
+    // index, so that a lookup only loads the filter partitions it needs
+    // instead of the filter of the whole table.
+    bool partition_filters = false;
+    size_t filter_partition_keys = 4096;
 };
 
 struct ReadIOStat {
@@ -123,6 +136,10 @@ struct ReadOptions {
     bool fill_cache = true;
 
     ReadIOStat* stat = nullptr;
+
+    // If non-null, the blocks missing in the block cache of a MultiGet
+    // are read in parallel by this pool.
+    ThreadPool* read_pool = nullptr;
 };
 
 // Options that control write operations
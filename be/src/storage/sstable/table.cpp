@@ -6,6 +6,8 @@
 
 #include <butil/time.h> // NOLINT
 
+#include <algorithm>
+
 #include "common/status.h"
 #include "fs/fs.h"
 #include "runtime/exec_env.h"
@@ -18,7 +20,10 @@
 #include "storage/sstable/options.h"
 #include "storage/sstable/two_level_iterator.h"
 #include "util/coding.h"
+#include "util/countdown_latch.h"
+#include "util/defer_op.h"
 #include "util/lru_cache.h"
+#include "util/threadpool.h"
 #include "util/trace.h"
 
 namespace starrocks::sstable {
@@ -27,6 +32,7 @@ struct Table::Rep {
     ~Rep() {
         delete filter;
         delete[] filter_data;
+        delete filter_index;
         delete index_block;
     }
 
@@ -37,6 +43,13 @@ struct Table::Rep {
     FilterBlockReader* filter;
     const char* filter_data;
 
+    // The policy of filter or filter_index, which may be one of
+    // options.fallback_filter_policies for a table written by an older version.
+    const FilterPolicy* filter_policy = nullptr;
+    // Index of the filter partitions, set instead of filter if the table
+    // has partitioned filters.
+    Block* filter_index = nullptr;
+
     BlockHandle metaindex_handle; // Handle to metaindex_block: saved from footer
     Block* index_block;
 };
@@ -107,11 +120,26 @@ void Table::ReadMeta(const Footer& footer) {
     Block* meta = new Block(contents);
 
     Iterator* iter = meta->NewIterator(BytewiseComparator());
-    std::string key = "filter.";
-    key.append(rep_->options.filter_policy->Name());
-    iter->Seek(key);
-    if (iter->Valid() && iter->key() == Slice(key)) {
-        ReadFilter(iter->value());
+    std::vector<const FilterPolicy*> policies{rep_->options.filter_policy};
+    policies.insert(policies.end(), rep_->options.fallback_filter_policies.begin(),
+                    rep_->options.fallback_filter_policies.end());
+    for (const FilterPolicy* policy : policies) {
+        std::string key = "partitionedfilter.";
+        key.append(policy->Name());
+        iter->Seek(key);
+        if (iter->Valid() && iter->key() == Slice(key)) {
+            rep_->filter_policy = policy;
+            ReadFilterIndex(iter->value());
+            break;
+        }
+        key = "filter.";
+        key.append(policy->Name());
+        iter->Seek(key);
+        if (iter->Valid() && iter->key() == Slice(key)) {
+            rep_->filter_policy = policy;
+            ReadFilter(iter->value());
+            break;
+        }
     }
     delete iter;
     delete meta;
@@ -137,7 +165,26 @@ void Table::ReadFilter(const Slice& filter_handle_value) {
     if (block.heap_allocated) {
         rep_->filter_data = block.data.get_data(); // Will need to delete later
     }
-    rep_->filter = new FilterBlockReader(rep_->options.filter_policy, block.data);
+    rep_->filter = new FilterBlockReader(rep_->filter_policy, block.data);
+}
+
+void Table::ReadFilterIndex(const Slice& filter_index_handle_value) {
+    Slice v = filter_index_handle_value;
+    BlockHandle filter_index_handle;
+    if (!filter_index_handle.DecodeFrom(&v).ok()) {
+        return;
+    }
+
+    ReadOptions opt;
+    if (rep_->options.paranoid_checks) {
+        opt.verify_checksums = true;
+    }
+    BlockContents block;
+    if (!ReadBlock(rep_->file, opt, filter_index_handle, &block).ok()) {
+        return;
+    }
+    // The filter partitions are read on demand by MultiGet
+    rep_->filter_index = new Block(block);
 }
 
 Table::~Table() {
@@ -159,6 +206,16 @@ static void ReleaseBlock(void* arg, void* h) {
     cache->release(handle);
 }
 
+static void DeleteCachedFilterPartition(const CacheKey& key, void* value) {
+    delete reinterpret_cast<std::string*>(value);
+}
+
+// Blocks are cached by the id of the table and their offsets in the file.
+static void EncodeCacheKey(uint64_t cache_id, uint64_t offset, char* buf) {
+    encode_fixed64_le(reinterpret_cast<uint8_t*>(buf), cache_id);
+    encode_fixed64_le(reinterpret_cast<uint8_t*>(buf + 8), offset);
+}
+
 // Convert an index iterator value (i.e., an encoded BlockHandle)
 // into an iterator over the contents of the corresponding block.
 Iterator* Table::BlockReader(void* arg, const ReadOptions& options, const Slice& index_value) {
@@ -177,8 +234,7 @@ Iterator* Table::BlockReader(void* arg, const ReadOptions& options, const Slice&
         BlockContents contents;
         if (block_cache != nullptr) {
             char cache_key_buffer[16];
-            encode_fixed64_le(reinterpret_cast<uint8_t*>(cache_key_buffer), table->rep_->cache_id);
-            encode_fixed64_le(reinterpret_cast<uint8_t*>(cache_key_buffer + 8), handle.offset());
+            EncodeCacheKey(table->rep_->cache_id, handle.offset(), cache_key_buffer);
             CacheKey key(cache_key_buffer, sizeof(cache_key_buffer));
             cache_handle = block_cache->lookup(key);
             if (cache_handle != nullptr) {
@@ -232,63 +288,279 @@ Iterator* Table::NewIterator(const ReadOptions& options) const {
                                const_cast<Table*>(this), options);
 }
 
-template <class ForwardIt>
-Status Table::MultiGet(const ReadOptions& options, const Slice* keys, ForwardIt begin, ForwardIt end,
-                       std::vector<std::string>* values) {
-    Status s;
-    Iterator* iiter = rep_->index_block->NewIterator(rep_->options.comparator);
-    std::unique_ptr<Iterator> current_block_itr_ptr;
-
-    // return true if find k
-    auto search_in_block = [](const Slice& k, std::string* value, Iterator* current_block_itr) -> StatusOr<bool> {
-        current_block_itr->Seek(k);
-        if (current_block_itr->Valid() && k == current_block_itr->key()) {
-            value->assign(current_block_itr->value().data, current_block_itr->value().size);
-            return true;
+namespace {
+
+// Reads the filter partitions of a table for keys looked up in sorted order,
+// keeping the partition of the last key.
+class FilterPartitionReader {
+public:
+    FilterPartitionReader(RandomAccessFile* file, Cache* block_cache, uint64_t cache_id, Block* filter_index,
+                          const FilterPolicy* policy, const Comparator* comparator, const ReadOptions& options)
+            : _file(file),
+              _block_cache(block_cache),
+              _cache_id(cache_id),
+              _index_iter(filter_index->NewIterator(comparator)),
+              _policy(policy),
+              _comparator(comparator),
+              _options(options) {}
+
+    ~FilterPartitionReader() { _release(); }
+
+    // REQUIRES: |key| is not less than the key of the last call.
+    StatusOr<bool> KeyMayMatch(const Slice& key) {
+        if (!_seeked || (_index_iter->Valid() && _comparator->Compare(key, _index_iter->key()) > 0)) {
+            _index_iter->Seek(key);
+            _seeked = true;
         }
-        if (!current_block_itr->status().ok()) {
-            return current_block_itr->status();
+        if (!_index_iter->Valid()) {
+            RETURN_IF_ERROR(_index_iter->status());
+            // After the last key of the table
+            return false;
         }
-        return false;
+        BlockHandle handle;
+        Slice v = _index_iter->value();
+        RETURN_IF_ERROR(handle.DecodeFrom(&v));
+        if (_data.get_data() == nullptr || handle.offset() != _offset) {
+            RETURN_IF_ERROR(_read_partition(handle));
+        }
+        return _policy->KeyMayMatch(key, _data);
+    }
+
+private:
+    Status _read_partition(const BlockHandle& handle) {
+        _release();
+        char cache_key_buffer[16];
+        EncodeCacheKey(_cache_id, handle.offset(), cache_key_buffer);
+        CacheKey key(cache_key_buffer, sizeof(cache_key_buffer));
+        if (_block_cache != nullptr) {
+            _cache_handle = _block_cache->lookup(key);
+        }
+        if (_cache_handle != nullptr) {
+            _data = Slice(*reinterpret_cast<std::string*>(_block_cache->value(_cache_handle)));
+            if (_options.stat != nullptr) {
+                _options.stat->block_cnt_from_cache++;
+            }
+            TRACE_COUNTER_INCREMENT("read_filter_hit_cache_cnt", 1);
+        } else {
+            BlockContents contents;
+            RETURN_IF_ERROR(ReadBlock(_file, _options, handle, &contents));
+            auto* partition = new std::string(contents.data.get_data(), contents.data.get_size());
+            if (contents.heap_allocated) {
+                delete[] contents.data.get_data();
+            }
+            if (_block_cache != nullptr && _options.fill_cache) {
+                _cache_handle = _block_cache->insert(key, partition, partition->size(), &DeleteCachedFilterPartition);
+            } else {
+                _owned.reset(partition);
+            }
+            _data = Slice(*partition);
+            if (_options.stat != nullptr) {
+                _options.stat->block_cnt_from_file++;
+            }
+            TRACE_COUNTER_INCREMENT("read_filter_miss_cache_cnt", 1);
+        }
+        _offset = handle.offset();
+        return Status::OK();
+    }
+
+    void _release() {
+        if (_cache_handle != nullptr) {
+            _block_cache->release(_cache_handle);
+            _cache_handle = nullptr;
+        }
+        _owned.reset();
+        _data = Slice();
+    }
+
+    RandomAccessFile* _file;
+    Cache* _block_cache;
+    uint64_t _cache_id;
+    std::unique_ptr<Iterator> _index_iter;
+    const FilterPolicy* _policy;
+    const Comparator* _comparator;
+    const ReadOptions& _options;
+    bool _seeked = false;
+
+    // The current partition, either pinned in the block cache or owned
+    uint64_t _offset = 0;
+    Cache::Handle* _cache_handle = nullptr;
+    std::unique_ptr<std::string> _owned;
+    Slice _data;
+};
+
+// A data block to read by MultiGet, and the range of the sorted keys to look up in it.
+struct BlockRead {
+    BlockHandle handle;
+    size_t keys_begin = 0;
+    size_t keys_end = 0;
+
+    Status status;
+    Block* block = nullptr;
+    Cache::Handle* cache_handle = nullptr;
+    ReadIOStat stat;
+};
+
+// Read the blocks of |reads|, the ones missing in |block_cache| are read in
+// parallel by options.read_pool if set.
+void ReadBlocks(RandomAccessFile* file, Cache* block_cache, uint64_t cache_id, const ReadOptions& options,
+                std::vector<BlockRead>* reads) {
+    std::vector<BlockRead*> misses;
+    for (auto& read : *reads) {
+        if (block_cache != nullptr) {
+            char cache_key_buffer[16];
+            EncodeCacheKey(cache_id, read.handle.offset(), cache_key_buffer);
+            read.cache_handle = block_cache->lookup(CacheKey(cache_key_buffer, sizeof(cache_key_buffer)));
+            if (read.cache_handle != nullptr) {
+                read.block = reinterpret_cast<Block*>(block_cache->value(read.cache_handle));
+                read.stat.block_cnt_from_cache++;
+                TRACE_COUNTER_INCREMENT("read_block_hit_cache_cnt", 1);
+                continue;
+            }
+        }
+        misses.push_back(&read);
+    }
+
+    auto read_block = [&](BlockRead* read) {
+        ReadOptions opts = options;
+        opts.stat = &read->stat;
+        BlockContents contents;
+        read->status = ReadBlock(file, opts, read->handle, &contents);
+        if (read->status.ok()) {
+            read->block = new Block(contents);
+            if (block_cache != nullptr && contents.cachable && options.fill_cache) {
+                char cache_key_buffer[16];
+                EncodeCacheKey(cache_id, read->handle.offset(), cache_key_buffer);
+                read->cache_handle = block_cache->insert(CacheKey(cache_key_buffer, sizeof(cache_key_buffer)),
+                                                         read->block, read->block->size(), &DeleteCachedBlock);
+            }
+        }
+        read->stat.block_cnt_from_file++;
     };
+    if (options.read_pool != nullptr && misses.size() > 1) {
+        CountDownLatch latch(static_cast<int>(misses.size()));
+        for (BlockRead* read : misses) {
+            Status st = options.read_pool->submit_func([&read_block, &latch, read]() {
+                read_block(read);
+                latch.count_down();
+            });
+            if (!st.ok()) {
+                // The pool is full or shut down, read it in this thread
+                read_block(read);
+                latch.count_down();
+            }
+        }
+        latch.wait();
+    } else {
+        for (BlockRead* read : misses) {
+            read_block(read);
+        }
+    }
+    TRACE_COUNTER_INCREMENT("read_block_miss_cache_cnt", misses.size());
+}
+
+} // namespace
 
+template <class ForwardIt>
+Status Table::MultiGet(const ReadOptions& options, const Slice* keys, ForwardIt begin, ForwardIt end,
+                       std::vector<std::string>* values) {
+    const Comparator* comparator = rep_->options.comparator;
+
+    // The keys and their positions in |values|, in the order of the comparator
+    std::vector<std::pair<Slice, size_t>> sorted_keys;
     size_t i = 0;
-    bool founded = false;
     for (auto it = begin; it != end; ++it, ++i) {
-        auto& k = keys[*it];
-        if (current_block_itr_ptr != nullptr && current_block_itr_ptr->Valid()) {
-            // keep searching current block
-            ASSIGN_OR_RETURN(founded, search_in_block(k, &(*values)[i], current_block_itr_ptr.get()));
-            if (founded) {
-                TRACE_COUNTER_INCREMENT("continue_block_read", 1);
-                continue;
-            } else {
-                current_block_itr_ptr.reset(nullptr);
-            }
+        sorted_keys.emplace_back(keys[*it], i);
+    }
+    std::sort(sorted_keys.begin(), sorted_keys.end(),
+              [comparator](const auto& a, const auto& b) { return comparator->Compare(a.first, b.first) < 0; });
+
+    std::unique_ptr<FilterPartitionReader> partitioned_filter;
+    if (rep_->filter_index != nullptr) {
+        partitioned_filter = std::make_unique<FilterPartitionReader>(rep_->file, rep_->options.block_cache,
+                                                                     rep_->cache_id, rep_->filter_index,
+                                                                     rep_->filter_policy, comparator, options);
+    }
+
+    // Find the data block of each key passing the filter, in a single pass over the
+    // index block.  The keys of a block are contiguous in |candidates|.
+    std::vector<std::pair<Slice, size_t>> candidates;
+    std::vector<BlockRead> reads;
+    std::unique_ptr<Iterator> iiter(rep_->index_block->NewIterator(comparator));
+    bool seeked = false;
+    for (const auto& key : sorted_keys) {
+        const Slice& k = key.first;
+        // The index key of a block is >= all keys in the block and < all keys
+        // in the subsequent blocks, so the current entry still covers |k| unless
+        // |k| is after its key.
+        if (!seeked || (iiter->Valid() && comparator->Compare(k, iiter->key()) > 0)) {
+            iiter->Seek(k);
+            seeked = true;
+        }
+        if (!iiter->Valid()) {
+            // The remaining keys are after the last block
+            break;
         }
-        iiter->Seek(k);
-        if (iiter->Valid()) {
-            Slice handle_value = iiter->value();
-            FilterBlockReader* filter = rep_->filter;
-            BlockHandle handle;
-            if (filter != nullptr && handle.DecodeFrom(&handle_value).ok() &&
-                !filter->KeyMayMatch(handle.offset(), k)) {
-                // Not found
-                TRACE_COUNTER_INCREMENT("sst_bloom_filter_rows", 1);
+        BlockHandle handle;
+        Slice handle_value = iiter->value();
+        RETURN_IF_ERROR(handle.DecodeFrom(&handle_value));
+        bool may_match = true;
+        if (partitioned_filter != nullptr) {
+            ASSIGN_OR_RETURN(may_match, partitioned_filter->KeyMayMatch(k));
+        } else if (rep_->filter != nullptr) {
+            may_match = rep_->filter->KeyMayMatch(handle.offset(), k);
+        }
+        if (!may_match) {
+            // Not found
+            TRACE_COUNTER_INCREMENT("sst_bloom_filter_rows", 1);
+            continue;
+        }
+        if (reads.empty() || reads.back().handle.offset() != handle.offset()) {
+            reads.emplace_back();
+            reads.back().handle = handle;
+            reads.back().keys_begin = candidates.size();
+        } else {
+            TRACE_COUNTER_INCREMENT("continue_block_read", 1);
+        }
+        candidates.push_back(key);
+        reads.back().keys_end = candidates.size();
+    }
+    RETURN_IF_ERROR(iiter->status());
+    partitioned_filter.reset();
+
+    DeferOp release_blocks([&]() {
+        for (auto& read : reads) {
+            if (read.cache_handle != nullptr) {
+                rep_->options.block_cache->release(read.cache_handle);
             } else {
-                auto start_ts = butil::gettimeofday_us();
-                current_block_itr_ptr.reset(BlockReader(this, options, iiter->value()));
-                auto end_ts = butil::gettimeofday_us();
-                TRACE_COUNTER_INCREMENT("read_block", end_ts - start_ts);
-                ASSIGN_OR_RETURN(founded, search_in_block(k, &(*values)[i], current_block_itr_ptr.get()));
+                delete read.block;
             }
         }
+    });
+    auto start_ts = butil::gettimeofday_us();
+    ReadBlocks(rep_->file, rep_->options.block_cache, rep_->cache_id, options, &reads);
+    auto end_ts = butil::gettimeofday_us();
+    TRACE_COUNTER_INCREMENT("read_block", end_ts - start_ts);
+
+    for (auto& read : reads) {
+        if (options.stat != nullptr) {
+            options.stat->bytes_from_file += read.stat.bytes_from_file;
+            options.stat->block_cnt_from_file += read.stat.block_cnt_from_file;
+            options.stat->block_cnt_from_cache += read.stat.block_cnt_from_cache;
+        }
     }
-    if (s.ok()) {
-        s = iiter->status();
+    for (auto& read : reads) {
+        RETURN_IF_ERROR(read.status);
+        std::unique_ptr<Iterator> block_iter(read.block->NewIterator(comparator));
+        for (size_t j = read.keys_begin; j < read.keys_end; j++) {
+            const auto& [k, pos] = candidates[j];
+            block_iter->Seek(k);
+            if (block_iter->Valid() && k == block_iter->key()) {
+                (*values)[pos].assign(block_iter->value().data, block_iter->value().size);
+            }
+            RETURN_IF_ERROR(block_iter->status());
+        }
     }
-    delete iiter;
-    return s;
+    return Status::OK();
 }
 
 // If new container wants to be supported in MultiGet, the initialization can be added here.
@@ -47,6 +47,10 @@ public:
 
     // Batch get keys within indexes iterator between begin to end.
     // If entry found, value of the corresponding index will be set.
+    //
+    // The keys are looked up in sorted order, so that each data block and
+    // filter partition is read at most once.  The data blocks missing in the
+    // block cache are read in parallel if options.read_pool is set.
     template <typename ForwardIt>
     Status MultiGet(const ReadOptions&, const Slice* keys, ForwardIt begin, ForwardIt end,
                     std::vector<std::string>* values);
@@ -60,6 +64,7 @@ private:
 
     void ReadMeta(const Footer& footer);
     void ReadFilter(const Slice& filter_handle_value);
+    void ReadFilterIndex(const Slice& filter_index_handle_value);
 
     Rep* const rep_;
 };
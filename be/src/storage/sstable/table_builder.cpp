@@ -27,8 +27,15 @@ struct TableBuilder::Rep {
               file(f),
               data_block(&options),
               index_block(&index_block_options),
-              filter_block(opt.filter_policy == nullptr ? nullptr : new FilterBlockBuilder(opt.filter_policy)) {
+              filter_index_block(&index_block_options) {
         index_block_options.block_restart_interval = 1;
+        if (opt.filter_policy != nullptr) {
+            if (opt.partition_filters) {
+                partitioned_filter = new PartitionedFilterBlockBuilder(opt.filter_policy, opt.filter_partition_keys);
+            } else {
+                filter_block = new FilterBlockBuilder(opt.filter_policy);
+            }
+        }
     }
 
     Options options;
@@ -41,7 +48,13 @@ struct TableBuilder::Rep {
     std::string last_key;
     int64_t num_entries{0};
     bool closed{false}; // Either Finish() or Abandon() has been called.
-    FilterBlockBuilder* filter_block;
+    FilterBlockBuilder* filter_block{nullptr};
+
+    // Used instead of filter_block if options.partition_filters is true.
+    // filter_index_block maps the last key of each filter partition to the
+    // handle of its filter.
+    PartitionedFilterBlockBuilder* partitioned_filter{nullptr};
+    BlockBuilder filter_index_block;
 
     // We do not emit the index entry for a block until we have seen the
     // first key for the next data block.  This allows us to use shorter
@@ -67,6 +80,7 @@ TableBuilder::TableBuilder(const Options& options, WritableFile* file) : rep_(ne
 TableBuilder::~TableBuilder() {
     assert(rep_->closed); // Catch errors where caller forgot to call Finish()
     delete rep_->filter_block;
+    delete rep_->partitioned_filter;
     delete rep_;
 }
 
@@ -105,6 +119,11 @@ void TableBuilder::Add(const Slice& key, const Slice& value) {
 
     if (r->filter_block != nullptr) {
         r->filter_block->AddKey(key);
+    } else if (r->partitioned_filter != nullptr) {
+        r->partitioned_filter->AddKey(key);
+        if (r->partitioned_filter->PartitionFull()) {
+            WriteFilterPartition();
+        }
     }
 
     r->last_key.assign(key.get_data(), key.get_size());
@@ -196,6 +215,18 @@ void TableBuilder::WriteRawBlock(const Slice& block_contents, CompressionType ty
     }
 }
 
+void TableBuilder::WriteFilterPartition() {
+    Rep* r = rep_;
+    if (!ok()) return;
+    BlockHandle handle;
+    WriteRawBlock(r->partitioned_filter->FinishPartition(), kNoCompression, &handle);
+    if (ok()) {
+        std::string handle_encoding;
+        handle.EncodeTo(&handle_encoding);
+        r->filter_index_block.Add(r->partitioned_filter->LastKey(), Slice(handle_encoding));
+    }
+}
+
 Status TableBuilder::status() const {
     return rep_->status;
 }
@@ -213,6 +244,16 @@ Status TableBuilder::Finish() {
         WriteRawBlock(r->filter_block->Finish(), kNoCompression, &filter_block_handle);
     }
 
+    // Write the last filter partition and the filter index block
+    if (ok() && r->partitioned_filter != nullptr) {
+        if (!r->partitioned_filter->PartitionEmpty()) {
+            WriteFilterPartition();
+        }
+        if (ok()) {
+            WriteBlock(&r->filter_index_block, &filter_block_handle);
+        }
+    }
+
     // Write metaindex block
     if (ok()) {
         BlockBuilder meta_index_block(&r->options);
@@ -223,6 +264,13 @@ Status TableBuilder::Finish() {
             std::string handle_encoding;
             filter_block_handle.EncodeTo(&handle_encoding);
             meta_index_block.Add(key, handle_encoding);
+        } else if (r->partitioned_filter != nullptr) {
+            // Add mapping from "partitionedfilter.Name" to location of filter index
+            std::string key = "partitionedfilter.";
+            key.append(r->options.filter_policy->Name());
+            std::string handle_encoding;
+            filter_block_handle.EncodeTo(&handle_encoding);
+            meta_index_block.Add(key, handle_encoding);
         }
 
         // TODO(postrelease): Add stats and other meta blocks
@@ -78,6 +78,7 @@ private:
     bool ok() const { return status().ok(); }
     void WriteBlock(BlockBuilder* block, BlockHandle* handle);
     void WriteRawBlock(const Slice& data, CompressionType, BlockHandle* handle);
+    void WriteFilterPartition();
 
     struct Rep;
     Rep* rep_;
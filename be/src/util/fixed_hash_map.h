@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
@@ -23,9 +24,12 @@
 #include <optional>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "column/column_hash.h"
 #include "glog/logging.h"
+#include "util/phmap/phmap.h"
+#include "util/phmap/phmap_dump.h"
 namespace starrocks {
 
 // FixedSizeHashMap
@@ -202,4 +206,247 @@ private:
     uint8_t _hash_table[hash_table_size + 1];
 };
 
+// The range of the keys mapped to an array by RangeDirectMappingHashMap/RangeDirectMappingHashSet, that is
+// [base, base + size). The range starts with the first key and is doubled on demand to cover the new keys,
+// as long as it spans at most max_size keys.
+struct DirectMappingRange {
+    static constexpr size_t kMinSize = 256;
+
+    int64_t base = 0;
+    size_t size = 0;
+    size_t max_size = 1 << 16;
+
+    // Return the index of |key| in the array, or size if |key| is out of the range.
+    size_t index(int64_t key) const {
+        auto offset = static_cast<uint64_t>(key - base);
+        return offset < size ? offset : size;
+    }
+
+    // Return the range extended to cover |key|, or false if it would span more than max_size keys.
+    bool extend(int64_t key, DirectMappingRange* extended) const {
+        int64_t lo = size == 0 ? key : std::min(base, key);
+        int64_t hi = size == 0 ? key : std::max(base + static_cast<int64_t>(size) - 1, key);
+        auto span = static_cast<size_t>(hi - lo + 1);
+        if (span > max_size) {
+            return false;
+        }
+        extended->size = std::min(max_size, std::max({span, size * 2, kMinSize}));
+        // Leave the spare slots on the side the keys grow to.
+        extended->base = size != 0 && key < base ? hi - static_cast<int64_t>(extended->size) + 1 : lo;
+        extended->max_size = max_size;
+        return true;
+    }
+
+    // Move the elements of |slots| in this range to their places in |extended|.
+    template <typename T>
+    std::vector<T> relocate(const std::vector<T>& slots, const DirectMappingRange& extended) const {
+        std::vector<T> relocated(extended.size, T());
+        std::copy(slots.begin(), slots.end(), relocated.begin() + (base - extended.base));
+        return relocated;
+    }
+};
+
+// A map of small integer keys, which stores the values of the keys in a DirectMappingRange in an array
+// indexed by key - base instead of hashing them, e.g. the codes of a global dictionary or the values of a
+// SMALLINT column. The other keys go to a hash table, and the range is never extended once the hash table
+// is not empty, so that a key is either in the array or in the hash table.
+// value shouldn't be nullptr
+template <typename KeyType, typename ValueType, PhmapSeed seed>
+class RangeDirectMappingHashMap {
+public:
+    static_assert(std::is_integral_v<KeyType> && sizeof(KeyType) <= sizeof(int32_t));
+    static_assert(std::is_pointer_v<ValueType>);
+
+    using key_type = KeyType;
+    using HashTable = phmap::flat_hash_map<KeyType, ValueType, StdHashWithSeed<KeyType, seed>>;
+
+    struct PPair {
+        using Cell = std::pair<KeyType, ValueType>;
+        PPair(KeyType key, ValueType value) : _data(key, value) {}
+        Cell _data;
+        Cell* operator->() { return &_data; }
+    };
+
+    class iterator {
+    public:
+        iterator(KeyType key, ValueType* value) : _key(key), _value(value) {}
+
+        PPair operator->() const { return {_key, *_value}; }
+
+        friend bool operator==(const iterator& a, const iterator& b) { return a._value == b._value; }
+        friend bool operator!=(const iterator& a, const iterator& b) { return !(a == b); }
+
+    private:
+        KeyType _key;
+        ValueType* _value;
+    };
+
+    void set_max_slots(size_t max_slots) { _range.max_size = max_slots; }
+
+    template <class F>
+    iterator lazy_emplace(KeyType key, F&& f) {
+        if (ValueType* slot = _find_or_extend_slot(key); slot != nullptr) {
+            return _emplace_slot(key, slot, std::forward<F>(f));
+        }
+        auto iter = _hash_table.lazy_emplace(key, std::forward<F>(f));
+        return iterator(key, &iter->second);
+    }
+
+    template <class F>
+    iterator lazy_emplace_with_hash(KeyType key, size_t& hashval, F&& f) {
+        if (ValueType* slot = _find_or_extend_slot(key); slot != nullptr) {
+            return _emplace_slot(key, slot, std::forward<F>(f));
+        }
+        auto iter = _hash_table.lazy_emplace_with_hash(key, hashval, std::forward<F>(f));
+        return iterator(key, &iter->second);
+    }
+
+    iterator find(KeyType key) {
+        if (size_t index = _range.index(key); index < _slots.size()) {
+            return _slots[index] == nullptr ? end() : iterator(key, &_slots[index]);
+        }
+        auto iter = _hash_table.find(key);
+        return iter == _hash_table.end() ? end() : iterator(key, &iter->second);
+    }
+
+    iterator end() { return iterator(0, nullptr); }
+
+    void prefetch_hash(size_t hashval) const { _hash_table.prefetch_hash(hashval); }
+
+    auto hash_function() const { return _hash_table.hash_function(); }
+
+    // Only the keys in the hash table are worth prefetching.
+    size_t bucket_count() const { return _hash_table.bucket_count(); }
+
+    size_t size() const { return _num_slots_used + _hash_table.size(); }
+
+    size_t capacity() const { return _slots.size() + _hash_table.capacity(); }
+
+    size_t dump_bound() const { return _slots.size() * sizeof(ValueType) + _hash_table.dump_bound(); }
+
+private:
+    ValueType* _find_or_extend_slot(KeyType key) {
+        size_t index = _range.index(key);
+        if (index == _slots.size()) {
+            DirectMappingRange extended;
+            if (!_hash_table.empty() || !_range.extend(key, &extended)) {
+                return nullptr;
+            }
+            _slots = _range.relocate(_slots, extended);
+            _range = extended;
+            index = _range.index(key);
+        }
+        return &_slots[index];
+    }
+
+    template <class F>
+    iterator _emplace_slot(KeyType key, ValueType* slot, F&& f) {
+        if (*slot == nullptr) {
+            f([&](KeyType key, ValueType value) {
+                DCHECK(value != nullptr);
+                *slot = value;
+            });
+            _num_slots_used++;
+        }
+        return iterator(key, slot);
+    }
+
+    DirectMappingRange _range;
+    std::vector<ValueType> _slots;
+    size_t _num_slots_used = 0;
+    HashTable _hash_table;
+};
+
+// The set version of RangeDirectMappingHashMap.
+template <typename KeyType, PhmapSeed seed>
+class RangeDirectMappingHashSet {
+public:
+    static_assert(std::is_integral_v<KeyType> && sizeof(KeyType) <= sizeof(int32_t));
+
+    using key_type = KeyType;
+    using HashTable = phmap::flat_hash_set<KeyType, StdHashWithSeed<KeyType, seed>>;
+
+    // Iterate the keys in the array, then the keys in the hash table.
+    class iterator {
+    public:
+        iterator(const RangeDirectMappingHashSet* set, size_t index, typename HashTable::const_iterator hash_iter)
+                : _set(set), _index(index), _hash_iter(hash_iter) {}
+
+        KeyType operator*() const {
+            return _index < _set->_slots.size() ? static_cast<KeyType>(_set->_range.base + _index) : *_hash_iter;
+        }
+
+        iterator& operator++() {
+            if (_index < _set->_slots.size()) {
+                _index++;
+                skip_empty_value();
+            } else {
+                ++_hash_iter;
+            }
+            return *this;
+        }
+
+        void skip_empty_value() {
+            while (_index < _set->_slots.size() && _set->_slots[_index] == 0) {
+                ++_index;
+            }
+        }
+
+        friend bool operator==(const iterator& a, const iterator& b) {
+            return a._index == b._index && a._hash_iter == b._hash_iter;
+        }
+        friend bool operator!=(const iterator& a, const iterator& b) { return !(a == b); }
+
+    private:
+        const RangeDirectMappingHashSet* _set;
+        size_t _index;
+        typename HashTable::const_iterator _hash_iter;
+    };
+
+    void set_max_slots(size_t max_slots) { _range.max_size = max_slots; }
+
+    iterator begin() const {
+        auto iter = iterator(this, 0, _hash_table.begin());
+        iter.skip_empty_value();
+        return iter;
+    }
+
+    iterator end() const { return iterator(this, _slots.size(), _hash_table.end()); }
+
+    void emplace(KeyType key) {
+        size_t index = _range.index(key);
+        if (index == _slots.size()) {
+            DirectMappingRange extended;
+            if (!_hash_table.empty() || !_range.extend(key, &extended)) {
+                _hash_table.emplace(key);
+                return;
+            }
+            _slots = _range.relocate(_slots, extended);
+            _range = extended;
+            index = _range.index(key);
+        }
+        _num_slots_used += _slots[index] == 0;
+        _slots[index] = 1;
+    }
+
+    bool contains(KeyType key) const {
+        if (size_t index = _range.index(key); index < _slots.size()) {
+            return _slots[index];
+        }
+        return _hash_table.contains(key);
+    }
+
+    size_t dump_bound() const { return _slots.size() + _hash_table.dump_bound(); }
+
+    size_t size() const { return _num_slots_used + _hash_table.size(); }
+
+    size_t capacity() const { return _slots.size() + _hash_table.capacity(); }
+
+private:
+    DirectMappingRange _range;
+    std::vector<uint8_t> _slots;
+    size_t _num_slots_used = 0;
+    HashTable _hash_table;
+};
+
 } // namespace starrocks
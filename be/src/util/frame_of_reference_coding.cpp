@@ -36,6 +36,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <type_traits>
 
 #include "util/bit_util.h"
 #include "util/coding.h"
@@ -368,6 +369,26 @@ T ForDecoder<T>::decode_frame_min_value(uint32_t frame_index) {
     return min;
 }
 
+template <typename T>
+bool ForDecoder<T>::frame_value_range(uint32_t frame_index, T* min, T* max) {
+    if constexpr (!std::is_integral_v<T> || sizeof(T) > sizeof(int64_t)) {
+        return false;
+    } else {
+        if (_storage_formats[frame_index] == 2) {
+            return false;
+        }
+        *min = decode_frame_min_value(frame_index);
+        // The deltas are from the min value, or from the previous value if the frame is ascending.
+        __int128 max_delta = (static_cast<__int128>(1) << _bit_widths[frame_index]) - 1;
+        if (_storage_formats[frame_index] == 1) {
+            max_delta *= frame_size(frame_index) - 1;
+        }
+        __int128 upper = static_cast<__int128>(*min) + max_delta;
+        *max = static_cast<T>(std::min<__int128>(upper, std::numeric_limits<T>::max()));
+        return true;
+    }
+}
+
 template <typename T>
 T* ForDecoder<T>::copy_value(T* val, size_t count) {
     memcpy(val, &_out_buffer[_current_index % _max_frame_size], sizeof(T) * count);
@@ -414,7 +435,8 @@ bool ForDecoder<T>::get_batch(T* val, size_t count) {
 
 template <typename T>
 bool ForDecoder<T>::skip(int32_t skip_num) {
-    if (_current_index + skip_num >= _values_num || _current_index + skip_num < 0) {
+    // Skipping to the end is allowed, so that the decoder stays in sync with the position of the page.
+    if (_current_index + skip_num > _values_num || _current_index + skip_num < 0) {
         return false;
     }
     _current_index = _current_index + skip_num;
@@ -163,6 +163,12 @@ public:
 
     uint32_t count() const { return _values_num; }
 
+    uint32_t max_frame_size() const { return _max_frame_size; }
+
+    // Compute the bounds of the values in frame |frame_index| from the frame header, without decoding
+    // the frame. Return false if the bounds are unknown, e.g. the frame stores the original values.
+    bool frame_value_range(uint32_t frame_index, T* min, T* max);
+
 private:
     void bit_unpack(const uint8_t* input, uint8_t in_num, int bit_width, T* output);
 
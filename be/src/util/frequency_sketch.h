@@ -0,0 +1,91 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace starrocks {
+
+// A count-min sketch estimating how often a key is seen recently, as used by TinyLFU, see
+// "TinyLFU: A Highly Efficient Cache Admission Policy" (TOS 2017). Each key is counted by one
+// saturating counter in each of kDepth rows, and its frequency is the minimum of them. All the
+// counters are halved once the number of increments reaches kSampleFactor times of the width, so
+// that the old occurrences fade out.
+//
+// Not thread-safe.
+class FrequencySketch {
+public:
+    static constexpr uint32_t kMaxFrequency = 15;
+
+    explicit FrequencySketch(size_t width) { resize(width); }
+
+    // Reset the sketch to |width| counters per row, rounded up to a power of 2.
+    void resize(size_t width) {
+        size_t n = 1;
+        while (n < width) {
+            n <<= 1;
+        }
+        _mask = n - 1;
+        _counters.assign(kDepth * n, 0);
+        _additions = 0;
+    }
+
+    size_t width() const { return _mask + 1; }
+
+    // Record an occurrence of the key of |hash|.
+    void increment(uint64_t hash) {
+        for (int row = 0; row < kDepth; row++) {
+            uint8_t& counter = _counters[row * width() + _index(hash, row)];
+            if (counter < kMaxFrequency) {
+                counter++;
+            }
+        }
+        if (++_additions >= kSampleFactor * width()) {
+            for (uint8_t& counter : _counters) {
+                counter >>= 1;
+            }
+            _additions /= 2;
+        }
+    }
+
+    // Return the estimated number of occurrences of the key of |hash|, at most kMaxFrequency.
+    uint32_t frequency(uint64_t hash) const {
+        uint32_t freq = kMaxFrequency;
+        for (int row = 0; row < kDepth; row++) {
+            freq = std::min<uint32_t>(freq, _counters[row * width() + _index(hash, row)]);
+        }
+        return freq;
+    }
+
+private:
+    static constexpr int kDepth = 4;
+    static constexpr size_t kSampleFactor = 10;
+    static constexpr uint64_t kSeeds[kDepth] = {0x9E3779B97F4A7C15ULL, 0xC2B2AE3D27D4EB4FULL, 0x165667B19E3779F9ULL,
+                                                0xD6E8FEB86659FD93ULL};
+
+    size_t _index(uint64_t hash, int row) const {
+        uint64_t h = (hash + kSeeds[row]) * kSeeds[row];
+        return (h ^ (h >> 32)) & _mask;
+    }
+
+    std::vector<uint8_t> _counters;
+    size_t _mask = 0;
+    size_t _additions = 0;
+};
+
+} // namespace starrocks
@@ -6,12 +6,14 @@
 
 #include <rapidjson/document.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <sstream>
 #include <string>
 
 #include "storage/olap_common.h"
+#include "util/frequency_sketch.h"
 
 using std::string;
 using std::stringstream;
@@ -150,10 +152,335 @@ bool HandleTable::_resize() {
     return true;
 }
 
-LRUCache::LRUCache() {
+static void list_remove(LRUHandle* e) {
+    e->next->prev = e->prev;
+    e->prev->next = e->next;
+    e->prev = e->next = nullptr;
+}
+
+static void list_append(LRUHandle* list, LRUHandle* e) {
+    // Make "e" newest entry by inserting just before *list
+    e->next = list;
+    e->prev = list->prev;
+    e->prev->next = e;
+    e->next->prev = e;
+}
+
+static void list_init(LRUHandle* list) {
+    list->next = list;
+    list->prev = list;
+}
+
+static bool list_empty(const LRUHandle* list) {
+    return list->next == list;
+}
+
+// The eviction policy of a LRUCache shard, which orders the evictable entries of NORMAL priority, i.e. the
+// entries in cache that are not referenced by any handle. An entry is added when it becomes evictable, and
+// removed when it's referenced again, erased or evicted. All the methods are called with the shard mutex held.
+class CachePolicy {
+public:
+    virtual ~CachePolicy() = default;
+
+    virtual void set_capacity(size_t capacity) {}
+
+    // |e| is inserted into the cache.
+    virtual void on_insert(LRUHandle* e) {}
+
+    // |e| is found by a lookup.
+    virtual void on_hit(LRUHandle* e) {}
+
+    // |e| is removed from the cache, by erase, replacement or eviction.
+    virtual void on_leave(LRUHandle* e) {}
+
+    virtual void add(LRUHandle* e) = 0;
+
+    virtual void remove(LRUHandle* e) { list_remove(e); }
+
+    // Remove and return the entry to evict next, or nullptr if there is no evictable entry.
+    virtual LRUHandle* pop_victim() = 0;
+};
+
+namespace {
+
+class LruPolicy final : public CachePolicy {
+public:
+    LruPolicy() { list_init(&_lru); }
+
+    void add(LRUHandle* e) override { list_append(&_lru, e); }
+
+    LRUHandle* pop_victim() override {
+        if (list_empty(&_lru)) {
+            return nullptr;
+        }
+        LRUHandle* e = _lru.next;
+        list_remove(e);
+        return e;
+    }
+
+private:
+    // Dummy head of LRU list.
+    // lru.prev is newest entry, lru.next is oldest entry.
+    LRUHandle _lru;
+};
+
+// Entries are moved between the queues when they become evictable, i.e. the position of an entry is
+// refreshed when the handles referencing it are released, instead of staying put on hits like in the paper.
+class S3FifoPolicy final : public CachePolicy {
+public:
+    S3FifoPolicy() {
+        list_init(&_small);
+        list_init(&_main);
+    }
+
+    void set_capacity(size_t capacity) override { _small_capacity = capacity / 10; }
+
+    void on_insert(LRUHandle* e) override {
+        e->freq = 0;
+        if (_remove_ghost(e->hash)) {
+            e->queue = kMain;
+        } else {
+            e->queue = kSmall;
+            _small_charge += e->charge;
+        }
+        _num_entries++;
+    }
+
+    void on_hit(LRUHandle* e) override {
+        if (e->freq < kMaxFreq) {
+            e->freq++;
+        }
+    }
+
+    void on_leave(LRUHandle* e) override {
+        if (e->queue == kSmall) {
+            _small_charge -= e->charge;
+        }
+        _num_entries--;
+    }
+
+    void add(LRUHandle* e) override { list_append(e->queue == kSmall ? &_small : &_main, e); }
+
+    LRUHandle* pop_victim() override {
+        while (true) {
+            if (!list_empty(&_small) && (_small_charge > _small_capacity || list_empty(&_main))) {
+                LRUHandle* e = _small.next;
+                list_remove(e);
+                if (e->freq > 0) {
+                    // Accessed again in the small queue, move it to the main queue.
+                    e->queue = kMain;
+                    e->freq = 0;
+                    _small_charge -= e->charge;
+                    list_append(&_main, e);
+                    continue;
+                }
+                _add_ghost(e->hash);
+                return e;
+            }
+            if (list_empty(&_main)) {
+                return nullptr;
+            }
+            LRUHandle* e = _main.next;
+            list_remove(e);
+            if (e->freq > 0) {
+                // Reinsert it with a lower frequency, like the CLOCK.
+                e->freq--;
+                list_append(&_main, e);
+                continue;
+            }
+            return e;
+        }
+    }
+
+private:
+    static constexpr uint8_t kSmall = 0;
+    static constexpr uint8_t kMain = 1;
+    static constexpr uint8_t kMaxFreq = 3;
+    static constexpr size_t kMinGhostSize = 64;
+
+    // The ghost queue remembers the hashes of the last entries evicted from the small queue, as many as the
+    // entries in cache. It's a direct-mapped table of twice the size, where a hash is in the ghost queue if
+    // it's in its slot and evicted within the last _num_entries evictions, and colliding hashes overwrite
+    // each other.
+    void _add_ghost(uint32_t hash) {
+        if (_ghost.size() < 2 * _num_entries) {
+            size_t size = std::max<size_t>(_ghost.size(), kMinGhostSize);
+            while (size < 2 * _num_entries) {
+                size *= 2;
+            }
+            _ghost.assign(size, {0, 0});
+        }
+        _ghost[hash & (_ghost.size() - 1)] = {hash, ++_ghost_seq};
+    }
+
+    bool _remove_ghost(uint32_t hash) {
+        if (_ghost.empty()) {
+            return false;
+        }
+        auto& slot = _ghost[hash & (_ghost.size() - 1)];
+        if (slot.second == 0 || slot.first != hash || _ghost_seq - slot.second >= _num_entries) {
+            return false;
+        }
+        slot = {0, 0};
+        return true;
+    }
+
+    size_t _small_capacity{0};
+    size_t _small_charge{0};
+    size_t _num_entries{0};
+    // Dummy heads of the FIFO queues, head.next is the oldest entry.
+    LRUHandle _small;
+    LRUHandle _main;
+    // The slots of the ghost queue, (hash, sequence of the eviction), the sequence starts from 1.
+    std::vector<std::pair<uint32_t, uint64_t>> _ghost;
+    uint64_t _ghost_seq{0};
+};
+
+class WTinyLfuPolicy final : public CachePolicy {
+public:
+    WTinyLfuPolicy() : _sketch(kMinSketchWidth) {
+        list_init(&_window);
+        list_init(&_probation);
+        list_init(&_protected);
+    }
+
+    // 1% of the capacity for the window, and 80% of the rest for the protected segment, as the paper suggests.
+    void set_capacity(size_t capacity) override {
+        _window_capacity = capacity / 100;
+        _main_capacity = capacity - _window_capacity;
+        _protected_capacity = _main_capacity / 10 * 8;
+    }
+
+    void on_insert(LRUHandle* e) override {
+        e->queue = kWindow;
+        _window_charge += e->charge;
+        // The sketch needs at least as many counters per row as the entries in cache to tell the frequent
+        // ones, it's reset on resizing, which happens only a few times while the cache fills up.
+        if (++_num_entries > _sketch.width() && _sketch.width() < kMaxSketchWidth) {
+            _sketch.resize(_sketch.width() * 4);
+        }
+        _sketch.increment(e->hash);
+    }
+
+    void on_hit(LRUHandle* e) override {
+        _sketch.increment(e->hash);
+        if (e->queue == kProbation) {
+            e->queue = kProtected;
+            _protected_charge += e->charge;
+            // Demote the least recently used entries of the protected segment.
+            while (_protected_charge > _protected_capacity && !list_empty(&_protected)) {
+                LRUHandle* old = _protected.next;
+                list_remove(old);
+                old->queue = kProbation;
+                _protected_charge -= old->charge;
+                list_append(&_probation, old);
+            }
+        }
+    }
+
+    void on_leave(LRUHandle* e) override {
+        if (e->queue == kWindow) {
+            _window_charge -= e->charge;
+        } else {
+            _main_charge -= e->charge;
+            if (e->queue == kProtected) {
+                _protected_charge -= e->charge;
+            }
+        }
+        _num_entries--;
+    }
+
+    void add(LRUHandle* e) override { list_append(_list_of(e->queue), e); }
+
+    LRUHandle* pop_victim() override {
+        while (_window_charge > _window_capacity && !list_empty(&_window)) {
+            LRUHandle* candidate = _window.next;
+            if (_main_charge + candidate->charge <= _main_capacity) {
+                list_remove(candidate);
+                _move_to_probation(candidate);
+                continue;
+            }
+            LRUHandle* victim = !list_empty(&_probation) ? _probation.next : _protected.next;
+            if (victim == &_protected) {
+                break;
+            }
+            // The candidate from the window is admitted only if it's more frequent than the victim.
+            list_remove(candidate);
+            if (_sketch.frequency(candidate->hash) > _sketch.frequency(victim->hash)) {
+                _move_to_probation(candidate);
+                list_remove(victim);
+                return victim;
+            }
+            return candidate;
+        }
+        for (LRUHandle* list : {&_probation, &_protected, &_window}) {
+            if (!list_empty(list)) {
+                LRUHandle* e = list->next;
+                list_remove(e);
+                return e;
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    static constexpr uint8_t kWindow = 0;
+    static constexpr uint8_t kProbation = 1;
+    static constexpr uint8_t kProtected = 2;
+    static constexpr size_t kMinSketchWidth = 1024;
+    static constexpr size_t kMaxSketchWidth = 1 << 20;
+
+    LRUHandle* _list_of(uint8_t queue) {
+        switch (queue) {
+        case kWindow:
+            return &_window;
+        case kProbation:
+            return &_probation;
+        default:
+            return &_protected;
+        }
+    }
+
+    void _move_to_probation(LRUHandle* e) {
+        e->queue = kProbation;
+        _window_charge -= e->charge;
+        _main_charge += e->charge;
+        list_append(&_probation, e);
+    }
+
+    size_t _window_capacity{0};
+    size_t _main_capacity{0};
+    size_t _protected_capacity{0};
+    size_t _window_charge{0};
+    // The charge of the main segmented LRU, i.e. the probation and protected segments.
+    size_t _main_charge{0};
+    size_t _protected_charge{0};
+    size_t _num_entries{0};
+    // Dummy heads of LRU lists, head.next is the least recently used entry.
+    LRUHandle _window;
+    LRUHandle _probation;
+    LRUHandle _protected;
+    FrequencySketch _sketch;
+};
+
+} // namespace
+
+bool parse_cache_eviction_policy(std::string_view name, CacheEvictionPolicy* policy) {
+    if (name == "lru") {
+        *policy = CacheEvictionPolicy::LRU;
+    } else if (name == "s3fifo") {
+        *policy = CacheEvictionPolicy::S3FIFO;
+    } else if (name == "wtinylfu") {
+        *policy = CacheEvictionPolicy::WTINYLFU;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+LRUCache::LRUCache() : _policy(std::make_unique<LruPolicy>()) {
     // Make empty circular linked list
-    _lru.next = &_lru;
-    _lru.prev = &_lru;
+    list_init(&_durable);
 }
 
 LRUCache::~LRUCache() noexcept {
@@ -166,18 +493,27 @@ bool LRUCache::_unref(LRUHandle* e) {
     return e->refs == 0;
 }
 
-void LRUCache::_lru_remove(LRUHandle* e) {
-    e->next->prev = e->prev;
-    e->prev->next = e->next;
-    e->prev = e->next = nullptr;
+void LRUCache::_add_evictable(LRUHandle* e) {
+    if (e->priority == CachePriority::DURABLE) {
+        list_append(&_durable, e);
+    } else {
+        _policy->add(e);
+    }
 }
 
-void LRUCache::_lru_append(LRUHandle* list, LRUHandle* e) {
-    // Make "e" newest entry by inserting just before *list
-    e->next = list;
-    e->prev = list->prev;
-    e->prev->next = e;
-    e->next->prev = e;
+void LRUCache::_remove_evictable(LRUHandle* e) {
+    if (e->priority == CachePriority::DURABLE) {
+        list_remove(e);
+    } else {
+        _policy->remove(e);
+    }
+}
+
+void LRUCache::_leave_cache(LRUHandle* e) {
+    e->in_cache = false;
+    if (e->priority == CachePriority::NORMAL) {
+        _policy->on_leave(e);
+    }
 }
 
 void LRUCache::set_capacity(size_t capacity) {
@@ -185,7 +521,8 @@ void LRUCache::set_capacity(size_t capacity) {
     {
         std::lock_guard l(_mutex);
         _capacity = capacity;
-        _evict_from_lru(0, &last_ref_list);
+        _policy->set_capacity(capacity);
+        _evict(0, &last_ref_list);
     }
 
     for (auto entry : last_ref_list) {
@@ -197,6 +534,23 @@ void LRUCache::set_charge_mode(ChargeMode charge_mode) {
     _charge_mode = charge_mode;
 }
 
+void LRUCache::set_eviction_policy(CacheEvictionPolicy policy) {
+    std::lock_guard l(_mutex);
+    DCHECK_EQ(0, _usage);
+    switch (policy) {
+    case CacheEvictionPolicy::S3FIFO:
+        _policy = std::make_unique<S3FifoPolicy>();
+        break;
+    case CacheEvictionPolicy::WTINYLFU:
+        _policy = std::make_unique<WTinyLfuPolicy>();
+        break;
+    default:
+        _policy = std::make_unique<LruPolicy>();
+        break;
+    }
+    _policy->set_capacity(_capacity);
+}
+
 uint64_t LRUCache::get_lookup_count() const {
     std::lock_guard l(_mutex);
     return _lookup_count;
@@ -225,11 +579,14 @@ Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
         // we get it from _table, so in_cache must be true
         DCHECK(e->in_cache);
         if (e->refs == 1) {
-            // only in LRU free list, remove it from list
-            _lru_remove(e);
+            // only in evictable list, remove it from list
+            _remove_evictable(e);
         }
         e->refs++;
         ++_hit_count;
+        if (e->priority == CachePriority::NORMAL) {
+            _policy->on_hit(e);
+        }
     }
     return reinterpret_cast<Cache::Handle*>(e);
 }
@@ -250,13 +607,13 @@ void LRUCache::release(Cache::Handle* handle) {
             if (_usage > _capacity) {
                 // take this opportunity and remove the item
                 _table.remove(e->key(), e->hash);
-                e->in_cache = false;
+                _leave_cache(e);
                 _unref(e);
                 _usage -= e->charge;
                 last_ref = true;
             } else {
-                // put it to LRU free list
-                _lru_append(&_lru, e);
+                // put it to evictable list
+                _add_evictable(e);
             }
         }
     }
@@ -267,33 +624,28 @@ void LRUCache::release(Cache::Handle* handle) {
     }
 }
 
-void LRUCache::_evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted) {
-    LRUHandle* cur = &_lru;
-    // 1. evict normal cache entries
-    while (_usage + charge > _capacity && cur->next != &_lru) {
-        LRUHandle* old = cur->next;
-        if (old->priority == CachePriority::DURABLE) {
-            cur = cur->next;
-            continue;
+void LRUCache::_evict(size_t charge, std::vector<LRUHandle*>* deleted) {
+    while (_usage + charge > _capacity) {
+        // 1. evict normal cache entries
+        LRUHandle* old = _policy->pop_victim();
+        // 2. evict durable cache entries if need
+        if (old == nullptr) {
+            if (list_empty(&_durable)) {
+                break;
+            }
+            old = _durable.next;
+            list_remove(old);
         }
         _evict_one_entry(old);
         deleted->push_back(old);
     }
-    // 2. evict durable cache entries if need
-    while (_usage + charge > _capacity && _lru.next != &_lru) {
-        LRUHandle* old = _lru.next;
-        DCHECK(old->priority == CachePriority::DURABLE);
-        _evict_one_entry(old);
-        deleted->push_back(old);
-    }
 }
 
 void LRUCache::_evict_one_entry(LRUHandle* e) {
     DCHECK(e->in_cache);
-    DCHECK(e->refs == 1); // LRU list contains elements which may be evicted
-    _lru_remove(e);
+    DCHECK(e->refs == 1); // evictable list contains elements which may be evicted
     _table.remove(e->key(), e->hash);
-    e->in_cache = false;
+    _leave_cache(e);
     _unref(e);
     _usage -= e->charge;
 }
@@ -312,14 +664,22 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     e->in_cache = true;
     e->priority = priority;
     e->value_size = value_size;
+    e->queue = 0;
+    e->freq = 0;
     memcpy(e->key_data, key.data(), key.size());
     std::vector<LRUHandle*> last_ref_list;
     {
         std::lock_guard l(_mutex);
 
-        // Free the space following strict LRU policy until enough space
-        // is freed or the lru list is empty
-        _evict_from_lru(charge, &last_ref_list);
+        // The policy knows the new entry before choosing the entries to evict,
+        // e.g. W-TinyLFU compares it with the entries in cache
+        if (priority == CachePriority::NORMAL) {
+            _policy->on_insert(e);
+        }
+
+        // Free the space following the eviction policy until enough space
+        // is freed or there is no evictable entry
+        _evict(charge, &last_ref_list);
 
         // insert into the cache
         // note that the cache might get larger than its capacity if not enough
@@ -327,12 +687,12 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
         auto old = _table.insert(e);
         _usage += charge;
         if (old != nullptr) {
-            old->in_cache = false;
+            _leave_cache(old);
             if (_unref(old)) {
                 _usage -= old->charge;
-                // old is on LRU because it's in cache and its reference count
+                // old is evictable because it's in cache and its reference count
                 // was just 1 (Unref returned 0)
-                _lru_remove(old);
+                _remove_evictable(old);
                 last_ref_list.push_back(old);
             }
         }
@@ -358,11 +718,11 @@ void LRUCache::erase(const CacheKey& key, uint32_t hash) {
             if (last_ref) {
                 _usage -= e->charge;
                 if (e->in_cache) {
-                    // locate in free list
-                    _lru_remove(e);
+                    // locate in evictable list
+                    _remove_evictable(e);
                 }
             }
-            e->in_cache = false;
+            _leave_cache(e);
         }
     }
     // free handle out of mutex, when last_ref is true, e must not be nullptr
@@ -375,15 +735,15 @@ int LRUCache::prune() {
     std::vector<LRUHandle*> last_ref_list;
     {
         std::lock_guard l(_mutex);
-        while (_lru.next != &_lru) {
-            LRUHandle* old = _lru.next;
-            DCHECK(old->in_cache);
-            DCHECK(old->refs == 1); // LRU list contains elements which may be evicted
-            _lru_remove(old);
-            _table.remove(old->key(), old->hash);
-            old->in_cache = false;
-            _unref(old);
-            _usage -= old->charge;
+        LRUHandle* old = nullptr;
+        while ((old = _policy->pop_victim()) != nullptr) {
+            _evict_one_entry(old);
+            last_ref_list.push_back(old);
+        }
+        while (!list_empty(&_durable)) {
+            old = _durable.next;
+            list_remove(old);
+            _evict_one_entry(old);
             last_ref_list.push_back(old);
         }
     }
@@ -401,10 +761,11 @@ uint32_t ShardedLRUCache::_shard(uint32_t hash) {
     return hash >> (32 - kNumShardBits);
 }
 
-ShardedLRUCache::ShardedLRUCache(size_t capacity, ChargeMode charge_mode)
+ShardedLRUCache::ShardedLRUCache(size_t capacity, ChargeMode charge_mode, CacheEvictionPolicy policy)
         : _last_id(0), _capacity(capacity), _charge_mode(charge_mode) {
     const size_t per_shard = (_capacity + (kNumShards - 1)) / kNumShards;
     for (auto& _shard : _shards) {
+        _shard.set_eviction_policy(policy);
         _shard.set_capacity(per_shard);
         _shard.set_charge_mode(_charge_mode);
     }
@@ -536,8 +897,8 @@ void ShardedLRUCache::get_cache_status(rapidjson::Document* document) {
     }
 }
 
-Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode) {
-    return new ShardedLRUCache(capacity, charge_mode);
+Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode, CacheEvictionPolicy policy) {
+    return new ShardedLRUCache(capacity, charge_mode, policy);
 }
 
 } // namespace starrocks
@@ -8,6 +8,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <string_view>
@@ -19,6 +20,7 @@ namespace starrocks {
 
 class Cache;
 class CacheKey;
+class CachePolicy;
 
 enum class ChargeMode {
     // use value size as charge
@@ -27,9 +29,26 @@ enum class ChargeMode {
     MEMSIZE = 1
 };
 
+enum class CacheEvictionPolicy {
+    // Least recently used.
+    LRU = 0,
+    // S3-FIFO, see "FIFO queues are all you need for cache eviction" (SOSP 2023). New entries go to a
+    // small FIFO queue, and only the ones accessed again before leaving it move to the main FIFO queue,
+    // so entries accessed only once, e.g. by a large scan, do not flush the main queue.
+    S3FIFO = 1,
+    // W-TinyLFU, see "TinyLFU: A Highly Efficient Cache Admission Policy" (TOS 2017). New entries go to
+    // a small LRU window, and enter the main segmented LRU only if they are accessed more often recently
+    // than the entry they would evict, which is estimated by a count-min sketch.
+    WTINYLFU = 2
+};
+
+// Parse the policy from its name: "lru", "s3fifo" or "wtinylfu". Return false if the name is unknown.
+bool parse_cache_eviction_policy(std::string_view name, CacheEvictionPolicy* policy);
+
 // Create a new cache with a fixed size capacity.  This implementation
-// of Cache uses a least-recently-used eviction policy.
-extern Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE);
+// of Cache uses a least-recently-used eviction policy by default.
+extern Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE,
+                            CacheEvictionPolicy policy = CacheEvictionPolicy::LRU);
 
 class CacheKey {
 public:
@@ -214,6 +233,8 @@ typedef struct LRUHandle {
     uint32_t hash; // Hash of key(); used for fast sharding and comparisons
     CachePriority priority = CachePriority::NORMAL;
     size_t value_size;
+    uint8_t queue;    // The queue of CachePolicy holding this entry
+    uint8_t freq;     // The access frequency kept by CachePolicy
     char key_data[1]; // Beginning of key
 
     CacheKey key() const {
@@ -276,6 +297,9 @@ public:
 
     void set_charge_mode(ChargeMode charge_mode);
 
+    // Must be called before any entry is inserted, the policy is LRU by default.
+    void set_eviction_policy(CacheEvictionPolicy policy);
+
     // Like Cache methods, but with an extra "hash" parameter.
     Cache::Handle* insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
                           void (*deleter)(const CacheKey& key, void* value),
@@ -291,10 +315,13 @@ public:
     size_t get_capacity() const;
 
 private:
-    void _lru_remove(LRUHandle* e);
-    void _lru_append(LRUHandle* list, LRUHandle* e);
     bool _unref(LRUHandle* e);
-    void _evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted);
+    // An entry is evictable if it's in cache and not referenced by any handle.
+    void _add_evictable(LRUHandle* e);
+    void _remove_evictable(LRUHandle* e);
+    // Called when the entry |e| in cache is removed from _table.
+    void _leave_cache(LRUHandle* e);
+    void _evict(size_t charge, std::vector<LRUHandle*>* deleted);
     void _evict_one_entry(LRUHandle* e);
 
     // Initialized before use.
@@ -306,10 +333,14 @@ private:
     mutable std::mutex _mutex;
     size_t _usage{0};
 
-    // Dummy head of LRU list.
-    // lru.prev is newest entry, lru.next is oldest entry.
+    // Orders the evictable entries of NORMAL priority.
+    std::unique_ptr<CachePolicy> _policy;
+
+    // Dummy head of LRU list of the evictable entries of DURABLE priority, which are evicted
+    // only if there is no evictable entry of NORMAL priority.
+    // durable.prev is newest entry, durable.next is oldest entry.
     // Entries have refs==1 and in_cache==true.
-    LRUHandle _lru;
+    LRUHandle _durable;
 
     HandleTable _table;
 
@@ -322,7 +353,8 @@ static const int kNumShards = 1 << kNumShardBits;
 
 class ShardedLRUCache : public Cache {
 public:
-    explicit ShardedLRUCache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE);
+    explicit ShardedLRUCache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE,
+                             CacheEvictionPolicy policy = CacheEvictionPolicy::LRU);
     ~ShardedLRUCache() override = default;
     Handle* insert(const CacheKey& key, void* value, size_t charge, void (*deleter)(const CacheKey& key, void* value),
                    CachePriority priority = CachePriority::NORMAL, size_t value_size = 0) override;
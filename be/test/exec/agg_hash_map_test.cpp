@@ -17,6 +17,8 @@
 #include <gtest/gtest.h>
 
 #include <any>
+#include <map>
+#include <set>
 
 #include "column/column_helper.h"
 #include "column/datum.h"
@@ -175,6 +177,69 @@ TEST(HashMapTest, TwoLevelConvert) {
     }
 }
 
+TEST(HashMapTest, DirectMapping) {
+    Int32DirectMappingAggHashMap<PhmapSeed1> hash_map;
+    hash_map.set_max_slots(1024);
+    std::vector<uint8_t> states(4096);
+    std::map<int32_t, AggDataPtr> expected;
+    auto emplace = [&](int32_t key) {
+        AggDataPtr value = states.data() + expected.size();
+        auto iter = hash_map.lazy_emplace(key, [&](const auto& ctor) {
+            ctor(key, value);
+            expected[key] = value;
+        });
+        ASSERT_EQ(expected[key], iter->second);
+    };
+
+    // The range grows up and down to cover the keys.
+    for (int32_t key = 500; key < 800; key++) {
+        emplace(key);
+    }
+    for (int32_t key = 499; key >= 0; key--) {
+        emplace(key);
+    }
+    ASSERT_EQ(0, hash_map.bucket_count());
+    // Out of max_slots, these keys are hashed, and the range is not extended any more.
+    emplace(-1000000);
+    emplace(1000000);
+    emplace(1100);
+    ASSERT_GT(hash_map.bucket_count(), 0);
+    for (int32_t key = 0; key < 1200; key++) {
+        emplace(key);
+    }
+    ASSERT_EQ(expected.size(), hash_map.size());
+    ASSERT_GE(hash_map.capacity(), expected.size());
+
+    for (auto [key, value] : expected) {
+        auto iter = hash_map.find(key);
+        ASSERT_TRUE(iter != hash_map.end());
+        ASSERT_EQ(value, iter->second);
+    }
+    ASSERT_TRUE(hash_map.find(-1) == hash_map.end());
+    ASSERT_TRUE(hash_map.find(5000) == hash_map.end());
+}
+
+TEST(HashSetTest, DirectMapping) {
+    Int16DirectMappingAggHashSet<PhmapSeed2> hash_set;
+    hash_set.set_max_slots(1024);
+    std::set<int16_t> expected;
+    for (int16_t key : {100, 3, -20, 3, 700, 30000, -30000, 200, 100}) {
+        hash_set.emplace(key);
+        expected.insert(key);
+    }
+    ASSERT_EQ(expected.size(), hash_set.size());
+    std::set<int16_t> keys;
+    for (auto iter = hash_set.begin(); iter != hash_set.end(); ++iter) {
+        ASSERT_TRUE(keys.insert(*iter).second);
+    }
+    ASSERT_EQ(expected, keys);
+    for (int16_t key : expected) {
+        ASSERT_TRUE(hash_set.contains(key));
+    }
+    ASSERT_FALSE(hash_set.contains(4));
+    ASSERT_FALSE(hash_set.contains(20000));
+}
+
 class AggHashMapKeyNotFoundsTest : public ::testing::Test {
 public:
     template <typename HashMapWithKey>
@@ -304,6 +369,16 @@ TEST_F(AggHashMapKeyNotFoundsTest, TestAllocateAndComputeNonFounds_NullInt32AggH
     TestAggHashMapKeyWithIntType<TestAggHashMapKey>(true);
 }
 
+TEST_F(AggHashMapKeyNotFoundsTest, TestAllocateAndComputeNonFounds_Int32DirectMappingAggHashMapWithOneNumberKey) {
+    using TestAggHashMapKey = Int32DirectMappingAggHashMapWithOneNumberKey<PhmapSeed1>;
+    TestAggHashMapKeyWithIntType<TestAggHashMapKey>(false);
+}
+
+TEST_F(AggHashMapKeyNotFoundsTest, TestAllocateAndComputeNonFounds_NullInt32DirectMappingAggHashMapWithOneNumberKey) {
+    using TestAggHashMapKey = NullInt32DirectMappingAggHashMapWithOneNumberKey<PhmapSeed2>;
+    TestAggHashMapKeyWithIntType<TestAggHashMapKey>(true);
+}
+
 TEST_F(AggHashMapKeyNotFoundsTest, TestAllocateAndComputeNonFounds_OneStringAggHashMap) {
     using TestAggHashMapKey = OneStringAggHashMap<PhmapSeed1>;
     TestAggHashMapKeyWithStringType<TestAggHashMapKey>(false);
@@ -0,0 +1,212 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/aggregator.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "simd/simd.h"
+#include "testutil/assert.h"
+#include "testutil/column_test_helper.h"
+#include "testutil/desc_tbl_helper.h"
+#include "testutil/exprs_test_helper.h"
+#include "testutil/scoped_updater.h"
+
+namespace starrocks {
+
+// Runs `select k, sum(v), count(v), min(v), max(v) group by k` through the Aggregator with the states of the
+// aggregate functions kept in columns (enable_agg_columnar_states) and in the rows, the results must be the same.
+class AggregatorTest : public testing::Test {
+public:
+    void SetUp() override {
+        _runtime_state = _obj_pool.add(new RuntimeState(TUniqueId(), TQueryOptions(), TQueryGlobals(), nullptr));
+        _runtime_profile = _runtime_state->runtime_profile();
+
+        // The update phase reads v from c1, the merge phase reads the intermediate states from c1...c4.
+        std::vector<SlotTypeInfoArray> slot_infos = {
+                // input slots
+                {{"k", TYPE_INT, true},
+                 {"c1", TYPE_BIGINT, false},
+                 {"c2", TYPE_BIGINT, false},
+                 {"c3", TYPE_BIGINT, false},
+                 {"c4", TYPE_BIGINT, false}},
+                // intermediate slots
+                {{"k", TYPE_INT, true},
+                 {"sum", TYPE_BIGINT, false},
+                 {"count", TYPE_BIGINT, false},
+                 {"min", TYPE_BIGINT, false},
+                 {"max", TYPE_BIGINT, false}},
+                // output slots
+                {{"k", TYPE_INT, true},
+                 {"sum", TYPE_BIGINT, false},
+                 {"count", TYPE_BIGINT, false},
+                 {"min", TYPE_BIGINT, false},
+                 {"max", TYPE_BIGINT, false}},
+        };
+        auto* desc_tbl = DescTblHelper::generate_desc_tbl(
+                _runtime_state, _obj_pool, DescTblHelper::create_slot_type_desc_info_arrays(slot_infos));
+        _runtime_state->set_desc_tbl(desc_tbl);
+    }
+
+protected:
+    std::shared_ptr<Aggregator> _create_aggregator(bool is_merge, bool needs_finalize, int64_t limit) {
+        auto bigint_type = ExprsTestHelper::create_scalar_type_desc(TPrimitiveType::BIGINT);
+        auto int_type = ExprsTestHelper::create_scalar_type_desc(TPrimitiveType::INT);
+
+        auto params = std::make_shared<AggregatorParams>();
+        params->needs_finalize = needs_finalize;
+        params->has_outer_join_child = false;
+        params->streaming_preaggregation_mode = TStreamingPreaggregationMode::AUTO;
+        params->intermediate_tuple_id = 1;
+        params->output_tuple_id = 2;
+        params->count_agg_idx = 0;
+        params->sql_grouping_keys = "";
+        params->sql_aggregate_functions = "";
+        params->conjuncts = {};
+        params->is_testing = true;
+        params->is_append_only = false;
+        params->is_generate_retract = false;
+        params->grouping_exprs = {
+                ExprsTestHelper::create_slot_expr(ExprsTestHelper::create_slot_expr_node(0, 0, int_type, true))};
+        params->intermediate_aggr_exprs = {};
+
+        const std::vector<std::string> fn_names = {"sum", "count", "min", "max"};
+        for (size_t i = 0; i < fn_names.size(); i++) {
+            SlotId slot_id = is_merge ? 1 + i : 1;
+            auto child = ExprsTestHelper::create_slot_expr_node(0, slot_id, bigint_type, false);
+            auto fn = ExprsTestHelper::create_builtin_function(fn_names[i], {bigint_type}, bigint_type, bigint_type);
+            auto agg_expr = ExprsTestHelper::create_aggregate_expr(fn, {child});
+            agg_expr.nodes[0].agg_expr.is_merge_agg = is_merge;
+            params->aggregate_functions.emplace_back(std::move(agg_expr));
+        }
+        params->limit = limit;
+        params->enable_pipeline_share_limit = false;
+        params->init();
+
+        auto aggregator = std::make_shared<Aggregator>(std::move(params));
+        CHECK(aggregator->prepare(_runtime_state, &_obj_pool, _runtime_profile).ok());
+        CHECK(aggregator->open(_runtime_state).ok());
+        return aggregator;
+    }
+
+    static ChunkPtr _create_chunk(const std::vector<int32_t>& keys, const std::vector<uint8_t>& key_nulls,
+                                  const std::vector<std::vector<int64_t>>& values) {
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(ColumnTestHelper::build_nullable_column(keys, key_nulls), 0);
+        for (size_t i = 0; i < values.size(); i++) {
+            chunk->append_column(ColumnTestHelper::build_column(values[i]), 1 + i);
+        }
+        return chunk;
+    }
+
+    // Aggregate the chunks like AggregateBlockingSinkOperator::push_chunk.
+    static void _push_chunks(Aggregator* aggregator, const std::vector<ChunkPtr>& chunks, bool with_limit) {
+        for (const auto& chunk : chunks) {
+            size_t chunk_size = chunk->num_rows();
+            ASSERT_OK(aggregator->evaluate_groupby_exprs(chunk.get()));
+            aggregator->build_hash_map(chunk_size, with_limit);
+            aggregator->try_convert_to_two_level_map();
+            if (with_limit && SIMD::count_zero(aggregator->streaming_selection().data(), chunk_size) != chunk_size) {
+                ASSERT_OK(aggregator->compute_batch_agg_states_with_selection(chunk.get(), chunk_size));
+            } else {
+                ASSERT_OK(aggregator->compute_batch_agg_states(chunk.get(), chunk_size));
+            }
+            aggregator->update_num_input_rows(chunk_size);
+        }
+    }
+
+    // The output rows sorted, since the order of the groups depends on the hash table.
+    std::vector<std::string> _pull_rows(Aggregator* aggregator) {
+        aggregator->hash_map_variant().visit(
+                [&](auto& hash_map_with_key) { aggregator->it_hash() = aggregator->_state_allocator.begin(); });
+        std::vector<std::string> rows;
+        while (!aggregator->is_ht_eos()) {
+            ChunkPtr chunk;
+            CHECK(aggregator->convert_hash_map_to_chunk(_runtime_state->chunk_size(), &chunk).ok());
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                rows.emplace_back(chunk->debug_row(i));
+            }
+        }
+        std::sort(rows.begin(), rows.end());
+        return rows;
+    }
+
+    // Run |fn| with the columnar states disabled and enabled, the rows of both must be |expected|.
+    template <typename Fn>
+    void _check_with_and_without_columnar_states(const std::vector<std::string>& expected, Fn&& fn) {
+        for (bool enable_columnar_states : {false, true}) {
+            SCOPED_UPDATE(bool, config::enable_agg_columnar_states, enable_columnar_states);
+            ASSERT_EQ(expected, fn()) << "enable_agg_columnar_states=" << enable_columnar_states;
+        }
+    }
+
+    ObjectPool _obj_pool;
+    RuntimeState* _runtime_state = nullptr;
+    RuntimeProfile* _runtime_profile = nullptr;
+};
+
+TEST_F(AggregatorTest, group_by_nullable_key) {
+    _check_with_and_without_columnar_states({"[1, 9, 3, 1, 5]", "[2, 7, 2, 2, 5]", "[NULL, 16, 2, 6, 10]"}, [&]() {
+        auto aggregator = _create_aggregator(false, true, -1);
+        auto chunk1 = _create_chunk({1, 2, 0, 1}, {0, 0, 1, 0}, {{1, 2, 6, 3}});
+        auto chunk2 = _create_chunk({2, 0, 1}, {0, 1, 0}, {{5, 10, 5}});
+        _push_chunks(aggregator.get(), {chunk1, chunk2}, false);
+        return _pull_rows(aggregator.get());
+    });
+}
+
+// Once the aggregation reaches its limit, the rows of the new non-null keys are not aggregated, the columnar
+// states update them into the discard group which must not show up in the results. The null key is still
+// created on its first row.
+TEST_F(AggregatorTest, group_by_with_limit) {
+    std::vector<std::string> expected = {"[1, 11, 2, 1, 10]", "[2, 2, 1, 2, 2]", "[NULL, 1000, 1, 1000, 1000]"};
+    _check_with_and_without_columnar_states(expected, [&]() {
+        auto aggregator = _create_aggregator(false, true, 2);
+        auto chunk1 = _create_chunk({1, 2}, {0, 0}, {{1, 2}});
+        auto chunk2 = _create_chunk({3, 1, 0, 4}, {0, 0, 1, 0}, {{100, 10, 1000, 10000}});
+        _push_chunks(aggregator.get(), {chunk1, chunk2}, true);
+        return _pull_rows(aggregator.get());
+    });
+}
+
+// The states are reset when the aggregator is reused, e.g. by the streaming aggregation once the hash table
+// is output, or by the query cache. Only the rows pushed after the reset are aggregated.
+TEST_F(AggregatorTest, reset_state) {
+    _check_with_and_without_columnar_states({"[1, 4, 1, 4, 4]", "[3, 5, 1, 5, 5]", "[NULL, 6, 1, 6, 6]"}, [&]() {
+        auto aggregator = _create_aggregator(false, true, -1);
+        _push_chunks(aggregator.get(), {_create_chunk({1, 2, 0}, {0, 0, 1}, {{1, 2, 3}})}, false);
+        CHECK(aggregator->reset_state(_runtime_state, {}, nullptr, false).ok());
+        _push_chunks(aggregator.get(), {_create_chunk({1, 3, 0}, {0, 0, 1}, {{4, 5, 6}})}, false);
+        return _pull_rows(aggregator.get());
+    });
+}
+
+// The second phase merges the serialized states of the first phase and serializes its states again.
+TEST_F(AggregatorTest, merge_intermediate_states) {
+    _check_with_and_without_columnar_states({"[1, 10, 5, -2, 7]", "[2, 4, 1, 4, 4]", "[NULL, 9, 4, 0, 8]"}, [&]() {
+        auto aggregator = _create_aggregator(true, false, -1);
+        // k, sum, count, min, max
+        auto chunk1 = _create_chunk({1, 0, 2}, {0, 1, 0}, {{3, 1, 4}, {2, 1, 1}, {1, 1, 4}, {2, 1, 4}});
+        auto chunk2 = _create_chunk({1, 0}, {0, 1}, {{7, 8}, {3, 3}, {-2, 0}, {7, 8}});
+        _push_chunks(aggregator.get(), {chunk1, chunk2}, false);
+        return _pull_rows(aggregator.get());
+    });
+}
+
+} // namespace starrocks
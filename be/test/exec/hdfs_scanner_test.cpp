@@ -1612,6 +1612,70 @@ TEST_F(HdfsScannerTest, TestParquetRuntimeFilter) {
     }
 }
 
+TEST_F(HdfsScannerTest, TestParquetUpdatedRuntimeFilter) {
+    SlotDesc parquet_descs[] = {{"c1", TypeDescriptor::from_logical_type(LogicalType::TYPE_BIGINT)},
+                                {"c2", TypeDescriptor::from_logical_type(LogicalType::TYPE_BIGINT)},
+                                {"c3", TypeDescriptor::from_logical_type(LogicalType::TYPE_VARCHAR, 22)},
+                                {""}};
+
+    const std::string parquet_file = "./be/test/exec/test_data/parquet_scanner/small_row_group_data.parquet";
+
+    auto* range = _create_scan_range(parquet_file, 0, 0);
+    auto* tuple_desc = _create_tuple_desc(parquet_descs);
+    auto* param = _create_param(parquet_file, range, tuple_desc);
+
+    auto scanner = std::make_shared<HdfsParquetScanner>();
+    RuntimeFilterProbeCollector rf_collector;
+    RuntimeFilterProbeDescriptor rf_probe_desc;
+    ColumnRef c1ref(tuple_desc->slots()[0]);
+    ExprContext probe_expr_ctx(&c1ref);
+    ASSERT_OK(probe_expr_ctx.prepare(_runtime_state));
+    ASSERT_OK(probe_expr_ctx.open(_runtime_state));
+
+    // A runtime filter covering all the rows, like the one of a TopN before its top rows are found.
+    JoinRuntimeFilter* f = RuntimeFilterHelper::create_join_runtime_filter(&_pool, LogicalType::TYPE_BIGINT);
+    f->init(10);
+    ColumnPtr column = ColumnHelper::create_column(tuple_desc->slots()[0]->type(), false);
+    auto c = ColumnHelper::cast_to_raw<LogicalType::TYPE_BIGINT>(column);
+    c->append(-10);
+    c->append(10000000);
+    ASSERT_OK(RuntimeFilterHelper::fill_runtime_bloom_filter(column, LogicalType::TYPE_BIGINT, f, 0, false));
+    ASSERT_OK(rf_probe_desc.init(0, &probe_expr_ctx));
+    rf_probe_desc.set_runtime_filter(f);
+    rf_collector.add_descriptor(&rf_probe_desc);
+    param->runtime_filter_collector = &rf_collector;
+
+    ASSERT_OK(scanner->init(_runtime_state, *param));
+    ASSERT_OK(scanner->open(_runtime_state));
+
+    ChunkPtr chunk = ChunkHelper::new_chunk(*tuple_desc, 0);
+    ASSERT_OK(scanner->get_next(_runtime_state, &chunk));
+    uint64_t records = chunk->num_rows();
+    ASSERT_GT(records, 0);
+
+    // Tighten the runtime filter to exclude all the rows, the row groups not read yet are skipped.
+    down_cast<RuntimeBloomFilter<LogicalType::TYPE_BIGINT>*>(f)->update_min_max<false>(-10);
+    Status status;
+    for (;;) {
+        chunk->reset();
+        status = scanner->get_next(_runtime_state, &chunk);
+        if (!status.ok() && !status.is_end_of_file()) {
+            break;
+        }
+        records += chunk->num_rows();
+        if (status.is_end_of_file()) {
+            break;
+        }
+    }
+    ASSERT_TRUE(status.is_end_of_file()) << status.message();
+    // At most the row group being read and the one prepared next, 5120 rows per row group.
+    EXPECT_GE(records, 5120);
+    EXPECT_LE(records, 2 * 5120);
+
+    scanner->close();
+    probe_expr_ctx.close(_runtime_state);
+}
+
 // =============================================================================
 
 /*
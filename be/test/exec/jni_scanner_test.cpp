@@ -16,8 +16,13 @@
 
 #include <gtest/gtest.h>
 
+#include <condition_variable>
+#include <thread>
+
 #include "runtime/descriptor_helper.h"
 #include "runtime/runtime_state.h"
+#include "storage/chunk_helper.h"
+#include "testutil/assert.h"
 #include "util/thrift_util.h"
 
 namespace starrocks {
@@ -416,4 +421,147 @@ TEST_F(JniScannerTest, test_create_odps_jni_scanner) {
     check_jni_scanner_params(scanner->_jni_scanner_params, expected);
 }
 
+// Fill the chunks without the java scanner, to test the prefetch of JniScanner.
+class PrefetchTestJniScanner final : public JniScanner {
+public:
+    PrefetchTestJniScanner(RuntimeState* state, int32_t num_chunks, size_t prefetch_capacity)
+            : JniScanner("", {}), _num_chunks(num_chunks) {
+        _runtime_state = state;
+        _mor_processor = std::make_shared<DefaultMORProcessor>();
+        _prefetch_capacity = prefetch_capacity;
+    }
+
+    Status _fill_chunk_sync(ChunkPtr* chunk, const std::vector<SlotDescriptor*>& slot_desc_list,
+                            HdfsScanStats* stats) override {
+        {
+            std::unique_lock<std::mutex> l(_mutex);
+            _cv.wait(l, [this] { return !_blocked; });
+            if (std::this_thread::get_id() != _scan_thread_id) {
+                _num_prefetched++;
+            }
+        }
+        if (_num_filled >= _num_chunks) {
+            return Status::EndOfFile("");
+        }
+        int32_t value = _num_filled++;
+        for (SlotDescriptor* slot_desc : slot_desc_list) {
+            (*chunk)->get_column_by_slot_id(slot_desc->id())->append_datum(Datum(value));
+        }
+        stats->raw_rows_read += 1;
+        stats->io_count += 1;
+        return Status::OK();
+    }
+
+    void block() {
+        std::lock_guard<std::mutex> l(_mutex);
+        _blocked = true;
+    }
+
+    void unblock() {
+        std::lock_guard<std::mutex> l(_mutex);
+        _blocked = false;
+        _cv.notify_all();
+    }
+
+    int32_t num_prefetched() {
+        std::lock_guard<std::mutex> l(_mutex);
+        return _num_prefetched;
+    }
+
+    const HdfsScanStats& app_stats() const { return _app_stats; }
+
+private:
+    const int32_t _num_chunks;
+    const std::thread::id _scan_thread_id = std::this_thread::get_id();
+    std::atomic<int32_t> _num_filled = 0;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _blocked = false;
+    int32_t _num_prefetched = 0;
+};
+
+TEST_F(JniScannerTest, test_prefetch) {
+    SlotDesc slot_descs[] = {{"c0", TypeDescriptor::from_logical_type(LogicalType::TYPE_INT)}, {""}};
+    const auto& slots = create_tuple_desc(slot_descs)->slots();
+    constexpr int32_t num_chunks = 10;
+    PrefetchTestJniScanner scanner(_runtime_state, num_chunks, 2);
+
+    for (int32_t i = 0; i < num_chunks; i++) {
+        ChunkPtr chunk = ChunkHelper::new_chunk(slots, _runtime_state->chunk_size());
+        ASSERT_OK(scanner.fill_empty_chunk(&chunk, slots));
+        ASSERT_EQ(1, chunk->num_rows());
+        ASSERT_EQ(i, chunk->get_column_by_slot_id(slots[0]->id())->get(0).get_int32());
+    }
+    ChunkPtr chunk = ChunkHelper::new_chunk(slots, _runtime_state->chunk_size());
+    ASSERT_TRUE(scanner.fill_empty_chunk(&chunk, slots).is_end_of_file());
+    ASSERT_EQ(0, chunk->num_rows());
+
+    // The chunks are filled by the prefetch task, and their stats are merged exactly once.
+    ASSERT_EQ(num_chunks + 1, scanner.num_prefetched());
+    ASSERT_EQ(num_chunks, scanner.app_stats().raw_rows_read);
+    ASSERT_EQ(num_chunks, scanner.app_stats().io_count);
+    scanner.close();
+}
+
+TEST_F(JniScannerTest, test_prefetch_cancel) {
+    SlotDesc slot_descs[] = {{"c0", TypeDescriptor::from_logical_type(LogicalType::TYPE_INT)}, {""}};
+    const auto& slots = create_tuple_desc(slot_descs)->slots();
+    PrefetchTestJniScanner scanner(_runtime_state, 10, 2);
+    scanner.block();
+
+    std::thread scan_thread([&]() {
+        ChunkPtr chunk = ChunkHelper::new_chunk(slots, _runtime_state->chunk_size());
+        // The chunk being read when the query is cancelled is still returned.
+        ASSERT_OK(scanner.fill_empty_chunk(&chunk, slots));
+        ASSERT_EQ(1, chunk->num_rows());
+        chunk = ChunkHelper::new_chunk(slots, _runtime_state->chunk_size());
+        ASSERT_TRUE(scanner.fill_empty_chunk(&chunk, slots).is_cancelled());
+    });
+    // Wait for the prefetch task submitted by the scan thread.
+    while (true) {
+        std::lock_guard<std::mutex> l(scanner._prefetch_mutex);
+        if (scanner._prefetch_running) {
+            break;
+        }
+    }
+    _runtime_state->set_is_cancelled(true);
+    scanner.unblock();
+    scan_thread.join();
+
+    scanner.close();
+    ASSERT_FALSE(scanner._prefetch_running);
+    ASSERT_TRUE(scanner._prefetched_chunks.empty());
+}
+
+TEST_F(JniScannerTest, test_prefetch_close) {
+    SlotDesc slot_descs[] = {{"c0", TypeDescriptor::from_logical_type(LogicalType::TYPE_INT)}, {""}};
+    const auto& slots = create_tuple_desc(slot_descs)->slots();
+    PrefetchTestJniScanner scanner(_runtime_state, 10, 2);
+    scanner.block();
+    {
+        std::lock_guard<std::mutex> l(scanner._prefetch_mutex);
+        ASSERT_TRUE(scanner._try_submit_prefetch_task(&slots));
+    }
+
+    // close() waits for the running prefetch task, which still refers to the scanner.
+    std::atomic<bool> closed = false;
+    std::thread close_thread([&]() {
+        scanner.close();
+        closed = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_FALSE(closed);
+    scanner.unblock();
+    close_thread.join();
+
+    ASSERT_TRUE(closed);
+    ASSERT_FALSE(scanner._prefetch_running);
+    ASSERT_TRUE(scanner._prefetched_chunks.empty());
+    // No more prefetch task is submitted after close.
+    {
+        std::lock_guard<std::mutex> l(scanner._prefetch_mutex);
+        ASSERT_FALSE(scanner._try_submit_prefetch_task(&slots));
+    }
+}
+
 } // namespace starrocks
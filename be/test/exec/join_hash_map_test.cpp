@@ -1044,6 +1044,99 @@ TEST_F(JoinHashMapTest, JoinBuildProbeFuncNullable) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, ParallelLinkJoinBuildFunc) {
+    auto runtime_state = create_runtime_state();
+    runtime_state->init_instance_mem_tracker();
+
+    const uint32_t row_count = 5000;
+    auto type = TypeDescriptor::from_logical_type(LogicalType::TYPE_INT);
+    auto build_column = ColumnHelper::create_column(type, true);
+    build_column->append_default();
+    for (uint32_t i = 0; i < row_count; i++) {
+        if (i % 7 == 0) {
+            build_column->append_nulls(1);
+        } else {
+            build_column->append_datum(Datum(static_cast<int32_t>(i % 1000)));
+        }
+    }
+
+    auto build = [&](JoinHashTableItems* table_items) {
+        HashTableProbeState probe_state;
+        table_items->key_columns.emplace_back(build_column);
+        table_items->row_count = row_count;
+        probe_state.buckets.resize(config::vector_chunk_size);
+        JoinBuildFunc<TYPE_INT>::prepare(runtime_state.get(), table_items);
+        JoinBuildFunc<TYPE_INT>::construct_hash_table(runtime_state.get(), table_items, &probe_state);
+    };
+
+    auto old_min_rows = config::join_hash_table_parallel_link_min_rows;
+    auto old_partition_num = config::join_hash_table_parallel_link_partition_num;
+
+    JoinHashTableItems sequential_items;
+    config::join_hash_table_parallel_link_min_rows = 0;
+    ASSERT_FALSE(JoinHashTableParallelLinker::enabled(sequential_items));
+    build(&sequential_items);
+
+    JoinHashTableItems parallel_items;
+    config::join_hash_table_parallel_link_min_rows = 1024;
+    config::join_hash_table_parallel_link_partition_num = 6;
+    build(&parallel_items);
+    ASSERT_TRUE(JoinHashTableParallelLinker::enabled(parallel_items));
+
+    config::join_hash_table_parallel_link_min_rows = old_min_rows;
+    config::join_hash_table_parallel_link_partition_num = old_partition_num;
+
+    // the parallel linking builds the same chains as the sequential one.
+    ASSERT_EQ(sequential_items.first, parallel_items.first);
+    ASSERT_EQ(sequential_items.next, parallel_items.next);
+    ASSERT_EQ(sequential_items.used_buckets, parallel_items.used_buckets);
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, JoinProbeFuncWithPrefetch) {
+    auto runtime_state = create_runtime_state();
+    runtime_state->init_instance_mem_tracker();
+
+    auto type = TypeDescriptor::from_logical_type(LogicalType::TYPE_INT);
+    auto build_column = ColumnHelper::create_column(type, false);
+    build_column->append_default();
+    build_column->append(*JoinHashMapTest::create_int32_column(1000, 0), 0, 1000);
+    auto probe_column = JoinHashMapTest::create_int32_nullable_column(100, 0);
+
+    JoinHashTableItems table_items;
+    HashTableProbeState build_state;
+    table_items.key_columns.emplace_back(build_column);
+    table_items.row_count = 1000;
+    JoinBuildFunc<TYPE_INT>::prepare(runtime_state.get(), &table_items);
+    JoinBuildFunc<TYPE_INT>::construct_hash_table(runtime_state.get(), &table_items, &build_state);
+
+    auto lookup = [&](bool prefetch) {
+        HashTableProbeState probe_state;
+        probe_state.probe_row_count = 100;
+        probe_state.buckets.resize(config::vector_chunk_size);
+        probe_state.next.resize(config::vector_chunk_size, 0);
+        Columns probe_columns{probe_column};
+        probe_state.key_columns = &probe_columns;
+        table_items.cache_miss_serious = prefetch;
+        EXPECT_EQ(prefetch, JoinHashMapHelper::probe_prefetch_enabled(table_items, probe_state));
+        JoinProbeFunc<TYPE_INT>::lookup_init(table_items, &probe_state);
+        return probe_state.next;
+    };
+
+    auto old_group_size = config::join_probe_prefetch_group_size;
+    config::join_probe_prefetch_group_size = 16;
+    auto next = lookup(false);
+    auto prefetched_next = lookup(true);
+    config::join_probe_prefetch_group_size = old_group_size;
+
+    ASSERT_EQ(next, prefetched_next);
+    for (size_t i = 0; i < 100; i++) {
+        // the odd rows of the probe column are null.
+        ASSERT_EQ(prefetched_next[i] != 0, i % 2 == 0);
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, DirectMappingJoinBuildProbeFunc) {
     auto runtime_state = create_runtime_state();
@@ -1840,6 +1933,72 @@ TEST_F(JoinHashMapTest, ProbeFromHtForRightXXXJoinWithOtherConjunctCoro) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, ExistenceJoinHashTable) {
+    auto runtime_profile = create_runtime_profile();
+    auto runtime_state = create_runtime_state();
+    std::shared_ptr<ObjectPool> object_pool = std::make_shared<ObjectPool>();
+    config::vector_chunk_size = 4096;
+
+    TDescriptorTableBuilder row_desc_builder;
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_INT, false);
+    add_tuple_descriptor(&row_desc_builder, LogicalType::TYPE_INT, false);
+
+    std::shared_ptr<RowDescriptor> row_desc =
+            create_row_desc(runtime_state.get(), object_pool, &row_desc_builder, false);
+    std::shared_ptr<RowDescriptor> probe_row_desc =
+            create_probe_desc(runtime_state.get(), object_pool, &row_desc_builder, false);
+    std::shared_ptr<RowDescriptor> build_row_desc =
+            create_build_desc(runtime_state.get(), object_pool, &row_desc_builder, false);
+
+    for (auto join_type : {TJoinOp::LEFT_SEMI_JOIN, TJoinOp::LEFT_ANTI_JOIN}) {
+        HashTableParam param;
+        param.with_other_conjunct = false;
+        param.join_type = join_type;
+        param.row_desc = row_desc.get();
+        param.join_keys.emplace_back(JoinKeyDesc{&_int_type, false, nullptr});
+        param.join_keys.emplace_back(JoinKeyDesc{&_int_type, false, nullptr});
+        param.probe_row_desc = probe_row_desc.get();
+        param.build_row_desc = build_row_desc.get();
+        param.search_ht_timer = ADD_TIMER(runtime_profile, "SearchHashTableTime");
+        param.output_build_column_timer = ADD_TIMER(runtime_profile, "OutputBuildColumnTime");
+        param.output_probe_column_timer = ADD_TIMER(runtime_profile, "OutputProbeColumnTime");
+
+        JoinHashTable hash_table;
+        hash_table.create(param);
+
+        // the build side holds every key twice.
+        for (int i = 0; i < 2; i++) {
+            auto build_chunk = create_int32_build_chunk(10, false);
+            Columns build_key_columns{build_chunk->columns()[0], build_chunk->columns()[1]};
+            hash_table.append_chunk(build_chunk, build_key_columns);
+        }
+        ASSERT_TRUE(hash_table.build(runtime_state.get()).ok());
+        ASSERT_EQ(10, hash_table._table_items->existence_table->num_keys());
+        // the existence table keeps its own copy of the distinct keys.
+        hash_table.release_build_data();
+        ASSERT_EQ(0, hash_table.get_build_chunk()->num_rows());
+
+        // probe keys (5, 15) ~ (14, 24), of which (5, 15) ~ (9, 19) exist.
+        auto probe_chunk = create_int32_probe_chunk(10, 5, false);
+        Columns probe_key_columns{probe_chunk->columns()[0], probe_chunk->columns()[1]};
+        ChunkPtr result_chunk = std::make_shared<Chunk>();
+        bool eos = false;
+        auto st = hash_table.probe(runtime_state.get(), probe_key_columns, &probe_chunk, &result_chunk, &eos);
+        ASSERT_TRUE(st.ok());
+
+        ASSERT_EQ(result_chunk->num_columns(), 6);
+        ASSERT_EQ(result_chunk->num_rows(), 5);
+        uint32_t start = join_type == TJoinOp::LEFT_SEMI_JOIN ? 5 : 10;
+        check_int32_column(result_chunk->get_column_by_slot_id(0), 5, start);
+        check_int32_column(result_chunk->get_column_by_slot_id(1), 5, start + 10);
+        check_int32_column(result_chunk->get_column_by_slot_id(2), 5, start + 20);
+        ASSERT_TRUE(result_chunk->get_column_by_slot_id(3)->only_null());
+
+        hash_table.close();
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, OneKeyJoinHashTable) {
     auto runtime_profile = create_runtime_profile();
@@ -21,6 +21,7 @@
 #include "exec/pipeline/pipeline_fwd.h"
 #include "exec/workgroup/work_group.h"
 #include "testutil/parallel_test.h"
+#include "util/defer_op.h"
 
 namespace starrocks::pipeline {
 
@@ -165,6 +166,79 @@ PARALLEL_TEST(QuerySharedDriverQueueTest, test_take_close) {
     consumer_thread->join();
 }
 
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_run_locally) {
+    WorkStealingDriverQueue queue(std::make_unique<QuerySharedDriverQueue>());
+    queue.register_worker();
+    DeferOp unregister_worker([&queue] { queue.unregister_worker(); });
+
+    QueryContext query_context;
+    // driver1 is still within the time slice of level 0.
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    driver1->driver_acct().update_last_time_spent(1'000'000L);
+    // driver2 uses up the time slice of level 0, so it goes to the shared queue to move to the next level.
+    auto driver2 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    driver2->driver_acct().update_last_time_spent(config::pipeline_driver_queue_level_time_slice_base_ns * 2);
+
+    for (auto* driver : {driver1.get(), driver2.get()}) {
+        queue.update_statistics(driver);
+        queue.put_back_from_executor(driver);
+    }
+    ASSERT_EQ(2, queue.size());
+    ASSERT_FALSE(driver1->is_in_ready_queue());
+    ASSERT_TRUE(driver2->is_in_ready_queue());
+    ASSERT_EQ(1, driver2->get_driver_queue_level());
+
+    auto maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(driver1.get(), maybe_driver.value());
+    maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(driver2.get(), maybe_driver.value());
+    ASSERT_EQ(0, queue.size());
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_steal) {
+    WorkStealingDriverQueue queue(std::make_unique<QuerySharedDriverQueue>());
+    queue.register_worker();
+    DeferOp unregister_worker([&queue] { queue.unregister_worker(); });
+
+    QueryContext query_context;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    queue.put_back_from_executor(driver1.get());
+    ASSERT_FALSE(driver1->is_in_ready_queue());
+
+    auto thief_thread = std::make_shared<std::thread>([&queue, &driver1] {
+        queue.register_worker();
+        auto maybe_driver = queue.take(false);
+        queue.unregister_worker();
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(driver1.get(), maybe_driver.value());
+    });
+    thief_thread->join();
+
+    ASSERT_EQ(0, queue.size());
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_unregister_worker) {
+    WorkStealingDriverQueue queue(std::make_unique<QuerySharedDriverQueue>());
+
+    QueryContext query_context;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+
+    auto worker_thread = std::make_shared<std::thread>([&queue, &driver1] {
+        queue.register_worker();
+        queue.put_back_from_executor(driver1.get());
+        queue.unregister_worker();
+    });
+    worker_thread->join();
+
+    // The driver left in the local queue of the removed worker goes to the shared queue.
+    ASSERT_TRUE(driver1->is_in_ready_queue());
+    auto maybe_driver = queue.take(true);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(driver1.get(), maybe_driver.value());
+}
+
 class WorkGroupDriverQueueTest : public ::testing::Test {
 public:
     void SetUp() override {
@@ -269,6 +343,43 @@ TEST_F(WorkGroupDriverQueueTest, test_basic) {
     }
 }
 
+TEST_F(WorkGroupDriverQueueTest, test_update_statistics_lazily) {
+    QueryContext query_ctx;
+    WorkGroupDriverQueue queue;
+
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_ctx, nullptr, nullptr, -1);
+    _set_driver_level(driver1.get(), 1);
+    driver1->set_workgroup(_wg1);
+    auto driver3 = std::make_shared<PipelineDriver>(_gen_operators(), &query_ctx, nullptr, nullptr, -1);
+    _set_driver_level(driver3.get(), 1);
+    driver3->set_workgroup(_wg3);
+
+    queue.put_back(driver1.get());
+    queue.put_back(driver3.get());
+
+    auto* sched_entity1 = _wg1->driver_sched_entity();
+    auto* sched_entity3 = _wg3->driver_sched_entity();
+    const int64_t vruntime1 = sched_entity1->vruntime_ns();
+    const int64_t runtime_ns =
+            (std::abs(sched_entity3->vruntime_ns() - vruntime1) + 1'000'000'000L) * sched_entity1->cpu_limit();
+
+    // The runtime is kept in the entity until the queue is locked next time.
+    driver1->driver_acct().update_last_time_spent(runtime_ns);
+    queue.update_statistics(driver1.get());
+    ASSERT_EQ(vruntime1, sched_entity1->vruntime_ns());
+    ASSERT_EQ(runtime_ns, sched_entity1->unaccounted_runtime_ns());
+
+    auto maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(driver3.get(), maybe_driver.value());
+    ASSERT_EQ(vruntime1 + runtime_ns / sched_entity1->cpu_limit(), sched_entity1->vruntime_ns());
+    ASSERT_EQ(0, sched_entity1->unaccounted_runtime_ns());
+
+    maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(driver1.get(), maybe_driver.value());
+}
+
 TEST_F(WorkGroupDriverQueueTest, test_take_block) {
     QueryContext query_ctx;
     WorkGroupDriverQueue queue;
@@ -0,0 +1,167 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/pipeline_observer.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "exec/pipeline/pipeline_driver.h"
+#include "exec/pipeline/pipeline_driver_poller.h"
+#include "exec/pipeline/scan/balanced_chunk_buffer.h"
+#include "exec/pipeline/source_operator.h"
+
+namespace starrocks::pipeline {
+
+class MockObservedOperator final : public SourceOperator {
+public:
+    MockObservedOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence)
+            : SourceOperator(factory, id, "mock_observed_operator", plan_node_id, false, driver_sequence) {}
+
+    ~MockObservedOperator() override = default;
+
+    bool has_output() const override { return false; }
+    bool is_finished() const override { return false; }
+
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override { return nullptr; }
+};
+
+class PipelineObserverTest : public ::testing::Test {
+protected:
+    DriverPtr create_driver() {
+        Operators operators;
+        operators.emplace_back(std::make_shared<MockObservedOperator>(nullptr, 1, 1, 0));
+        return std::make_shared<PipelineDriver>(operators, &_query_context, nullptr, nullptr, -1);
+    }
+
+    // The poller is not started, so the woken drivers are kept in it.
+    std::vector<DriverRawPtr> take_woken_drivers() {
+        std::lock_guard<std::mutex> lock(_poller._global_mutex);
+        std::vector<DriverRawPtr> woken_drivers;
+        woken_drivers.swap(_poller._woken_drivers);
+        return woken_drivers;
+    }
+
+    static ChunkPtr create_chunk(size_t num_rows) {
+        auto column = Int32Column::create();
+        for (size_t i = 0; i < num_rows; i++) {
+            column->append(static_cast<int32_t>(i));
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(column), 0);
+        return chunk;
+    }
+
+    QueryContext _query_context;
+    PipelineDriverPoller _poller{nullptr};
+};
+
+TEST_F(PipelineObserverTest, test_notify_observing_driver) {
+    auto driver = create_driver();
+    auto observer = std::make_shared<PipelineObserver>(driver.get());
+    Observable observable;
+    observable.add_observer(observer);
+
+    // The driver is running, so the notification is dropped.
+    ASSERT_FALSE(observable.notify_observers());
+    ASSERT_TRUE(take_woken_drivers().empty());
+
+    observer->start_observing(&_poller);
+    ASSERT_TRUE(observable.notify_observers());
+    ASSERT_EQ(std::vector<DriverRawPtr>{driver.get()}, take_woken_drivers());
+
+    observer->stop_observing();
+    ASSERT_FALSE(observable.notify_observers());
+    ASSERT_TRUE(take_woken_drivers().empty());
+}
+
+TEST_F(PipelineObserverTest, test_remove_observer) {
+    auto driver1 = create_driver();
+    auto driver2 = create_driver();
+    auto observer1 = std::make_shared<PipelineObserver>(driver1.get());
+    auto observer2 = std::make_shared<PipelineObserver>(driver2.get());
+    observer1->start_observing(&_poller);
+    observer2->start_observing(&_poller);
+
+    Observable observable;
+    observable.add_observer(observer1);
+    observable.add_observer(observer2);
+    ASSERT_EQ(2, observable.num_observers());
+
+    observable.remove_observer(observer1);
+    ASSERT_EQ(1, observable.num_observers());
+    ASSERT_EQ(1, observer1.use_count());
+    ASSERT_TRUE(observable.notify_observers());
+    ASSERT_EQ(std::vector<DriverRawPtr>{driver2.get()}, take_woken_drivers());
+
+    observable.remove_observer(observer2);
+    ASSERT_EQ(0, observable.num_observers());
+    ASSERT_FALSE(observable.notify_observers());
+    ASSERT_TRUE(take_woken_drivers().empty());
+}
+
+TEST_F(PipelineObserverTest, test_round_robin_chunk_buffer) {
+    constexpr int num_outputs = 3;
+    BalancedChunkBuffer buffer(BalanceStrategy::kRoundRobin, num_outputs, nullptr);
+    std::vector<DriverPtr> drivers;
+    std::vector<PipelineObserverPtr> observers;
+    for (int i = 0; i < num_outputs; i++) {
+        drivers.emplace_back(create_driver());
+        observers.emplace_back(std::make_shared<PipelineObserver>(drivers.back().get()));
+        observers.back()->start_observing(&_poller);
+        buffer.attach_observer(i, observers.back());
+    }
+
+    // All the chunks are produced for the first operator, but each one wakes up the operator receiving it.
+    for (int i = 0; i < num_outputs * 2; i++) {
+        ASSERT_TRUE(buffer.put(0, create_chunk(1), nullptr));
+        int target = i % num_outputs;
+        ASSERT_EQ(1, buffer.size(target));
+        ASSERT_EQ(std::vector<DriverRawPtr>{drivers[target].get()}, take_woken_drivers());
+        ChunkPtr chunk;
+        ASSERT_TRUE(buffer.try_get(target, &chunk));
+    }
+
+    // The empty chunk is dropped without any notification.
+    ASSERT_TRUE(buffer.put(0, create_chunk(0), nullptr));
+    ASSERT_TRUE(buffer.all_empty());
+    ASSERT_TRUE(take_woken_drivers().empty());
+
+    // The detached operator is not woken up anymore.
+    buffer.detach_observer(0, observers[0]);
+    ASSERT_TRUE(buffer.put(0, create_chunk(1), nullptr));
+    ASSERT_EQ(1, buffer.size(0));
+    ASSERT_TRUE(take_woken_drivers().empty());
+}
+
+TEST_F(PipelineObserverTest, test_direct_chunk_buffer) {
+    constexpr int num_outputs = 2;
+    BalancedChunkBuffer buffer(BalanceStrategy::kDirect, num_outputs, nullptr);
+    std::vector<DriverPtr> drivers;
+    std::vector<PipelineObserverPtr> observers;
+    for (int i = 0; i < num_outputs; i++) {
+        drivers.emplace_back(create_driver());
+        observers.emplace_back(std::make_shared<PipelineObserver>(drivers.back().get()));
+        observers.back()->start_observing(&_poller);
+        buffer.attach_observer(i, observers.back());
+    }
+
+    ASSERT_TRUE(buffer.put(1, create_chunk(1), nullptr));
+    ASSERT_EQ(std::vector<DriverRawPtr>{drivers[1].get()}, take_woken_drivers());
+    ASSERT_TRUE(buffer.put(0, create_chunk(1), nullptr));
+    ASSERT_EQ(std::vector<DriverRawPtr>{drivers[0].get()}, take_woken_drivers());
+}
+
+} // namespace starrocks::pipeline
@@ -551,6 +551,138 @@ static void test_merge_path(const size_t num_cols, const size_t left_start, cons
     success = true;
 }
 
+TEST(SortingTest, stable_sort_by_normalized_keys) {
+    std::mt19937 rng(0);
+    const size_t num_rows = 5000;
+    ColumnPtr c_int = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+    ColumnPtr c_bigint = ColumnHelper::create_column(TypeDescriptor(TYPE_BIGINT), false);
+    ColumnPtr c_date = ColumnHelper::create_column(TypeDescriptor(TYPE_DATE), false);
+    ColumnPtr c_varchar = ColumnHelper::create_column(TypeDescriptor::create_varchar_type(16), true);
+    const std::string words[] = {"", "a", "ab", std::string("ab\0", 3), "b", "starrocks", "star", "rocks"};
+    for (size_t i = 0; i < num_rows; i++) {
+        if (rng() % 10 == 0) {
+            c_int->append_nulls(1);
+        } else {
+            c_int->append_datum(Datum(static_cast<int32_t>(rng() % 100) - 50));
+        }
+        c_bigint->append_datum(Datum(static_cast<int64_t>(rng() % 7) * (INT64_MAX / 4) - INT64_MAX / 2));
+        c_date->append_datum(Datum(DateValue::create(2000 + rng() % 3, 1 + rng() % 12, 1)));
+        if (rng() % 10 == 0) {
+            c_varchar->append_nulls(1);
+        } else {
+            c_varchar->append_datum(Datum(Slice(words[rng() % 8])));
+        }
+    }
+
+    std::vector<Columns> column_sets = {{c_int}, {c_varchar, c_int}, {c_date, c_bigint}, {c_int, c_varchar, c_date}};
+    for (const Columns& columns : column_sets) {
+        for (int orders = 0; orders < (1 << columns.size()); orders++) {
+            for (bool null_first : {true, false}) {
+                std::vector<bool> is_asc;
+                std::vector<bool> null_firsts;
+                for (size_t i = 0; i < columns.size(); i++) {
+                    is_asc.push_back((orders >> i) & 1);
+                    null_firsts.push_back(null_first);
+                }
+                SortDescs sort_desc(is_asc, null_firsts);
+                SmallPermutation expected = create_small_permutation(num_rows);
+                ASSERT_OK(stable_sort_and_tie_columns(false, columns, sort_desc, &expected));
+                SmallPermutation perm = create_small_permutation(num_rows);
+                ASSERT_OK(stable_sort_by_normalized_keys(false, columns, sort_desc, 64, &perm));
+                ASSERT_EQ(expected, perm);
+            }
+        }
+    }
+
+    // Only sort keys of narrow integers, dates, timestamps and strings are supported.
+    SmallPermutation perm = create_small_permutation(num_rows);
+    SortDescs sort_desc = SortDescs::asc_null_first(1);
+    ASSERT_TRUE(stable_sort_by_normalized_keys(false, {c_bigint}, sort_desc, 4, &perm).is_not_supported());
+    ColumnPtr c_double = ColumnHelper::create_column(TypeDescriptor(TYPE_DOUBLE), false);
+    c_double->append_datum(Datum(1.0));
+    perm = create_small_permutation(1);
+    ASSERT_TRUE(stable_sort_by_normalized_keys(false, {c_double}, sort_desc, 64, &perm).is_not_supported());
+}
+
+// The keys are truncated, or stop at a column which could not be normalized, and the ties are compared.
+TEST(SortingTest, sort_by_normalized_keys_with_comparisons) {
+    std::mt19937 rng(0);
+    const size_t num_rows = 5000;
+    ColumnPtr c_int = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+    ColumnPtr c_double = ColumnHelper::create_column(TypeDescriptor(TYPE_DOUBLE), false);
+    ColumnPtr c_varchar = ColumnHelper::create_column(TypeDescriptor::create_varchar_type(64), true);
+    const std::string prefix(20, 'x');
+    for (size_t i = 0; i < num_rows; i++) {
+        if (rng() % 10 == 0) {
+            c_int->append_nulls(1);
+        } else {
+            c_int->append_datum(Datum(static_cast<int32_t>(rng() % 10)));
+        }
+        c_double->append_datum(Datum(static_cast<double>(rng() % 100) / 4));
+        if (rng() % 10 == 0) {
+            c_varchar->append_nulls(1);
+        } else {
+            // Long strings sharing the prefix, which differ beyond the truncated keys.
+            std::string value = prefix.substr(0, rng() % 21) + std::to_string(rng() % 50);
+            c_varchar->append_datum(Datum(Slice(value)));
+        }
+    }
+
+    std::vector<Columns> column_sets = {
+            {c_varchar}, {c_varchar, c_int}, {c_int, c_varchar}, {c_int, c_double}, {c_int, c_double, c_varchar}};
+    for (const Columns& columns : column_sets) {
+        for (int orders = 0; orders < (1 << columns.size()); orders++) {
+            for (size_t max_key_width : {1, 8, 13, 32}) {
+                std::vector<bool> is_asc;
+                std::vector<bool> null_firsts;
+                for (size_t i = 0; i < columns.size(); i++) {
+                    is_asc.push_back((orders >> i) & 1);
+                    null_firsts.push_back(orders % 3 == 0);
+                }
+                SortDescs sort_desc(is_asc, null_firsts);
+                SmallPermutation expected = create_small_permutation(num_rows);
+                ASSERT_OK(stable_sort_and_tie_columns(false, columns, sort_desc, &expected));
+                SmallPermutation perm = create_small_permutation(num_rows);
+                ASSERT_OK(stable_sort_by_normalized_keys(false, columns, sort_desc, max_key_width, &perm));
+                ASSERT_EQ(expected, perm);
+
+                // Not stable, so the rows are compared instead.
+                Permutation unstable;
+                ASSERT_OK(sort_by_normalized_keys(false, columns, sort_desc, max_key_width, &unstable));
+                ASSERT_EQ(num_rows, unstable.size());
+                for (size_t i = 0; i < num_rows; i++) {
+                    for (size_t col = 0; col < columns.size(); col++) {
+                        int cmp = columns[col]->compare_at(expected[i].index_in_chunk, unstable[i].index_in_chunk,
+                                                           *columns[col], null_firsts[col] ? -1 : 1);
+                        ASSERT_EQ(0, cmp);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Empty input, including the columns compared on the ties of the keys.
+TEST(SortingTest, sort_by_normalized_keys_empty) {
+    ColumnPtr c_int = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+    ColumnPtr c_double = ColumnHelper::create_column(TypeDescriptor(TYPE_DOUBLE), false);
+    ColumnPtr c_varchar = ColumnHelper::create_column(TypeDescriptor::create_varchar_type(64), true);
+
+    std::vector<Columns> column_sets = {{c_int}, {c_varchar}, {c_int, c_double}, {c_varchar, c_int}};
+    for (const Columns& columns : column_sets) {
+        for (size_t max_key_width : {1, 64}) {
+            SortDescs sort_desc = SortDescs::asc_null_first(columns.size());
+            SmallPermutation perm;
+            ASSERT_OK(stable_sort_by_normalized_keys(false, columns, sort_desc, max_key_width, &perm));
+            ASSERT_TRUE(perm.empty());
+
+            Permutation unstable;
+            ASSERT_OK(sort_by_normalized_keys(false, columns, sort_desc, max_key_width, &unstable));
+            ASSERT_TRUE(unstable.empty());
+        }
+    }
+}
+
 TEST(MergePathTest, test1) {
     for (size_t num_col = 1; num_col <= 2; num_col++) {
         for (size_t left_num_rows = 0; left_num_rows <= 4096; left_num_rows += 2048) {
@@ -22,6 +22,7 @@
 #include "column/fixed_length_column.h"
 #include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
+#include "exec/aggregate/columnar_agg_states.h"
 #include "exprs/agg/aggregate_factory.h"
 #include "exprs/agg/any_value.h"
 #include "exprs/agg/array_agg.h"
@@ -982,6 +983,71 @@ TEST_F(AggregateTest, test_min) {
 //    test_agg_function<int64_t, int64_t>(ctx, func, 1024, 1000, 2024);
 //}
 
+// The columnar states must end up the same as the states updated through the per-row pointers.
+TEST_F(AggregateTest, test_columnar_states) {
+    std::vector<const AggregateFunction*> funcs = {
+            get_aggregate_function("sum", TYPE_INT, TYPE_BIGINT, false),
+            get_aggregate_function("count", TYPE_BIGINT, TYPE_BIGINT, false),
+            get_aggregate_function("max", TYPE_INT, TYPE_INT, false),
+            get_aggregate_function("min", TYPE_INT, TYPE_INT, false)};
+    std::vector<FunctionContext*> ctxs(funcs.size(), ctx);
+    ColumnarAggStates columnar_states;
+    columnar_states.init(funcs, ctxs, {0, 1, 2, 3});
+
+    const size_t num_groups = 7;
+    for (size_t g = 1; g <= num_groups; g++) {
+        ASSERT_EQ(g, columnar_states.allocate());
+    }
+
+    ColumnPtr column = gen_input_column1<int32_t>();
+    const Column* columns[] = {column.get()};
+    std::vector<uint32_t> group_ids(column->size());
+    for (size_t i = 0; i < group_ids.size(); i++) {
+        // Every 10th row goes to the discard group.
+        group_ids[i] = i % 10 == 0 ? ColumnarAggStates::kDiscardGroupId : 1 + i % num_groups;
+    }
+
+    for (size_t f = 0; f < funcs.size(); f++) {
+        funcs[f]->update_batch_columnar(ctx, column->size(), columns, group_ids.data(), columnar_states.states(f));
+
+        std::vector<std::unique_ptr<ManagedAggrState>> row_states;
+        Buffer<AggDataPtr> states(column->size());
+        for (size_t g = 0; g <= num_groups; g++) {
+            row_states.emplace_back(ManagedAggrState::create(ctx, funcs[f]));
+        }
+        for (size_t i = 0; i < column->size(); i++) {
+            states[i] = row_states[group_ids[i]]->state();
+        }
+        funcs[f]->update_batch(ctx, column->size(), 0, columns, states.data());
+
+        for (size_t g = 1; g <= num_groups; g++) {
+            ASSERT_EQ(0, memcmp(row_states[g]->state(), columnar_states.state(f, g), funcs[f]->size()));
+        }
+    }
+
+    // Merge the serialized states into the same groups, which doubles the sums and counts.
+    auto sum_column = Int64Column::create();
+    auto count_column = Int64Column::create();
+    std::vector<uint32_t> all_groups;
+    for (uint32_t g = 1; g <= num_groups; g++) {
+        funcs[0]->serialize_to_column(ctx, columnar_states.state(0, g), sum_column.get());
+        funcs[1]->serialize_to_column(ctx, columnar_states.state(1, g), count_column.get());
+        all_groups.push_back(g);
+    }
+    funcs[0]->merge_batch_columnar(ctx, num_groups, sum_column.get(), all_groups.data(), columnar_states.states(0));
+    funcs[1]->merge_batch_columnar(ctx, num_groups, count_column.get(), all_groups.data(), columnar_states.states(1));
+    auto result = Int64Column::create();
+    for (uint32_t g = 1; g <= num_groups; g++) {
+        funcs[1]->finalize_to_column(ctx, columnar_states.state(1, g), result.get());
+        ASSERT_EQ(count_column->get_data()[g - 1] * 2, result->get_data().back());
+        funcs[0]->finalize_to_column(ctx, columnar_states.state(0, g), result.get());
+        ASSERT_EQ(sum_column->get_data()[g - 1] * 2, result->get_data().back());
+    }
+
+    columnar_states.reset();
+    ASSERT_EQ(1, columnar_states.allocate());
+}
+
 TEST_F(AggregateTest, test_count_distinct) {
     const AggregateFunction* func = get_aggregate_function("multi_distinct_count", TYPE_SMALLINT, TYPE_BIGINT, false);
     test_agg_function<int16_t, int64_t>(ctx, func, 1024, 1000, 2024);
@@ -39,6 +39,7 @@
 #include "exec/sorting/merge.h"
 #include "exec/sorting/sorting.h"
 #include "exec/spill/executor.h"
+#include "exec/spill/io_uring_block_manager.h"
 #include "exec/spill/log_block_manager.h"
 #include "exec/spill/mem_table.h"
 #include "exec/spill/spill_components.h"
@@ -56,6 +57,7 @@
 #include "storage/olap_define.h"
 #include "testutil/assert.h"
 #include "types/logical_type.h"
+#include "util/alignment.h"
 #include "util/defer_op.h"
 #include "util/runtime_profile.h"
 #include "util/uid_util.h"
@@ -421,6 +423,118 @@ TEST_F(SpillTest, unsorted_process) {
     }
 }
 
+TEST_F(SpillTest, compressed_serde) {
+    ObjectPool pool;
+
+    TExprBuilder order_by_slots_builder;
+    order_by_slots_builder << TYPE_INT;
+    auto order_by_slots = order_by_slots_builder.get_res();
+    std::vector<bool> nullables = {false, true};
+    TExprBuilder tuple_slots_builder;
+    tuple_slots_builder << TYPE_INT << TYPE_VARCHAR;
+    auto tuple_slots = tuple_slots_builder.get_res();
+
+    auto ctx_st = no_partition_context(&pool, &dummy_rt_st, order_by_slots, tuple_slots);
+    ASSERT_OK(ctx_st.status());
+    auto ctx = ctx_st.value();
+    auto& tuple = ctx->sort_exprs.sort_tuple_slot_expr_ctxs();
+
+    RandomChunkBuilder chunk_builder;
+    auto factory = spill::make_spilled_factory();
+
+    auto sum_of_first_column = [](const ChunkPtr& chunk) {
+        int64_t sum = 0;
+        for (auto value : down_cast<Int32Column*>(chunk->get_column_by_index(0).get())->get_data()) {
+            sum += value;
+        }
+        return sum;
+    };
+
+    // Repeated values, so that the chunks are compressed by any codec.
+    auto gen_compressible_chunk = [&](size_t seed) {
+        ChunkPtr chunk = std::make_shared<Chunk>();
+        for (size_t i = 0; i < tuple.size(); ++i) {
+            auto col = ColumnHelper::create_column(tuple[i]->root()->type(), nullables[i]);
+            for (size_t row = 0; row < 1024; ++row) {
+                if (i == 0) {
+                    col->append_datum(Datum(static_cast<int32_t>((seed + row) % 16)));
+                } else {
+                    col->append_datum(Datum(Slice("compressible")));
+                }
+            }
+            chunk->append_column(std::move(col), tuple[i]->root()->get_column_ref()->slot_id());
+        }
+        return chunk;
+    };
+    auto flushed_bytes = [&]() { return metrics.local_flush_bytes->value() + metrics.remote_flush_bytes->value(); };
+
+    auto old_enable_spill_compression = config::enable_spill_compression;
+    config::enable_spill_compression = true;
+    DeferOp defer([&]() { config::enable_spill_compression = old_enable_spill_compression; });
+
+    for (auto [compress_type, encode_level] : std::vector<std::pair<CompressionTypePB, int>>{
+                 {CompressionTypePB::NO_COMPRESSION, 7},
+                 {CompressionTypePB::LZ4, 0},
+                 {CompressionTypePB::LZ4, 7},
+                 {CompressionTypePB::ZSTD, 7}}) {
+        SpilledOptions spill_options;
+        spill_options.mem_table_pool_size = 2;
+        spill_options.spill_mem_table_bytes_size = 1 * 1024 * 1024;
+        spill_options.spill_type = spill::SpillFormaterType::SPILL_BY_COLUMN;
+        spill_options.compress_type = compress_type;
+        spill_options.encode_level = encode_level;
+        spill_options.block_manager = dummy_block_mgr.get();
+
+        auto spiller = factory->create(spill_options);
+        spiller->set_metrics(metrics);
+        SpillerCaller<spill::RawSpillerWriter*, spill::SpillerReader*> caller(spiller.get());
+        ASSERT_OK(spiller->prepare(&dummy_rt_st));
+
+        int64_t prev_uncompressed_bytes = metrics.uncompressed_bytes->value();
+        int64_t prev_flushed_bytes = flushed_bytes();
+        size_t test_loop = 256;
+        size_t input_rows = 0;
+        int64_t input_sum = 0;
+        for (size_t i = 0; i < test_loop; ++i) {
+            auto chunk = i % 2 == 0 ? chunk_builder.gen(tuple, nullables) : gen_compressible_chunk(i);
+            input_rows += chunk->num_rows();
+            input_sum += sum_of_first_column(chunk);
+            ASSERT_OK(caller.spill<SyncExecutor>(&dummy_rt_st, chunk, EmptyMemGuard{}));
+            ASSERT_OK(spiller->_spilled_task_status);
+        }
+        ASSERT_OK(caller.flush<SyncExecutor>(&dummy_rt_st, EmptyMemGuard{}));
+
+        // Without a codec the chunks are spilled by ColumnarSerde, otherwise the spilled blocks must be smaller
+        // than the serialized chunks.
+        int64_t uncompressed_bytes = metrics.uncompressed_bytes->value() - prev_uncompressed_bytes;
+        int64_t spilled_bytes = flushed_bytes() - prev_flushed_bytes;
+        ASSERT_GT(spilled_bytes, 0);
+        if (compress_type == CompressionTypePB::NO_COMPRESSION) {
+            ASSERT_EQ(0, uncompressed_bytes);
+        } else {
+            ASSERT_LT(spilled_bytes, uncompressed_bytes);
+        }
+
+        size_t output_rows = 0;
+        int64_t output_sum = 0;
+        ASSERT_OK(caller.trigger_restore<SyncExecutor>(&dummy_rt_st, EmptyMemGuard{}));
+        while (true) {
+            auto chunk_st = caller.restore<SyncExecutor>(&dummy_rt_st, EmptyMemGuard{});
+            if (chunk_st.status().is_end_of_file()) {
+                break;
+            }
+            ASSERT_OK(chunk_st.status());
+            ASSERT_OK(spiller->_spilled_task_status);
+            if (chunk_st.value() != nullptr) {
+                output_rows += chunk_st.value()->num_rows();
+                output_sum += sum_of_first_column(chunk_st.value());
+            }
+        }
+        ASSERT_EQ(input_rows, output_rows);
+        ASSERT_EQ(input_sum, output_sum);
+    }
+}
+
 TEST_F(SpillTest, order_by_process) {
     ObjectPool pool;
     // order by id_int
@@ -577,6 +691,86 @@ TEST_F(SpillTest, aligned_buffer) {
     ASSERT_TRUE(is_aligned(buffer.data(), 4096));
 }
 
+TEST_F(SpillTest, io_uring_block_manager) {
+    if (!spill::IoUringBlockManager::is_supported()) {
+        GTEST_SKIP() << "io_uring is not supported";
+    }
+    auto old_buffer_size = config::spill_io_uring_buffer_size;
+    config::spill_io_uring_buffer_size = 8192;
+    DeferOp defer([&]() { config::spill_io_uring_buffer_size = old_buffer_size; });
+
+    spill::IoUringBlockManager block_mgr(generate_uuid(), dummy_dir_mgr.get());
+    ASSERT_OK(block_mgr.open());
+
+    // the blocks share the same container, and cross the boundaries of the buffers and pages
+    std::vector<spill::BlockPtr> blocks;
+    std::vector<std::string> contents;
+    for (size_t block_size : {1, 4095, 8192, 20000, 100}) {
+        spill::AcquireBlockOptions opts;
+        opts.plan_node_id = 1;
+        opts.name = "io_uring_test";
+        opts.block_size = block_size;
+        ASSIGN_OR_ABORT(auto block, block_mgr.acquire_block(opts));
+        ASSERT_TRUE(block->preallocate(block_size));
+
+        std::string content(block_size, 0);
+        std::generate(content.begin(), content.end(), []() { return static_cast<char>(rand()); });
+        size_t half = block_size / 2;
+        ASSERT_OK(block->append({Slice(content.data(), half), Slice(content.data() + half, block_size - half)}));
+        ASSERT_OK(block->flush());
+        ASSERT_OK(block_mgr.release_block(block));
+        ASSERT_EQ(block_size, block->size());
+        blocks.emplace_back(std::move(block));
+        contents.emplace_back(std::move(content));
+    }
+
+    for (size_t i = 0; i < blocks.size(); i++) {
+        auto reader = blocks[i]->get_reader();
+        std::string content(contents[i].size(), 0);
+        size_t offset = 0;
+        // read in small pieces to consume the read-ahead buffers
+        while (offset < content.size()) {
+            size_t len = std::min<size_t>(3000, content.size() - offset);
+            ASSERT_OK(reader->read_fully(content.data() + offset, len));
+            offset += len;
+        }
+        ASSERT_EQ(contents[i], content);
+        char c;
+        ASSERT_TRUE(reader->read_fully(&c, 1).is_end_of_file());
+    }
+}
+
+TEST_F(SpillTest, io_uring_block_manager_pre_allocate) {
+    if (!spill::IoUringBlockManager::is_supported()) {
+        GTEST_SKIP() << "io_uring is not supported";
+    }
+    spill::IoUringBlockManager block_mgr(generate_uuid(), dummy_dir_mgr.get());
+    ASSERT_OK(block_mgr.open());
+    ASSIGN_OR_ABORT(auto dir, dummy_dir_mgr->acquire_writable_dir(spill::AcquireDirOptions()));
+    int64_t base_size = dir->get_current_size();
+
+    spill::AcquireBlockOptions opts;
+    opts.plan_node_id = 1;
+    opts.name = "io_uring_test";
+    opts.block_size = 4100;
+    ASSIGN_OR_ABORT(auto block, block_mgr.acquire_block(opts));
+    // only the last page of a block is charged for the padding
+    for (int i = 0; i < 41; i++) {
+        ASSERT_TRUE(block->preallocate(100));
+        ASSERT_EQ(base_size + ALIGN_UP((i + 1) * 100, 4096), dir->get_current_size());
+    }
+    std::string content(4100, 'a');
+    ASSERT_OK(block->append({Slice(content)}));
+    ASSERT_OK(block->flush());
+    ASSERT_OK(block_mgr.release_block(block));
+
+    // the next block starts from a new page
+    opts.block_size = 1;
+    ASSIGN_OR_ABORT(auto next_block, block_mgr.acquire_block(opts));
+    ASSERT_TRUE(next_block->preallocate(1));
+    ASSERT_EQ(base_size + 3 * 4096, dir->get_current_size());
+}
+
 /*
 TEST_F(SpillTest, file_group_test) {
     auto chunk = std::make_unique<Chunk>();
@@ -16,7 +16,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <ctime>
+#include <random>
 #include <set>
 
 #include "common/config.h"
@@ -30,7 +32,9 @@
 #include "storage/sstable/table.h"
 #include "storage/sstable/table_builder.h"
 #include "testutil/assert.h"
+#include "util/lru_cache.h"
 #include "util/phmap/btree.h"
+#include "util/threadpool.h"
 
 namespace starrocks::lake {
 
@@ -419,4 +423,104 @@ TEST_F(PersistentIndexSstableTest, test_persistent_index_sstable) {
     }
 }
 
+// Build a table of the even keys in [0, 2 * n) with |policy|.
+static uint64_t build_filtered_sst(const std::string& path, const sstable::FilterPolicy* policy,
+                                   bool partition_filters, int n) {
+    sstable::Options options;
+    options.filter_policy = policy;
+    options.partition_filters = partition_filters;
+    options.filter_partition_keys = 100;
+    options.block_size = 512;
+    ASSIGN_OR_ABORT(auto file, fs::new_writable_file(path));
+    sstable::TableBuilder builder(options, file.get());
+    for (int i = 0; i < n; i++) {
+        builder.Add(Slice(fmt::format("test_key_{:016X}", 2 * i)), Slice(fmt::format("value_{}", 2 * i)));
+    }
+    CHECK_OK(builder.Finish());
+    CHECK_OK(file->close());
+    return builder.FileSize();
+}
+
+// Look up the keys in [0, 2 * n + 10) in random order, and check only the even keys in [0, 2 * n) are found.
+static void check_multi_get(sstable::Table* table, const sstable::ReadOptions& options, int n) {
+    std::vector<std::string> keys_str;
+    for (int i = 0; i < 2 * n + 10; i++) {
+        keys_str.push_back(fmt::format("test_key_{:016X}", i));
+    }
+    std::shuffle(keys_str.begin(), keys_str.end(), std::mt19937(0));
+    std::vector<Slice> keys(keys_str.begin(), keys_str.end());
+    std::set<size_t> key_indexes;
+    for (size_t i = 0; i < keys.size(); i++) {
+        key_indexes.insert(i);
+    }
+    std::vector<std::string> values(keys.size());
+    ASSERT_OK(table->MultiGet(options, keys.data(), key_indexes.begin(), key_indexes.end(), &values));
+    for (size_t i = 0; i < keys.size(); i++) {
+        int k = std::stoi(keys_str[i].substr(9), nullptr, 16);
+        if (k % 2 == 0 && k < 2 * n) {
+            ASSERT_EQ(fmt::format("value_{}", k), values[i]);
+        } else {
+            ASSERT_TRUE(values[i].empty()) << keys_str[i];
+        }
+    }
+}
+
+TEST_F(PersistentIndexSstableTest, test_partitioned_xor_filter_multi_get) {
+    const int N = 10000;
+    std::unique_ptr<const sstable::FilterPolicy> xor_policy(sstable::NewXorFilterPolicy());
+    std::unique_ptr<const sstable::FilterPolicy> bloom_policy(sstable::NewBloomFilterPolicy(10));
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_OK(ThreadPoolBuilder("test_sst_read").set_max_threads(4).build(&pool));
+    std::unique_ptr<Cache> cache(new_lru_cache(16 * 1024 * 1024));
+
+    sstable::Options options;
+    options.filter_policy = xor_policy.get();
+    options.fallback_filter_policies.push_back(bloom_policy.get());
+    options.block_cache = cache.get();
+
+    // A table with partitioned xor filters, read in parallel and then from the block cache.
+    {
+        const std::string path = lake::join_path(kTestDir, "test_partitioned_xor_filter.sst");
+        uint64_t filesz = build_filtered_sst(path, xor_policy.get(), true, N);
+        ASSIGN_OR_ABORT(auto read_file, fs::new_random_access_file(path));
+        sstable::Table* table = nullptr;
+        ASSERT_OK(sstable::Table::Open(options, read_file.get(), filesz, &table));
+        std::unique_ptr<sstable::Table> table_ptr(table);
+
+        sstable::ReadIOStat stat;
+        sstable::ReadOptions read_options;
+        read_options.read_pool = pool.get();
+        read_options.stat = &stat;
+        check_multi_get(table, read_options, N);
+        ASSERT_GT(stat.block_cnt_from_file, 0);
+        ASSERT_EQ(0, stat.block_cnt_from_cache);
+
+        sstable::ReadIOStat cached_stat;
+        read_options.stat = &cached_stat;
+        check_multi_get(table, read_options, N);
+        ASSERT_EQ(0, cached_stat.block_cnt_from_file);
+        ASSERT_EQ(stat.block_cnt_from_file, cached_stat.block_cnt_from_cache);
+
+        // Read sequentially without the cache.
+        sstable::Options no_cache_options = options;
+        no_cache_options.block_cache = nullptr;
+        ASSERT_OK(sstable::Table::Open(no_cache_options, read_file.get(), filesz, &table));
+        std::unique_ptr<sstable::Table> no_cache_table(table);
+        check_multi_get(table, sstable::ReadOptions(), N);
+    }
+    // A table with a bloom filter written by older versions is read with the fallback policy.
+    {
+        const std::string path = lake::join_path(kTestDir, "test_legacy_bloom_filter.sst");
+        uint64_t filesz = build_filtered_sst(path, bloom_policy.get(), false, N);
+        ASSIGN_OR_ABORT(auto read_file, fs::new_random_access_file(path));
+        sstable::Table* table = nullptr;
+        ASSERT_OK(sstable::Table::Open(options, read_file.get(), filesz, &table));
+        std::unique_ptr<sstable::Table> table_ptr(table);
+        sstable::ReadOptions read_options;
+        read_options.read_pool = pool.get();
+        check_multi_get(table, read_options, N);
+    }
+    pool->shutdown();
+}
+
 } // namespace starrocks::lake
@@ -36,6 +36,7 @@
 
 #include <gtest/gtest.h>
 
+#include "common/config.h"
 #include "runtime/mem_tracker.h"
 
 namespace starrocks {
@@ -184,4 +185,42 @@ TEST_F(StoragePageCacheTest, metrics) {
     ASSERT_EQ(cache.get_hit_count(), 2);
 }
 
+// NOLINTNEXTLINE
+TEST_F(StoragePageCacheTest, decoded) {
+    StoragePageCache cache(_mem_tracker.get(), kNumShards * 2048);
+    StoragePageCache::CacheKey key("abc", 0);
+    const int32_t encoding = 1;
+
+    // Admitted once requested decoded_page_cache_admit_frequency times.
+    for (int i = 1; i < config::decoded_page_cache_admit_frequency; i++) {
+        ASSERT_FALSE(cache.admit_decoded(key, encoding));
+    }
+    ASSERT_TRUE(cache.admit_decoded(key, encoding));
+
+    static int num_deleted = 0;
+    auto deleter = [](const CacheKey& /*key*/, void* value) {
+        delete static_cast<int*>(value);
+        num_deleted++;
+    };
+    {
+        PageCacheHandle handle;
+        auto* value = new int(42);
+        cache.insert_decoded(key, encoding, value, sizeof(int), deleter, &handle);
+        ASSERT_EQ(value, handle.value());
+    }
+    {
+        PageCacheHandle handle;
+        ASSERT_TRUE(cache.lookup_decoded(key, encoding, &handle));
+        ASSERT_EQ(42, *static_cast<int*>(handle.value()));
+        // The decoded page does not collide with the page itself or the page of another encoding.
+        ASSERT_FALSE(cache.lookup(key, &handle));
+        ASSERT_FALSE(cache.lookup_decoded(key, encoding + 1, &handle));
+    }
+
+    cache.prune();
+    ASSERT_EQ(1, num_deleted);
+    PageCacheHandle handle;
+    ASSERT_FALSE(cache.lookup_decoded(key, encoding, &handle));
+}
+
 } // namespace starrocks
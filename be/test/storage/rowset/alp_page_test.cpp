@@ -0,0 +1,197 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/alp_page.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+
+#include "storage/chunk_helper.h"
+#include "storage/rowset/options.h"
+#include "storage/rowset/page_builder.h"
+#include "storage/rowset/page_decoder.h"
+
+namespace starrocks {
+
+class AlpPageTest : public testing::Test {
+public:
+    // Return the number of vectors encoded by ALP.
+    template <LogicalType Type>
+    size_t test_encode_decode_page(const std::vector<typename TypeTraits<Type>::CppType>& src) {
+        typedef typename TypeTraits<Type>::CppType CppType;
+        PageBuilderOptions builder_options;
+        builder_options.data_page_size = 256 * 1024;
+        AlpPageBuilder<Type> page_builder(builder_options);
+        size_t size = page_builder.add(reinterpret_cast<const uint8_t*>(src.data()), src.size());
+        EXPECT_EQ(src.size(), size);
+        OwnedSlice s = page_builder.finish()->build();
+        EXPECT_EQ(size, page_builder.count());
+        LOG(INFO) << "ALP encoded size for " << size << " values: " << s.slice().size
+                  << ", original size:" << size * sizeof(CppType);
+
+        AlpPageDecoder<Type> page_decoder(s.slice());
+        EXPECT_TRUE(page_decoder.init().ok());
+        EXPECT_EQ(0, page_decoder.current_index());
+        EXPECT_EQ(size, page_decoder.count());
+        EXPECT_EQ(ALP_ENCODING, page_decoder.encoding_type());
+
+        // Compare the bits, so that NaN and -0.0 are checked.
+        auto column = ChunkHelper::column_from_field_type(Type, false);
+        size_t size_to_fetch = size;
+        EXPECT_TRUE(page_decoder.next_batch(&size_to_fetch, column.get()).ok());
+        EXPECT_EQ(size, size_to_fetch);
+        EXPECT_EQ(0, memcmp(src.data(), column->raw_data(), size * sizeof(CppType)));
+
+        // Seek within the page by ordinal, and read across the vectors.
+        std::mt19937 rng(0);
+        for (int i = 0; i < 100 && size > 0; i++) {
+            uint32_t seek_off = rng() % size;
+            EXPECT_TRUE(page_decoder.seek_to_position_in_page(seek_off).ok());
+            EXPECT_EQ(seek_off, page_decoder.current_index());
+            auto column1 = ChunkHelper::column_from_field_type(Type, false);
+            size_t n = 1 + rng() % 2000;
+            EXPECT_TRUE(page_decoder.next_batch(&n, column1.get()).ok());
+            EXPECT_EQ(std::min<size_t>(n, size - seek_off), column1->size());
+            EXPECT_EQ(0, memcmp(src.data() + seek_off, column1->raw_data(), column1->size() * sizeof(CppType)));
+        }
+
+        EXPECT_TRUE(page_decoder.seek_to_position_in_page(0).ok());
+        auto column2 = ChunkHelper::column_from_field_type(Type, false);
+        SparseRange<> read_range;
+        read_range.add(Range<>(0, size / 3));
+        read_range.add(Range<>(size / 2, (size * 2 / 3)));
+        read_range.add(Range<>((size * 3 / 4), size));
+        size_t read_num = read_range.span_size();
+        EXPECT_TRUE(page_decoder.next_batch(read_range, column2.get()).ok());
+        EXPECT_EQ(read_num, column2->size());
+
+        auto* values2 = reinterpret_cast<const CppType*>(column2->raw_data());
+        SparseRangeIterator<> read_iter = read_range.new_iterator();
+        size_t offset = 0;
+        while (read_iter.has_more()) {
+            Range<> r = read_iter.next(read_num);
+            EXPECT_EQ(0, memcmp(src.data() + r.begin(), values2 + offset, r.span_size() * sizeof(CppType)));
+            offset += r.span_size();
+        }
+        return page_builder.num_alp_vectors();
+    }
+};
+
+TEST_F(AlpPageTest, TestDoubleDecimals) {
+    std::mt19937_64 rng(1);
+    std::vector<double> prices;
+    for (int i = 0; i < 10000; i++) {
+        prices.push_back(static_cast<double>(rng() % 100000) / 100);
+    }
+    ASSERT_EQ(10, test_encode_decode_page<TYPE_DOUBLE>(prices));
+}
+
+TEST_F(AlpPageTest, TestDoubleSensor) {
+    std::mt19937_64 rng(2);
+    std::vector<double> readings;
+    double value = 20;
+    for (int i = 0; i < 5000; i++) {
+        value += (static_cast<int>(rng() % 21) - 10) / 1000.0;
+        readings.push_back(std::round(value * 1000) / 1000);
+    }
+    ASSERT_EQ(5, test_encode_decode_page<TYPE_DOUBLE>(readings));
+}
+
+TEST_F(AlpPageTest, TestDoubleRandom) {
+    std::mt19937_64 rng(3);
+    std::vector<double> ratios;
+    for (int i = 0; i < 3000; i++) {
+        ratios.push_back(static_cast<double>(rng()) / static_cast<double>(rng()));
+    }
+    // Falls back to XOR.
+    ASSERT_EQ(0, test_encode_decode_page<TYPE_DOUBLE>(ratios));
+}
+
+TEST_F(AlpPageTest, TestDoubleExceptions) {
+    std::vector<double> values = {std::numeric_limits<double>::quiet_NaN(),
+                                  -0.0,
+                                  std::numeric_limits<double>::infinity(),
+                                  -std::numeric_limits<double>::infinity(),
+                                  std::numeric_limits<double>::max(),
+                                  std::numeric_limits<double>::lowest(),
+                                  std::numeric_limits<double>::denorm_min(),
+                                  1.0 / 3};
+    for (int i = 0; i < 2000; i++) {
+        values.push_back(i * 0.1);
+    }
+    ASSERT_EQ(2, test_encode_decode_page<TYPE_DOUBLE>(values));
+}
+
+TEST_F(AlpPageTest, TestDoubleConstant) {
+    std::vector<double> values(3000, 42.5);
+    ASSERT_EQ(3, test_encode_decode_page<TYPE_DOUBLE>(values));
+}
+
+TEST_F(AlpPageTest, TestFloat) {
+    std::mt19937 rng(4);
+    std::vector<float> values;
+    for (int i = 0; i < 5000; i++) {
+        values.push_back(static_cast<float>(rng() % 10000) / 10.0f);
+    }
+    test_encode_decode_page<TYPE_FLOAT>(values);
+
+    values.clear();
+    for (int i = 0; i < 2000; i++) {
+        values.push_back(static_cast<float>(rng()) / static_cast<float>(rng()));
+    }
+    values.push_back(std::numeric_limits<float>::quiet_NaN());
+    values.push_back(-0.0f);
+    test_encode_decode_page<TYPE_FLOAT>(values);
+}
+
+TEST_F(AlpPageTest, TestEmptyAndSingle) {
+    test_encode_decode_page<TYPE_DOUBLE>({});
+    test_encode_decode_page<TYPE_DOUBLE>({3.14});
+}
+
+TEST_F(AlpPageTest, TestFirstLastValue) {
+    std::vector<double> values;
+    for (int i = 0; i < 128; i++) {
+        values.push_back(i * 0.5);
+    }
+    PageBuilderOptions builder_options;
+    AlpPageBuilder<TYPE_DOUBLE> page_builder(builder_options);
+    page_builder.add(reinterpret_cast<const uint8_t*>(values.data()), values.size());
+    OwnedSlice s = page_builder.finish()->build();
+    double first_value = -1;
+    ASSERT_TRUE(page_builder.get_first_value(&first_value).ok());
+    ASSERT_EQ(0, first_value);
+    double last_value = 0;
+    ASSERT_TRUE(page_builder.get_last_value(&last_value).ok());
+    ASSERT_EQ(63.5, last_value);
+}
+
+TEST_F(AlpPageTest, TestCorruptedPage) {
+    std::vector<double> values(300, 1.5);
+    PageBuilderOptions builder_options;
+    AlpPageBuilder<TYPE_DOUBLE> page_builder(builder_options);
+    page_builder.add(reinterpret_cast<const uint8_t*>(values.data()), values.size());
+    OwnedSlice s = page_builder.finish()->build();
+
+    AlpPageDecoder<TYPE_FLOAT> wrong_type_decoder(s.slice());
+    ASSERT_TRUE(wrong_type_decoder.init().is_corruption());
+    AlpPageDecoder<TYPE_DOUBLE> truncated_decoder(Slice(s.slice().data, s.slice().size - 1));
+    ASSERT_TRUE(truncated_decoder.init().is_corruption());
+}
+
+} // namespace starrocks
@@ -62,6 +62,7 @@
 #include "storage/types.h"
 #include "testutil/assert.h"
 #include "types/date_value.h"
+#include "util/defer_op.h"
 
 using std::string;
 
@@ -800,4 +801,92 @@ TEST_F(ColumnReaderWriterTest, test_large_varchar_column_writer) {
     }
 }
 
+TEST_F(ColumnReaderWriterTest, test_dict_codes_zone_map) {
+    auto fs = std::make_shared<MemoryFileSystem>();
+    ASSERT_TRUE(fs->create_dir(TEST_DIR).ok());
+    const std::string fname = strings::Substitute("$0/test_dict_codes_zone_map.data", TEST_DIR);
+    // Every group of rows has "a", "z" and its own "m_<group>", so that the min/max of the pages can not
+    // filter "m_<group>", but the dictionary codes of the pages can.
+    const int kGroups = 8;
+    const int kGroupRows = 1024;
+    const int kNumRows = kGroups * kGroupRows;
+    ColumnMetaPB meta;
+    {
+        ASSIGN_OR_ABORT(auto wfile, fs->new_writable_file(fname));
+        ColumnWriterOptions writer_opts;
+        writer_opts.page_format = 2;
+        writer_opts.meta = &meta;
+        writer_opts.meta->set_column_id(0);
+        writer_opts.meta->set_unique_id(0);
+        writer_opts.meta->set_type(TYPE_VARCHAR);
+        writer_opts.meta->set_length(128);
+        writer_opts.meta->set_encoding(DICT_ENCODING);
+        writer_opts.meta->set_compression(starrocks::LZ4_FRAME);
+        writer_opts.meta->set_is_nullable(true);
+        writer_opts.need_zone_map = true;
+        writer_opts.data_page_size = 1024;
+
+        TabletColumn column = create_varchar_key(1, true, 128);
+        ASSIGN_OR_ABORT(auto writer, ColumnWriter::create(writer_opts, &column, wfile.get()));
+        ASSERT_OK(writer->init());
+        std::vector<std::string> values;
+        for (int i = 0; i < kNumRows; i++) {
+            int group = i / kGroupRows;
+            values.emplace_back(i % 3 == 0 ? "a" : (i % 3 == 1 ? "z" : strings::Substitute("m_$0", group)));
+        }
+        std::vector<Slice> slices(values.begin(), values.end());
+        auto col = ChunkHelper::column_from_field_type(TYPE_VARCHAR, true);
+        col->append_strings(slices);
+        ASSERT_OK(writer->append(*col));
+        ASSERT_OK(writer->finish());
+        ASSERT_OK(writer->write_data());
+        ASSERT_OK(writer->write_ordinal_index());
+        ASSERT_OK(writer->write_zone_map());
+        ASSERT_OK(wfile->close());
+    }
+    ASSERT_EQ(DICT_ENCODING, meta.encoding());
+
+    auto segment = create_dummy_segment(fs, fname);
+    ASSIGN_OR_ABORT(auto reader, ColumnReader::create(&meta, segment.get()));
+    ASSIGN_OR_ABORT(auto read_file, fs->new_random_access_file(fname));
+    auto get_row_ranges = [&](const ColumnPredicate* pred, SparseRange<>* ranges) {
+        ASSIGN_OR_ABORT(auto iter, reader->new_iterator());
+        ColumnIteratorOptions iter_opts;
+        OlapReaderStatistics stats;
+        iter_opts.stats = &stats;
+        iter_opts.read_file = read_file.get();
+        ASSERT_OK(iter->init(iter_opts));
+        ASSERT_OK(iter->get_row_ranges_by_zone_map({pred}, nullptr, ranges));
+    };
+    auto type_info = get_type_info(TYPE_VARCHAR);
+
+    std::unique_ptr<ColumnPredicate> eq(new_column_eq_predicate(type_info, 0, "m_3"));
+    SparseRange<> eq_ranges;
+    get_row_ranges(eq.get(), &eq_ranges);
+    SparseRange<> group3;
+    group3.add(Range<>(3 * kGroupRows, 4 * kGroupRows));
+    ASSERT_EQ(group3.span_size(), (eq_ranges & group3).span_size());
+    ASSERT_LT(eq_ranges.span_size(), 2 * kGroupRows);
+
+    std::unique_ptr<ColumnPredicate> in(new_column_in_predicate(type_info, 0, {"m_1", "m_6", "m_9"}));
+    SparseRange<> in_ranges;
+    get_row_ranges(in.get(), &in_ranges);
+    ASSERT_LT(in_ranges.span_size(), 3 * kGroupRows);
+    ASSERT_GE(in_ranges.span_size(), 2 * kGroupRows);
+
+    // Every page has "a".
+    std::unique_ptr<ColumnPredicate> eq_a(new_column_eq_predicate(type_info, 0, "a"));
+    SparseRange<> all_ranges;
+    get_row_ranges(eq_a.get(), &all_ranges);
+    ASSERT_EQ(kNumRows, all_ranges.span_size());
+
+    // Without the bitmaps, the pages are filtered by min/max only.
+    int32_t old_max_dict_codes = config::zone_map_max_dict_codes;
+    DeferOp defer([&]() { config::zone_map_max_dict_codes = old_max_dict_codes; });
+    config::zone_map_max_dict_codes = 0;
+    SparseRange<> no_dict_ranges;
+    get_row_ranges(eq.get(), &no_dict_ranges);
+    ASSERT_EQ(kNumRows, no_dict_ranges.span_size());
+}
+
 } // namespace starrocks
@@ -0,0 +1,227 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/delta_page.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <memory>
+#include <random>
+
+#include "storage/chunk_helper.h"
+#include "storage/rowset/options.h"
+#include "storage/rowset/page_builder.h"
+#include "storage/rowset/page_decoder.h"
+
+namespace starrocks {
+
+class DeltaPageTest : public testing::Test {
+public:
+    template <LogicalType Type>
+    void test_encode_decode_page(const std::vector<typename TypeTraits<Type>::CppType>& src,
+                                 DeltaPageMode expected_mode) {
+        typedef typename TypeTraits<Type>::CppType CppType;
+        PageBuilderOptions builder_options;
+        builder_options.data_page_size = 256 * 1024;
+        DeltaPageBuilder<Type> page_builder(builder_options);
+        size_t size = page_builder.add(reinterpret_cast<const uint8_t*>(src.data()), src.size());
+        ASSERT_EQ(src.size(), size);
+        OwnedSlice s = page_builder.finish()->build();
+        ASSERT_EQ(size, page_builder.count());
+        ASSERT_EQ(expected_mode, page_builder.mode());
+        LOG(INFO) << "Delta encoded size for " << size << " values: " << s.slice().size
+                  << ", original size:" << size * sizeof(CppType);
+
+        DeltaPageDecoder<Type> page_decoder(s.slice());
+        ASSERT_TRUE(page_decoder.init().ok());
+        ASSERT_EQ(0, page_decoder.current_index());
+        ASSERT_EQ(size, page_decoder.count());
+        ASSERT_EQ(DELTA_ENCODING, page_decoder.encoding_type());
+
+        auto column = ChunkHelper::column_from_field_type(Type, false);
+        size_t size_to_fetch = size;
+        ASSERT_TRUE(page_decoder.next_batch(&size_to_fetch, column.get()).ok());
+        ASSERT_EQ(size, size_to_fetch);
+        auto* values = reinterpret_cast<const CppType*>(column->raw_data());
+        for (size_t i = 0; i < size; i++) {
+            ASSERT_EQ(src[i], values[i]);
+        }
+
+        // Seek within the page by ordinal, and read across the miniblocks.
+        std::mt19937 rng(0);
+        for (int i = 0; i < 100; i++) {
+            uint32_t seek_off = rng() % size;
+            ASSERT_TRUE(page_decoder.seek_to_position_in_page(seek_off).ok());
+            ASSERT_EQ(seek_off, page_decoder.current_index());
+            auto column1 = ChunkHelper::column_from_field_type(Type, false);
+            size_t n = 1 + rng() % 300;
+            ASSERT_TRUE(page_decoder.next_batch(&n, column1.get()).ok());
+            ASSERT_EQ(std::min<size_t>(n, size - seek_off), column1->size());
+            auto* values1 = reinterpret_cast<const CppType*>(column1->raw_data());
+            for (size_t j = 0; j < column1->size(); j++) {
+                ASSERT_EQ(src[seek_off + j], values1[j]);
+            }
+        }
+
+        ASSERT_TRUE(page_decoder.seek_to_position_in_page(0).ok());
+        auto column2 = ChunkHelper::column_from_field_type(Type, false);
+        SparseRange<> read_range;
+        read_range.add(Range<>(0, size / 3));
+        read_range.add(Range<>(size / 2, (size * 2 / 3)));
+        read_range.add(Range<>((size * 3 / 4), size));
+        size_t read_num = read_range.span_size();
+        ASSERT_TRUE(page_decoder.next_batch(read_range, column2.get()).ok());
+        ASSERT_EQ(read_num, column2->size());
+
+        auto* values2 = reinterpret_cast<const CppType*>(column2->raw_data());
+        SparseRangeIterator<> read_iter = read_range.new_iterator();
+        size_t offset = 0;
+        while (read_iter.has_more()) {
+            Range<> r = read_iter.next(read_num);
+            for (uint32_t i = 0; i < r.span_size(); ++i) {
+                ASSERT_EQ(src[r.begin() + i], values2[offset + i]);
+            }
+            offset += r.span_size();
+        }
+    }
+};
+
+TEST_F(DeltaPageTest, TestInt32Sorted) {
+    std::mt19937 rng(1);
+    std::vector<int32_t> ints;
+    int32_t value = -5000;
+    for (int i = 0; i < 10000; i++) {
+        value += rng() % 4;
+        ints.push_back(value);
+    }
+    test_encode_decode_page<TYPE_INT>(ints, DeltaPageMode::DELTA);
+}
+
+TEST_F(DeltaPageTest, TestInt32Random) {
+    std::mt19937 rng(2);
+    std::vector<int32_t> ints;
+    for (int i = 0; i < 10000; i++) {
+        ints.push_back(rng() % 1000);
+    }
+    test_encode_decode_page<TYPE_INT>(ints, DeltaPageMode::FOR);
+}
+
+TEST_F(DeltaPageTest, TestInt32MinMax) {
+    std::vector<int32_t> ints;
+    for (int i = 0; i < 1001; i++) {
+        ints.push_back(i % 2 == 0 ? std::numeric_limits<int32_t>::lowest() : std::numeric_limits<int32_t>::max());
+    }
+    // The deltas wrap around to -1 and 1.
+    test_encode_decode_page<TYPE_INT>(ints, DeltaPageMode::DELTA);
+}
+
+TEST_F(DeltaPageTest, TestInt64Timestamp) {
+    std::vector<int64_t> ints;
+    for (int64_t i = 0; i < 10000; i++) {
+        ints.push_back(1700000000000000L + i * 1000000);
+    }
+    test_encode_decode_page<TYPE_BIGINT>(ints, DeltaPageMode::DELTA);
+    test_encode_decode_page<TYPE_DATETIME>(ints, DeltaPageMode::DELTA);
+}
+
+TEST_F(DeltaPageTest, TestInt64SteadyStep) {
+    std::vector<int64_t> ints;
+    for (int64_t i = 0; i < 10000; i++) {
+        ints.push_back(1700000000000000L + i * i * 1000);
+    }
+    test_encode_decode_page<TYPE_BIGINT>(ints, DeltaPageMode::DELTA_OF_DELTA);
+}
+
+TEST_F(DeltaPageTest, TestInt64Random) {
+    std::mt19937_64 rng(3);
+    std::vector<int64_t> ints;
+    ints.push_back(std::numeric_limits<int64_t>::lowest());
+    ints.push_back(std::numeric_limits<int64_t>::max());
+    for (int i = 0; i < 1000; i++) {
+        ints.push_back(static_cast<int64_t>(rng()));
+    }
+    test_encode_decode_page<TYPE_BIGINT>(ints, DeltaPageMode::FOR);
+}
+
+TEST_F(DeltaPageTest, TestDate) {
+    std::vector<int32_t> ints;
+    for (int i = 0; i < 3000; i++) {
+        ints.push_back(2460000 + i / 10);
+    }
+    test_encode_decode_page<TYPE_DATE>(ints, DeltaPageMode::DELTA);
+}
+
+TEST_F(DeltaPageTest, TestEncodedSize) {
+    std::vector<int32_t> ints;
+    for (int i = 0; i < 129; i++) {
+        ints.push_back(100 + i * 5);
+    }
+    PageBuilderOptions builder_options;
+    builder_options.data_page_size = 256 * 1024;
+    DeltaPageBuilder<TYPE_INT> page_builder(builder_options);
+    page_builder.add(reinterpret_cast<const uint8_t*>(ints.data()), ints.size());
+    OwnedSlice s = page_builder.finish()->build();
+    ASSERT_EQ(DeltaPageMode::DELTA, page_builder.mode());
+    // header: 8 bytes
+    // miniblock headers: 2 * (4 bytes first value + 4 bytes min delta + 1 byte bit width) = 18
+    // miniblock data: the deltas are all 5, so the bit widths are 0
+    ASSERT_EQ(26, s.slice().size);
+}
+
+TEST_F(DeltaPageTest, TestFirstLastValue) {
+    std::vector<int32_t> ints;
+    for (int i = 0; i < 128; i++) {
+        ints.push_back(i);
+    }
+    PageBuilderOptions builder_options;
+    builder_options.data_page_size = 256 * 1024;
+    DeltaPageBuilder<TYPE_INT> page_builder(builder_options);
+    page_builder.add(reinterpret_cast<const uint8_t*>(ints.data()), ints.size());
+    OwnedSlice s = page_builder.finish()->build();
+    int32_t first_value = -1;
+    ASSERT_TRUE(page_builder.get_first_value(&first_value).ok());
+    ASSERT_EQ(0, first_value);
+    int32_t last_value = 0;
+    ASSERT_TRUE(page_builder.get_last_value(&last_value).ok());
+    ASSERT_EQ(127, last_value);
+
+    page_builder.reset();
+    ASSERT_EQ(0, page_builder.count());
+    ASSERT_TRUE(page_builder.get_first_value(&first_value).is_not_found());
+}
+
+TEST_F(DeltaPageTest, TestPageFull) {
+    std::vector<int64_t> ints(1000, 7);
+    PageBuilderOptions builder_options;
+    builder_options.data_page_size = 800;
+    DeltaPageBuilder<TYPE_BIGINT> page_builder(builder_options);
+    ASSERT_EQ(100, page_builder.add(reinterpret_cast<const uint8_t*>(ints.data()), ints.size()));
+    ASSERT_TRUE(page_builder.is_page_full());
+}
+
+TEST_F(DeltaPageTest, TestCorruptedPage) {
+    std::vector<int32_t> ints(300, 1);
+    PageBuilderOptions builder_options;
+    DeltaPageBuilder<TYPE_INT> page_builder(builder_options);
+    page_builder.add(reinterpret_cast<const uint8_t*>(ints.data()), ints.size());
+    OwnedSlice s = page_builder.finish()->build();
+
+    DeltaPageDecoder<TYPE_BIGINT> wrong_type_decoder(s.slice());
+    ASSERT_TRUE(wrong_type_decoder.init().is_corruption());
+    DeltaPageDecoder<TYPE_INT> truncated_decoder(Slice(s.slice().data, s.slice().size - 1));
+    ASSERT_TRUE(truncated_decoder.init().is_corruption());
+}
+
+} // namespace starrocks
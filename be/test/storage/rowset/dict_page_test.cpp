@@ -22,6 +22,7 @@
 
 #include "column/column.h"
 #include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
 #include "storage/rowset/binary_plain_page.h"
 #include "storage/rowset/page_decoder.h"
 #include "storage/rowset/storage_page_decoder.h"
@@ -391,4 +392,71 @@ TEST_F(DictPageTest, TestLargeDataSize) {
     }
 }
 
+TEST_F(DictPageTest, TestNextBatchWithFilter) {
+    const uint32_t size = 2000;
+    std::vector<int32_t> ints(size);
+    for (int i = 0; i < size; i++) {
+        ints[i] = (i * 7) % 100;
+    }
+    PageBuilderOptions options;
+    options.data_page_size = 1024 * 1024;
+    options.dict_page_size = 1024 * 1024;
+    DictPageBuilder<TYPE_INT> page_builder(options);
+    ASSERT_EQ(size, page_builder.add(reinterpret_cast<const uint8_t*>(ints.data()), size));
+    OwnedSlice data_slice = page_builder.finish()->build();
+    OwnedSlice dict_slice = page_builder.get_dictionary_page()->build();
+
+    PageFooterPB footer;
+    footer.set_type(DATA_PAGE);
+    footer.mutable_data_page_footer()->set_nullmap_size(0);
+    Slice encoded_dict = dict_slice.slice();
+    std::unique_ptr<char[]> dict_page;
+    ASSERT_TRUE(StoragePageDecoder::decode_page(&footer, 0, BIT_SHUFFLE, &dict_page, &encoded_dict).ok());
+    BitShufflePageDecoder<TYPE_INT> dict_decoder(encoded_dict);
+    ASSERT_TRUE(dict_decoder.init().ok());
+    ASSERT_EQ(100, dict_decoder.count());
+
+    Slice encoded_data = data_slice.slice();
+    std::unique_ptr<char[]> data_page;
+    ASSERT_TRUE(StoragePageDecoder::decode_page(&footer, 0, DICT_ENCODING, &data_page, &encoded_data).ok());
+    DictPageDecoder<TYPE_INT> page_decoder(encoded_data);
+    page_decoder.set_dict_decoder(&dict_decoder);
+    ASSERT_TRUE(page_decoder.init().ok());
+
+    auto type_info = get_type_info(TYPE_INT);
+    std::unique_ptr<ColumnPredicate> ge(new_column_ge_predicate(type_info, 0, "90"));
+    std::unique_ptr<ColumnPredicate> ne(new_column_ne_predicate(type_info, 0, "95"));
+    std::vector<const ColumnPredicate*> preds = {ge.get(), ne.get()};
+
+    // The results of the codes evaluated by the first batch are reused by the second one.
+    std::vector<SparseRange<>> ranges = {SparseRange<>(0, 50), SparseRange<>({Range<>(60, 500), Range<>(1000, 2000)})};
+    for (const SparseRange<>& range : ranges) {
+        ASSERT_TRUE(page_decoder.seek_to_position_in_page(range.begin()).ok());
+        auto column = ChunkHelper::column_from_field_type(TYPE_INT, false);
+        std::vector<uint8_t> selection(range.span_size(), 1);
+        ASSERT_TRUE(page_decoder.next_batch_with_filter(range, preds, selection.data(), column.get()).ok());
+        ASSERT_EQ(range.span_size(), column->size());
+        ASSERT_EQ(range.end(), page_decoder.current_index());
+
+        size_t row = 0;
+        SparseRangeIterator<> iter = range.new_iterator();
+        while (iter.has_more()) {
+            Range<> r = iter.next(range.span_size());
+            for (uint32_t i = r.begin(); i < r.end(); i++, row++) {
+                ASSERT_EQ(ints[i] >= 90 && ints[i] != 95, selection[row] != 0) << i;
+                if (selection[row]) {
+                    ASSERT_EQ(ints[i], column->get(row).get_int32());
+                }
+            }
+        }
+    }
+
+    std::unique_ptr<ColumnPredicate> is_null(new_column_null_predicate(type_info, 0, true));
+    auto column = ChunkHelper::column_from_field_type(TYPE_INT, false);
+    std::vector<uint8_t> selection(10, 1);
+    Status st = page_decoder.next_batch_with_filter(SparseRange<>(0, 10), {is_null.get()}, selection.data(),
+                                                    column.get());
+    ASSERT_TRUE(st.is_not_supported());
+}
+
 } // namespace starrocks
@@ -126,6 +126,48 @@ TEST_F(EncodingInfoTest, get_default_encoding_number_types) {
     config::dictionary_encoding_ratio_for_non_string_column = 0;
 }
 
+TEST_F(EncodingInfoTest, get_default_encoding_delta) {
+    std::vector<LogicalType> delta_types = {TYPE_INT, TYPE_BIGINT, TYPE_DATE, TYPE_DATETIME};
+    for (auto logicType : delta_types) {
+        EXPECT_EQ(true, integer_types_support_delta_encoding(logicType));
+        const EncodingInfo* encoding_info;
+        auto status = EncodingInfo::get(logicType, DELTA_ENCODING, &encoding_info);
+        ASSERT_TRUE(status.ok());
+        EXPECT_EQ(DELTA_ENCODING, encoding_info->encoding());
+        EXPECT_EQ(BIT_SHUFFLE, EncodingInfo::get_default_encoding(logicType, false));
+    }
+    EXPECT_EQ(false, integer_types_support_delta_encoding(TYPE_LARGEINT));
+    EXPECT_EQ(false, integer_types_support_delta_encoding(TYPE_DOUBLE));
+
+    config::enable_integer_delta_encoding = true;
+    for (auto logicType : delta_types) {
+        EXPECT_EQ(DELTA_ENCODING, EncodingInfo::get_default_encoding(logicType, false));
+        EXPECT_EQ(FOR_ENCODING, EncodingInfo::get_default_encoding(logicType, true));
+        const EncodingInfo* encoding_info;
+        auto status = EncodingInfo::get(logicType, DEFAULT_ENCODING, &encoding_info);
+        ASSERT_TRUE(status.ok());
+        EXPECT_EQ(DELTA_ENCODING, encoding_info->encoding());
+    }
+    EXPECT_EQ(BIT_SHUFFLE, EncodingInfo::get_default_encoding(TYPE_SMALLINT, false));
+    config::enable_integer_delta_encoding = false;
+}
+
+TEST_F(EncodingInfoTest, get_default_encoding_alp) {
+    for (auto logicType : {TYPE_FLOAT, TYPE_DOUBLE}) {
+        EXPECT_EQ(true, float_types_support_alp_encoding(logicType));
+        const EncodingInfo* encoding_info;
+        auto status = EncodingInfo::get(logicType, ALP_ENCODING, &encoding_info);
+        ASSERT_TRUE(status.ok());
+        EXPECT_EQ(ALP_ENCODING, encoding_info->encoding());
+        EXPECT_EQ(BIT_SHUFFLE, EncodingInfo::get_default_encoding(logicType, false));
+
+        config::enable_float_alp_encoding = true;
+        EXPECT_EQ(ALP_ENCODING, EncodingInfo::get_default_encoding(logicType, false));
+        config::enable_float_alp_encoding = false;
+    }
+    EXPECT_EQ(false, float_types_support_alp_encoding(TYPE_DECIMALV2));
+}
+
 TEST_F(EncodingInfoTest, default_encoding) {
     std::map<LogicalType, EncodingTypePB> default_expected = {
             {TYPE_TINYINT, BIT_SHUFFLE},  {TYPE_SMALLINT, BIT_SHUFFLE},  {TYPE_INT, BIT_SHUFFLE},
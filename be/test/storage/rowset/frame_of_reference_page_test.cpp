@@ -36,6 +36,7 @@
 
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <memory>
 
 #include "column/column_helper.h"
@@ -44,6 +45,7 @@
 #include "runtime/large_int_value.h"
 #include "runtime/mem_pool.h"
 #include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
 #include "storage/rowset/options.h"
 #include "storage/rowset/page_builder.h"
 #include "storage/rowset/page_decoder.h"
@@ -343,4 +345,60 @@ TEST_F(FrameOfReferencePageTest, TestFindBitsOfInt) {
     ASSERT_EQ(65, bits(bits_65));
 }
 
+TEST_F(FrameOfReferencePageTest, TestNextBatchWithFilter) {
+    const uint32_t size = 10000;
+    std::vector<int32_t> ints(size);
+    for (int32_t i = 0; i < size; i++) {
+        ints[i] = i * 10 + random() % 10;
+    }
+    PageBuilderOptions builder_options;
+    builder_options.data_page_size = 256 * 1024;
+    FrameOfReferencePageBuilder<TYPE_INT> builder(builder_options);
+    builder.add(reinterpret_cast<const uint8_t*>(ints.data()), size);
+    OwnedSlice s = builder.finish()->build();
+
+    auto type_info = get_type_info(TYPE_INT);
+    std::unique_ptr<ColumnPredicate> ge(new_column_ge_predicate(type_info, 0, "35000"));
+    std::unique_ptr<ColumnPredicate> lt(new_column_lt_predicate(type_info, 0, "60005"));
+    std::unique_ptr<ColumnPredicate> eq(new_column_eq_predicate(type_info, 0, std::to_string(ints[4321])));
+    std::vector<std::pair<std::vector<const ColumnPredicate*>, std::function<bool(int32_t)>>> cases = {
+            {{ge.get()}, [](int32_t v) { return v >= 35000; }},
+            {{ge.get(), lt.get()}, [](int32_t v) { return v >= 35000 && v < 60005; }},
+            {{eq.get()}, [&](int32_t v) { return v == ints[4321]; }},
+    };
+    for (const auto& [preds, expected] : cases) {
+        FrameOfReferencePageDecoder<TYPE_INT> decoder(s.slice());
+        ASSERT_TRUE(decoder.init().ok());
+        SparseRange<> range;
+        range.add(Range<>(100, 3000));
+        range.add(Range<>(3100, 7000));
+        range.add(Range<>(9000, size));
+        ASSERT_TRUE(decoder.seek_to_position_in_page(range.begin()).ok());
+        auto column = ChunkHelper::column_from_field_type(TYPE_INT, false);
+        std::vector<uint8_t> selection(range.span_size(), 1);
+        ASSERT_TRUE(decoder.next_batch_with_filter(range, preds, selection.data(), column.get()).ok());
+        ASSERT_EQ(range.span_size(), column->size());
+        ASSERT_EQ(size, decoder.current_index());
+
+        size_t row = 0;
+        SparseRangeIterator<> iter = range.new_iterator();
+        while (iter.has_more()) {
+            Range<> r = iter.next(range.span_size());
+            for (uint32_t i = r.begin(); i < r.end(); i++, row++) {
+                ASSERT_EQ(expected(ints[i]), selection[row] != 0) << i;
+                if (selection[row]) {
+                    ASSERT_EQ(ints[i], column->get(row).get_int32());
+                }
+            }
+        }
+
+        // The decoder can still be read after the frames skipped.
+        ASSERT_TRUE(decoder.seek_to_position_in_page(4000).ok());
+        auto column1 = ChunkHelper::column_from_field_type(TYPE_INT, false);
+        size_t n = 10;
+        ASSERT_TRUE(decoder.next_batch(&n, column1.get()).ok());
+        ASSERT_EQ(ints[4000], column1->get(0).get_int32());
+    }
+}
+
 } // namespace starrocks
@@ -0,0 +1,263 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/fsst_page.h"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "column/binary_column.h"
+#include "storage/column_predicate.h"
+#include "storage/range.h"
+#include "storage/rowset/options.h"
+#include "storage/types.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class FsstPageTest : public testing::Test {
+protected:
+    void SetUp() override {
+        std::mt19937 rng(0);
+        const char* parts[] = {"https://", "www.", "starrocks", ".io", "/docs", "/blog", "?id=", "&page="};
+        for (int i = 0; i < 1000; i++) {
+            std::string s;
+            for (int j = 0; j < 4; j++) {
+                s += parts[rng() % 8];
+            }
+            s += std::to_string(rng() % 100);
+            _values.push_back(std::move(s));
+        }
+        // Bytes not covered by any symbol, and an empty string.
+        _values[10] = std::string("\x00\xff\x01", 3);
+        _values[11] = "";
+    }
+
+    OwnedSlice build_page(const std::vector<std::string>& values) {
+        std::vector<Slice> slices(values.begin(), values.end());
+        PageBuilderOptions options;
+        options.data_page_size = 256 * 1024;
+        FsstPageBuilder builder(options);
+        EXPECT_EQ(slices.size(), builder.add(reinterpret_cast<const uint8_t*>(slices.data()), slices.size()));
+        OwnedSlice page = builder.finish()->build();
+        EXPECT_EQ(slices.size(), builder.count());
+        EXPECT_GT(builder.num_symbols(), 0);
+
+        Slice first;
+        Slice last;
+        EXPECT_TRUE(builder.get_first_value(&first).ok());
+        EXPECT_TRUE(builder.get_last_value(&last).ok());
+        EXPECT_EQ(Slice(values.front()), first);
+        EXPECT_EQ(Slice(values.back()), last);
+        return page;
+    }
+
+    // Read the rows of |range| with |preds|, and check the rows selected against |expected|.
+    void check_filter(const std::vector<const ColumnPredicate*>& preds, const SparseRange<>& range,
+                      const std::function<bool(const std::string&)>& expected) {
+        OwnedSlice page = build_page(_values);
+        FsstPageDecoder<TYPE_VARCHAR> decoder(page.slice());
+        ASSERT_OK(decoder.init());
+        ASSERT_OK(decoder.seek_to_position_in_page(range.begin()));
+
+        BinaryColumn column;
+        std::vector<uint8_t> selection(range.span_size(), 1);
+        ASSERT_OK(decoder.next_batch_with_filter(range, preds, selection.data(), &column));
+        ASSERT_EQ(range.span_size(), column.size());
+        ASSERT_EQ(range.end(), decoder.current_index());
+
+        size_t row = 0;
+        SparseRangeIterator<> iter = range.new_iterator();
+        while (iter.has_more()) {
+            Range<> r = iter.next(range.span_size());
+            for (uint32_t i = r.begin(); i < r.end(); i++, row++) {
+                ASSERT_EQ(expected(_values[i]), selection[row] != 0) << _values[i];
+                if (selection[row]) {
+                    ASSERT_EQ(_values[i], column.get_slice(row).to_string());
+                }
+            }
+        }
+    }
+
+    std::vector<std::string> _values;
+};
+
+TEST_F(FsstPageTest, test_encode_decode) {
+    OwnedSlice page = build_page(_values);
+    size_t raw_size = 0;
+    for (const auto& v : _values) {
+        raw_size += v.size();
+    }
+    EXPECT_LT(page.slice().size, raw_size);
+
+    FsstPageDecoder<TYPE_VARCHAR> decoder(page.slice());
+    ASSERT_OK(decoder.init());
+    ASSERT_EQ(_values.size(), decoder.count());
+    ASSERT_EQ(FSST_ENCODING, decoder.encoding_type());
+
+    BinaryColumn column;
+    size_t n = _values.size();
+    ASSERT_OK(decoder.next_batch(&n, &column));
+    ASSERT_EQ(_values.size(), n);
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(_values[i], column.get_slice(i).to_string());
+    }
+
+    // Seek and read across the end of the page.
+    ASSERT_OK(decoder.seek_to_position_in_page(990));
+    column.reset_column();
+    n = 100;
+    ASSERT_OK(decoder.next_batch(&n, &column));
+    ASSERT_EQ(10, n);
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(_values[990 + i], column.get_slice(i).to_string());
+    }
+}
+
+TEST_F(FsstPageTest, test_read_by_range) {
+    OwnedSlice page = build_page(_values);
+    FsstPageDecoder<TYPE_VARCHAR> decoder(page.slice());
+    ASSERT_OK(decoder.init());
+
+    SparseRange<> range;
+    range.add(Range<>(5, 20));
+    range.add(Range<>(100, 101));
+    range.add(Range<>(500, 800));
+    ASSERT_OK(decoder.seek_to_position_in_page(5));
+    BinaryColumn column;
+    ASSERT_OK(decoder.next_batch(range, &column));
+    ASSERT_EQ(range.span_size(), column.size());
+    ASSERT_EQ(800, decoder.current_index());
+
+    size_t row = 0;
+    SparseRangeIterator<> iter = range.new_iterator();
+    while (iter.has_more()) {
+        Range<> r = iter.next(range.span_size());
+        for (uint32_t i = r.begin(); i < r.end(); i++) {
+            ASSERT_EQ(_values[i], column.get_slice(row++).to_string());
+        }
+    }
+}
+
+TEST_F(FsstPageTest, test_char_strip_zero) {
+    std::vector<std::string> values = {std::string("abc\0\0\0", 6), std::string("starrocks\0", 10), "xyz"};
+    OwnedSlice page = build_page(values);
+    FsstPageDecoder<TYPE_CHAR> decoder(page.slice());
+    ASSERT_OK(decoder.init());
+    BinaryColumn column;
+    size_t n = values.size();
+    ASSERT_OK(decoder.next_batch(&n, &column));
+    ASSERT_EQ("abc", column.get_slice(0).to_string());
+    ASSERT_EQ("starrocks", column.get_slice(1).to_string());
+    ASSERT_EQ("xyz", column.get_slice(2).to_string());
+}
+
+TEST_F(FsstPageTest, test_corrupted_page) {
+    OwnedSlice page = build_page(_values);
+    Slice data = page.slice();
+    FsstPageDecoder<TYPE_VARCHAR> truncated(Slice(data.data, data.size - 1));
+    ASSERT_FALSE(truncated.init().ok());
+    FsstPageDecoder<TYPE_VARCHAR> empty(Slice(data.data, 2));
+    ASSERT_FALSE(empty.init().ok());
+}
+
+TEST_F(FsstPageTest, test_filter_eq_ne) {
+    const std::string target = _values[42];
+    std::unique_ptr<ColumnPredicate> eq(new_column_eq_predicate(get_type_info(TYPE_VARCHAR), 0, target));
+    std::unique_ptr<ColumnPredicate> ne(new_column_ne_predicate(get_type_info(TYPE_VARCHAR), 0, target));
+    ASSERT_TRUE(eq->support_fsst_evaluate());
+    ASSERT_TRUE(ne->support_fsst_evaluate());
+
+    SparseRange<> range;
+    range.add(Range<>(0, 300));
+    range.add(Range<>(600, 1000));
+    check_filter({eq.get()}, range, [&](const std::string& v) { return v == target; });
+    check_filter({ne.get()}, range, [&](const std::string& v) { return v != target; });
+    check_filter({eq.get(), ne.get()}, range, [](const std::string& v) { return false; });
+}
+
+TEST_F(FsstPageTest, test_filter_like) {
+    auto type_info = get_type_info(TYPE_VARCHAR);
+    SparseRange<> range;
+    range.add(Range<>(0, 1000));
+
+    std::unique_ptr<ColumnPredicate> prefix(new_column_like_predicate(type_info, 0, "https://www.%"));
+    ASSERT_NE(nullptr, prefix);
+    check_filter({prefix.get()}, range, [](const std::string& v) { return v.rfind("https://www.", 0) == 0; });
+
+    std::unique_ptr<ColumnPredicate> suffix(new_column_like_predicate(type_info, 0, "%.io7"));
+    ASSERT_NE(nullptr, suffix);
+    check_filter({suffix.get()}, range, [](const std::string& v) {
+        return v.size() >= 4 && v.compare(v.size() - 4, 4, ".io7") == 0;
+    });
+
+    std::unique_ptr<ColumnPredicate> contains(new_column_like_predicate(type_info, 0, "%docs?id=%"));
+    ASSERT_NE(nullptr, contains);
+    check_filter({contains.get()}, range, [](const std::string& v) { return v.find("docs?id=") != std::string::npos; });
+
+    std::unique_ptr<ColumnPredicate> exact(new_column_like_predicate(type_info, 0, _values[7]));
+    ASSERT_NE(nullptr, exact);
+    const std::string target = _values[7];
+    check_filter({exact.get()}, range, [&](const std::string& v) { return v == target; });
+
+    // Longer than FsstMatcher::kMaxNeedleLength, evaluated by decompressing the strings.
+    std::string long_needle(FsstMatcher::kMaxNeedleLength + 1, 'a');
+    std::unique_ptr<ColumnPredicate> long_like(new_column_like_predicate(type_info, 0, "%" + long_needle + "%"));
+    ASSERT_NE(nullptr, long_like);
+    check_filter({long_like.get()}, range, [](const std::string& v) { return false; });
+
+    check_filter({prefix.get(), contains.get()}, range, [](const std::string& v) {
+        return v.rfind("https://www.", 0) == 0 && v.find("docs?id=") != std::string::npos;
+    });
+
+    // Only the simple patterns on VARCHAR are supported.
+    ASSERT_EQ(nullptr, new_column_like_predicate(type_info, 0, "a%b"));
+    ASSERT_EQ(nullptr, new_column_like_predicate(type_info, 0, "a_b"));
+    ASSERT_EQ(nullptr, new_column_like_predicate(get_type_info(TYPE_CHAR), 0, "ab%"));
+}
+
+TEST_F(FsstPageTest, test_like_predicate_evaluate) {
+    std::unique_ptr<ColumnPredicate> like(new_column_like_predicate(get_type_info(TYPE_VARCHAR), 0, "%rock%"));
+    ASSERT_NE(nullptr, like);
+    ASSERT_EQ(PredicateType::kLike, like->type());
+    BinaryColumn column;
+    column.append(Slice("starrocks"));
+    column.append(Slice("rock"));
+    column.append(Slice("roc"));
+    std::vector<uint8_t> selection(3, 0);
+    ASSERT_OK(like->evaluate(&column, selection.data(), 0, 3));
+    ASSERT_EQ(std::vector<uint8_t>({1, 1, 0}), selection);
+}
+
+TEST_F(FsstPageTest, test_unsupported_predicate) {
+    std::unique_ptr<ColumnPredicate> lt(new_column_lt_predicate(get_type_info(TYPE_VARCHAR), 0, "m"));
+    ASSERT_FALSE(lt->support_fsst_evaluate());
+    OwnedSlice page = build_page(_values);
+    FsstPageDecoder<TYPE_VARCHAR> decoder(page.slice());
+    ASSERT_OK(decoder.init());
+    SparseRange<> range;
+    range.add(Range<>(0, 10));
+    BinaryColumn column;
+    std::vector<uint8_t> selection(10, 1);
+    ASSERT_TRUE(decoder.next_batch_with_filter(range, {lt.get()}, selection.data(), &column).is_not_supported());
+    ASSERT_EQ(0, column.size());
+    ASSERT_EQ(0, decoder.current_index());
+}
+
+} // namespace starrocks
@@ -43,6 +43,7 @@
 #include "runtime/mem_pool.h"
 #include "runtime/mem_tracker.h"
 #include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
 #include "storage/rowset/options.h"
 #include "storage/rowset/page_builder.h"
 #include "storage/rowset/page_decoder.h"
@@ -258,4 +259,52 @@ TEST_F(RlePageTest, TestRleBoolBlockEncoderSize) {
     ASSERT_EQ(7, s.slice().size);
 }
 
+TEST_F(RlePageTest, TestRleBoolNextBatchWithFilter) {
+    const uint32_t size = 10000;
+    std::vector<uint8_t> bools;
+    while (bools.size() < size) {
+        bools.insert(bools.end(), 1 + random() % 50, random() % 2);
+    }
+    bools.resize(size);
+    OwnedSlice s = rle_encode<TYPE_BOOLEAN>(reinterpret_cast<bool*>(bools.data()), size);
+
+    std::unique_ptr<ColumnPredicate> eq(new_column_eq_predicate(get_type_info(TYPE_BOOLEAN), 0, "1"));
+    std::unique_ptr<ColumnPredicate> ne(new_column_ne_predicate(get_type_info(TYPE_BOOLEAN), 0, "1"));
+    for (const ColumnPredicate* pred : {eq.get(), ne.get()}) {
+        RlePageDecoder<TYPE_BOOLEAN> decoder(s.slice());
+        ASSERT_TRUE(decoder.init().ok());
+        SparseRange<> range;
+        range.add(Range<>(10, 3000));
+        range.add(Range<>(5000, size));
+        ASSERT_TRUE(decoder.seek_to_position_in_page(range.begin()).ok());
+        auto column = ChunkHelper::column_from_field_type(TYPE_BOOLEAN, false);
+        std::vector<uint8_t> selection(range.span_size(), 1);
+        ASSERT_TRUE(decoder.next_batch_with_filter(range, {pred}, selection.data(), column.get()).ok());
+        ASSERT_EQ(range.span_size(), column->size());
+        ASSERT_EQ(size, decoder.current_index());
+
+        const auto* values = reinterpret_cast<const uint8_t*>(column->raw_data());
+        size_t row = 0;
+        SparseRangeIterator<> iter = range.new_iterator();
+        while (iter.has_more()) {
+            Range<> r = iter.next(range.span_size());
+            for (uint32_t i = r.begin(); i < r.end(); i++, row++) {
+                ASSERT_EQ(bools[i], values[row]);
+                ASSERT_EQ((bools[i] != 0) == (pred == eq.get()), selection[row] != 0);
+            }
+        }
+    }
+
+    // The predicates which take NULL into account are not supported.
+    std::unique_ptr<ColumnPredicate> is_null(new_column_null_predicate(get_type_info(TYPE_BOOLEAN), 0, true));
+    RlePageDecoder<TYPE_BOOLEAN> decoder(s.slice());
+    ASSERT_TRUE(decoder.init().ok());
+    SparseRange<> range(0, 10);
+    auto column = ChunkHelper::column_from_field_type(TYPE_BOOLEAN, false);
+    std::vector<uint8_t> selection(10, 1);
+    Status st = decoder.next_batch_with_filter(range, {is_null.get()}, selection.data(), column.get());
+    ASSERT_TRUE(st.is_not_supported());
+    ASSERT_EQ(0, column->size());
+}
+
 } // namespace starrocks
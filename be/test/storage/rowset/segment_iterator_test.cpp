@@ -34,6 +34,7 @@
 #include "storage/tablet_schema_helper.h"
 #include "testutil/assert.h"
 #include "types/logical_type.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -530,4 +531,100 @@ TEST_F(SegmentIteratorTest, TestGlobalDictNoLocalDict) {
     res_chunk->reset();
 }
 
+// NOLINTNEXTLINE
+TEST_F(SegmentIteratorTest, TestProgressiveLateMaterialization) {
+    using namespace starrocks::test;
+
+    std::string file_name = kSegmentDir + "/progressive_late_materialization";
+    ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(file_name));
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 100;
+    TabletSchemaBuilder builder;
+    std::shared_ptr<TabletSchema> tablet_schema = builder.create(1, false, TYPE_INT, true)
+                                                          .create(2, false, TYPE_INT)
+                                                          .create(3, false, TYPE_INT)
+                                                          .create(4, false, TYPE_INT)
+                                                          .build();
+    SegmentWriter writer(std::move(wfile), 0, tablet_schema, opts);
+
+    const int32_t chunk_size = config::vector_chunk_size;
+    const size_t num_rows = 10000;
+    TabletDataBuilder segment_data_builder(writer, tablet_schema, chunk_size, num_rows);
+    ASSERT_OK(segment_data_builder.append(0, [](int32_t i) { return i; }));
+    ASSERT_OK(segment_data_builder.append(1, [](int32_t i) { return i % 7; }));
+    ASSERT_OK(segment_data_builder.append(2, [](int32_t i) { return i % 3; }));
+    ASSERT_OK(segment_data_builder.append(3, [](int32_t i) { return -i; }));
+    ASSERT_OK(segment_data_builder.finalize_footer());
+
+    auto segment = *Segment::open(_fs, FileInfo{file_name}, 0, tablet_schema);
+    ASSERT_EQ(segment->num_rows(), num_rows);
+
+    auto type_int = get_type_info(TYPE_INT);
+    std::unique_ptr<ColumnPredicate> c0_ge(new_column_ge_predicate(type_int, 0, "100"));
+    std::unique_ptr<ColumnPredicate> c1_eq(new_column_eq_predicate(type_int, 1, "3"));
+    std::unique_ptr<ColumnPredicate> c2_eq(new_column_eq_predicate(type_int, 2, "0"));
+
+    auto read = [&](bool progressive, OlapReaderStatistics* stats) {
+        auto old_progressive = config::enable_progressive_late_materialization;
+        auto old_ratio = config::late_materialization_ratio;
+        config::enable_progressive_late_materialization = progressive;
+        // always use late materialization.
+        config::late_materialization_ratio = 1000;
+        DeferOp defer([&]() {
+            config::enable_progressive_late_materialization = old_progressive;
+            config::late_materialization_ratio = old_ratio;
+        });
+
+        VecSchemaBuilder schema_builder;
+        schema_builder.add(0, "c0", TYPE_INT).add(1, "c1", TYPE_INT).add(2, "c2", TYPE_INT).add(3, "c3", TYPE_INT);
+        auto vec_schema = schema_builder.build();
+        SegmentReadOptions seg_opts;
+        seg_opts.fs = _fs;
+        seg_opts.stats = stats;
+        seg_opts.tablet_schema = tablet_schema;
+        PredicateAndNode pred_root;
+        pred_root.add_child(PredicateColumnNode{c0_ge.get()});
+        pred_root.add_child(PredicateColumnNode{c1_eq.get()});
+        pred_root.add_child(PredicateColumnNode{c2_eq.get()});
+        seg_opts.pred_tree = PredicateTree::create(std::move(pred_root));
+
+        auto chunk_iter = new_segment_iterator(segment, vec_schema, seg_opts);
+        auto res_chunk = ChunkHelper::new_chunk(chunk_iter->schema(), chunk_size);
+        std::vector<int32_t> rows;
+        while (true) {
+            res_chunk->reset();
+            Status st = chunk_iter->get_next(res_chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            EXPECT_OK(st);
+            for (size_t i = 0; i < res_chunk->num_rows(); i++) {
+                int32_t c0 = res_chunk->get_column_by_index(0)->get(i).get_int32();
+                EXPECT_EQ(c0 % 7, res_chunk->get_column_by_index(1)->get(i).get_int32());
+                EXPECT_EQ(c0 % 3, res_chunk->get_column_by_index(2)->get(i).get_int32());
+                EXPECT_EQ(-c0, res_chunk->get_column_by_index(3)->get(i).get_int32());
+                rows.push_back(c0);
+            }
+        }
+        chunk_iter->close();
+        return rows;
+    };
+
+    std::vector<int32_t> expected;
+    for (int32_t i = 100; i < num_rows; i++) {
+        if (i % 7 == 3 && i % 3 == 0) {
+            expected.push_back(i);
+        }
+    }
+    OlapReaderStatistics stats;
+    ASSERT_EQ(expected, read(false, &stats));
+    ASSERT_EQ(0, stats.rows_pred_column_skipped);
+
+    OlapReaderStatistics progressive_stats;
+    ASSERT_EQ(expected, read(true, &progressive_stats));
+    // The later predicate columns are read only for the rows selected by the previous ones.
+    ASSERT_GT(progressive_stats.rows_pred_column_skipped, num_rows);
+    ASSERT_EQ(stats.rows_vec_cond_filtered, progressive_stats.rows_vec_cond_filtered);
+}
+
 } // namespace starrocks
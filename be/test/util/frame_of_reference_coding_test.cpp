@@ -19,6 +19,8 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
+
 namespace starrocks {
 class TestForCoding : public testing::Test {
 public:
@@ -243,4 +245,50 @@ TEST_F(TestForCoding, TestValueSeek) {
     ASSERT_EQ(found, false);
 }
 
+TEST_F(TestForCoding, TestFrameValueRange) {
+    faststring buffer(1);
+    ForEncoder<int64_t> encoder(&buffer);
+
+    std::vector<int64_t> data;
+    // Ascending frame.
+    for (int64_t i = 0; i < 128; ++i) {
+        data.push_back(1000 + i * 3);
+    }
+    // Frame of deltas from the min value.
+    for (int64_t i = 0; i < 128; ++i) {
+        data.push_back(-50 + (i * 37) % 101);
+    }
+    // Frame of the original values.
+    for (int64_t i = 0; i < 128; ++i) {
+        data.push_back(i % 2 == 0 ? std::numeric_limits<int64_t>::min() : std::numeric_limits<int64_t>::max());
+    }
+    // The last frame is shorter.
+    data.push_back(7);
+    data.push_back(7);
+    encoder.put_batch(data.data(), data.size());
+    encoder.flush();
+
+    ForDecoder<int64_t> decoder(buffer.data(), buffer.length());
+    ASSERT_TRUE(decoder.init());
+    ASSERT_EQ(128, decoder.max_frame_size());
+    for (uint32_t frame = 0; frame < 4; ++frame) {
+        int64_t min = 0;
+        int64_t max = 0;
+        if (frame == 2) {
+            ASSERT_FALSE(decoder.frame_value_range(frame, &min, &max));
+            continue;
+        }
+        ASSERT_TRUE(decoder.frame_value_range(frame, &min, &max));
+        for (size_t i = frame * 128; i < std::min<size_t>(data.size(), (frame + 1) * 128); ++i) {
+            ASSERT_LE(min, data[i]);
+            ASSERT_GE(max, data[i]);
+        }
+    }
+
+    // Skip to the end, the decoder stays at the end.
+    ASSERT_TRUE(decoder.skip(data.size()));
+    ASSERT_EQ(data.size(), decoder.current_index());
+    ASSERT_FALSE(decoder.skip(1));
+}
+
 } // namespace starrocks
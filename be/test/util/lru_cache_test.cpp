@@ -38,6 +38,8 @@
 
 #include <vector>
 
+#include "util/frequency_sketch.h"
+
 using namespace starrocks;
 using namespace std;
 
@@ -348,4 +350,157 @@ TEST_F(CacheTest, SetCapacity) {
     ASSERT_EQ(32, _cache->get_memory_usage());
 }
 
+class CachePolicyTest : public testing::TestWithParam<CacheEvictionPolicy> {
+public:
+    static void Deleter(const CacheKey& key, void* v) { _s_num_deleted++; }
+
+    static const int kCacheSize = kNumShards * 100;
+    static int _s_num_deleted;
+
+    CachePolicyTest() : _cache(new_lru_cache(kCacheSize, ChargeMode::VALUESIZE, GetParam())) { _s_num_deleted = 0; }
+
+    bool Lookup(int key) {
+        std::string result;
+        Cache::Handle* handle = _cache->lookup(EncodeKey(&result, key));
+        if (handle == nullptr) {
+            return false;
+        }
+        EXPECT_EQ(key, DecodeValue(_cache->value(handle)));
+        _cache->release(handle);
+        return true;
+    }
+
+    void Insert(int key, int charge, CachePriority priority = CachePriority::NORMAL) {
+        std::string result;
+        _cache->release(
+                _cache->insert(EncodeKey(&result, key), EncodeValue(key), charge, &CachePolicyTest::Deleter, priority));
+    }
+
+    // Read |key| through the cache, and return true if it's a hit.
+    bool Access(int key) {
+        if (Lookup(key)) {
+            return true;
+        }
+        Insert(key, 1);
+        return false;
+    }
+
+    std::unique_ptr<Cache> _cache;
+};
+int CachePolicyTest::_s_num_deleted;
+const int CachePolicyTest::kCacheSize;
+
+TEST_P(CachePolicyTest, HitMissAndErase) {
+    ASSERT_FALSE(Lookup(100));
+    Insert(100, 1);
+    Insert(200, 1);
+    ASSERT_TRUE(Lookup(100));
+    ASSERT_TRUE(Lookup(200));
+
+    // Replace, erase and pin.
+    Insert(100, 1);
+    ASSERT_EQ(1, _s_num_deleted);
+    std::string result;
+    CacheKey key = EncodeKey(&result, 200);
+    Cache::Handle* handle = _cache->lookup(key);
+    ASSERT_NE(nullptr, handle);
+    _cache->erase(key);
+    ASSERT_FALSE(Lookup(200));
+    ASSERT_EQ(1, _s_num_deleted);
+    _cache->release(handle);
+    ASSERT_EQ(2, _s_num_deleted);
+
+    _cache->prune();
+    ASSERT_FALSE(Lookup(100));
+    ASSERT_EQ(3, _s_num_deleted);
+    ASSERT_EQ(0, _cache->get_memory_usage());
+}
+
+TEST_P(CachePolicyTest, UsageWithinCapacity) {
+    for (int i = 0; i < 10 * kCacheSize; i++) {
+        Insert(i, (i & 1) ? 1 : 10);
+        ASSERT_LE(_cache->get_memory_usage(), kCacheSize + 10 * kNumShards);
+    }
+    // Entries pinned by handles are never evicted.
+    std::vector<Cache::Handle*> handles;
+    for (int i = 0; i < 2 * kCacheSize; i++) {
+        std::string result;
+        handles.push_back(_cache->insert(EncodeKey(&result, -1 - i), EncodeValue(-1 - i), 1, &Deleter));
+    }
+    ASSERT_EQ(2 * kCacheSize, _cache->get_memory_usage());
+    for (auto* handle : handles) {
+        _cache->release(handle);
+    }
+    ASSERT_LE(_cache->get_memory_usage(), kCacheSize);
+}
+
+TEST_P(CachePolicyTest, DurableEvictedLast) {
+    Insert(100, 1, CachePriority::DURABLE);
+    for (int i = 0; i < 10 * kCacheSize; i++) {
+        Insert(1000 + i, 1);
+    }
+    ASSERT_TRUE(Lookup(100));
+}
+
+TEST_P(CachePolicyTest, ScanResistance) {
+    // A hot set of half of the cache, which is accessed repeatedly and interleaved with a large scan.
+    const int kHotKeys = kCacheSize / 2;
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < kHotKeys; i++) {
+            Access(i);
+        }
+    }
+    int scan_key = kCacheSize;
+    int hits = 0;
+    for (int round = 0; round < 5; round++) {
+        for (int i = 0; i < kCacheSize; i++) {
+            Access(scan_key++);
+        }
+        for (int i = 0; i < kHotKeys; i++) {
+            hits += Access(i);
+        }
+    }
+    if (GetParam() == CacheEvictionPolicy::LRU) {
+        ASSERT_EQ(0, hits);
+    } else {
+        ASSERT_GT(hits, 5 * kHotKeys * 8 / 10);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(CachePolicyTest, CachePolicyTest,
+                         testing::Values(CacheEvictionPolicy::LRU, CacheEvictionPolicy::S3FIFO,
+                                         CacheEvictionPolicy::WTINYLFU));
+
+TEST(CacheEvictionPolicyTest, Parse) {
+    CacheEvictionPolicy policy;
+    ASSERT_TRUE(parse_cache_eviction_policy("s3fifo", &policy));
+    ASSERT_EQ(CacheEvictionPolicy::S3FIFO, policy);
+    ASSERT_TRUE(parse_cache_eviction_policy("wtinylfu", &policy));
+    ASSERT_EQ(CacheEvictionPolicy::WTINYLFU, policy);
+    ASSERT_TRUE(parse_cache_eviction_policy("lru", &policy));
+    ASSERT_EQ(CacheEvictionPolicy::LRU, policy);
+    ASSERT_FALSE(parse_cache_eviction_policy("fifo", &policy));
+}
+
+TEST(FrequencySketchTest, Frequency) {
+    FrequencySketch sketch(1024);
+    ASSERT_EQ(1024, sketch.width());
+    for (int i = 0; i < 5; i++) {
+        sketch.increment(42);
+    }
+    ASSERT_EQ(5, sketch.frequency(42));
+    ASSERT_EQ(0, sketch.frequency(43));
+    for (int i = 0; i < 100; i++) {
+        sketch.increment(7);
+    }
+    ASSERT_EQ(FrequencySketch::kMaxFrequency, sketch.frequency(7));
+
+    // The counters are halved periodically.
+    for (uint64_t i = 0; i < 10 * sketch.width(); i++) {
+        sketch.increment(43);
+    }
+    ASSERT_EQ(2, sketch.frequency(42));
+    ASSERT_EQ(FrequencySketch::kMaxFrequency / 2, sketch.frequency(7));
+}
+
 } // namespace starrocks
@@ -0,0 +1,204 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package com.starrocks.odps.reader;
+
+import com.aliyun.odps.type.TypeInfo;
+
+import java.nio.charset.StandardCharsets;
+import java.time.LocalDate;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.function.Function;
+
+/**
+ * A single-column predicate passed by BE, see `OdpsJniScanner` in jni_scanner.cpp. It is
+ * evaluated by the reader on the batches sent by odps, not by the odps service.
+ * Serialized as `column 0x1 op [0x1 value]...`, and predicates are separated by 0x2.
+ * Only integer, date and string columns are passed, and values are compared with the
+ * same semantic as BE (strings are compared as unsigned UTF-8 bytes).
+ * BE maps JSON and some other odps types to VARCHAR, the predicates on such columns, or on
+ * columns unknown to the reader, are not supported and select every row.
+ */
+public class OdpsPredicate {
+    private static final String KV_SEPARATOR = "\u0001";
+    private static final String PROP_SEPARATOR = "\u0002";
+
+    enum Op {
+        EQ, NE, LT, LE, GT, GE, IN, NOT_IN, IS_NULL, IS_NOT_NULL
+    }
+
+    private final String column;
+    private final Op op;
+    // null if the predicate is not supported
+    private final List<Comparable<Object>> values;
+
+    private OdpsPredicate(String column, Op op, List<Comparable<Object>> values) {
+        this.column = column;
+        this.op = op;
+        this.values = values;
+    }
+
+    public String getColumn() {
+        return column;
+    }
+
+    public boolean isSupported() {
+        return values != null;
+    }
+
+    public static List<OdpsPredicate> parse(String serialized, Function<String, TypeInfo> types) {
+        List<OdpsPredicate> predicates = new ArrayList<>();
+        if (serialized == null || serialized.isEmpty()) {
+            return predicates;
+        }
+        for (String item : serialized.split(PROP_SEPARATOR)) {
+            String[] parts = item.split(KV_SEPARATOR, -1);
+            String column = parts[0];
+            Op op = Op.valueOf(parts[1].toUpperCase());
+            TypeInfo typeInfo = types.apply(column);
+            predicates.add(new OdpsPredicate(column, op, parseValues(typeInfo, parts)));
+        }
+        return predicates;
+    }
+
+    // returns null if the predicate can not be evaluated on the column.
+    private static List<Comparable<Object>> parseValues(TypeInfo typeInfo, String[] parts) {
+        if (typeInfo == null || !isSupportedType(typeInfo)) {
+            return null;
+        }
+        List<Comparable<Object>> values = new ArrayList<>(parts.length - 2);
+        try {
+            for (int i = 2; i < parts.length; i++) {
+                values.add(parseValue(typeInfo, parts[i]));
+            }
+        } catch (RuntimeException e) {
+            return null;
+        }
+        return values;
+    }
+
+    private static boolean isSupportedType(TypeInfo typeInfo) {
+        switch (typeInfo.getOdpsType()) {
+            case TINYINT:
+            case SMALLINT:
+            case INT:
+            case BIGINT:
+            case DATE:
+            case STRING:
+            case VARCHAR:
+            case CHAR:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    @SuppressWarnings("unchecked")
+    private static Comparable<Object> parseValue(TypeInfo typeInfo, String value) {
+        switch (typeInfo.getOdpsType()) {
+            case TINYINT:
+            case SMALLINT:
+            case INT:
+            case BIGINT:
+                return (Comparable) Long.valueOf(value);
+            case DATE:
+                return (Comparable) LocalDate.parse(value);
+            default:
+                return (Comparable) new Utf8Bytes(value.getBytes(StandardCharsets.UTF_8));
+        }
+    }
+
+    @SuppressWarnings("unchecked")
+    private static Comparable<Object> normalize(Object data) {
+        if (data instanceof Number) {
+            return (Comparable) Long.valueOf(((Number) data).longValue());
+        }
+        if (data instanceof String) {
+            return (Comparable) new Utf8Bytes(((String) data).getBytes(StandardCharsets.UTF_8));
+        }
+        return (Comparable<Object>) data;
+    }
+
+    /**
+     * @param data the value of the column, decoded by {@link OdpsTypeUtils#getData}
+     * @return whether the row satisfies this predicate, null never satisfies a comparison.
+     */
+    public boolean test(Object data) {
+        if (!isSupported()) {
+            return true;
+        }
+        if (op == Op.IS_NULL) {
+            return data == null;
+        }
+        if (op == Op.IS_NOT_NULL) {
+            return data != null;
+        }
+        if (data == null) {
+            return false;
+        }
+        Comparable<Object> value = normalize(data);
+        switch (op) {
+            case EQ:
+                return value.compareTo(values.get(0)) == 0;
+            case NE:
+                return value.compareTo(values.get(0)) != 0;
+            case LT:
+                return value.compareTo(values.get(0)) < 0;
+            case LE:
+                return value.compareTo(values.get(0)) <= 0;
+            case GT:
+                return value.compareTo(values.get(0)) > 0;
+            case GE:
+                return value.compareTo(values.get(0)) >= 0;
+            case IN:
+                return values.contains(value);
+            case NOT_IN:
+                return !values.contains(value);
+            default:
+                return true;
+        }
+    }
+
+    private static final class Utf8Bytes implements Comparable<Utf8Bytes> {
+        private final byte[] bytes;
+
+        Utf8Bytes(byte[] bytes) {
+            this.bytes = bytes;
+        }
+
+        @Override
+        public int compareTo(Utf8Bytes other) {
+            int len = Math.min(bytes.length, other.bytes.length);
+            for (int i = 0; i < len; i++) {
+                int cmp = (bytes[i] & 0xff) - (other.bytes[i] & 0xff);
+                if (cmp != 0) {
+                    return cmp;
+                }
+            }
+            return bytes.length - other.bytes.length;
+        }
+
+        @Override
+        public boolean equals(Object o) {
+            return o instanceof Utf8Bytes && Arrays.equals(bytes, ((Utf8Bytes) o).bytes);
+        }
+
+        @Override
+        public int hashCode() {
+            return Arrays.hashCode(bytes);
+        }
+    }
+}
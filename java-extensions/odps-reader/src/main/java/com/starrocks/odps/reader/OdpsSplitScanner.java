@@ -29,10 +29,16 @@ import com.aliyun.odps.table.read.TableBatchReadSession;
 import com.aliyun.odps.table.read.split.InputSplit;
 import com.aliyun.odps.table.read.split.impl.IndexedInputSplit;
 import com.aliyun.odps.table.read.split.impl.RowRangeInputSplit;
+import com.aliyun.odps.type.TypeInfo;
 import com.aliyun.odps.utils.StringUtils;
 import com.starrocks.jni.connector.ColumnType;
 import com.starrocks.jni.connector.ConnectorScanner;
 import com.starrocks.utils.loader.ThreadContextClassLoader;
+import org.apache.arrow.c.ArrowArray;
+import org.apache.arrow.c.ArrowSchema;
+import org.apache.arrow.c.Data;
+import org.apache.arrow.memory.BufferAllocator;
+import org.apache.arrow.memory.RootAllocator;
 import org.apache.arrow.vector.FieldVector;
 import org.apache.arrow.vector.VectorSchemaRoot;
 import org.apache.arrow.vector.types.pojo.Field;
@@ -68,6 +74,15 @@ public class OdpsSplitScanner extends ConnectorScanner {
     private Map<String, Integer> nameIndexMap;
 
     private final String timezone;
+    // export batches through the Arrow C Data Interface instead of the off-heap table
+    private final boolean useArrowCData;
+    private BufferAllocator exportAllocator;
+    // predicates and limit passed by BE, rows rejected by them are not copied to the off-heap table.
+    // They only filter the batches already sent by odps, the read session is built by FE without a filter.
+    private final List<OdpsPredicate> readerPredicates;
+    // the limit is only applied if every predicate is evaluated by the reader, -1 otherwise.
+    private long limit;
+    private long numRowsReturned = 0;
 
     public OdpsSplitScanner(int fetchSize, Map<String, String> params) {
         this.fetchSize = fetchSize;
@@ -120,6 +135,17 @@ public class OdpsSplitScanner extends ConnectorScanner {
         settings = builder.build();
         this.classLoader = this.getClass().getClassLoader();
         this.timezone = params.get("time_zone");
+        this.useArrowCData = Boolean.parseBoolean(params.get("use_arrow_c_data"));
+        this.readerPredicates = OdpsPredicate.parse(params.get("reader_predicates"), name -> {
+            Column column = nameColumnMap.get(name);
+            return column == null ? null : column.getTypeInfo();
+        });
+        if (StringUtils.isNullOrEmpty(params.get("limit")) ||
+                !readerPredicates.stream().allMatch(OdpsPredicate::isSupported)) {
+            this.limit = -1;
+        } else {
+            this.limit = Long.parseLong(params.get("limit"));
+        }
     }
 
     @Override
@@ -130,6 +156,9 @@ public class OdpsSplitScanner extends ConnectorScanner {
                             .withCompressionCodec(CompressionCodec.ZSTD)
                             .withSettings(settings).build());
             initOffHeapTableWriter(requiredTypes, requiredFields, fetchSize);
+            if (useArrowCData) {
+                exportAllocator = new RootAllocator();
+            }
         } catch (Exception e) {
             close();
             String msg = "Failed to open the odps reader.";
@@ -144,6 +173,10 @@ public class OdpsSplitScanner extends ConnectorScanner {
             if (reader != null) {
                 reader.close();
             }
+            if (exportAllocator != null) {
+                exportAllocator.close();
+                exportAllocator = null;
+            }
         } catch (Exception e) {
             String msg = "Failed to close the odps reader.";
             LOG.error(msg, e);
@@ -159,22 +192,38 @@ public class OdpsSplitScanner extends ConnectorScanner {
     @Override
     public int getNext() throws IOException {
         try (ThreadContextClassLoader ignored = new ThreadContextClassLoader(classLoader)) {
-            if (reader.hasNext()) {
+            while (reader.hasNext()) {
+                if (limit >= 0 && numRowsReturned >= limit) {
+                    return 0;
+                }
                 VectorSchemaRoot vectorSchemaRoot = reader.get();
                 List<FieldVector> fieldVectors = vectorSchemaRoot.getFieldVectors();
                 ArrowVectorAccessor[] columnAccessors = new ArrowVectorAccessor[requireColumns.length];
                 List<Field> fields = vectorSchemaRoot.getSchema().getFields();
+                Map<String, Integer> vectorIndexMap = new HashMap<>();
                 for (int i = 0; i < fieldVectors.size(); i++) {
                     String filedName = fields.get(i).getName();
                     int fieldIndex = nameIndexMap.get(filedName);
                     columnAccessors[i] =
                             OdpsTypeUtils.createColumnVectorAccessor(fieldVectors.get(i),
                                     requireColumns[fieldIndex].getTypeInfo());
+                    vectorIndexMap.put(filedName, i);
                 }
+                int numRows = vectorSchemaRoot.getRowCount();
+                boolean[] selection = selectRows(columnAccessors, vectorIndexMap, numRows);
+                int numSelected = 0;
                 for (int rowId = 0; rowId < fieldVectors.size(); rowId++) {
                     String filedName = fields.get(rowId).getName();
                     int fieldIndex = nameIndexMap.get(filedName);
-                    for (int index = 0; index < vectorSchemaRoot.getRowCount(); index++) {
+                    numSelected = 0;
+                    for (int index = 0; index < numRows; index++) {
+                        if (selection != null && !selection[index]) {
+                            continue;
+                        }
+                        if (limit >= 0 && numRowsReturned + numSelected >= limit) {
+                            break;
+                        }
+                        numSelected++;
                         Object data =
                                 OdpsTypeUtils.getData(columnAccessors[rowId], requireColumns[fieldIndex].getTypeInfo(),
                                         index);
@@ -185,7 +234,14 @@ public class OdpsSplitScanner extends ConnectorScanner {
                         }
                     }
                 }
-                return vectorSchemaRoot.getRowCount();
+                if (fieldVectors.isEmpty()) {
+                    numSelected = limit >= 0 ? (int) Math.min(numRows, limit - numRowsReturned) : numRows;
+                }
+                if (numSelected > 0) {
+                    numRowsReturned += numSelected;
+                    return numSelected;
+                }
+                // every row of this batch is filtered, returning 0 would be treated as the end of split.
             }
             return 0;
         } catch (Exception e) {
@@ -196,6 +252,63 @@ public class OdpsSplitScanner extends ConnectorScanner {
         }
     }
 
+    // evaluate the reader predicates on the batch, returns null if all rows are selected.
+    private boolean[] selectRows(ArrowVectorAccessor[] columnAccessors, Map<String, Integer> vectorIndexMap,
+                                 int numRows) {
+        if (readerPredicates.isEmpty()) {
+            return null;
+        }
+        boolean[] selection = new boolean[numRows];
+        Arrays.fill(selection, true);
+        for (OdpsPredicate predicate : readerPredicates) {
+            Integer vectorIndex = vectorIndexMap.get(predicate.getColumn());
+            Integer fieldIndex = nameIndexMap.get(predicate.getColumn());
+            if (!predicate.isSupported() || vectorIndex == null || fieldIndex == null) {
+                // BE still evaluates the predicate, but the rows can not be limited here anymore.
+                limit = -1;
+                continue;
+            }
+            TypeInfo typeInfo = requireColumns[fieldIndex].getTypeInfo();
+            for (int index = 0; index < numRows; index++) {
+                if (selection[index]) {
+                    selection[index] =
+                            predicate.test(OdpsTypeUtils.getData(columnAccessors[vectorIndex], typeInfo, index));
+                }
+            }
+        }
+        return selection;
+    }
+
+    /**
+     * Export the next batch through the Arrow C Data Interface into the structs allocated by BE.
+     * The exported buffers are retained until BE calls the release callback, so BE can convert
+     * them directly without the intermediate off-heap table.
+     *
+     * @param arrayAddress  address of the `ArrowArray` struct to fill
+     * @param schemaAddress address of the `ArrowSchema` struct to fill
+     * @return the number of rows exported, 0 means end of split and nothing is exported.
+     */
+    public int getNextArrowBatch(long arrayAddress, long schemaAddress) throws IOException {
+        try (ThreadContextClassLoader ignored = new ThreadContextClassLoader(classLoader)) {
+            if (!reader.hasNext()) {
+                return 0;
+            }
+            VectorSchemaRoot vectorSchemaRoot = reader.get();
+            int numRows = vectorSchemaRoot.getRowCount();
+            if (numRows == 0) {
+                return 0;
+            }
+            Data.exportVectorSchemaRoot(exportAllocator, vectorSchemaRoot, null,
+                    ArrowArray.wrap(arrayAddress), ArrowSchema.wrap(schemaAddress));
+            return numRows;
+        } catch (Exception e) {
+            close();
+            String msg = "Failed to export the next arrow batch of odps.";
+            LOG.error(msg, e);
+            throw new IOException(msg, e);
+        }
+    }
+
     @Override
     public String toString() {
         StringBuilder sb = new StringBuilder();
@@ -0,0 +1,128 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+package com.starrocks.odps.reader;
+
+import com.aliyun.odps.OdpsType;
+import com.aliyun.odps.type.TypeInfo;
+import com.aliyun.odps.type.TypeInfoFactory;
+import org.junit.Assert;
+import org.junit.Test;
+
+import java.time.LocalDate;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+public class TestOdpsPredicate {
+    private static final Map<String, TypeInfo> TYPES = new HashMap<>();
+
+    static {
+        TYPES.put("i", TypeInfoFactory.BIGINT);
+        TYPES.put("d", TypeInfoFactory.DATE);
+        TYPES.put("s", TypeInfoFactory.STRING);
+        TYPES.put("j", TypeInfoFactory.getPrimitiveTypeInfo(OdpsType.JSON));
+    }
+
+    private static OdpsPredicate parseOne(String... parts) {
+        List<OdpsPredicate> predicates = OdpsPredicate.parse(String.join("\u0001", parts), TYPES::get);
+        Assert.assertEquals(1, predicates.size());
+        return predicates.get(0);
+    }
+
+    @Test
+    public void testParseMultiple() {
+        String serialized = "i\u0001ge\u00011\u0002s\u0001is_not_null";
+        List<OdpsPredicate> predicates = OdpsPredicate.parse(serialized, TYPES::get);
+        Assert.assertEquals(2, predicates.size());
+        Assert.assertEquals("i", predicates.get(0).getColumn());
+        Assert.assertEquals("s", predicates.get(1).getColumn());
+        Assert.assertTrue(OdpsPredicate.parse("", TYPES::get).isEmpty());
+        Assert.assertTrue(OdpsPredicate.parse(null, TYPES::get).isEmpty());
+    }
+
+    @Test
+    public void testInteger() {
+        OdpsPredicate eq = parseOne("i", "eq", "10");
+        Assert.assertTrue(eq.isSupported());
+        Assert.assertTrue(eq.test(10L));
+        Assert.assertTrue(eq.test(10));
+        Assert.assertFalse(eq.test(11L));
+        Assert.assertFalse(eq.test(null));
+
+        OdpsPredicate lt = parseOne("i", "lt", "-3");
+        Assert.assertTrue(lt.test(-4L));
+        Assert.assertFalse(lt.test(-3L));
+
+        OdpsPredicate in = parseOne("i", "in", "1", "3");
+        Assert.assertTrue(in.test(3L));
+        Assert.assertFalse(in.test(2L));
+
+        OdpsPredicate notIn = parseOne("i", "not_in", "1", "3");
+        Assert.assertTrue(notIn.test(2L));
+        Assert.assertFalse(notIn.test(1L));
+        Assert.assertFalse(notIn.test(null));
+    }
+
+    @Test
+    public void testDate() {
+        OdpsPredicate ge = parseOne("d", "ge", "2024-02-29");
+        Assert.assertTrue(ge.test(LocalDate.of(2024, 2, 29)));
+        Assert.assertTrue(ge.test(LocalDate.of(2024, 3, 1)));
+        Assert.assertFalse(ge.test(LocalDate.of(2023, 12, 31)));
+    }
+
+    @Test
+    public void testString() {
+        OdpsPredicate eq = parseOne("s", "eq", "abc");
+        Assert.assertTrue(eq.test("abc"));
+        Assert.assertFalse(eq.test("abd"));
+
+        // compared as unsigned utf-8 bytes like BE, not as utf-16 chars
+        OdpsPredicate gt = parseOne("s", "gt", "\uFF5E");
+        Assert.assertTrue(gt.test("\uD83D\uDE00"));
+        Assert.assertFalse(gt.test("z"));
+        Assert.assertTrue(parseOne("s", "lt", "ab").test("a"));
+    }
+
+    @Test
+    public void testNull() {
+        OdpsPredicate isNull = parseOne("s", "is_null");
+        Assert.assertTrue(isNull.test(null));
+        Assert.assertFalse(isNull.test("a"));
+
+        OdpsPredicate isNotNull = parseOne("i", "is_not_null");
+        Assert.assertTrue(isNotNull.test(1L));
+        Assert.assertFalse(isNotNull.test(null));
+    }
+
+    @Test
+    public void testUnsupported() {
+        // json is mapped to varchar by FE, the reader can not compare it
+        OdpsPredicate json = parseOne("j", "eq", "{}");
+        Assert.assertFalse(json.isSupported());
+        Assert.assertTrue(json.test("{\"a\":1}"));
+        Assert.assertTrue(json.test(null));
+
+        // column unknown to the reader
+        OdpsPredicate unknown = parseOne("x", "is_null");
+        Assert.assertFalse(unknown.isSupported());
+        Assert.assertTrue(unknown.test(1L));
+
+        // value that can not be parsed as the column type
+        OdpsPredicate badValue = parseOne("i", "eq", "abc");
+        Assert.assertFalse(badValue.isSupported());
+        Assert.assertTrue(badValue.test(1L));
+    }
+}